@@ -461,6 +461,7 @@ int __cdecl main(int argc, char** argv)
 	static struct wdi_options_install_cert oic = { 0 };
 	static BOOL driverInstalled = FALSE;
 	static opt_extract = 0, log_level = WDI_LOG_LEVEL_WARNING;
+	struct wdi_device_id id;
 	int c, r;
 	char *inf_name;
 	char *ext_dir;
@@ -580,6 +581,14 @@ int __cdecl main(int argc, char** argv)
 					&& (ldev->is_composite == dev->is_composite)) {
 					deviceConnected = TRUE;
 					if (ldev->driver == NULL || strcmp(ldev->driver, "WinUSB") != 0) {
+						// The driver is installed for the hardware ID, so it must be the one of this interface
+						if ((wdi_parse_device_id(ldev->hardware_id, &id) != WDI_SUCCESS)
+							|| (id.vid != dev->vid) || (id.pid != dev->pid)
+							|| (id.has_mi != dev->is_composite) || (id.mi != dev->mi)) {
+							oprintf("Unexpected hardware ID %s, skipping\n", ldev->hardware_id);
+							deviceConnected = FALSE;
+							continue;
+						}
 						needsInstalling = TRUE;
 						dev->hardware_id = ldev->hardware_id;
 						dev->device_id = ldev->device_id;
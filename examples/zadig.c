@@ -91,6 +91,9 @@ struct wdi_device_info *device, *list = NULL;
 int current_device_index = CB_ERR;
 char* current_device_hardware_id = NULL;
 char* editable_desc = NULL;
+// Buffers that replaced the descriptions of the device list, to edit them
+char** editable_descs = NULL;
+int nb_editable_descs = 0;
 int default_driver_type = WDI_WINUSB;
 int log_level = WDI_LOG_LEVEL_DEBUG;
 int nb_devices = -1;
@@ -266,27 +269,19 @@ void __cdecl notification_delay_thread(void* param)
 // Retrieve the driver type according to its service string
 int get_driver_type(struct wdi_device_info* dev)
 {
-	int i;
-	const char* libusb_name[] = { "WinUSB", "libusb0", "libusbK", "usbser" };
-	const char* system_name[] = { "usbccgp", "usbstor", "uaspstor", "vusbstor", "etronstor", "hidusb",
-		// NOTE: The list of hubs below should match the one from libwdi.c
-		"usbhub", "usbhub3", "nusb3hub", "usbhub", "usbhub3", "usb3hub", "nusb3hub", "rusb3hub",
-		"flxhcih", "tihub3", "etronhub3", "viahub3", "asmthub3", "iusb3hub", "vusb3hub", "amdhub30", "vhhub" };
-
 	if ((dev == NULL) || (dev->driver == NULL)) {
 		return DT_NONE;
 	}
-	for (i=0; i<ARRAYSIZE(libusb_name); i++) {
-		if (safe_strcmp(dev->driver, libusb_name[i]) == 0) {
-			return DT_LIBUSB;
-		}
-	}
-	for (i=0; i<ARRAYSIZE(system_name); i++) {
-		if (safe_stricmp(dev->driver, system_name[i]) == 0) {
-			return DT_SYSTEM;
-		}
+	switch (wdi_get_driver_class(dev->driver)) {
+	case WDI_DRIVER_CLASS_LIBWDI:
+		return DT_LIBUSB;
+	case WDI_DRIVER_CLASS_SYSTEM:
+	case WDI_DRIVER_CLASS_HUB:
+	case WDI_DRIVER_CLASS_COMPOSITE:
+		return DT_SYSTEM;
+	default:
+		return DT_UNKNOWN;
 	}
-	return DT_UNKNOWN;
 }
 
 /*
@@ -605,6 +600,51 @@ void toggle_advanced(void)
 	CheckMenuItem(hMenuOptions, IDM_ADVANCEDMODE, advanced_mode?MF_CHECKED:MF_UNCHECKED);
 }
 
+/*
+ * Replace the description of a device with a buffer of STR_BUFFER_SIZE bytes, that can be
+ * edited. The buffer is reused if the device is edited again, and freed by destroy_list(),
+ * as wdi_destroy_list() doesn't free the strings that we put in the list.
+ */
+char* get_editable_desc(struct wdi_device_info* dev)
+{
+	char **p, *desc;
+	int i;
+
+	for (i = 0; i < nb_editable_descs; i++) {
+		if (editable_descs[i] == dev->desc) {
+			return dev->desc;
+		}
+	}
+	p = (char**)realloc(editable_descs, (nb_editable_descs + 1) * sizeof(char*));
+	if (p == NULL) {
+		return NULL;
+	}
+	editable_descs = p;
+	desc = (char*)malloc(STR_BUFFER_SIZE);
+	if (desc == NULL) {
+		return NULL;
+	}
+	safe_strcpy(desc, STR_BUFFER_SIZE, (dev->desc != NULL) ? dev->desc : "(Unknown Device)");
+	editable_descs[nb_editable_descs++] = desc;
+	dev->desc = desc;
+	return desc;
+}
+
+void destroy_list(void)
+{
+	int i;
+
+	if (list != NULL) {
+		wdi_destroy_list(list);
+		list = NULL;
+	}
+	for (i = 0; i < nb_editable_descs; i++) {
+		free(editable_descs[i]);
+	}
+	safe_free(editable_descs);
+	nb_editable_descs = 0;
+}
+
 // Toggle edit description
 void toggle_edit(void)
 {
@@ -614,16 +654,13 @@ void toggle_edit(void)
 			dprintf("program assertion failed - editable_desc != NULL");
 			return;
 		}
-		editable_desc = (char*)malloc(STR_BUFFER_SIZE);
+		editable_desc = get_editable_desc(device);
 		if (editable_desc == NULL) {
 			dprintf("could not allocate buffer to edit description");
 			CheckDlgButton(hMainDialog, IDC_EDITNAME, BST_UNCHECKED);
 			combo_breaker(FALSE);
 			return;
 		}
-		safe_strcpy(editable_desc, STR_BUFFER_SIZE, device->desc);
-		free(device->desc);	// No longer needed
-		device->desc = editable_desc;
 		SetDlgItemTextU(hMainDialog, IDC_DEVICEEDIT, editable_desc);
 		SetFocus(GetDlgItem(hMainDialog, IDC_DEVICEEDIT));
 	} else {
@@ -1307,7 +1344,7 @@ INT_PTR CALLBACK main_callback(HWND hDlg, UINT message, WPARAM wParam, LPARAM lP
 			CheckDlgButton(hMainDialog, IDC_EDITNAME, BST_UNCHECKED);
 		}
 		id_options.install_filter_driver = FALSE;
-		if (list != NULL) wdi_destroy_list(list);
+		destroy_list();
 		if (!from_install) {
 			current_device_index = 0;
 		}
@@ -1478,13 +1515,9 @@ INT_PTR CALLBACK main_callback(HWND hDlg, UINT message, WPARAM wParam, LPARAM lP
 				if (device != NULL) {
 					// Change the description string if needed
 					if (device->desc == NULL) {
-						editable_desc = (char*)malloc(STR_BUFFER_SIZE);
+						editable_desc = get_editable_desc(device);
 						if (editable_desc == NULL) {
 							dprintf("could not use modified device description");
-							editable_desc = device->desc;
-						} else {
-							safe_sprintf(editable_desc, STR_BUFFER_SIZE, "(Unknown Device)");
-							device->desc = editable_desc;
 						}
 					}
 					// Display the current driver info
@@ -1618,7 +1651,7 @@ INT_PTR CALLBACK main_callback(HWND hDlg, UINT message, WPARAM wParam, LPARAM lP
 			break;
 		case IDOK:			// close application
 		case IDCANCEL:
-			wdi_destroy_list(list);
+			destroy_list();
 			EndDialog(hDlg, 0);
 			break;
 		// Main Menus
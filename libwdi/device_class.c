@@ -0,0 +1,258 @@
+/*
+ * Device quirks and driver classes
+ * This file is autogenerated from device_class.txt by device_class.sh
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "libwdi.h"
+#include "libwdi_i.h"
+
+#define NB_QUIRK_RANGES 70
+#define DRIVER_NAME_MAX_LENGTH 9
+#define DRIVER_HASH_MULTIPLIER 1229
+#define DRIVER_HASH_BITS 6
+
+// Bitmap of the VIDs that have quirks
+static const uint32_t quirk_vid[0x10000 / 32] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000100,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000,
+	0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000,
+};
+
+// Sorted PID ranges of the devices that have quirks, keyed as (vid << 16) | pid
+static const struct {
+	uint32_t first;
+	uint32_t last;
+	uint32_t quirks;
+} quirk_range[70] = {
+	{ 0x0451d022, 0x0451d022, DEVICE_QUIRK_ANDROID },
+	{ 0x0451d101, 0x0451d101, DEVICE_QUIRK_ANDROID },
+	{ 0x0489c001, 0x0489c001, DEVICE_QUIRK_ANDROID },
+	{ 0x04e8685b, 0x04e8685e, DEVICE_QUIRK_ANDROID },
+	{ 0x04e86860, 0x04e86860, DEVICE_QUIRK_ANDROID },
+	{ 0x04e86863, 0x04e86866, DEVICE_QUIRK_ANDROID },
+	{ 0x04e86868, 0x04e86868, DEVICE_QUIRK_ANDROID },
+	{ 0x04e86877, 0x04e86877, DEVICE_QUIRK_ANDROID },
+	{ 0x04e8689e, 0x04e8689e, DEVICE_QUIRK_ANDROID },
+	{ 0x05c69018, 0x05c69018, DEVICE_QUIRK_ANDROID },
+	{ 0x05c69025, 0x05c69025, DEVICE_QUIRK_ANDROID },
+	{ 0x09557030, 0x09557030, DEVICE_QUIRK_ANDROID },
+	{ 0x09557100, 0x09557100, DEVICE_QUIRK_ANDROID },
+	{ 0x0955b400, 0x0955b401, DEVICE_QUIRK_ANDROID },
+	{ 0x0955cf05, 0x0955cf09, DEVICE_QUIRK_ANDROID },
+	{ 0x0b054d00, 0x0b054d03, DEVICE_QUIRK_ANDROID },
+	{ 0x0b054e01, 0x0b054e01, DEVICE_QUIRK_ANDROID },
+	{ 0x0b054e03, 0x0b054e03, DEVICE_QUIRK_ANDROID },
+	{ 0x0b054e1f, 0x0b054e1f, DEVICE_QUIRK_ANDROID },
+	{ 0x0b054e3f, 0x0b054e3f, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40c01, 0x0bb40c03, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40c13, 0x0bb40c13, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40c1f, 0x0bb40c1f, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40c5f, 0x0bb40c5f, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40c86, 0x0bb40c87, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40c8b, 0x0bb40c8b, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40c8d, 0x0bb40c8d, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40c91, 0x0bb40c99, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40c9e, 0x0bb40c9e, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40ca2, 0x0bb40ca5, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40cac, 0x0bb40cae, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40cba, 0x0bb40cba, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40ced, 0x0bb40ced, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40e03, 0x0bb40e03, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40f64, 0x0bb40f64, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40ff8, 0x0bb40ff9, DEVICE_QUIRK_ANDROID },
+	{ 0x0bb40ffe, 0x0bb40fff, DEVICE_QUIRK_ANDROID },
+	{ 0x0fce0dde, 0x0fce0dde, DEVICE_QUIRK_ANDROID },
+	{ 0x0fce4e30, 0x0fce4e30, DEVICE_QUIRK_ANDROID },
+	{ 0x0fce6860, 0x0fce6860, DEVICE_QUIRK_ANDROID },
+	{ 0x0fced001, 0x0fced001, DEVICE_QUIRK_ANDROID },
+	{ 0x1004618e, 0x1004618e, DEVICE_QUIRK_ANDROID },
+	{ 0x12d11501, 0x12d11501, DEVICE_QUIRK_ANDROID },
+	{ 0x18d10d02, 0x18d10d02, DEVICE_QUIRK_ANDROID },
+	{ 0x18d12c10, 0x18d12c11, DEVICE_QUIRK_ANDROID },
+	{ 0x18d14d00, 0x18d14d00, DEVICE_QUIRK_ANDROID },
+	{ 0x18d14d02, 0x18d14d02, DEVICE_QUIRK_ANDROID },
+	{ 0x18d14d04, 0x18d14d04, DEVICE_QUIRK_ANDROID },
+	{ 0x18d14d06, 0x18d14d07, DEVICE_QUIRK_ANDROID },
+	{ 0x18d14e10, 0x18d14e13, DEVICE_QUIRK_ANDROID },
+	{ 0x18d14e20, 0x18d14e24, DEVICE_QUIRK_ANDROID },
+	{ 0x18d14e30, 0x18d14e30, DEVICE_QUIRK_ANDROID },
+	{ 0x18d14e40, 0x18d14e44, DEVICE_QUIRK_ANDROID },
+	{ 0x18d14ee0, 0x18d14ee7, DEVICE_QUIRK_ANDROID },
+	{ 0x18d1708c, 0x18d1708c, DEVICE_QUIRK_ANDROID },
+	{ 0x18d17102, 0x18d17102, DEVICE_QUIRK_ANDROID },
+	{ 0x18d19001, 0x18d19001, DEVICE_QUIRK_ANDROID },
+	{ 0x18d1b004, 0x18d1b004, DEVICE_QUIRK_ANDROID },
+	{ 0x18d1d001, 0x18d1d002, DEVICE_QUIRK_ANDROID },
+	{ 0x18d1d109, 0x18d1d10a, DEVICE_QUIRK_ANDROID },
+	{ 0x19d21351, 0x19d21351, DEVICE_QUIRK_ANDROID },
+	{ 0x19d21354, 0x19d21354, DEVICE_QUIRK_ANDROID },
+	{ 0x20800001, 0x20800004, DEVICE_QUIRK_ANDROID },
+	{ 0x22b82d66, 0x22b82d66, DEVICE_QUIRK_ANDROID },
+	{ 0x22b841db, 0x22b841db, DEVICE_QUIRK_ANDROID },
+	{ 0x22b84286, 0x22b84286, DEVICE_QUIRK_ANDROID },
+	{ 0x22b842a4, 0x22b842a4, DEVICE_QUIRK_ANDROID },
+	{ 0x22b842da, 0x22b842da, DEVICE_QUIRK_ANDROID },
+	{ 0x22b84331, 0x22b84331, DEVICE_QUIRK_ANDROID },
+	{ 0x22b870a9, 0x22b870a9, DEVICE_QUIRK_ANDROID },
+};
+
+// Perfect hash table of the lowercase driver names
+static const struct {
+	const char* name;
+	int driver_class;
+} driver_class[1 << DRIVER_HASH_BITS] = {
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "usb3hub", WDI_DRIVER_CLASS_HUB },
+	{ "usbser", WDI_DRIVER_CLASS_LIBWDI },
+	{ "hidusb", WDI_DRIVER_CLASS_SYSTEM },
+	{ "vhhub", WDI_DRIVER_CLASS_HUB },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "tihub3", WDI_DRIVER_CLASS_HUB },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "asmthub3", WDI_DRIVER_CLASS_HUB },
+	{ "uaspstor", WDI_DRIVER_CLASS_SYSTEM },
+	{ "winusb", WDI_DRIVER_CLASS_LIBWDI },
+	{ "libusb0", WDI_DRIVER_CLASS_LIBWDI },
+	{ "libusbk", WDI_DRIVER_CLASS_LIBWDI },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "nusb3hub", WDI_DRIVER_CLASS_HUB },
+	{ "usbhub3", WDI_DRIVER_CLASS_HUB },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "etronhub3", WDI_DRIVER_CLASS_HUB },
+	{ "vusbstor", WDI_DRIVER_CLASS_SYSTEM },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "iusb3hub", WDI_DRIVER_CLASS_HUB },
+	{ "rusb3hub", WDI_DRIVER_CLASS_HUB },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "flxhcih", WDI_DRIVER_CLASS_HUB },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "usbccgp", WDI_DRIVER_CLASS_COMPOSITE },
+	{ "usbstor", WDI_DRIVER_CLASS_SYSTEM },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "vusb3hub", WDI_DRIVER_CLASS_HUB },
+	{ "etronstor", WDI_DRIVER_CLASS_SYSTEM },
+	{ "amdhub30", WDI_DRIVER_CLASS_HUB },
+	{ "usbhub", WDI_DRIVER_CLASS_HUB },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+	{ "viahub3", WDI_DRIVER_CLASS_HUB },
+	{ NULL, WDI_DRIVER_CLASS_UNKNOWN },
+};
+
+uint32_t get_device_quirks(uint16_t vid, uint16_t pid)
+{
+	uint32_t key = ((uint32_t)vid << 16) | pid;
+	size_t base = 0, half, n = NB_QUIRK_RANGES;
+
+	if ((quirk_vid[vid >> 5] & (1UL << (vid & 31))) == 0) {
+		return 0;
+	}
+	// Find the last range that starts at or before the key
+	while (n > 1) {
+		half = n / 2;
+		base = (quirk_range[base + half].first <= key) ? base + half : base;
+		n -= half;
+	}
+	return ((quirk_range[base].first <= key) && (key <= quirk_range[base].last)) ? quirk_range[base].quirks : 0;
+}
+
+int LIBWDI_API wdi_get_driver_class(const char* driver)
+{
+	char name[DRIVER_NAME_MAX_LENGTH + 1];
+	uint32_t hash = 0;
+	size_t i;
+
+	if (driver == NULL) {
+		return WDI_DRIVER_CLASS_UNKNOWN;
+	}
+	for (i = 0; driver[i] != 0; i++) {
+		if (i >= DRIVER_NAME_MAX_LENGTH) {
+			return WDI_DRIVER_CLASS_UNKNOWN;
+		}
+		name[i] = ((driver[i] >= 'A') && (driver[i] <= 'Z')) ? driver[i] - 'A' + 'a' : driver[i];
+		hash = (hash * DRIVER_HASH_MULTIPLIER + (unsigned char)name[i]) & 0xffff;
+	}
+	name[i] = 0;
+	i = hash >> (16 - DRIVER_HASH_BITS);
+	if ((driver_class[i].name == NULL) || (strcmp(name, driver_class[i].name) != 0)) {
+		return WDI_DRIVER_CLASS_UNKNOWN;
+	}
+	return driver_class[i].driver_class;
+}
@@ -0,0 +1,289 @@
+#!/bin/sh
+
+echo This file recreates device_class.c according to device_class.txt
+echo
+
+# check that awk is available
+type -P awk &>/dev/null || { echo "awk command not found. Aborting." >&2; exit 1; }
+
+# Create the awk command file
+# The quirks are looked up in a VID bitmap, so that most devices are rejected with
+# a single test, and then in the sorted PID ranges of the VID. The driver classes
+# are looked up in a perfect hash table of the lowercase service names, for which
+# we look for a multiplier that doesn't produce any collision.
+cat > cmd.awk <<\_EOF
+BEGIN {
+	nb_ranges = 0
+	nb_drivers = 0
+	max_length = 0
+	hash_bits = 6
+	hash_size = 2 ^ hash_bits
+	for (i = 32; i < 127; i++) {
+		ord[sprintf("%c", i)] = i
+	}
+	for (i = 0; i < 16; i++) {
+		hex[substr("0123456789abcdef", i + 1, 1)] = i
+	}
+}
+
+function fail(msg) {
+	print "device_class.txt line " NR ": " msg > "/dev/stderr"
+	error = 1
+	exit 1
+}
+
+function parse_hex(s,    i, v) {
+	v = 0
+	for (i = 1; i <= length(s); i++) {
+		v = v * 16 + hex[substr(s, i, 1)]
+	}
+	return v
+}
+
+function hash(name, multiplier,    i, h) {
+	h = 0
+	for (i = 1; i <= length(name); i++) {
+		h = (h * multiplier + ord[substr(name, i, 1)]) % 65536
+	}
+	return h
+}
+
+{
+	sub(/#.*/, "")
+}
+
+NF == 0 {
+	next
+}
+
+# Quirks: "<quirk> <vid> <pid>" or "<quirk> <vid> <first pid>-<last pid>"
+NF == 3 {
+	vid = tolower($2)
+	pid = tolower($3)
+	if (vid !~ /^[0-9a-f][0-9a-f][0-9a-f][0-9a-f]$/)
+		fail("invalid VID")
+	if (pid ~ /^[0-9a-f][0-9a-f][0-9a-f][0-9a-f]$/) {
+		first = parse_hex(pid)
+		last = first
+	} else if (pid ~ /^[0-9a-f][0-9a-f][0-9a-f][0-9a-f]-[0-9a-f][0-9a-f][0-9a-f][0-9a-f]$/) {
+		first = parse_hex(substr(pid, 1, 4))
+		last = parse_hex(substr(pid, 6, 4))
+		if (last < first)
+			fail("invalid PID range")
+	} else {
+		fail("invalid PID")
+	}
+	# Keep the ranges sorted by start, as there are only a few hundred of them
+	v = parse_hex(vid) * 65536
+	for (i = nb_ranges; (i > 0) && (range_first[i - 1] > v + first); i--) {
+		range_first[i] = range_first[i - 1]
+		range_last[i] = range_last[i - 1]
+		range_quirk[i] = range_quirk[i - 1]
+	}
+	range_first[i] = v + first
+	range_last[i] = v + last
+	range_quirk[i] = "DEVICE_QUIRK_" toupper($1)
+	nb_ranges++
+	next
+}
+
+# Driver classes: "<class> <service name>"
+NF == 2 {
+	name = tolower($2)
+	if (name in driver_class)
+		fail("duplicate driver")
+	for (i = 1; i <= length(name); i++) {
+		if (!(substr(name, i, 1) in ord))
+			fail("driver names must be ASCII")
+	}
+	driver_class[name] = "WDI_DRIVER_CLASS_" toupper($1)
+	driver[nb_drivers++] = name
+	if (length(name) > max_length)
+		max_length = length(name)
+	next
+}
+
+{
+	fail("invalid line")
+}
+
+# Print a key as (vid << 16) | pid
+function print_key(key) {
+	return sprintf("0x%04x%04x", int(key / 65536), key % 65536)
+}
+
+END {
+	if (error)
+		exit 1
+
+	# Merge the adjacent and overlapping ranges that have the same quirk
+	n = 0
+	for (i = 0; i < nb_ranges; i++) {
+		if ((n > 0) && (range_first[i] <= range_last[n - 1] + 1)) {
+			if (range_quirk[i] != range_quirk[n - 1]) {
+				print "device_class.txt: overlapping ranges must have the same quirk" > "/dev/stderr"
+				exit 1
+			}
+			if (range_last[i] > range_last[n - 1])
+				range_last[n - 1] = range_last[i]
+			continue
+		}
+		range_first[n] = range_first[i]
+		range_last[n] = range_last[i]
+		range_quirk[n] = range_quirk[i]
+		n++
+	}
+	nb_ranges = n
+
+	# Bitmap of the VIDs, as 32 bit words
+	nb_words = 0
+	for (i = 0; i < nb_ranges; i++) {
+		for (v = int(range_first[i] / 65536); v <= int(range_last[i] / 65536); v++) {
+			if (v in has_vid)
+				continue
+			has_vid[v] = 1
+			w = int(v / 32)
+			word[w] += 2 ^ (v % 32)
+			if (w + 1 > nb_words)
+				nb_words = w + 1
+		}
+	}
+
+	# Look for a multiplier that gives a perfect hash of the driver names
+	for (multiplier = 1; multiplier < 65536; multiplier += 2) {
+		split("", slot)
+		for (i = 0; i < nb_drivers; i++) {
+			# The top bits depend on all the characters
+			s = int(hash(driver[i], multiplier) / 2 ^ (16 - hash_bits))
+			if (s in slot)
+				break
+			slot[s] = driver[i]
+		}
+		if (i == nb_drivers)
+			break
+	}
+	if (multiplier >= 65536) {
+		print "device_class.txt: could not find a perfect hash for the driver names" > "/dev/stderr"
+		exit 1
+	}
+
+	print "/*"
+	print " * Device quirks and driver classes"
+	print " * This file is autogenerated from device_class.txt by device_class.sh"
+	print " *"
+	print " * This library is free software; you can redistribute it and/or"
+	print " * modify it under the terms of the GNU Lesser General Public"
+	print " * License as published by the Free Software Foundation; either"
+	print " * version 3 of the License, or (at your option) any later version."
+	print " *"
+	print " * This library is distributed in the hope that it will be useful,"
+	print " * but WITHOUT ANY WARRANTY; without even the implied warranty of"
+	print " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU"
+	print " * Lesser General Public License for more details."
+	print " *"
+	print " * You should have received a copy of the GNU Lesser General Public"
+	print " * License along with this library; if not, write to the Free Software"
+	print " * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA"
+	print " */"
+	print ""
+	print "#include <stdlib.h>"
+	print "#include <stdint.h>"
+	print "#include <string.h>"
+	print "#include \"libwdi.h\""
+	print "#include \"libwdi_i.h\""
+	print ""
+	printf("#define NB_QUIRK_RANGES %d\n", nb_ranges)
+	printf("#define DRIVER_NAME_MAX_LENGTH %d\n", max_length)
+	printf("#define DRIVER_HASH_MULTIPLIER %d\n", multiplier)
+	printf("#define DRIVER_HASH_BITS %d\n", hash_bits)
+	print ""
+	print "// Bitmap of the VIDs that have quirks"
+	print "static const uint32_t quirk_vid[0x10000 / 32] = {"
+	# Empty initializers are not valid C
+	if (nb_words == 0)
+		print "\t0,"
+	line = ""
+	for (w = 0; w < nb_words; w++) {
+		line = line sprintf("0x%04x%04x,", int(word[w] / 65536), word[w] % 65536)
+		if ((w % 8 == 7) || (w == nb_words - 1)) {
+			print "\t" line
+			line = ""
+		} else {
+			line = line " "
+		}
+	}
+	print "};"
+	print ""
+	print "// Sorted PID ranges of the devices that have quirks, keyed as (vid << 16) | pid"
+	print "static const struct {"
+	print "\tuint32_t first;"
+	print "\tuint32_t last;"
+	print "\tuint32_t quirks;"
+	printf("} quirk_range[%d] = {\n", (nb_ranges > 0) ? nb_ranges : 1)
+	if (nb_ranges == 0)
+		print "\t{ 0xffffffff, 0, 0 },"
+	for (i = 0; i < nb_ranges; i++) {
+		printf("\t{ %s, %s, %s },\n", print_key(range_first[i]), print_key(range_last[i]), range_quirk[i])
+	}
+	print "};"
+	print ""
+	print "// Perfect hash table of the lowercase driver names"
+	print "static const struct {"
+	print "\tconst char* name;"
+	print "\tint driver_class;"
+	print "} driver_class[1 << DRIVER_HASH_BITS] = {"
+	for (i = 0; i < hash_size; i++) {
+		if (i in slot)
+			printf("\t{ \"%s\", %s },\n", slot[i], driver_class[slot[i]])
+		else
+			print "\t{ NULL, WDI_DRIVER_CLASS_UNKNOWN },"
+	}
+	print "};"
+	print ""
+	print "uint32_t get_device_quirks(uint16_t vid, uint16_t pid)"
+	print "{"
+	print "\tuint32_t key = ((uint32_t)vid << 16) | pid;"
+	print "\tsize_t base = 0, half, n = NB_QUIRK_RANGES;"
+	print ""
+	print "\tif ((quirk_vid[vid >> 5] & (1UL << (vid & 31))) == 0) {"
+	print "\t\treturn 0;"
+	print "\t}"
+	print "\t// Find the last range that starts at or before the key"
+	print "\twhile (n > 1) {"
+	print "\t\thalf = n / 2;"
+	print "\t\tbase = (quirk_range[base + half].first <= key) ? base + half : base;"
+	print "\t\tn -= half;"
+	print "\t}"
+	print "\treturn ((quirk_range[base].first <= key) && (key <= quirk_range[base].last)) ? quirk_range[base].quirks : 0;"
+	print "}"
+	print ""
+	print "int LIBWDI_API wdi_get_driver_class(const char* driver)"
+	print "{"
+	print "\tchar name[DRIVER_NAME_MAX_LENGTH + 1];"
+	print "\tuint32_t hash = 0;"
+	print "\tsize_t i;"
+	print ""
+	print "\tif (driver == NULL) {"
+	print "\t\treturn WDI_DRIVER_CLASS_UNKNOWN;"
+	print "\t}"
+	print "\tfor (i = 0; driver[i] != 0; i++) {"
+	print "\t\tif (i >= DRIVER_NAME_MAX_LENGTH) {"
+	print "\t\t\treturn WDI_DRIVER_CLASS_UNKNOWN;"
+	print "\t\t}"
+	print "\t\tname[i] = ((driver[i] >= 'A') && (driver[i] <= 'Z')) ? driver[i] - 'A' + 'a' : driver[i];"
+	print "\t\thash = (hash * DRIVER_HASH_MULTIPLIER + (unsigned char)name[i]) & 0xffff;"
+	print "\t}"
+	print "\tname[i] = 0;"
+	print "\ti = hash >> (16 - DRIVER_HASH_BITS);"
+	print "\tif ((driver_class[i].name == NULL) || (strcmp(name, driver_class[i].name) != 0)) {"
+	print "\t\treturn WDI_DRIVER_CLASS_UNKNOWN;"
+	print "\t}"
+	print "\treturn driver_class[i].driver_class;"
+	print "}"
+}
+_EOF
+
+# Run awk to generate the source.
+LC_ALL=C awk -f cmd.awk device_class.txt > device_class.c || { rm cmd.awk device_class.c; exit 1; }
+rm cmd.awk
+echo Done.
@@ -0,0 +1,184 @@
+/*
+ * device_id.h: USB device and hardware IDs parser
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * A device ID is "<enumerator>\<fields>\<instance ID>", and a hardware ID is
+ * "<enumerator>\<fields>", where the fields are separated by '&', e.g.
+ *   USB\VID_1234&PID_5678&MI_01\6&12345678&0&0001
+ *   USB\VID_1234&PID_5678&REV_0100&MI_01
+ * Device interface paths, such as \\?\USB#VID_1234&PID_5678#0001#{GUID},
+ * are also accepted.
+ *
+ * The ID is parsed in a single pass, without allocating or modifying anything,
+ * so that it can be parsed from any thread, unlike with strtok().
+ */
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+#include "libwdi.h"
+
+#define DEVICE_ID_IS_SEPARATOR(c) (((c) == '\\') || ((c) == '#'))
+#define DEVICE_ID_TOUPPER(c) ((((c) >= 'a') && ((c) <= 'z')) ? ((c) - 'a' + 'A') : (c))
+
+/*
+ * Parse a field that must be made of exactly nb_digits hex digits.
+ * Returns the value, or -1 if the field is invalid.
+ */
+static __inline int device_id_parse_hex(const char* s, size_t len, size_t nb_digits)
+{
+	size_t i;
+	int value = 0;
+
+	if (len != nb_digits) {
+		return -1;
+	}
+	for (i = 0; i < nb_digits; i++) {
+		value <<= 4;
+		if ((s[i] >= '0') && (s[i] <= '9')) {
+			value |= s[i] - '0';
+		} else if ((s[i] >= 'a') && (s[i] <= 'f')) {
+			value |= s[i] - 'a' + 10;
+		} else if ((s[i] >= 'A') && (s[i] <= 'F')) {
+			value |= s[i] - 'A' + 10;
+		} else {
+			return -1;
+		}
+	}
+	return value;
+}
+
+// Whether a field starts with prefix, which must be uppercase, without regard to case
+static __inline int device_id_has_prefix(const char* s, size_t len, const char* prefix)
+{
+	size_t i;
+
+	for (i = 0; prefix[i] != 0; i++) {
+		if ((i >= len) || (DEVICE_ID_TOUPPER(s[i]) != prefix[i])) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Parse a device or hardware ID. Fields other than VID, PID, REV and MI are ignored.
+ * Returns WDI_SUCCESS, or WDI_ERROR_INVALID_PARAM if id is NULL or if one of the
+ * fields we look for is invalid, in which case the other fields are still parsed.
+ */
+static __inline int parse_device_id(const char* id, struct wdi_device_id* device_id)
+{
+	const char *p, *field;
+	size_t len;
+	int value, r = WDI_SUCCESS;
+
+	memset(device_id, 0, sizeof(*device_id));
+	if (id == NULL) {
+		return WDI_ERROR_INVALID_PARAM;
+	}
+
+	// Skip the prefix of a device interface path, then the enumerator, if any
+	p = id;
+	if ((p[0] == '\\') && (p[1] == '\\') && (p[2] == '?') && (p[3] == '\\')) {
+		p += 4;
+	}
+	for (field = p; (*p != 0) && (!DEVICE_ID_IS_SEPARATOR(*p)); p++);
+	if (*p == 0) {
+		p = field;
+	} else {
+		if (p > field) {
+			device_id->enumerator = field;
+			device_id->enumerator_length = p - field;
+		}
+		p++;
+	}
+
+	for (;;) {
+		for (field = p; (*p != 0) && (*p != '&') && (!DEVICE_ID_IS_SEPARATOR(*p)); p++);
+		len = p - field;
+		if (device_id_has_prefix(field, len, "VID_")) {
+			value = device_id_parse_hex(field + 4, len - 4, 4);
+			device_id->has_vid = (value >= 0);
+			device_id->vid = (unsigned short)((value >= 0) ? value : 0);
+		} else if (device_id_has_prefix(field, len, "PID_")) {
+			value = device_id_parse_hex(field + 4, len - 4, 4);
+			device_id->has_pid = (value >= 0);
+			device_id->pid = (unsigned short)((value >= 0) ? value : 0);
+		} else if (device_id_has_prefix(field, len, "REV_")) {
+			value = device_id_parse_hex(field + 4, len - 4, 4);
+			device_id->has_rev = (value >= 0);
+			device_id->rev = (unsigned short)((value >= 0) ? value : 0);
+		} else if (device_id_has_prefix(field, len, "MI_")) {
+			value = device_id_parse_hex(field + 3, len - 3, 2);
+			device_id->has_mi = (value >= 0);
+			device_id->mi = (unsigned char)((value >= 0) ? value : 0);
+		} else {
+			value = 0;
+		}
+		if (value < 0) {
+			r = WDI_ERROR_INVALID_PARAM;
+		}
+		if (*p != '&') {
+			break;
+		}
+		p++;
+	}
+
+	// The instance ID, which ends with the string, or with the GUID of an interface path
+	if (DEVICE_ID_IS_SEPARATOR(*p)) {
+		field = ++p;
+		for (; (*p != 0) && (!DEVICE_ID_IS_SEPARATOR(*p)); p++);
+		if (p > field) {
+			device_id->instance = field;
+			device_id->instance_length = p - field;
+			// Instance IDs that Windows generates have '&' separated parts
+			device_id->is_serial = (memchr(field, '&', p - field) == NULL);
+		}
+	}
+	return r;
+}
+
+// Whether two parts of IDs are the same, without regard to case
+static __inline int device_id_same_part(const char* a, size_t a_len, const char* b, size_t b_len)
+{
+	size_t i;
+
+	if (a_len != b_len) {
+		return 0;
+	}
+	for (i = 0; i < a_len; i++) {
+		if (DEVICE_ID_TOUPPER(a[i]) != DEVICE_ID_TOUPPER(b[i])) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Whether two parsed IDs designate the same device: same enumerator, VID, PID, revision,
+ * interface and instance ID. Fields other than these are not compared.
+ */
+static __inline int is_same_device_id(const struct wdi_device_id* a, const struct wdi_device_id* b)
+{
+	return (a->has_vid == b->has_vid) && (a->vid == b->vid) && (a->has_pid == b->has_pid)
+		&& (a->pid == b->pid) && (a->has_rev == b->has_rev) && (a->rev == b->rev)
+		&& (a->has_mi == b->has_mi) && (a->mi == b->mi)
+		&& device_id_same_part(a->enumerator, a->enumerator_length, b->enumerator, b->enumerator_length)
+		&& device_id_same_part(a->instance, a->instance_length, b->instance, b->instance_length);
+}
@@ -0,0 +1,155 @@
+/*
+ * device_list.h: allocation of the device lists of wdi_create_list()
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * The devices of a list, and their strings, are allocated from a chain of blocks, which
+ * are released together. The first device of a list is the first allocation of the first
+ * block. The lists that are live are chained from their first block, so that a list can
+ * be recognized by its address alone.
+ */
+#pragma once
+
+#include <stdlib.h>
+#include <string.h>
+#include <windows.h>
+#include "libwdi.h"
+
+#define DEVICE_LIST_BLOCK_SIZE (16*1024)
+struct device_list_block {
+	size_t size;
+	size_t used;
+	struct device_list_block* next;
+	// Only set in the first block
+	struct device_list_block* last;
+	struct device_list_block* next_list;
+};
+#define DEVICE_LIST_HEADER_SIZE ((sizeof(struct device_list_block) + 15) & ~(size_t)15)
+#define DEVICE_LIST_DATA(block) ((char*)(block) + DEVICE_LIST_HEADER_SIZE)
+
+struct device_lists {
+	struct device_list_block* first;
+	volatile LONG lock;
+};
+
+// Allocate size bytes from the blocks of a list, aligned for a struct if needed
+static __inline void* device_list_alloc(struct device_list_block** blocks, size_t size, BOOL align)
+{
+	struct device_list_block *block = NULL, *new_block;
+	size_t offset, block_size = DEVICE_LIST_BLOCK_SIZE;
+
+	if (*blocks != NULL) {
+		block = (*blocks)->last;
+		offset = align ? ((block->used + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1)) : block->used;
+		if (offset + size <= block->size) {
+			block->used = offset + size;
+			return DEVICE_LIST_DATA(block) + offset;
+		}
+		// Each block is twice as large as the previous one
+		block_size = 2 * block->size;
+	}
+	while (block_size < size) {
+		block_size *= 2;
+	}
+	new_block = (struct device_list_block*)malloc(DEVICE_LIST_HEADER_SIZE + block_size);
+	if (new_block == NULL) {
+		return NULL;
+	}
+	new_block->size = block_size;
+	new_block->used = size;
+	new_block->next = NULL;
+	new_block->last = NULL;
+	new_block->next_list = NULL;
+	if (block == NULL) {
+		*blocks = new_block;
+	} else {
+		block->next = new_block;
+	}
+	(*blocks)->last = new_block;
+	return DEVICE_LIST_DATA(new_block);
+}
+
+static __inline char* device_list_strdup(struct device_list_block** blocks, const char* str, BOOL* error)
+{
+	size_t size;
+	char* p;
+
+	if (str == NULL) {
+		return NULL;
+	}
+	size = strlen(str) + 1;
+	p = (char*)device_list_alloc(blocks, size, FALSE);
+	if (p == NULL) {
+		*error = TRUE;
+		return NULL;
+	}
+	memcpy(p, str, size);
+	return p;
+}
+
+static __inline void free_device_list(struct device_list_block* blocks)
+{
+	struct device_list_block* next;
+
+	for (; blocks != NULL; blocks = next) {
+		next = blocks->next;
+		free(blocks);
+	}
+}
+
+static __inline void lock_device_lists(struct device_lists* lists)
+{
+	while (InterlockedCompareExchange(&lists->lock, 1, 0) != 0) {
+		SwitchToThread();
+	}
+}
+
+static __inline void unlock_device_lists(struct device_lists* lists)
+{
+	InterlockedExchange(&lists->lock, 0);
+}
+
+static __inline void add_device_list(struct device_lists* lists, struct device_list_block* blocks)
+{
+	lock_device_lists(lists);
+	blocks->next_list = lists->first;
+	lists->first = blocks;
+	unlock_device_lists(lists);
+}
+
+// Unchain the blocks of a live list, from the address of its first device, which is only
+// compared, as it may be anything that the application passed. Returns NULL if no live
+// list starts there.
+static __inline struct device_list_block* remove_device_list(struct device_lists* lists,
+	struct wdi_device_info* list)
+{
+	struct device_list_block *blocks, **link;
+
+	lock_device_lists(lists);
+	for (link = &lists->first; *link != NULL; link = &(*link)->next_list) {
+		if ((struct wdi_device_info*)DEVICE_LIST_DATA(*link) == list) {
+			break;
+		}
+	}
+	blocks = *link;
+	if (blocks != NULL) {
+		*link = blocks->next_list;
+	}
+	unlock_device_lists(lists);
+	return blocks;
+}
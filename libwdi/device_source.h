@@ -0,0 +1,301 @@
+/*
+ * device_source.h: sources of devices for the device list
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * wdi_create_list() reads the devnodes through a device source, which is either
+ * the system (SetupAPI and Cfgmgr32, see libwdi.c), or the replay of a snapshot
+ * that was recorded with device_snapshot_write(), so that the list can be built,
+ * and profiled, without the devices or the system calls.
+ *
+ * A snapshot is a text file, with a section per devnode, named after its ID, and
+ * one line per property that is set:
+ *   [USB\VID_1234&PID_5678\0001]
+ *   Service=WinUSB
+ *   HardwareID=USB\VID_1234&PID_5678&REV_0100
+ * Lines that start with ';' or '#' are comments, and unknown properties are ignored.
+ * For the REG_MULTI_SZ properties, only the first string is recorded, as this is
+ * the only one we use.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+enum device_property {
+	DEVICE_PROPERTY_DRIVER,		// Driver key, only set for devices that have a driver
+	DEVICE_PROPERTY_DRIVER_VERSION,
+	DEVICE_PROPERTY_SERVICE,
+	DEVICE_PROPERTY_HARDWARE_ID,
+	DEVICE_PROPERTY_COMPATIBLE_ID,
+	DEVICE_PROPERTY_UPPER_FILTER,
+	DEVICE_PROPERTY_BUS_DESC,	// Bus reported device description
+	DEVICE_PROPERTY_DESC,
+	DEVICE_NB_PROPERTIES
+};
+
+static const char* const device_property_name[DEVICE_NB_PROPERTIES] = {
+	"Driver", "DriverVersion", "Service", "HardwareID", "CompatibleID",
+	"UpperFilter", "BusReportedDeviceDesc", "DeviceDesc"
+};
+
+/*
+ * The functions of a device source. Strings are UTF-8, and are copied to buf,
+ * which holds size bytes, with their NUL terminator. They return nonzero on
+ * success, and 0 if the devnode does not exist, or if the property is not set
+ * or doesn't fit in buf.
+ */
+struct device_source {
+	// Returns the context of the other calls, or NULL on error
+	void* (*open)(void* param);
+	void (*close)(void* context);
+	// Select the devnode that the next calls apply to
+	int (*get_devnode)(void* context, unsigned int index);
+	int (*get_property)(void* context, enum device_property property, char* buf, size_t size);
+	int (*get_device_id)(void* context, char* buf, size_t size);
+};
+
+struct device_snapshot_entry {
+	const char* device_id;
+	const char* property[DEVICE_NB_PROPERTIES];
+};
+
+struct device_snapshot {
+	size_t nb_devices;
+	struct device_snapshot_entry* device;
+	// Time, in microseconds, that each call of the replay takes
+	unsigned int latency;
+	size_t current;
+};
+
+static __inline void device_snapshot_free(struct device_snapshot* snapshot)
+{
+	free(snapshot->device);
+	memset(snapshot, 0, sizeof(*snapshot));
+}
+
+/*
+ * Index size bytes of snapshot data in a single pass. As with usb_ids_parse(),
+ * the lines are NUL terminated in place, so the data must be writable up to
+ * data[size] included, and it must outlive the snapshot.
+ * Returns 0 on success, in which case the snapshot must be freed with
+ * device_snapshot_free(), -1 if memory could not be allocated, or the number of
+ * the first line that is invalid.
+ */
+static __inline int device_snapshot_parse(char* data, size_t size, struct device_snapshot* snapshot)
+{
+	char *line, *eol, *value, *end = data + size;
+	struct device_snapshot_entry* device = NULL, *p;
+	size_t nb_devices = 0, capacity = 256;
+	int i, line_nr = 0;
+
+	memset(snapshot, 0, sizeof(*snapshot));
+	device = (struct device_snapshot_entry*)malloc(capacity * sizeof(struct device_snapshot_entry));
+	if (device == NULL) {
+		return -1;
+	}
+
+	data[size] = 0;
+	for (line = data; line < end; line = eol + 1) {
+		line_nr++;
+		eol = (char*)memchr(line, '\n', end - line);
+		if (eol == NULL) {
+			eol = end;
+		}
+		*eol = 0;
+		if ((eol > line) && (eol[-1] == '\r')) {
+			eol[-1] = 0;
+		}
+		if ((line[0] == 0) || (line[0] == ';') || (line[0] == '#')) {
+			continue;
+		}
+
+		// Devnode: "[device ID]"
+		if (line[0] == '[') {
+			value = strrchr(line, ']');
+			if ((value == NULL) || (value[1] != 0) || (value == &line[1])) {
+				free(device);
+				return line_nr;
+			}
+			*value = 0;
+			if (nb_devices == capacity) {
+				capacity *= 2;
+				p = (struct device_snapshot_entry*)realloc(device, capacity * sizeof(struct device_snapshot_entry));
+				if (p == NULL) {
+					free(device);
+					return -1;
+				}
+				device = p;
+			}
+			memset(&device[nb_devices], 0, sizeof(struct device_snapshot_entry));
+			device[nb_devices++].device_id = &line[1];
+			continue;
+		}
+
+		// Property: "name=value"
+		value = strchr(line, '=');
+		if ((value == NULL) || (nb_devices == 0)) {
+			free(device);
+			return line_nr;
+		}
+		*value++ = 0;
+		for (i = 0; i < DEVICE_NB_PROPERTIES; i++) {
+			if (strcmp(line, device_property_name[i]) == 0) {
+				device[nb_devices - 1].property[i] = value;
+				break;
+			}
+		}
+	}
+
+	snapshot->nb_devices = nb_devices;
+	snapshot->device = device;
+	return 0;
+}
+
+/*
+ * Record all the devnodes of a source, which must have been opened, to a snapshot.
+ * Returns 0 on success, or -1 if the snapshot could not be written.
+ */
+static __inline int device_snapshot_write(FILE* fd, const struct device_source* source, void* context)
+{
+	char buf[1024];
+	unsigned int index;
+	int i;
+
+	fprintf(fd, "; libwdi device snapshot\n");
+	for (index = 0; source->get_devnode(context, index); index++) {
+		if (!source->get_device_id(context, buf, sizeof(buf))) {
+			continue;
+		}
+		fprintf(fd, "\n[%s]\n", buf);
+		for (i = 0; i < DEVICE_NB_PROPERTIES; i++) {
+			if (source->get_property(context, (enum device_property)i, buf, sizeof(buf))) {
+				// A property can't span more than one line
+				buf[strcspn(buf, "\r\n")] = 0;
+				fprintf(fd, "%s=%s\n", device_property_name[i], buf);
+			}
+		}
+	}
+	return ferror(fd) ? -1 : 0;
+}
+
+/*
+ * Replay of a snapshot, which param of open() is a struct device_snapshot.
+ * The latency is a busy wait, as the system calls that are emulated typically
+ * take less time than the granularity of Sleep().
+ */
+static __inline void device_replay_wait(unsigned int latency)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER frequency, start, now;
+
+	if (latency == 0) {
+		return;
+	}
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&start);
+	do {
+		QueryPerformanceCounter(&now);
+	} while ((now.QuadPart - start.QuadPart) * 1000000 < (LONGLONG)latency * frequency.QuadPart);
+#else
+	struct timespec start, now;
+
+	if (latency == 0) {
+		return;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	do {
+		clock_gettime(CLOCK_MONOTONIC, &now);
+	} while ((now.tv_sec - start.tv_sec) * 1000000LL + (now.tv_nsec - start.tv_nsec) / 1000 < (long long)latency);
+#endif
+}
+
+static __inline int device_replay_copy(const char* value, char* buf, size_t size)
+{
+	size_t len;
+
+	if (value == NULL) {
+		return 0;
+	}
+	len = strlen(value);
+	if (len >= size) {
+		return 0;
+	}
+	memcpy(buf, value, len + 1);
+	return 1;
+}
+
+static __inline void* device_replay_open(void* param)
+{
+	struct device_snapshot* snapshot = (struct device_snapshot*)param;
+
+	if (snapshot == NULL) {
+		return NULL;
+	}
+	device_replay_wait(snapshot->latency);
+	snapshot->current = 0;
+	return snapshot;
+}
+
+static __inline void device_replay_close(void* context)
+{
+	device_replay_wait(((struct device_snapshot*)context)->latency);
+}
+
+static __inline int device_replay_get_devnode(void* context, unsigned int index)
+{
+	struct device_snapshot* snapshot = (struct device_snapshot*)context;
+
+	device_replay_wait(snapshot->latency);
+	if (index >= snapshot->nb_devices) {
+		return 0;
+	}
+	snapshot->current = index;
+	return 1;
+}
+
+static __inline int device_replay_get_property(void* context, enum device_property property, char* buf, size_t size)
+{
+	struct device_snapshot* snapshot = (struct device_snapshot*)context;
+
+	device_replay_wait(snapshot->latency);
+	return device_replay_copy(snapshot->device[snapshot->current].property[property], buf, size);
+}
+
+static __inline int device_replay_get_device_id(void* context, char* buf, size_t size)
+{
+	struct device_snapshot* snapshot = (struct device_snapshot*)context;
+
+	device_replay_wait(snapshot->latency);
+	return device_replay_copy(snapshot->device[snapshot->current].device_id, buf, size);
+}
+
+static const struct device_source device_replay = {
+	device_replay_open,
+	device_replay_close,
+	device_replay_get_devnode,
+	device_replay_get_property,
+	device_replay_get_device_id
+};
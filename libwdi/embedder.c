@@ -41,11 +41,14 @@
 #include <string.h>
 #include <dirent.h>
 #include <unistd.h>
+#include <pthread.h>
 #endif
 
 #include <config.h>
 #include "embedder.h"
 #include "embedder_files.h"
+#include "lz4.h"
+#include "xxhash.h"
 
 #define safe_free(p) do {if (p != NULL) {free(p); p = NULL;}} while(0)
 #define perr(...) fprintf(stderr, "embedder : error: " __VA_ARGS__)
@@ -80,21 +83,473 @@ char initial_dir[MAX_PATH];
 #define NON_NATIVE_SEPARATOR	'\\'
 #endif
 
-void dump_buffer_hex(FILE* fd, unsigned char *buffer, size_t size)
+#if defined(_WIN32)
+#define NATIVE_THREAD			HANDLE
+#define NATIVE_MUTEX			CRITICAL_SECTION
+#define NATIVE_MUTEX_INIT(m)	InitializeCriticalSection(m)
+#define NATIVE_MUTEX_LOCK(m)	EnterCriticalSection(m)
+#define NATIVE_MUTEX_UNLOCK(m)	LeaveCriticalSection(m)
+#define NATIVE_MUTEX_FREE(m)	DeleteCriticalSection(m)
+#else
+#define NATIVE_THREAD			pthread_t
+#define NATIVE_MUTEX			pthread_mutex_t
+#define NATIVE_MUTEX_INIT(m)	pthread_mutex_init(m, NULL)
+#define NATIVE_MUTEX_LOCK(m)	pthread_mutex_lock(m)
+#define NATIVE_MUTEX_UNLOCK(m)	pthread_mutex_unlock(m)
+#define NATIVE_MUTEX_FREE(m)	pthread_mutex_destroy(m)
+#endif
+
+#define MAX_THREADS				64
+
+/*
+ * Lookup table for the "0x##," hex encoding of a byte, filled by init_hex_table()
+ */
+#define HEX_ENTRY_SIZE			5
+#define HEX_BYTES_PER_LINE		0x10
+static char hex_table[256][HEX_ENTRY_SIZE];
+
+void init_hex_table(void)
 {
-	size_t i;
+	const char hex_digit[] = "0123456789ABCDEF";
+	int i;
+
+	for (i=0; i<256; i++) {
+		hex_table[i][0] = '0';
+		hex_table[i][1] = 'x';
+		hex_table[i][2] = hex_digit[i >> 4];
+		hex_table[i][3] = hex_digit[i & 0x0F];
+		hex_table[i][4] = ',';
+	}
+}
+
+// Maximum size of the buffer needed by encode_buffer_hex() for size bytes of data
+size_t encoded_hex_size(size_t size)
+{
+	return size*HEX_ENTRY_SIZE + 2*(size/HEX_BYTES_PER_LINE + 1) + 5;
+}
+
+/*
+ * Produces the exact same output as a series of fprintf(fd, "0x%02X,") would, with a
+ * "\n\t" every 16 bytes, into a buffer that was sized with encoded_hex_size().
+ * Returns the number of characters written.
+ */
+size_t encode_buffer_hex(const unsigned char *buffer, size_t size, char* dst)
+{
+	size_t i, j;
+	char* p = dst;
 
 	// Make sure we output something even if the original file is empty
 	if (size == 0) {
-		fprintf(fd, "0x00");
+		memcpy(p, "0x00", 4);
+		p += 4;
+	}
+
+	for (i=0; i<size; i+=HEX_BYTES_PER_LINE) {
+		*p++ = '\n';
+		*p++ = '\t';
+		for (j=i; (j<size) && (j<i+HEX_BYTES_PER_LINE); j++) {
+			memcpy(p, hex_table[buffer[j]], HEX_ENTRY_SIZE);
+			p += HEX_ENTRY_SIZE;
+		}
+	}
+	*p++ = '\n';
+	return (size_t)(p - dst);
+}
+
+/*
+ * Minimal PE parser, to retrieve the VS_FIXEDFILEINFO of the embedded drivers on
+ * the build host, so that the library doesn't need to extract them at runtime.
+ * See "PE Format" and "VS_VERSIONINFO" in the Microsoft documentation.
+ */
+#define VS_FIXEDFILEINFO_DWORDS	13
+#define VS_FFI_SIGNATURE		0xFEEF04BD
+#define PE_RT_VERSION			16
+#define PE_RESOURCE_DIRECTORY	2
+
+static uint32_t pe_read16(const unsigned char* buffer, size_t size, size_t offset)
+{
+	if ((offset > size) || (size - offset < 2))
+		return 0;
+	return (uint32_t)buffer[offset] | ((uint32_t)buffer[offset+1] << 8);
+}
+
+static uint32_t pe_read32(const unsigned char* buffer, size_t size, size_t offset)
+{
+	if ((offset > size) || (size - offset < 4))
+		return 0;
+	return pe_read16(buffer, size, offset) | (pe_read16(buffer, size, offset+2) << 16);
+}
+
+// Returns the file offset of the first entry of a resource directory that has the
+// requested id (or the first entry if id is 0), or 0 if not found
+static size_t pe_find_resource_entry(const unsigned char* buffer, size_t size, size_t rsrc,
+	size_t dir, uint32_t id, int* is_dir)
+{
+	uint32_t i, nb_entries, entry_id, entry_offset;
+	size_t entry;
+
+	nb_entries = pe_read16(buffer, size, rsrc + dir + 12) + pe_read16(buffer, size, rsrc + dir + 14);
+	for (i=0; i<nb_entries; i++) {
+		entry = rsrc + dir + 16 + 8*(size_t)i;
+		if (entry + 8 > size)
+			return 0;
+		entry_id = pe_read32(buffer, size, entry);
+		entry_offset = pe_read32(buffer, size, entry + 4);
+		if ((id == 0) || (entry_id == id)) {
+			*is_dir = ((entry_offset & 0x80000000) != 0);
+			return entry_offset & 0x7FFFFFFF;
+		}
+	}
+	return 0;
+}
+
+// Fills version with the VS_FIXEDFILEINFO of a PE file. Returns 0 on success.
+static int get_pe_version(const unsigned char* buffer, size_t size, uint32_t* version)
+{
+	size_t pe, opt, sections, rsrc = 0, dir = 0, data_offset = 0, info;
+	uint32_t i, nb_sections, nb_dirs, rsrc_rva, rva, sec_rva, sec_vsize, sec_raw, sec_rawsize, data_size;
+	int level, is_dir;
+
+	if ((size < 0x40) || (buffer[0] != 'M') || (buffer[1] != 'Z'))
+		return 1;
+	pe = pe_read32(buffer, size, 0x3C);
+	if ((pe_read32(buffer, size, pe) != 0x00004550))	// "PE\0\0"
+		return 1;
+	nb_sections = pe_read16(buffer, size, pe + 6);
+	opt = pe + 24;
+	sections = opt + pe_read16(buffer, size, pe + 20);
+	switch (pe_read16(buffer, size, opt)) {
+	case 0x10B:	// PE32
+		nb_dirs = pe_read32(buffer, size, opt + 92);
+		rsrc_rva = pe_read32(buffer, size, opt + 96 + 8*PE_RESOURCE_DIRECTORY);
+		break;
+	case 0x20B:	// PE32+
+		nb_dirs = pe_read32(buffer, size, opt + 108);
+		rsrc_rva = pe_read32(buffer, size, opt + 112 + 8*PE_RESOURCE_DIRECTORY);
+		break;
+	default:
+		return 1;
+	}
+	if ((nb_dirs <= PE_RESOURCE_DIRECTORY) || (rsrc_rva == 0))
+		return 1;
+
+	// Convert RVAs to file offsets, through the section table
+	for (rva = rsrc_rva, level = 0; level < 2; level++) {
+		for (i=0; i<nb_sections; i++) {
+			sec_vsize = pe_read32(buffer, size, sections + 40*(size_t)i + 8);
+			sec_rva = pe_read32(buffer, size, sections + 40*(size_t)i + 12);
+			sec_rawsize = pe_read32(buffer, size, sections + 40*(size_t)i + 16);
+			sec_raw = pe_read32(buffer, size, sections + 40*(size_t)i + 20);
+			if (sec_vsize < sec_rawsize)
+				sec_vsize = sec_rawsize;
+			if ((rva >= sec_rva) && (rva - sec_rva < sec_vsize))
+				break;
+		}
+		if ((i == nb_sections) || (rva - sec_rva >= sec_rawsize))
+			return 1;
+		if (level == 0) {
+			rsrc = (size_t)sec_raw + (rva - sec_rva);
+			// Walk the type, name and language levels of the resource tree
+			dir = pe_find_resource_entry(buffer, size, rsrc, 0, PE_RT_VERSION, &is_dir);
+			if ((dir == 0) || (!is_dir))
+				return 1;
+			dir = pe_find_resource_entry(buffer, size, rsrc, dir, 0, &is_dir);
+			if ((dir == 0) || (!is_dir))
+				return 1;
+			dir = pe_find_resource_entry(buffer, size, rsrc, dir, 0, &is_dir);
+			if ((dir == 0) || (is_dir))
+				return 1;
+			// IMAGE_RESOURCE_DATA_ENTRY
+			rva = pe_read32(buffer, size, rsrc + dir);
+			data_size = pe_read32(buffer, size, rsrc + dir + 4);
+		} else {
+			data_offset = (size_t)sec_raw + (rva - sec_rva);
+		}
+	}
+
+	// VS_VERSIONINFO: 3 WORDs, then L"VS_VERSION_INFO", then VS_FIXEDFILEINFO, 32 bit aligned
+	info = (data_offset + 6 + 2*sizeof("VS_VERSION_INFO") + 3) & ~(size_t)3;
+	if ( (data_size < info - data_offset + 4*VS_FIXEDFILEINFO_DWORDS)
+	  || (pe_read16(buffer, size, data_offset + 2) < 4*VS_FIXEDFILEINFO_DWORDS)
+	  || (pe_read32(buffer, size, info) != VS_FFI_SIGNATURE)
+	  || (info + 4*VS_FIXEDFILEINFO_DWORDS > size) )
+		return 1;
+	for (i=0; i<VS_FIXEDFILEINFO_DWORDS; i++)
+		version[i] = pe_read32(buffer, size, info + 4*(size_t)i);
+	return 0;
+}
+
+/*
+ * SHA-1 and SHA-256 (FIPS 180-4), to precompute the hashes that go into the .cat
+ * files, so that the library doesn't need to hash the extracted files at runtime.
+ */
+#define SHA1_HASH_SIZE			20
+#define SHA256_HASH_SIZE		32
+#define SHA_ROTR32(x, r)		(((x) >> (r)) | ((x) << (32 - (r))))
+#define SHA_ROTL32(x, r)		(((x) << (r)) | ((x) >> (32 - (r))))
+
+struct sha_ctx {
+	uint32_t h[8];
+	uint64_t bytes;
+	unsigned char block[64];
+	size_t used;
+	size_t hash_size;
+	void (*transform)(uint32_t* h, const unsigned char* block);
+};
+
+static uint32_t sha_read_be32(const unsigned char* p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static void sha1_transform(uint32_t* h, const unsigned char* block)
+{
+	uint32_t w[80], a, b, c, d, e, f, k, t;
+	int i;
+
+	for (i=0; i<16; i++)
+		w[i] = sha_read_be32(&block[4*i]);
+	for (; i<80; i++)
+		w[i] = SHA_ROTL32(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
+	a = h[0]; b = h[1]; c = h[2]; d = h[3]; e = h[4];
+	for (i=0; i<80; i++) {
+		if (i < 20) {
+			f = (b & c) | (~b & d);
+			k = 0x5A827999;
+		} else if (i < 40) {
+			f = b ^ c ^ d;
+			k = 0x6ED9EBA1;
+		} else if (i < 60) {
+			f = (b & c) | (b & d) | (c & d);
+			k = 0x8F1BBCDC;
+		} else {
+			f = b ^ c ^ d;
+			k = 0xCA62C1D6;
+		}
+		t = SHA_ROTL32(a, 5) + f + e + k + w[i];
+		e = d; d = c; c = SHA_ROTL32(b, 30); b = a; a = t;
+	}
+	h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+}
+
+static void sha256_transform(uint32_t* h, const unsigned char* block)
+{
+	static const uint32_t k[64] = {
+		0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+		0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+		0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+		0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+		0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+		0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+		0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+		0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+	};
+	uint32_t w[64], s[8], s0, s1, t1, t2;
+	int i;
+
+	for (i=0; i<16; i++)
+		w[i] = sha_read_be32(&block[4*i]);
+	for (; i<64; i++) {
+		s0 = SHA_ROTR32(w[i-15], 7) ^ SHA_ROTR32(w[i-15], 18) ^ (w[i-15] >> 3);
+		s1 = SHA_ROTR32(w[i-2], 17) ^ SHA_ROTR32(w[i-2], 19) ^ (w[i-2] >> 10);
+		w[i] = w[i-16] + s0 + w[i-7] + s1;
+	}
+	memcpy(s, h, sizeof(s));
+	for (i=0; i<64; i++) {
+		s1 = SHA_ROTR32(s[4], 6) ^ SHA_ROTR32(s[4], 11) ^ SHA_ROTR32(s[4], 25);
+		t1 = s[7] + s1 + ((s[4] & s[5]) ^ (~s[4] & s[6])) + k[i] + w[i];
+		s0 = SHA_ROTR32(s[0], 2) ^ SHA_ROTR32(s[0], 13) ^ SHA_ROTR32(s[0], 22);
+		t2 = s0 + ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+		memmove(&s[1], &s[0], 7*sizeof(uint32_t));
+		s[4] += t1;
+		s[0] = t1 + t2;
+	}
+	for (i=0; i<8; i++)
+		h[i] += s[i];
+}
+
+static void sha1_init(struct sha_ctx* ctx)
+{
+	static const uint32_t iv[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+
+	memset(ctx, 0, sizeof(*ctx));
+	memcpy(ctx->h, iv, sizeof(iv));
+	ctx->hash_size = SHA1_HASH_SIZE;
+	ctx->transform = sha1_transform;
+}
+
+static void sha256_init(struct sha_ctx* ctx)
+{
+	static const uint32_t iv[8] = { 0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+		0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19 };
+
+	memset(ctx, 0, sizeof(*ctx));
+	memcpy(ctx->h, iv, sizeof(iv));
+	ctx->hash_size = SHA256_HASH_SIZE;
+	ctx->transform = sha256_transform;
+}
+
+static void sha_update(struct sha_ctx* ctx, const unsigned char* data, size_t size)
+{
+	size_t len;
+
+	ctx->bytes += size;
+	if (ctx->used != 0) {
+		len = 64 - ctx->used;
+		if (len > size)
+			len = size;
+		memcpy(&ctx->block[ctx->used], data, len);
+		ctx->used += len;
+		data += len;
+		size -= len;
+		if (ctx->used < 64)
+			return;
+		ctx->transform(ctx->h, ctx->block);
+		ctx->used = 0;
+	}
+	for (; size >= 64; data += 64, size -= 64)
+		ctx->transform(ctx->h, data);
+	memcpy(ctx->block, data, size);
+	ctx->used = size;
+}
+
+static void sha_final(struct sha_ctx* ctx, unsigned char* hash)
+{
+	uint64_t bits = ctx->bytes * 8;
+	size_t i;
+
+	ctx->block[ctx->used++] = 0x80;
+	if (ctx->used > 56) {
+		memset(&ctx->block[ctx->used], 0, 64 - ctx->used);
+		ctx->transform(ctx->h, ctx->block);
+		ctx->used = 0;
+	}
+	memset(&ctx->block[ctx->used], 0, 56 - ctx->used);
+	for (i=0; i<8; i++)
+		ctx->block[56 + i] = (unsigned char)(bits >> (56 - 8*i));
+	ctx->transform(ctx->h, ctx->block);
+	for (i=0; i<ctx->hash_size; i++)
+		hash[i] = (unsigned char)(ctx->h[i/4] >> (24 - 8*(i%4)));
+}
+
+/*
+ * Computes the hashes the way CryptCATAdminCalcHashFromFileHandle() does, that is,
+ * the Authenticode hash for PE files (see "Calculating the PE Image Hash" in the PE
+ * Format specs) and a flat hash of the whole file for anything else.
+ */
+#define PE_SECURITY_DIRECTORY	4
+#define PE_MAX_SECTIONS			96
+
+struct hash_range {
+	size_t offset;
+	size_t size;
+};
+
+// Returns the number of ranges to hash, or 0 if this isn't a PE file we can handle
+static int get_authenticode_ranges(const unsigned char* buffer, size_t size, struct hash_range* range)
+{
+	size_t pe, opt, sections, security_dir, headers_size, hashed, cert_size = 0, section;
+	uint32_t i, j, nb_sections, nb_dirs;
+	int nb_ranges = 0;
+	struct hash_range sec[PE_MAX_SECTIONS], tmp;
+
+	if ((size < 0x40) || (buffer[0] != 'M') || (buffer[1] != 'Z'))
+		return 0;
+	pe = pe_read32(buffer, size, 0x3C);
+	if ((pe_read32(buffer, size, pe) != 0x00004550))	// "PE\0\0"
+		return 0;
+	nb_sections = pe_read16(buffer, size, pe + 6);
+	if (nb_sections > PE_MAX_SECTIONS)
+		return 0;
+	opt = pe + 24;
+	sections = opt + pe_read16(buffer, size, pe + 20);
+	switch (pe_read16(buffer, size, opt)) {
+	case 0x10B:	// PE32
+		nb_dirs = pe_read32(buffer, size, opt + 92);
+		security_dir = opt + 96 + 8*PE_SECURITY_DIRECTORY;
+		break;
+	case 0x20B:	// PE32+
+		nb_dirs = pe_read32(buffer, size, opt + 108);
+		security_dir = opt + 112 + 8*PE_SECURITY_DIRECTORY;
+		break;
+	default:
+		return 0;
+	}
+	headers_size = pe_read32(buffer, size, opt + 60);
+	if ((headers_size > size) || (sections + 40*(size_t)nb_sections > size))
+		return 0;
+
+	// Headers, minus the checksum and the security directory entry
+	range[nb_ranges].offset = 0;
+	range[nb_ranges++].size = opt + 64;
+	if (nb_dirs > PE_SECURITY_DIRECTORY) {
+		if (security_dir + 8 > headers_size)
+			return 0;
+		range[nb_ranges].offset = opt + 68;
+		range[nb_ranges++].size = security_dir - (opt + 68);
+		range[nb_ranges].offset = security_dir + 8;
+		range[nb_ranges++].size = headers_size - (security_dir + 8);
+		cert_size = pe_read32(buffer, size, security_dir + 4);
+	} else {
+		if (opt + 68 > headers_size)
+			return 0;
+		range[nb_ranges].offset = opt + 68;
+		range[nb_ranges++].size = headers_size - (opt + 68);
+	}
+	hashed = headers_size;
+
+	// Sections, in the order of their file offset
+	for (i=0, j=0; i<nb_sections; i++) {
+		section = sections + 40*(size_t)i;
+		sec[j].size = pe_read32(buffer, size, section + 16);
+		sec[j].offset = pe_read32(buffer, size, section + 20);
+		if (sec[j].size == 0)
+			continue;
+		if ((sec[j].offset > size) || (sec[j].size > size - sec[j].offset))
+			return 0;
+		j++;
+	}
+	nb_sections = j;
+	for (i=1; i<nb_sections; i++) {
+		for (j=i; (j>0) && (sec[j-1].offset > sec[j].offset); j--) {
+			tmp = sec[j];
+			sec[j] = sec[j-1];
+			sec[j-1] = tmp;
+		}
+	}
+	for (i=0; i<nb_sections; i++) {
+		range[nb_ranges++] = sec[i];
+		hashed += sec[i].size;
+	}
+
+	// Any extra data, except for the certificates
+	if ((size > hashed) && (size - hashed > cert_size)) {
+		range[nb_ranges].offset = hashed;
+		range[nb_ranges++].size = size - hashed - cert_size;
 	}
+	return nb_ranges;
+}
+
+static void get_cat_hashes(const unsigned char* buffer, size_t size, unsigned char* sha1, unsigned char* sha256)
+{
+	struct hash_range range[PE_MAX_SECTIONS + 4];
+	struct sha_ctx ctx[2];
+	int i, nb_ranges;
 
-	for (i=0; i<size; i++) {
-		if (!(i%0x10))
-			fprintf(fd, "\n\t");
-		fprintf(fd, "0x%02X,", buffer[i]);
+	sha1_init(&ctx[0]);
+	sha256_init(&ctx[1]);
+	nb_ranges = get_authenticode_ranges(buffer, size, range);
+	if (nb_ranges == 0) {
+		range[0].offset = 0;
+		range[0].size = size;
+		nb_ranges = 1;
 	}
-	fprintf(fd, "\n");
+	for (i=0; i<nb_ranges; i++) {
+		sha_update(&ctx[0], &buffer[range[i].offset], range[i].size);
+		sha_update(&ctx[1], &buffer[range[i].offset], range[i].size);
+	}
+	sha_final(&ctx[0], sha1);
+	sha_final(&ctx[1], sha256);
 }
 
 void handle_separators(char* path)
@@ -306,26 +761,558 @@ void add_user_files(void) {
 }
 #endif
 
+/*
+ * The manifest is a sidecar file to the header, that records the hash and size of
+ * every embedded file, along with the location of its hex data in the header, so
+ * that content that hasn't changed can be reused without being encoded again.
+ */
+#define MANIFEST_EXT			".manifest"
+#define MANIFEST_MAGIC			"embedder-manifest 6"
+
+struct manifest_entry {
+	uint64_t hash;
+	uint64_t size;
+	uint64_t compressed_size;
+	int64_t creation_time;
+	uint64_t offset;
+	uint64_t length;
+	int reuse_last;
+	char* subdir;
+	char* path;
+};
+
+static struct manifest_entry* manifest = NULL;
+static int nb_manifest_entries = 0;
+// Set if the resources are LZ4 compressed (-z)
+static int compress_resources = 0;
+// Assembler source and binary data files, if the resources are produced in assembler mode (-s)
+static char* asm_name = NULL;
+static char* bin_name = NULL;
+
+static void free_manifest(void)
+{
+	int i;
+
+	if (manifest == NULL)
+		return;
+	for (i=0; i<nb_manifest_entries; i++) {
+		safe_free(manifest[i].subdir);
+		safe_free(manifest[i].path);
+	}
+	safe_free(manifest);
+	nb_manifest_entries = 0;
+}
+
+// Returns 0 on success, non zero if no valid manifest could be read
+static int load_manifest(const char* manifest_name)
+{
+	FILE* fd;
+	char line[2*MAX_PATH + 128];
+	char *subdir, *path, *end;
+	int n, size = 0, ret = 1, compressed, assembler;
+	struct manifest_entry* new_manifest;
+
+	fd = fopen(manifest_name, "r");
+	if (fd == NULL)
+		return 1;
+	// The data of a previous run can only be reused with the same output settings
+	if ( (fgets(line, sizeof(line), fd) == NULL)
+	  || (sscanf(line, MANIFEST_MAGIC " %d %d", &compressed, &assembler) != 2)
+	  || (compressed != compress_resources) || (assembler != (asm_name != NULL)) )
+		goto out;
+
+	while (fgets(line, sizeof(line), fd) != NULL) {
+		if (nb_manifest_entries >= size) {
+			size = (size == 0) ? 64 : 2*size;
+			new_manifest = (struct manifest_entry*) realloc(manifest, size*sizeof(struct manifest_entry));
+			if (new_manifest == NULL)
+				goto out;
+			manifest = new_manifest;
+		}
+		memset(&manifest[nb_manifest_entries], 0, sizeof(struct manifest_entry));
+		n = 0;
+		if (sscanf(line, "%" SCNx64 " %" SCNu64 " %" SCNu64 " %" SCNd64 " %" SCNu64 " %" SCNu64 " %d%n",
+			&manifest[nb_manifest_entries].hash, &manifest[nb_manifest_entries].size,
+			&manifest[nb_manifest_entries].compressed_size, &manifest[nb_manifest_entries].creation_time,
+			&manifest[nb_manifest_entries].offset, &manifest[nb_manifest_entries].length,
+			&manifest[nb_manifest_entries].reuse_last, &n) != 7)
+			goto out;
+		// Don't use a '\t' in the format above, as it would also skip an empty subdir
+		if (line[n] != '\t')
+			goto out;
+		subdir = &line[n+1];
+		path = strchr(subdir, '\t');
+		if (path == NULL)
+			goto out;
+		*path++ = 0;
+		end = strpbrk(path, "\r\n");
+		if (end != NULL)
+			*end = 0;
+		manifest[nb_manifest_entries].subdir = NATIVE_STRDUP(subdir);
+		manifest[nb_manifest_entries].path = NATIVE_STRDUP(path);
+		nb_manifest_entries++;
+		if ((manifest[nb_manifest_entries-1].subdir == NULL) || (manifest[nb_manifest_entries-1].path == NULL))
+			goto out;
+	}
+	ret = 0;
+
+out:
+	fclose(fd);
+	if (ret != 0) {
+		printf("  ignoring invalid manifest '%s'\n", manifest_name);
+		free_manifest();
+	}
+	return ret;
+}
+
+/*
+ * Each embeddable file is read and hashed, and then, if its content changed,
+ * compressed and hex encoded, as independent jobs run by a pool of worker threads. The results are
+ * then written to the header, in order.
+ */
+enum job_status {
+	JOB_PENDING,
+	JOB_SUCCESS,
+	JOB_OPEN_ERROR,
+	JOB_ALLOC_ERROR,
+	JOB_READ_ERROR,
+};
+
+struct emb_job {
+	char fullpath[MAX_PATH];
+	int status;
+	int has_stat;
+	size_t size;
+	// Size of the LZ4 data, or 0 if the file is embedded uncompressed
+	size_t compressed_size;
+	time_t creation_time;
+	uint64_t hash;
+	// VS_FIXEDFILEINFO, for PE files that have one
+	int has_version;
+	uint32_t version[VS_FIXEDFILEINFO_DWORDS];
+	// Hashes of the file, as used in .cat files
+	unsigned char sha1[SHA1_HASH_SIZE];
+	unsigned char sha256[SHA256_HASH_SIZE];
+	// File data, or, in assembler mode, the data to write after encode_job()
+	unsigned char* data;
+	// Entry from the previous manifest, if the content of this file is unchanged
+	struct manifest_entry* cached;
+	// Index of an earlier job with the exact same content, or -1
+	int same_as;
+	char* hex;
+	size_t hex_size;
+	// Location of the hex data in the new header, or of the data in the binary file
+	uint64_t offset;
+};
+
+static struct emb_job* job = NULL;
+static int nb_jobs, next_job;
+static NATIVE_MUTEX job_mutex;
+static void (*process_job)(struct emb_job* j) = NULL;
+
+static void read_job(struct emb_job* j)
+{
+	FILE* fd;
+	int i;
+	struct NATIVE_STAT stbuf;
+#if defined(_WIN32)
+	wchar_t wfullpath[MAX_PATH];
+
+	MultiByteToWideChar(CP_UTF8, 0, j->fullpath, -1, wfullpath, MAX_PATH);
+	fd = _wfopen(wfullpath, L"rb");
+#else
+	fd = fopen(j->fullpath, "rb");
+#endif
+	if (fd == NULL) {
+		j->status = JOB_OPEN_ERROR;
+		return;
+	}
+
+	// Read the creation date and size
+	memset(&stbuf, 0, sizeof(stbuf));
+	j->has_stat = (NATIVE_STAT(j->fullpath, &stbuf) == 0);
+	j->creation_time = stbuf.st_ctime;
+	j->size = (size_t)stbuf.st_size;
+
+	// +1, as some platforms return NULL for malloc(0)
+	j->data = (unsigned char*) malloc(j->size + 1);
+	if (j->data == NULL) {
+		j->status = JOB_ALLOC_ERROR;
+		goto out;
+	}
+
+	if (fread(j->data, 1, j->size, fd) != j->size) {
+		j->status = JOB_READ_ERROR;
+		goto out;
+	}
+	j->hash = xxh64(j->data, j->size);
+	j->has_version = (get_pe_version(j->data, j->size, j->version) == 0);
+	get_cat_hashes(j->data, j->size, j->sha1, j->sha256);
+	j->status = JOB_SUCCESS;
+
+	// Look for the same content in the previous manifest
+	for (i=0; i<nb_manifest_entries; i++) {
+		if ( (!manifest[i].reuse_last) && (manifest[i].hash == j->hash)
+		  && (manifest[i].size == (uint64_t)j->size)
+		  && (strcmp(manifest[i].path, j->fullpath) == 0) ) {
+			j->cached = &manifest[i];
+			break;
+		}
+	}
+
+out:
+	fclose(fd);
+}
+
+static void encode_job(struct emb_job* j)
+{
+	unsigned char* compressed = NULL;
+	unsigned char* data;
+	size_t size;
+
+	if ((j->status != JOB_SUCCESS) || (j->cached != NULL) || (j->same_as >= 0) || (j->data == NULL))
+		return;
+	data = j->data;
+	size = j->size;
+	if (compress_resources && (size != 0)) {
+		compressed = (unsigned char*) malloc(lz4_chunks_bound(size));
+		if (compressed == NULL) {
+			j->status = JOB_ALLOC_ERROR;
+			goto out;
+		}
+		j->compressed_size = lz4_compress_chunks(j->data, j->size, compressed);
+		// Don't bother with data that doesn't compress
+		if (j->compressed_size < j->size) {
+			data = compressed;
+			size = j->compressed_size;
+		} else {
+			j->compressed_size = 0;
+		}
+	}
+	// In assembler mode, the data is written as is, and included with .incbin
+	if (asm_name != NULL) {
+		if (data == compressed) {
+			free(j->data);
+			j->data = compressed;
+		}
+		return;
+	}
+	j->hex = (char*) malloc(encoded_hex_size(size));
+	if (j->hex == NULL) {
+		j->status = JOB_ALLOC_ERROR;
+	} else {
+		j->hex_size = encode_buffer_hex(data, size, j->hex);
+	}
+
+out:
+	safe_free(compressed);
+	safe_free(j->data);
+}
+
+static void process_jobs(void)
+{
+	int i;
+
+	while (1) {
+		NATIVE_MUTEX_LOCK(&job_mutex);
+		i = next_job++;
+		NATIVE_MUTEX_UNLOCK(&job_mutex);
+		if (i >= nb_jobs)
+			break;
+		process_job(&job[i]);
+	}
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI job_thread(LPVOID param)
+{
+	(void)param;
+	process_jobs();
+	return 0;
+}
+#else
+static void* job_thread(void* param)
+{
+	(void)param;
+	process_jobs();
+	return NULL;
+}
+#endif
+
+// Run process_fn on all the jobs using nb_threads threads (0 = as many as there are CPUs)
+static int run_jobs(void (*process_fn)(struct emb_job* j), int nb_threads)
+{
+	NATIVE_THREAD thread[MAX_THREADS];
+	int i, nb_started = 0;
+#if defined(_WIN32)
+	SYSTEM_INFO si;
+
+	if (nb_threads <= 0) {
+		GetSystemInfo(&si);
+		nb_threads = (int)si.dwNumberOfProcessors;
+	}
+#else
+	if (nb_threads <= 0) {
+		nb_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	}
+#endif
+	if (nb_threads > nb_jobs)
+		nb_threads = nb_jobs;
+	if (nb_threads > MAX_THREADS)
+		nb_threads = MAX_THREADS;
+
+	process_job = process_fn;
+	next_job = 0;
+	NATIVE_MUTEX_INIT(&job_mutex);
+	// The current thread also processes jobs, so we only need to spawn nb_threads-1 more
+	for (i=0; i<nb_threads-1; i++) {
+#if defined(_WIN32)
+		thread[nb_started] = CreateThread(NULL, 0, job_thread, NULL, 0, NULL);
+		if (thread[nb_started] == NULL)
+			break;
+#else
+		if (pthread_create(&thread[nb_started], NULL, job_thread, NULL) != 0)
+			break;
+#endif
+		nb_started++;
+	}
+	process_jobs();
+	for (i=0; i<nb_started; i++) {
+#if defined(_WIN32)
+		WaitForSingleObject(thread[i], INFINITE);
+		CloseHandle(thread[i]);
+#else
+		pthread_join(thread[i], NULL);
+#endif
+	}
+	NATIVE_MUTEX_FREE(&job_mutex);
+	return nb_started+1;
+}
+
+/*
+ * Point all the files that have the exact same content to the first instance,
+ * so that it only gets embedded once. Returns the number of duplicates found.
+ */
+static int dedupe_jobs(uint64_t* bytes_saved)
+{
+	int i, k, nb_dups = 0;
+
+	*bytes_saved = 0;
+	for (i=0; i<nb_jobs; i++) {
+		if ((embeddable[i].reuse_last) || (job[i].status != JOB_SUCCESS))
+			continue;
+		for (k=0; k<i; k++) {
+			if ( (!embeddable[k].reuse_last) && (job[k].status == JOB_SUCCESS) && (job[k].same_as < 0)
+			  && (job[k].hash == job[i].hash) && (job[k].size == job[i].size)
+			  && (memcmp(job[k].data, job[i].data, job[i].size) == 0) ) {
+				job[i].same_as = k;
+				*bytes_saved += (uint64_t)job[i].size;
+				nb_dups++;
+				break;
+			}
+		}
+	}
+	return nb_dups;
+}
+
+// Reads the whole previous header, in text mode, so that offsets match the ones we wrote
+static char* read_header(const char* header_name, size_t* header_size)
+{
+	FILE* fd;
+	char *buffer = NULL, *new_buffer;
+	size_t size = 0, alloc_size = 0, rd;
+
+	fd = fopen(header_name, "r");
+	if (fd == NULL)
+		return NULL;
+	do {
+		if (size == alloc_size) {
+			alloc_size = (alloc_size == 0) ? 0x100000 : 2*alloc_size;
+			new_buffer = (char*) realloc(buffer, alloc_size);
+			if (new_buffer == NULL) {
+				safe_free(buffer);
+				break;
+			}
+			buffer = new_buffer;
+		}
+		rd = fread(&buffer[size], 1, alloc_size - size, fd);
+		size += rd;
+	} while (rd != 0);
+	fclose(fd);
+	*header_size = size;
+	return buffer;
+}
+
+// Write to the header, while keeping track of the position, for the manifest
+static uint64_t header_pos = 0;
+static void header_write(const char* data, size_t size, FILE* fd)
+{
+	fwrite(data, 1, size, fd);
+	header_pos += size;
+}
+
+/*
+ * In assembler mode, the header only declares the symbols, which are defined in an
+ * assembler source that uses .incbin to pull the data from a single binary file.
+ * This is much faster to build than a C array initializer, and uses less memory.
+ */
+static uint64_t bin_pos = 0;
+static const char asm_preamble[] = "/* Generated by embedder - DO NOT EDIT */\n\n" \
+	"/* Symbols must follow the C naming convention of the target (e.g. '_' prefix on x86) */\n" \
+	"#define SYMBOL1(prefix, name) prefix ## name\n" \
+	"#define SYMBOL2(prefix, name) SYMBOL1(prefix, name)\n" \
+	"#define SYMBOL(name) SYMBOL2(__USER_LABEL_PREFIX__, name)\n\n" \
+	"\t.section .rdata,\"dr\"\n";
+
+static int write_asm_entry(int i, FILE* header_fd, FILE* asm_fd, FILE* bin_fd)
+{
+	size_t size = (job[i].compressed_size != 0) ? job[i].compressed_size : job[i].size;
+
+	fprintf(header_fd, "extern const unsigned char file_%03X[];\n", (unsigned char)i);
+	fprintf(asm_fd, "\n\t.globl SYMBOL(file_%03X)\n\t.balign 16\nSYMBOL(file_%03X):\n",
+		(unsigned char)i, (unsigned char)i);
+	// Make sure we output something even if the original file is empty
+	if (size == 0) {
+		fprintf(asm_fd, "\t.byte 0\n");
+		return 0;
+	}
+	fprintf(asm_fd, "\t.incbin \"%s\", %" PRIu64 ", %" PRIu64 "\n", bin_name, bin_pos, (uint64_t)size);
+	if (fwrite(job[i].data, 1, size, bin_fd) != size) {
+		perr("Could not write file '%s'.\n", bin_name);
+		return 1;
+	}
+	job[i].offset = bin_pos;
+	job[i].hex_size = size;
+	bin_pos += size;
+	safe_free(job[i].data);
+	return 0;
+}
+
+/*
+ * The resource table is followed by an index of the resources sorted by name and
+ * subdir, so that the library can look them up with a binary search. The keys are
+ * compared as the library sees them, i.e. with '\\' as the path separator.
+ */
+struct res_key {
+	char* name;
+	char* subdir;
+	int index;
+};
+
+static int compare_res_keys(const void* a, const void* b)
+{
+	const struct res_key* ka = (const struct res_key*)a;
+	const struct res_key* kb = (const struct res_key*)b;
+	int r;
+
+	r = strcmp(ka->name, kb->name);
+	if (r == 0)
+		r = strcmp(ka->subdir, kb->subdir);
+	if (r == 0)
+		r = ka->index - kb->index;
+	return r;
+}
+
+static int write_resource_index(FILE* fd)
+{
+	struct res_key* key;
+	char *junk, *file_name;
+	int i, j, ret = 1;
+
+	key = (struct res_key*) calloc(nb_embeddables, sizeof(struct res_key));
+	if (key == NULL)
+		return 1;
+	for (i=0; i<nb_embeddables; i++) {
+		basename_split(embeddable[i].file_name, &junk, &file_name);
+		key[i].name = NATIVE_STRDUP(file_name);
+		basename_free(embeddable[i].file_name);
+		key[i].subdir = NATIVE_STRDUP(embeddable[i].extraction_subdir);
+		key[i].index = i;
+		if ((key[i].name == NULL) || (key[i].subdir == NULL))
+			goto out;
+		for (j=0; key[i].subdir[j] != 0; j++) {
+			if (key[i].subdir[j] == NON_NATIVE_SEPARATOR)
+				key[i].subdir[j] = '\\';
+			else if (key[i].subdir[j] == NATIVE_SEPARATOR)
+				key[i].subdir[j] = '\\';
+		}
+	}
+	qsort(key, nb_embeddables, sizeof(struct res_key), compare_res_keys);
+
+	fprintf(fd, "\n// Indexes of the resources, sorted by name and subdir\n");
+	fprintf(fd, "const int resource_index[] = {");
+	for (i=0; i<nb_embeddables; i++) {
+		fprintf(fd, "%s%d,", (i % 16 == 0) ? "\n\t" : " ", key[i].index);
+	}
+	fprintf(fd, "\n};\n");
+	ret = 0;
+
+out:
+	for (i=0; i<nb_embeddables; i++) {
+		safe_free(key[i].name);
+		safe_free(key[i].subdir);
+	}
+	safe_free(key);
+	return ret;
+}
+
+static void write_hash(FILE* fd, const unsigned char* hash, size_t size)
+{
+	size_t i;
+
+	fprintf(fd, "{ ");
+	for (i=0; i<size; i++)
+		fprintf(fd, "0x%02X,", hash[i]);
+	fprintf(fd, " }");
+}
+
+static int save_manifest(const char* manifest_name)
+{
+	FILE* fd;
+	int i;
+
+	fd = fopen(manifest_name, "w");
+	if (fd == NULL) {
+		perr("Could not create file '%s'.\n", manifest_name);
+		return 1;
+	}
+	fprintf(fd, "%s %d %d\n", MANIFEST_MAGIC, compress_resources, (asm_name != NULL));
+	for (i=0; i<nb_embeddables; i++) {
+		if (embeddable[i].reuse_last) {
+			fprintf(fd, "0 0 0 0 0 0 1\t%s\t%s\n", embeddable[i].extraction_subdir, embeddable[i].file_name);
+			continue;
+		}
+		fprintf(fd, "%016" PRIx64 " %" PRIu64 " %" PRIu64 " %" PRId64 " %" PRIu64 " %" PRIu64 " 0\t%s\t%s\n",
+			job[i].hash, (uint64_t)job[i].size, (uint64_t)job[i].compressed_size,
+			(int64_t)job[i].creation_time, job[i].offset,
+			(uint64_t)job[i].hex_size, embeddable[i].extraction_subdir, job[i].fullpath);
+	}
+	fclose(fd);
+	return 0;
+}
+
 int
 #ifdef DDKBUILD
 __cdecl
 #endif
 main (int argc, char *argv[])
 {
-	int ret = 1, i, j, rebuild;
-	size_t size;
+	int ret = 1, i, j, unchanged, nb_threads = 0, nb_reused = 0, nb_rebuilt = 0, nb_dups;
+	uint64_t dups_size, total_size = 0, total_compressed_size = 0;
+	char* header_name = NULL;
+	char* manifest_name = NULL;
 	char* file_name = NULL;
 	char* junk;
-	size_t* file_size = NULL;
-	int64_t* file_time = NULL;
-	FILE *fd, *header_fd;
-	time_t header_time;
+	char* old_header = NULL;
+	char* ext;
+	size_t old_header_size = 0;
+	FILE *header_fd, *asm_fd = NULL, *bin_fd = NULL;
 	struct NATIVE_STAT stbuf;
 	struct tm* ltm;
 	char internal_name[] = "file_###";
-	unsigned char* buffer = NULL;
-	unsigned char last;
-	char fullpath[MAX_PATH];
+	char version_name[] = "&file_version_###";
+	char header_line[64];
+	int last, data_index;
 #if defined(_WIN32)
 	wchar_t wfullpath[MAX_PATH];
 #endif
@@ -333,120 +1320,249 @@ main (int argc, char *argv[])
 	// Disable stdout bufferring
 	setvbuf(stdout, NULL, _IONBF, 0);
 
-	if (argc != 2) {
+	for (i=1; i<argc; i++) {
+		if (strcmp(argv[i], "-j") == 0) {
+			if (++i >= argc) {
+				perr("Option -j requires a thread count.\n");
+				return 1;
+			}
+			nb_threads = atoi(argv[i]);
+		} else if (strcmp(argv[i], "-z") == 0) {
+			compress_resources = 1;
+		} else if (strcmp(argv[i], "-s") == 0) {
+			if (++i >= argc) {
+				perr("Option -s requires an assembler file name.\n");
+				return 1;
+			}
+			asm_name = argv[i];
+		} else if (header_name == NULL) {
+			header_name = argv[i];
+		} else {
+			header_name = NULL;
+			break;
+		}
+	}
+	if (header_name == NULL) {
 		perr("You must supply a header name.\n");
+		fprintf(stderr, "Usage: embedder [-j <nb_threads>] [-z] [-s <asm_file>] <header>\n");
+		return 1;
+	}
+	manifest_name = (char*) malloc(strlen(header_name) + sizeof(MANIFEST_EXT));
+	if (manifest_name == NULL)
 		return 1;
+	sprintf(manifest_name, "%s%s", header_name, MANIFEST_EXT);
+	if (asm_name != NULL) {
+		// The binary data goes to a file with the same name as the assembler source, and a .bin extension
+		bin_name = (char*) malloc(strlen(asm_name) + 5);
+		if (bin_name == NULL)
+			goto out1;
+		strcpy(bin_name, asm_name);
+		ext = strrchr(bin_name, '.');
+		if ((ext != NULL) && (strchr(ext, '/') == NULL) && (strchr(ext, '\\') == NULL))
+			*ext = 0;
+		strcat(bin_name, ".bin");
 	}
 
+	init_hex_table();
 	nb_embeddables = nb_embeddables_fixed;
 #if defined(USER_DIR)
 	add_user_files();
 #endif
-	// Check if any of the embedded files have changed
-	rebuild = 0;
+
+	// The previous manifest is only of use if the files it describes still exist
 	// coverity[fs_check_call]
-	if (NATIVE_STAT(argv[1], &stbuf) == 0) {
-		header_time = stbuf.st_mtime;	// make sure to use modification time!
-		for (i=0; i<nb_embeddables; i++) {
-			if (embeddable[i].reuse_last) continue;
-			if (get_full_path(embeddable[i].file_name, fullpath, MAX_PATH)) {
-				perr("Unable to get full path for '%s'.\n", embeddable[i].file_name);
-				goto out1;
-			}
-			if (NATIVE_STAT(fullpath, &stbuf) != 0) {
-				printf("unable to stat '%s' - assuming rebuild needed\n", fullpath);
-				rebuild = 1;
-				break;
-			}
-			if (stbuf.st_mtime > header_time) {
-				printf("detected change for '%s'\n", fullpath);
-				rebuild = 1;
-				break;
-			}
+	if ( (NATIVE_STAT(header_name, &stbuf) == 0) && ((asm_name == NULL)
+	  || ((NATIVE_STAT(asm_name, &stbuf) == 0) && (NATIVE_STAT(bin_name, &stbuf) == 0))) ) {
+		load_manifest(manifest_name);
+	}
+
+	// Jobs are indexed as the embeddables, with reused entries left empty
+	nb_jobs = nb_embeddables;
+	job = (struct emb_job*) calloc(nb_jobs, sizeof(struct emb_job));
+	if (job == NULL) goto out1;
+
+	// get_full_path() is not thread safe, so resolve all the paths beforehand
+	for (i=0; i<nb_embeddables; i++) {
+		job[i].same_as = -1;
+		if (embeddable[i].reuse_last) {
+			job[i].status = JOB_SUCCESS;
+			continue;
 		}
-		if (!rebuild) {
-			printf("  resources haven't changed - skipping step\n");
-			ret = 0; goto out1;
+		if (get_full_path(embeddable[i].file_name, job[i].fullpath, MAX_PATH)) {
+			perr("Could not get full path for '%s'.\n", embeddable[i].file_name);
+			goto out1;
 		}
 	}
+	run_jobs(read_job, nb_threads);
+	nb_dups = dedupe_jobs(&dups_size);
 
-	size = sizeof(size_t)*nb_embeddables;
-	file_size = malloc(size);
-	if (file_size == NULL) goto out1;
-	size = sizeof(int64_t)*nb_embeddables;
-	file_time = malloc(size);
-	if (file_time == NULL) goto out1;
+	// Check if the content of any of the embedded files has changed
+	unchanged = (nb_manifest_entries == nb_embeddables);
+	for (i=0; (i<nb_embeddables) && unchanged; i++) {
+		if ( (manifest[i].reuse_last != embeddable[i].reuse_last)
+		  || (strcmp(manifest[i].subdir, embeddable[i].extraction_subdir) != 0) ) {
+			unchanged = 0;
+		} else if (embeddable[i].reuse_last) {
+			unchanged = (strcmp(manifest[i].path, embeddable[i].file_name) == 0);
+		} else {
+			unchanged = (job[i].status == JOB_SUCCESS) && (job[i].cached == &manifest[i]);
+		}
+	}
+	if (unchanged) {
+		printf("  resources haven't changed - skipping step (%d file(s) checked)\n", nb_jobs);
+		ret = 0; goto out1;
+	}
+
+	// Retrieve the hex data we can reuse from the previous header
+	for (i=0; i<nb_embeddables; i++) {
+		if ((job[i].cached == NULL) || (job[i].same_as >= 0))
+			continue;
+		// There is no encoding to save in assembler mode, so just rewrite the data
+		if (asm_name != NULL) {
+			job[i].creation_time = (time_t)job[i].cached->creation_time;
+			job[i].cached = NULL;
+			continue;
+		}
+		if (old_header == NULL)
+			old_header = read_header(header_name, &old_header_size);
+		// Make sure that the fragment is where the manifest says it should be
+		if ( (old_header == NULL) || (job[i].cached->offset == 0)
+		  || (job[i].cached->offset + job[i].cached->length + 4 > old_header_size)
+		  || (old_header[job[i].cached->offset - 1] != '{')
+		  || (memcmp(&old_header[job[i].cached->offset + job[i].cached->length], "};\n\n", 4) != 0) ) {
+			job[i].cached = NULL;
+			continue;
+		}
+		// Keep the original creation time, so that unchanged content produces the same header
+		job[i].creation_time = (time_t)job[i].cached->creation_time;
+		job[i].compressed_size = (size_t)job[i].cached->compressed_size;
+	}
+	run_jobs(encode_job, nb_threads);
 
-	header_fd = fopen(argv[1], "w");
+	header_fd = fopen(header_name, "w");
 	if (header_fd == NULL) {
-		perr("Could not create file '%s'.\n", argv[1]);
+		perr("Could not create file '%s'.\n", header_name);
 		goto out1;
 	}
-	fprintf(header_fd, "#pragma once\n");
+	header_pos = 0;
+	header_write("#pragma once\n", 13, header_fd);
+	if (asm_name != NULL) {
+		asm_fd = fopen(asm_name, "w");
+		if (asm_fd == NULL) {
+			perr("Could not create file '%s'.\n", asm_name);
+			goto out2;
+		}
+		bin_fd = fopen(bin_name, "wb");
+		if (bin_fd == NULL) {
+			perr("Could not create file '%s'.\n", bin_name);
+			goto out2;
+		}
+		fputs(asm_preamble, asm_fd);
+		bin_pos = 0;
+	}
 
 	for (i=0; i<nb_embeddables; i++) {
 		if (embeddable[i].reuse_last) {
 			continue;
 		}
-		if (get_full_path(embeddable[i].file_name, fullpath, MAX_PATH)) {
-			perr("Could not get full path for '%s'.\n", embeddable[i].file_name);
-			goto out2;
-		}
 #if defined(_WIN32)
-		MultiByteToWideChar(CP_UTF8, 0, fullpath, -1, wfullpath, MAX_PATH);
-		wprintf(L"  EMBED  %s ", wfullpath);
-		fd = _wfopen(wfullpath, L"rb");
+		MultiByteToWideChar(CP_UTF8, 0, job[i].fullpath, -1, wfullpath, MAX_PATH);
+		wprintf(L"  %s  %s ", (job[i].same_as >= 0) ? L"DEDUP" : ((job[i].cached != NULL) ? L"REUSE" : L"EMBED"), wfullpath);
 #else
-		printf("  EMBED  %s ", fullpath);
-		fd = fopen(fullpath, "rb");
+		printf("  %s  %s ", (job[i].same_as >= 0) ? "DEDUP" : ((job[i].cached != NULL) ? "REUSE" : "EMBED"), job[i].fullpath);
 #endif
-		if (fd == NULL) {
-			perr("Could not open file '%s'.\n", fullpath);
+		switch (job[i].status) {
+		case JOB_SUCCESS:
+			break;
+		case JOB_OPEN_ERROR:
+			perr("Could not open file '%s'.\n", job[i].fullpath);
+			goto out2;
+		case JOB_ALLOC_ERROR:
+			perr("Could not allocate buffer.\n");
+			goto out2;
+		default:
+			perr("Could not read file '%s'.\n", job[i].fullpath);
 			goto out2;
 		}
-
-		// Read the creation date
-		memset(&stbuf, 0, sizeof(stbuf));
-		if ( (NATIVE_STAT(fullpath, &stbuf) == 0) && ((ltm = localtime(&stbuf.st_ctime)) != NULL) ) {
+		if ( job[i].has_stat && ((ltm = localtime(&job[i].creation_time)) != NULL) ) {
 			printf("(%04d.%02d.%02d)\n", ltm->tm_year+1900, ltm->tm_mon+1, ltm->tm_mday);
 		} else {
 			printf("\n");
 		}
-		file_time[i] = (int64_t)stbuf.st_ctime;
-		file_size[i] = (size_t)stbuf.st_size;
-
-		buffer = (unsigned char*) malloc(file_size[i]);
-		if (buffer == NULL) {
-			perr("Could not allocate buffer.\n");
-			goto out3;
+		if (job[i].same_as >= 0) {
+			printf("         same content as '%s' - not embedded again\n", job[job[i].same_as].fullpath);
+			job[i].compressed_size = job[job[i].same_as].compressed_size;
+			continue;
 		}
-
-		if (fread(buffer, 1, file_size[i], fd) != file_size[i]) {
-			perr("Could not read file '%s'.\n", fullpath);
-			goto out4;
+		total_size += (uint64_t)job[i].size;
+		total_compressed_size += (uint64_t)((job[i].compressed_size != 0) ? job[i].compressed_size : job[i].size);
+		if (asm_name != NULL) {
+			if (write_asm_entry(i, header_fd, asm_fd, bin_fd) != 0)
+				goto out2;
+			nb_rebuilt++;
+			continue;
 		}
-		fclose(fd);
 
-		sprintf(internal_name, "file_%03X", (unsigned char)i);
-		fprintf(header_fd, "const unsigned char %s[] = {", internal_name);
-		dump_buffer_hex(header_fd, buffer, file_size[i]);
-		fprintf(header_fd, "};\n\n");
-		safe_free(buffer);
+		sprintf(header_line, "const unsigned char file_%03X[] = {", (unsigned char)i);
+		header_write(header_line, strlen(header_line), header_fd);
+		job[i].offset = header_pos;
+		if (job[i].cached != NULL) {
+			job[i].hex_size = (size_t)job[i].cached->length;
+			header_write(&old_header[job[i].cached->offset], job[i].hex_size, header_fd);
+			nb_reused++;
+		} else {
+			header_write(job[i].hex, job[i].hex_size, header_fd);
+			safe_free(job[i].hex);
+			nb_rebuilt++;
+		}
+		header_write("};\n\n", 4, header_fd);
+	}
+	if (asm_name != NULL) {
+		fclose(asm_fd);
+		fclose(bin_fd);
+		asm_fd = NULL;
+		bin_fd = NULL;
+		fprintf(header_fd, "\n");
 	}
 	fprintf(header_fd, "struct res {\n" \
 		"\tchar* subdir;\n" \
 		"\tchar* name;\n" \
 		"\tsize_t size;\n" \
+		"\tsize_t compressed_size;\n" \
+		"\tuint64_t hash;\n" \
 		"\tint64_t creation_time;\n" \
 		"\tconst unsigned char* data;\n" \
-		"};\n\n");
+		"\tconst VS_FIXEDFILEINFO* version_info;\n" \
+		"\tunsigned char sha1[%d];\n" \
+		"\tunsigned char sha256[%d];\n" \
+		"};\n\n", SHA1_HASH_SIZE, SHA256_HASH_SIZE);
+
+	// Version info of the PE files, as extracted from their VS_VERSIONINFO resource
+	for (i=0; i<nb_embeddables; i++) {
+		if ((embeddable[i].reuse_last) || (job[i].same_as >= 0) || (!job[i].has_version)) {
+			continue;
+		}
+		fprintf(header_fd, "const VS_FIXEDFILEINFO file_version_%03X = {", (unsigned char)i);
+		for (j=0; j<VS_FIXEDFILEINFO_DWORDS; j++) {
+			fprintf(header_fd, "%s0x%08X", (j == 0) ? " " : ", ", job[i].version[j]);
+		}
+		fprintf(header_fd, " };\n");
+	}
+	fprintf(header_fd, "\n");
 
 	fprintf(header_fd, "const struct res resource[] = {\n");
 	for (last=0,i=0; i<nb_embeddables; i++) {
 		if (!embeddable[i].reuse_last) {
-			last = (unsigned char)i;
+			last = i;
+		}
+		// Duplicates point to the data of the first file with the same content
+		data_index = (job[last].same_as >= 0) ? job[last].same_as : last;
+		sprintf(internal_name, "file_%03X", (unsigned char)data_index);
+		if (job[data_index].has_version) {
+			sprintf(version_name, "&file_version_%03X", (unsigned char)data_index);
+		} else {
+			strcpy(version_name, "NULL");
 		}
-		sprintf(internal_name, "file_%03X", last);
 		fprintf(header_fd, "\t{ \"");
 		// Backslashes need to be escaped
 		for (j=0; j<(int)strlen(embeddable[i].extraction_subdir); j++) {
@@ -459,25 +1575,51 @@ main (int argc, char *argv[])
 			}
 		}
 		basename_split(embeddable[i].file_name, &junk, &file_name);
-		fprintf(header_fd, "\", \"%s\", %d, INT64_C(%"PRId64"), %s },\n",
-			file_name, (int)file_size[last], file_time[last], internal_name);
+		fprintf(header_fd, "\", \"%s\", %d, %d, UINT64_C(0x%016"PRIx64"), INT64_C(%"PRId64"), %s, %s,\n\t\t",
+			file_name, (int)job[last].size, (int)job[last].compressed_size, job[last].hash,
+			(int64_t)job[last].creation_time, internal_name, version_name);
+		write_hash(header_fd, job[last].sha1, SHA1_HASH_SIZE);
+		fprintf(header_fd, ",\n\t\t");
+		write_hash(header_fd, job[last].sha256, SHA256_HASH_SIZE);
+		fprintf(header_fd, " },\n");
 		basename_free(embeddable[i].file_name);
 	}
 	fprintf(header_fd, "};\n");
 	fprintf(header_fd, "\nconst int nb_resources = sizeof(resource)/sizeof(resource[0]);\n");
+	if (write_resource_index(header_fd) != 0) {
+		perr("Could not create resource index.\n");
+		goto out2;
+	}
 
 	fclose(header_fd);
+	printf("  %d file(s) reused, %d file(s) rebuilt\n", nb_reused, nb_rebuilt);
+	if (compress_resources && (total_size != 0)) {
+		printf("  %" PRIu64 " bytes compressed to %" PRIu64 " bytes (%d%%)\n", total_size,
+			total_compressed_size, (int)((100 * total_compressed_size) / total_size));
+	}
+	if (nb_dups > 0) {
+		printf("  %d duplicate file(s) embedded only once, saving %" PRIu64 " bytes\n", nb_dups, dups_size);
+	}
+	if (save_manifest(manifest_name) != 0) {
+		// Without a manifest, the next run will rebuild everything anyway
+		NATIVE_UNLINK(manifest_name);
+	}
 	ret = 0; goto out1;
 
-out4:
-	safe_free(buffer);
-out3:
-	fclose(fd);
 out2:
 	fclose(header_fd);
+	if (asm_fd != NULL)
+		fclose(asm_fd);
+	if (bin_fd != NULL)
+		fclose(bin_fd);
 	// Must delete a failed file so that Make can relaunch its build
 	// coverity[tainted_string]
-	NATIVE_UNLINK(argv[1]);
+	NATIVE_UNLINK(header_name);
+	NATIVE_UNLINK(manifest_name);
+	if (asm_name != NULL) {
+		NATIVE_UNLINK(asm_name);
+		NATIVE_UNLINK(bin_name);
+	}
 out1:
 #if defined(USER_DIR)
 	for (i=nb_embeddables_fixed; i<nb_embeddables; i++) {
@@ -488,7 +1630,16 @@ out1:
 		safe_free(embeddable);
 	}
 #endif
-	safe_free(file_size);
-	safe_free(file_time);
+	if (job != NULL) {
+		for (i=0; i<nb_jobs; i++) {
+			safe_free(job[i].data);
+			safe_free(job[i].hex);
+		}
+		safe_free(job);
+	}
+	free_manifest();
+	safe_free(old_header);
+	safe_free(manifest_name);
+	safe_free(bin_name);
 	return ret;
 }
@@ -27,6 +27,10 @@
  * use the --with-userdir option when running configure.
  */
 
+/*
+ * Files with identical content are automatically embedded only once, so
+ * reuse_last is only needed to extract the previous file under another name.
+ */
 struct emb {
 	int reuse_last;
 	char* file_name;
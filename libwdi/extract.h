@@ -0,0 +1,275 @@
+/*
+ * extract.h: parallel extraction of the embedded resources
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * This header has the parts of the extraction that don't depend on libwdi: a pool
+ * of threads that share a list of items, and the writing of one resource, either
+ * stored or LZ4 compressed, to a file. It uses Win32 on Windows, and POSIX otherwise,
+ * so that the same code can be benchmarked on Linux.
+ *
+ * Nothing here logs, as the pool threads must not use the logger. The errors are
+ * returned to the caller, which reports them.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+#include "lz4.h"
+
+// Size of the write buffer of each extraction thread (16 LZ4 chunks)
+#define EXTRACT_BUFFER_SIZE (16*LZ4_CHUNK_SIZE)
+#define EXTRACT_MAX_THREADS 4
+
+enum extract_error {
+	EXTRACT_SUCCESS = 0,
+	// The file could not be preallocated
+	EXTRACT_ERROR_ALLOCATE = -1,
+	EXTRACT_ERROR_WRITE = -2,
+	// The compressed data doesn't decompress to the expected size
+	EXTRACT_ERROR_CORRUPTED = -3
+};
+
+#if defined(_WIN32)
+typedef HANDLE extract_handle_t;
+#else
+typedef int extract_handle_t;
+#endif
+
+/*
+ * Called by the pool for each item, with the write buffer of the calling thread.
+ * Returns 0 on success. The first nonzero value stops the pool.
+ */
+typedef int (*extract_item_t)(void* context, int item, unsigned char* write_buffer);
+
+struct extract_pool {
+	extract_item_t process;
+	void* context;
+	int nb_items;
+#if defined(_WIN32)
+	volatile LONG next_item;
+	volatile LONG status;
+#else
+	volatile long next_item;
+	volatile long status;
+#endif
+};
+
+struct extract_worker {
+	struct extract_pool* pool;
+	unsigned char* write_buffer;
+};
+
+static __inline int extract_next_item(struct extract_pool* pool)
+{
+#if defined(_WIN32)
+	return (int)InterlockedIncrement(&pool->next_item) - 1;
+#else
+	return (int)__sync_fetch_and_add(&pool->next_item, 1);
+#endif
+}
+
+static __inline void extract_set_status(struct extract_pool* pool, int status)
+{
+#if defined(_WIN32)
+	InterlockedCompareExchange(&pool->status, status, 0);
+#else
+	__sync_val_compare_and_swap(&pool->status, 0, status);
+#endif
+}
+
+static __inline void extract_work(struct extract_worker* worker)
+{
+	struct extract_pool* pool = worker->pool;
+	int i, r;
+
+	// Stop picking up new items as soon as any of them failed
+	while ((pool->status == 0) && ((i = extract_next_item(pool)) < pool->nb_items)) {
+		r = pool->process(pool->context, i, worker->write_buffer);
+		if (r != 0)
+			extract_set_status(pool, r);
+	}
+}
+
+#if defined(_WIN32)
+static __inline DWORD WINAPI extract_worker_thread(LPVOID param)
+{
+	extract_work((struct extract_worker*)param);
+	return 0;
+}
+#else
+static __inline void* extract_worker_thread(void* param)
+{
+	extract_work((struct extract_worker*)param);
+	return NULL;
+}
+#endif
+
+// Number of threads to use for nb_items items
+static __inline int extract_nb_threads(int nb_items)
+{
+	int nb_cpus;
+#if defined(_WIN32)
+	SYSTEM_INFO si;
+
+	GetSystemInfo(&si);
+	nb_cpus = (int)si.dwNumberOfProcessors;
+#else
+	nb_cpus = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	if (nb_cpus > nb_items)
+		nb_cpus = nb_items;
+	if (nb_cpus > EXTRACT_MAX_THREADS)
+		nb_cpus = EXTRACT_MAX_THREADS;
+	return (nb_cpus < 1) ? 1 : nb_cpus;
+}
+
+/*
+ * Process items 0 to nb_items-1 with one thread per write buffer. The buffers, of
+ * EXTRACT_BUFFER_SIZE bytes, are allocated by the caller. If no thread can be created,
+ * the items are processed from the calling thread.
+ * Returns 0, or the first nonzero value returned by process.
+ */
+static __inline int extract_run(extract_item_t process, void* context, int nb_items,
+	unsigned char** write_buffers, int nb_threads)
+{
+	struct extract_pool pool;
+	struct extract_worker worker[EXTRACT_MAX_THREADS];
+#if defined(_WIN32)
+	HANDLE thread[EXTRACT_MAX_THREADS];
+#else
+	pthread_t thread[EXTRACT_MAX_THREADS];
+#endif
+	int i, nb_started = 0;
+
+	memset(&pool, 0, sizeof(pool));
+	pool.process = process;
+	pool.context = context;
+	pool.nb_items = nb_items;
+	if (nb_threads > EXTRACT_MAX_THREADS)
+		nb_threads = EXTRACT_MAX_THREADS;
+	for (i = 0; i < nb_threads; i++) {
+		worker[nb_started].pool = &pool;
+		worker[nb_started].write_buffer = write_buffers[i];
+#if defined(_WIN32)
+		thread[nb_started] = CreateThread(NULL, 0, extract_worker_thread, &worker[nb_started], 0, NULL);
+		if (thread[nb_started] == NULL)
+			continue;
+#else
+		if (pthread_create(&thread[nb_started], NULL, extract_worker_thread, &worker[nb_started]) != 0)
+			continue;
+#endif
+		nb_started++;
+	}
+	if (nb_started == 0) {
+		worker[0].pool = &pool;
+		worker[0].write_buffer = write_buffers[0];
+		extract_work(&worker[0]);
+	}
+	for (i = 0; i < nb_started; i++) {
+#if defined(_WIN32)
+		WaitForSingleObject(thread[i], INFINITE);
+		CloseHandle(thread[i]);
+#else
+		pthread_join(thread[i], NULL);
+#endif
+	}
+	return (int)pool.status;
+}
+
+static __inline int extract_write_all(extract_handle_t handle, const unsigned char* data, size_t size)
+{
+#if defined(_WIN32)
+	DWORD size_written;
+
+	return (WriteFile(handle, data, (DWORD)size, &size_written, NULL) && (size_written == size)) ? 0 : -1;
+#else
+	ssize_t r;
+
+	while (size > 0) {
+		r = write(handle, data, size);
+		if (r <= 0)
+			return -1;
+		data += r;
+		size -= (size_t)r;
+	}
+	return 0;
+#endif
+}
+
+/*
+ * Writes a resource of size bytes to handle, after preallocating the file to its final
+ * size, so that the file system can allocate it in one go. A resource with compressed_size
+ * set is decompressed chunk by chunk into write_buffer, which is written out whenever it
+ * can't hold another chunk. Others are written straight from data.
+ */
+static __inline int extract_to_handle(extract_handle_t handle, const unsigned char* data,
+	size_t compressed_size, size_t size, unsigned char* write_buffer)
+{
+	const unsigned char* src = data;
+	const unsigned char* src_end = data + compressed_size;
+	size_t written = 0, pos = 0, len;
+	int chunk_size;
+#if defined(_WIN32)
+	LARGE_INTEGER li;
+
+	li.QuadPart = (LONGLONG)size;
+	if ((!SetFilePointerEx(handle, li, NULL, FILE_BEGIN)) || (!SetEndOfFile(handle)))
+		return EXTRACT_ERROR_ALLOCATE;
+	li.QuadPart = 0;
+	if (!SetFilePointerEx(handle, li, NULL, FILE_BEGIN))
+		return EXTRACT_ERROR_ALLOCATE;
+#else
+	if (ftruncate(handle, (off_t)size) != 0)
+		return EXTRACT_ERROR_ALLOCATE;
+#endif
+
+	if (compressed_size == 0) {
+		while (written < size) {
+			len = size - written;
+			if (len > EXTRACT_BUFFER_SIZE)
+				len = EXTRACT_BUFFER_SIZE;
+			if (extract_write_all(handle, data + written, len) != 0)
+				return EXTRACT_ERROR_WRITE;
+			written += len;
+		}
+		return EXTRACT_SUCCESS;
+	}
+	while (src < src_end) {
+		chunk_size = lz4_decompress_chunk(&src, src_end, &write_buffer[pos], EXTRACT_BUFFER_SIZE - pos);
+		if ((chunk_size < 0) || (written + pos + chunk_size > size))
+			return EXTRACT_ERROR_CORRUPTED;
+		pos += chunk_size;
+		// Flush the buffer when it can't hold another chunk, or at the end
+		if ((pos > EXTRACT_BUFFER_SIZE - LZ4_CHUNK_SIZE) || (src >= src_end)) {
+			if (extract_write_all(handle, write_buffer, pos) != 0)
+				return EXTRACT_ERROR_WRITE;
+			written += pos;
+			pos = 0;
+		}
+	}
+	return (written == size) ? EXTRACT_SUCCESS : EXTRACT_ERROR_CORRUPTED;
+}
@@ -0,0 +1,67 @@
+/*
+ * inf_tags.h: tags of the inf and cat templates
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * The #TAG# placeholders of the *.inf.in and *.cat.in templates, that the tokenizer
+ * replaces with the values of the package. This is kept apart from libwdi_i.h so that
+ * the tokenizer benchmarks use the same tags as libwdi.c.
+ */
+#pragma once
+
+enum INF_TAGS
+{
+	INF_FILENAME,
+	CAT_FILENAME,
+	DEVICE_DESCRIPTION,
+	DEVICE_HARDWARE_ID,
+	DEVICE_INTERFACE_GUID,
+	DEVICE_MANUFACTURER,
+	DRIVER_DATE,
+	DRIVER_VERSION,
+	USE_DEVICE_INTERFACE_GUID,
+	WDF_VERSION,
+	KMDF_VERSION,
+	LK_COMMA,
+	LK_DLL,
+	LK_X86_DLL,
+	LK_EQ_X86,
+	LK_EQ_X64,
+	NB_INF_TAGS
+};
+
+static const char* inf_tags[NB_INF_TAGS+1] =
+{
+	"INF_FILENAME",
+	"CAT_FILENAME",
+	"DEVICE_DESCRIPTION",
+	"DEVICE_HARDWARE_ID",
+	"DEVICE_INTERFACE_GUID",
+	"DEVICE_MANUFACTURER",
+	"DRIVER_DATE",
+	"DRIVER_VERSION",
+	"USE_DEVICE_INTERFACE_GUID",
+	"WDF_VERSION",
+	"KMDF_VERSION",
+	"LK_COMMA",
+	"LK_DLL",
+	"LK_X86_DLL",
+	"LK_EQ_X86",
+	"LK_EQ_X64",
+	NULL // DO NOT REMOVE!
+};
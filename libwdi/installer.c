@@ -33,6 +33,7 @@
 #include "installer.h"
 #include "libwdi.h"
 #include "msapi_utf8.h"
+#include "device_id.h"
 
 // DDK complains about checking a const string against NULL...
 #if defined(DDKBUILD)
@@ -282,6 +283,11 @@ void check_removed(char* device_hardware_id)
 	HDEVINFO dev_info;
 	SP_DEVINFO_DATA dev_info_data;
 	char hardware_id[STR_BUFFER_SIZE];
+	struct wdi_device_id id, device_id;
+	BOOL has_id;
+
+	// Hardware IDs are not case sensitive, so we compare their fields when we can
+	has_id = (parse_device_id(device_hardware_id, &device_id) == WDI_SUCCESS) && (device_id.has_vid);
 
 	// List all known USB devices (including non present ones)
 	dev_info = SetupDiGetClassDevsA(NULL, "USB", NULL, DIGCF_ALLCLASSES);
@@ -304,7 +310,12 @@ void check_removed(char* device_hardware_id)
 		}
 
 		// Match?
-		if (safe_strncmp(hardware_id, device_hardware_id, STR_BUFFER_SIZE) != 0) {
+		if (has_id) {
+			if ( (parse_device_id(hardware_id, &id) != WDI_SUCCESS)
+			  || (!is_same_device_id(&id, &device_id)) ) {
+				continue;
+			}
+		} else if (safe_stricmp(hardware_id, device_hardware_id) != 0) {
 			continue;
 		}
 
@@ -45,6 +45,16 @@
 #include "logging.h"
 #include "tokenizer.h"
 #include "embedded.h"	// auto-generated during compilation
+#include "resource_index.h"
+#include "lz4.h"
+#include "xxhash.h"
+#include "extract.h"
+#include "utf16le.h"
+#include "usb_ids.h"
+#include "usb_ids_versions.h"
+#include "device_source.h"
+#include "device_id.h"
+#include "device_list.h"
 #include "msapi_utf8.h"
 #include "stdfn.h"
 
@@ -53,11 +63,23 @@ static struct wdi_device_info *current_device = NULL;
 static BOOL filter_driver = FALSE;
 static DWORD timeout = DEFAULT_TIMEOUT;
 static HANDLE pipe_handle = INVALID_HANDLE_VALUE;
-static VS_FIXEDFILEINFO driver_version[WDI_NB_DRIVERS-1] = { {0}, {0}, {0}, {0} };
+// Compiled on first use, for the lifetime of the library, and never modified afterwards
+static token_matcher_t* inf_matcher = NULL;
+static token_template_t* inf_compiled[WDI_NB_DRIVERS-1] = { NULL, NULL, NULL, NULL };
+static token_template_t* cat_compiled[WDI_NB_DRIVERS-1] = { NULL, NULL, NULL, NULL };
 static const char* driver_name[WDI_NB_DRIVERS-1] = {"winusbcoinstaller2.dll", "libusb0.sys", "libusbK.sys", ""};
 static const char* inf_template[WDI_NB_DRIVERS-1] = {"winusb.inf.in", "libusb0.inf.in", "libusbk.inf.in", "usbser.inf.in"};
 static const char* cat_template[WDI_NB_DRIVERS-1] = {"winusb.cat.in", "libusb0.cat.in", "libusbk.cat.in", "usbser.cat.in"};
 static const char* ms_compat_id[WDI_NB_DRIVERS-1] = {"MS_COMP_WINUSB", "MS_COMP_LIBUSB0", "MS_COMP_LIBUSBK", "MS_COMP_USBSER"};
+// usb.ids file loaded with wdi_load_usb_ids(), and its versions, see usb_ids_versions.h
+static struct usb_ids_versions usb_ids = { NULL, NULL, 0 };
+static volatile LONG usb_ids_checking = 0;
+static DWORD usb_ids_check_time = 0;
+// Vendor names index of the built-in table, built on first use
+static struct usb_ids_index* builtin_index = NULL;
+// Snapshot loaded with wdi_load_device_snapshot(), that replaces the system devices
+static struct device_snapshot* device_snapshot = NULL;
+static char* device_snapshot_data = NULL;
 int nWindowsVersion = WINDOWS_UNDEFINED;
 char WindowsVersionStr[128] = "Windows ";
 
@@ -189,7 +211,7 @@ void GetWindowsVersion(void)
  */
 char *windows_error_str(uint32_t retval)
 {
-static char err_string[STR_BUFFER_SIZE];
+static THREAD_LOCAL char err_string[STR_BUFFER_SIZE];
 
 	DWORD size;
 	size_t i;
@@ -353,37 +375,17 @@ static int check_dir(const char* path, BOOL create)
 }
 
 /*
- * fopen equivalent, that uses CreateFile with security attributes
- * to create file as the user of the application. Supports UTF-8.
+ * CreateFile equivalent, that uses security attributes to create
+ * the file as the user of the application. Supports UTF-8.
  */
-static FILE *fopen_as_userU(const char *filename, const char *mode)
+static HANDLE create_file_as_userU(const char *filename, DWORD access_mode)
 {
 	HANDLE handle;
-	size_t i;
-	DWORD access_mode = 0;
 	SECURITY_ATTRIBUTES *ps = NULL;
-	int lowlevel_fd;
 	PSID sid = NULL;
 	SECURITY_ATTRIBUTES s_attr;
 	SECURITY_DESCRIPTOR s_desc;
 
-	if ((filename == NULL) || (mode == NULL)) {
-		return NULL;
-	}
-
-	// Simple mode handling.
-	for (i=0; i<strlen(mode); i++) {
-		if (mode[i] == 'r') {
-			access_mode |= GENERIC_READ;
-		} else if (mode[i] == 'w') {
-			access_mode |= GENERIC_WRITE;
-		}
-	}
-	if (!(access_mode & GENERIC_WRITE)) {
-		// If the file is not used for writing, might as well use fopen
-		return NULL;
-	}
-
 	// Change the owner from admin to regular user
 	sid = GetSid();
 	if ( (sid != NULL)
@@ -400,119 +402,120 @@ static FILE *fopen_as_userU(const char *filename, const char *mode)
 	handle = CreateFileU(filename, access_mode, FILE_SHARE_READ,
 		ps, CREATE_ALWAYS, 0, NULL);
 	if (sid != NULL) LocalFree(sid);
-
-	if (handle == INVALID_HANDLE_VALUE) {
-		return NULL;
-	}
-
-	lowlevel_fd = _open_osfhandle((intptr_t)handle,
-		(access_mode&GENERIC_READ)?_O_RDWR:_O_WRONLY);
-	return _fdopen(lowlevel_fd, mode);
+	return handle;
 }
 
+/*
+ * Returns the index of the embedded resource called name, in subdir, or -1 if
+ * not found. If subdir is NULL, the first resource with that name is returned.
+ * This uses a binary search over the resource_index[] generated by the embedder.
+ */
+static int find_resource(const char* subdir, const char* name)
+{
+	return resource_index_find(resource, resource_index, nb_resources, subdir, name);
+}
 
-// Retrieve the version info from the WinUSB, libusbK or libusb0 drivers
-int get_version_info(int driver_type, VS_FIXEDFILEINFO* driver_info)
+/*
+ * Returns the precomputed SHA1 .cat hash of the embedded file that was extracted
+ * to subdir\name, or NULL if there's no such file, or if the size of the file on
+ * disk doesn't match. This is used by CreateCat(), to avoid hashing these again.
+ * Only the files that extract_binaries() flagged in extracted, because it wrote
+ * them or checked their content, qualify. Any other file with the same name, such
+ * as one that was modified after an earlier extraction, must be hashed.
+ */
+const uint8_t* get_embedded_cat_hash(const uint8_t* extracted, const char* subdir, const char* name, uint64_t size)
 {
-	// Version (avoids linking against version.lib)
-	PF_DECL_LOAD_LIBRARY(Version);
-	PF_TYPE_DECL(WINAPI, BOOL, VerQueryValueW, (LPCVOID, LPWSTR, LPVOID, PUINT));
-	PF_TYPE_DECL(WINAPI, BOOL, GetFileVersionInfoW, (LPWSTR, DWORD, DWORD, LPVOID));
-	PF_TYPE_DECL(WINAPI, BOOL, GetFileVersionInfoSizeW, (LPWSTR, LPDWORD));
-	FILE *fd;
-	int res, r;
-	char* tmpdir;
-	char filename[MAX_PATH];
-	wchar_t *wfilename;
-	int64_t t;
-	DWORD version_size;
-	void* version_buf;
-	UINT junk;
-	VS_FIXEDFILEINFO *file_info;
+	int res;
 
-	if ((driver_type < 0) || (driver_type >= WDI_USER) || (driver_info == NULL)) {
-		r = WDI_ERROR_INVALID_PARAM;
-		goto out;
+	if (extracted == NULL) {
+		return NULL;
 	}
-
-	// No need to extract the version again if available
-	if (driver_version[driver_type].dwSignature != 0) {
-		memcpy(driver_info, &driver_version[driver_type], sizeof(VS_FIXEDFILEINFO));
-		r = WDI_SUCCESS;
-		goto out;
+	// Files from the root of the extraction directory use "." as their subdir
+	res = find_resource(((subdir == NULL) || (subdir[0] == 0)) ? "." : subdir, name);
+	if ((res < 0) || (!extracted[res]) || ((uint64_t)resource[res].size != size)) {
+		return NULL;
 	}
+	return resource[res].sha1;
+}
 
-	// Avoid the need for end user apps to link against version.lib
-	r = WDI_ERROR_RESOURCE;
-	PF_INIT_OR_OUT(VerQueryValueW, Version);
-	PF_INIT_OR_OUT(GetFileVersionInfoW, Version);
-	PF_INIT_OR_OUT(GetFileVersionInfoSizeW, Version);
+/*
+ * Returns the data of an embedded resource, decompressing it if needed into
+ * *buffer, which is (re)allocated as required, so that it can be reused by
+ * successive calls. *buffer must be freed by the caller. Returns NULL on error.
+ */
+static const unsigned char* get_resource_data(int res, unsigned char** buffer, size_t* buffer_size)
+{
+	unsigned char* new_buffer;
 
-	for (res=0; res<nb_resources; res++) {
-		// Identify the WinUSB and libusb0 files we'll pick the date & version of
-		if (safe_strcmp(resource[res].name, driver_name[driver_type]) == 0) {
-			break;
+	if (resource[res].compressed_size == 0) {
+		return resource[res].data;
+	}
+	if (*buffer_size < resource[res].size) {
+		new_buffer = (unsigned char*)realloc(*buffer, resource[res].size);
+		if (new_buffer == NULL) {
+			wdi_err("could not allocate buffer for '%s'", resource[res].name);
+			return NULL;
 		}
+		*buffer = new_buffer;
+		*buffer_size = resource[res].size;
 	}
-	if (res == nb_resources) {
-		r = WDI_ERROR_NOT_FOUND;
-		goto out;
+	if (lz4_decompress_chunks(resource[res].data, resource[res].compressed_size,
+		*buffer, resource[res].size) != (int)resource[res].size) {
+		wdi_err("embedded resource '%s' is corrupted", resource[res].name);
+		return NULL;
 	}
+	return *buffer;
+}
 
-	// First, we need a physical file => extract it
-	tmpdir = getenvU("TEMP");
-	if (tmpdir == NULL) {
-		wdi_warn("unable to use TEMP to extract file");
-		r = WDI_ERROR_RESOURCE;
-		goto out;
-	}
-	r = check_dir(tmpdir, TRUE);
-	if (r != WDI_SUCCESS) {
-		free(tmpdir);
-		goto out;
+/*
+ * Writes an embedded resource to handle, through write_buffer, which must be
+ * EXTRACT_BUFFER_SIZE bytes
+ */
+static int write_resource(int res, HANDLE handle, unsigned char* write_buffer)
+{
+	switch (extract_to_handle(handle, resource[res].data, resource[res].compressed_size,
+		resource[res].size, write_buffer)) {
+	case EXTRACT_SUCCESS:
+		return WDI_SUCCESS;
+	case EXTRACT_ERROR_ALLOCATE:
+		wdi_err("could not allocate %" PRIu64 " bytes for '%s' (%s)", (uint64_t)resource[res].size,
+			resource[res].name, windows_error_str(0));
+		return WDI_ERROR_RESOURCE;
+	case EXTRACT_ERROR_CORRUPTED:
+		wdi_err("embedded resource '%s' is corrupted", resource[res].name);
+		return WDI_ERROR_RESOURCE;
+	default:
+		return WDI_ERROR_RESOURCE;
 	}
+}
 
-	safe_strcpy(filename, MAX_PATH, tmpdir);
-	free(tmpdir);
-	safe_strcat(filename, MAX_PATH, "\\");
-	if (resource[res].name != NULL)	// Stupid Clang!
-		safe_strcat(filename, MAX_PATH, resource[res].name);
+// Retrieve the version info from the WinUSB, libusbK or libusb0 drivers
+// The VS_FIXEDFILEINFO is extracted by the embedder, when the library is built
+int get_version_info(int driver_type, VS_FIXEDFILEINFO* driver_info)
+{
+	int res;
+	int64_t t;
 
-	fd = fopen_as_userU(filename, "w");
-	if (fd == NULL) {
-		wdi_warn("failed to create file '%s' (%s)", filename, windows_error_str(0));
-		r = WDI_ERROR_RESOURCE;
-		goto out;
+	if ((driver_type < 0) || (driver_type >= WDI_USER) || (driver_info == NULL)) {
+		return WDI_ERROR_INVALID_PARAM;
 	}
 
-	fwrite(resource[res].data, 1, resource[res].size, fd);
-	fclose(fd);
-
-	// Read the version
-	wfilename = utf8_to_wchar(filename);
-	version_size = pfGetFileVersionInfoSizeW(wfilename, NULL);
-	version_buf = malloc(version_size);
-	r = WDI_SUCCESS;
-	if ( (version_buf != NULL)
-	  && (pfGetFileVersionInfoW(wfilename, 0, version_size, version_buf))
-	  && (pfVerQueryValueW(version_buf, L"\\", (void*)&file_info, &junk)) ) {
-		// Fill the creation date of VS_FIXEDFILEINFO with the one from embedded.h
-		t = unixtime_to_msfiletime((time_t)resource[res].creation_time);
-		file_info->dwFileDateLS = (DWORD)t;
-		file_info->dwFileDateMS = t >> 32;
-		memcpy(&driver_version[driver_type], file_info, sizeof(VS_FIXEDFILEINFO));
-		memcpy(driver_info, file_info, sizeof(VS_FIXEDFILEINFO));
-	} else {
-		wdi_warn("unable to allocate buffer for version info");
-		r = WDI_ERROR_RESOURCE;
+	// Identify the WinUSB and libusb0 files we'll pick the date & version of
+	res = find_resource(NULL, driver_name[driver_type]);
+	if (res < 0) {
+		return WDI_ERROR_NOT_FOUND;
+	}
+	if (resource[res].version_info == NULL) {
+		wdi_warn("no version info for '%s'", resource[res].name);
+		return WDI_ERROR_RESOURCE;
 	}
-	safe_free(wfilename);
-	safe_free(version_buf);
-	DeleteFileU(filename);
 
-out:
-	PF_FREE_LIBRARY(Version);
-	return r;
+	memcpy(driver_info, resource[res].version_info, sizeof(VS_FIXEDFILEINFO));
+	// Fill the creation date of VS_FIXEDFILEINFO with the one from embedded.h
+	t = unixtime_to_msfiletime((time_t)resource[res].creation_time);
+	driver_info->dwFileDateLS = (DWORD)t;
+	driver_info->dwFileDateMS = t >> 32;
+	return WDI_SUCCESS;
 }
 
 
@@ -568,19 +571,268 @@ BOOL LIBWDI_API wdi_is_driver_supported(int driver_type, VS_FIXEDFILEINFO* drive
  */
 BOOL LIBWDI_API wdi_is_file_embedded(const char* path, const char* name)
 {
-	int i;
+	return (find_resource(path, name) >= 0);
+}
 
-	for (i=0; i<nb_resources; i++) {
-		if (safe_strcmp(name, resource[i].name) == 0) {
-			if (path == NULL) {
-				return TRUE;
-			}
-			if (safe_strcmp(path, resource[i].subdir) == 0) {
-				return TRUE;
+// Read a whole file, with a NUL terminator, and optionally its last write time
+static int read_file(const char* path, LONGLONG max_size, char** data, DWORD* data_size,
+	FILETIME* last_write_time)
+{
+	int r = WDI_ERROR_RESOURCE;
+	HANDLE handle;
+	LARGE_INTEGER size;
+	DWORD nb_read;
+	char* buf = NULL;
+
+	// Don't prevent the file from being updated, as we may look for changes
+	handle = CreateFileU(path, GENERIC_READ, FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE,
+		NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (handle == INVALID_HANDLE_VALUE) {
+		wdi_err("could not open '%s': %s", path, windows_error_str(0));
+		return WDI_ERROR_NOT_FOUND;
+	}
+	if ( (!GetFileSizeEx(handle, &size))
+	  || ((last_write_time != NULL) && (!GetFileTime(handle, NULL, NULL, last_write_time))) ) {
+		wdi_err("could not get the size of '%s': %s", path, windows_error_str(0));
+		r = WDI_ERROR_IO;
+		goto out;
+	}
+	if (size.QuadPart > max_size) {
+		wdi_err("'%s' is too large", path);
+		r = WDI_ERROR_OVERFLOW;
+		goto out;
+	}
+	// Read the whole file at once, with room for a NUL terminator
+	buf = (char*)malloc((size_t)size.QuadPart + 1);
+	if (buf == NULL) {
+		goto out;
+	}
+	if ( (!ReadFile(handle, buf, size.LowPart, &nb_read, NULL)) || (nb_read != size.LowPart) ) {
+		wdi_err("could not read '%s': %s", path, windows_error_str(0));
+		r = WDI_ERROR_IO;
+		goto out;
+	}
+	buf[nb_read] = 0;
+	*data = buf;
+	*data_size = nb_read;
+	buf = NULL;
+	r = WDI_SUCCESS;
+
+out:
+	safe_free(buf);
+	CloseHandle(handle);
+	return r;
+}
+
+// Read and index a usb.ids file
+static int read_usb_ids(const char* path, struct usb_ids_file** file)
+{
+	int r, l;
+	DWORD size;
+	struct usb_ids_file* f;
+
+	f = (struct usb_ids_file*)calloc(1, sizeof(struct usb_ids_file));
+	if (f == NULL) {
+		return WDI_ERROR_RESOURCE;
+	}
+	r = read_file(path, USB_IDS_MAX_SIZE, &f->data, &size, &f->last_write_time);
+	if (r != WDI_SUCCESS) {
+		goto out;
+	}
+	r = WDI_ERROR_RESOURCE;
+	// Each version has its own copy of the path, that is reloaded while it is in use
+	f->path = safe_strdup(path);
+	if (f->path == NULL) {
+		goto out;
+	}
+	l = usb_ids_parse(f->data, size, &f->table);
+	if (l < 0) {
+		goto out;
+	}
+	if (l > 0) {
+		wdi_err("'%s' is not sorted at line %d", path, l);
+		r = WDI_ERROR_INVALID_PARAM;
+		goto out;
+	}
+	if (usb_ids_build_index(&f->table, &f->index) != 0) {
+		usb_ids_free(&f->table);
+		goto out;
+	}
+	wdi_info("loaded %d vendors, %d products and %d classes from '%s'", (int)f->table.nb_vendors,
+		(int)f->table.nb_products, (int)f->table.nb_classes, path);
+	*file = f;
+	f = NULL;
+	r = WDI_SUCCESS;
+
+out:
+	if (f != NULL) {
+		safe_free(f->data);
+		safe_free(f->path);
+		free(f);
+	}
+	return r;
+}
+
+// Return the loaded usb.ids, if any, after reloading it if it was modified, and count the
+// caller as one of its users, until it calls usb_ids_release()
+// The file is only checked once every USB_IDS_CHECK_INTERVAL ms, by a single thread
+static struct usb_ids_file* get_usb_ids(void)
+{
+	struct usb_ids_file *file, *new_file;
+	WIN32_FILE_ATTRIBUTE_DATA attr;
+	DWORD now = GetTickCount();
+
+	file = usb_ids_acquire(&usb_ids);
+	if (file == NULL) {
+		return NULL;
+	}
+	if ( (now - usb_ids_check_time >= USB_IDS_CHECK_INTERVAL)
+	  && (InterlockedCompareExchange(&usb_ids_checking, 1, 0) == 0) ) {
+		usb_ids_check_time = now;
+		if ( (GetFileAttributesExU(file->path, GetFileExInfoStandard, &attr))
+		  && (CompareFileTime(&attr.ftLastWriteTime, &file->last_write_time) != 0) ) {
+			wdi_info("'%s' was modified - reloading", file->path);
+			// If the file can't be read, e.g. because it is being written, we'll try again later
+			if (read_usb_ids(file->path, &new_file) == WDI_SUCCESS) {
+				if (usb_ids_add_version(&usb_ids, new_file, file)) {
+					usb_ids_release(file);
+					file = usb_ids_acquire(&usb_ids);
+				} else {
+					// The file was loaded again, or unloaded, in the meantime
+					usb_ids_free_file(new_file);
+				}
 			}
 		}
+		InterlockedExchange(&usb_ids_checking, 0);
 	}
-	return FALSE;
+	return file;
+}
+
+/*
+ * Load a usb.ids file, that takes precedence over the built-in names,
+ * or unload it if path is NULL
+ */
+int LIBWDI_API wdi_load_usb_ids(const char* path)
+{
+	int r;
+	struct usb_ids_file* file = NULL;
+
+	if (path != NULL) {
+		r = read_usb_ids(path, &file);
+		if (r != WDI_SUCCESS) {
+			return r;
+		}
+	}
+	usb_ids_check_time = GetTickCount();
+	usb_ids_replace(&usb_ids, file);
+	return WDI_SUCCESS;
+}
+
+const char* LIBWDI_API wdi_get_vendor_name(unsigned short vid)
+{
+	struct usb_ids_file* file = get_usb_ids();
+	const char* name = NULL;
+
+	if (file != NULL) {
+		name = usb_ids_vendor_name(&file->table, vid);
+		usb_ids_release(file);
+	}
+	return (name != NULL) ? name : usb_ids_vendor_name(&usb_ids_builtin, vid);
+}
+
+const char* LIBWDI_API wdi_get_product_name(unsigned short vid, unsigned short pid)
+{
+	struct usb_ids_file* file = get_usb_ids();
+	const char* name = NULL;
+
+	if (file != NULL) {
+		name = usb_ids_product_name(&file->table, vid, pid);
+		usb_ids_release(file);
+	}
+	return (name != NULL) ? name : usb_ids_product_name(&usb_ids_builtin, vid, pid);
+}
+
+const char* LIBWDI_API wdi_get_class_name(int class_code, int subclass, int protocol)
+{
+	struct usb_ids_file* file = get_usb_ids();
+	const char* name = NULL;
+
+	if (file != NULL) {
+		name = usb_ids_class_name(&file->table, class_code, subclass, protocol);
+		usb_ids_release(file);
+	}
+	return (name != NULL) ? name : usb_ids_class_name(&usb_ids_builtin, class_code, subclass, protocol);
+}
+
+static int compare_vendor_matches(const void* a, const void* b)
+{
+	uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+
+	return (x > y) - (x < y);
+}
+
+/*
+ * Find the vendors which name contains pattern, best matches first
+ */
+int LIBWDI_API wdi_find_vendors(const char* pattern, unsigned short* vids, int max_vids)
+{
+	struct usb_ids_file* file;
+	struct usb_ids_index* index;
+	uint32_t* match;
+	char* lowercase;
+	size_t i, n = 0, nb_loaded, nb_builtin;
+
+	if ((pattern == NULL) || (max_vids < 0) || ((vids == NULL) && (max_vids != 0))) {
+		return WDI_ERROR_INVALID_PARAM;
+	}
+	if (pattern[0] == 0) {
+		return 0;
+	}
+	if (builtin_index == NULL) {
+		index = (struct usb_ids_index*)malloc(sizeof(struct usb_ids_index));
+		if ((index == NULL) || (usb_ids_build_index(&usb_ids_builtin, index) != 0)) {
+			safe_free(index);
+			return WDI_ERROR_RESOURCE;
+		}
+		if (InterlockedCompareExchangePointer((PVOID*)&builtin_index, index, NULL) != NULL) {
+			usb_ids_free_index(index);
+			free(index);
+		}
+	}
+
+	file = get_usb_ids();
+	lowercase = safe_strdup(pattern);
+	match = (uint32_t*)malloc((usb_ids_builtin.nb_vendors + ((file != NULL) ? file->table.nb_vendors : 0) + 1) * sizeof(uint32_t));
+	if ((lowercase == NULL) || (match == NULL)) {
+		usb_ids_release(file);
+		safe_free(lowercase);
+		safe_free(match);
+		return WDI_ERROR_RESOURCE;
+	}
+	for (i = 0; lowercase[i] != 0; i++) {
+		lowercase[i] = (char)USB_IDS_TOLOWER(lowercase[i]);
+	}
+
+	if (file != NULL) {
+		n = usb_ids_find_vendors(&file->table, &file->index, lowercase, match);
+	}
+	nb_loaded = n;
+	nb_builtin = usb_ids_find_vendors(&usb_ids_builtin, builtin_index, lowercase, &match[nb_loaded]);
+	for (i = nb_loaded; i < nb_loaded + nb_builtin; i++) {
+		// The built-in names of the vendors from the usb.ids file are not used
+		if ((file == NULL) || (usb_ids_vendor_name(&file->table, (uint16_t)match[i]) == NULL)) {
+			match[n++] = match[i];
+		}
+	}
+	qsort(match, n, sizeof(uint32_t), compare_vendor_matches);
+	for (i = 0; (i < n) && (i < (size_t)max_vids); i++) {
+		vids[i] = (unsigned short)match[i];
+	}
+
+	usb_ids_release(file);
+	free(lowercase);
+	free(match);
+	return (int)i;
 }
 
 /*
@@ -646,10 +898,9 @@ const char* LIBWDI_API wdi_strerror(int error_code)
 }
 
 // convert a GUID to an hex GUID string
-static char* guid_to_string(const GUID guid)
+// guid_string must be at least MAX_GUID_STRING_LENGTH
+static char* guid_to_string(const GUID guid, char* guid_string)
 {
-	static char guid_string[MAX_GUID_STRING_LENGTH];
-
 	sprintf(guid_string, "{%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X}",
 		(unsigned int)guid.Data1, guid.Data2, guid.Data3,
 		guid.Data4[0], guid.Data4[1], guid.Data4[2], guid.Data4[3],
@@ -657,47 +908,223 @@ static char* guid_to_string(const GUID guid)
 	return guid_string;
 }
 
-// free a device info struct
-static void free_di(struct wdi_device_info *di)
+// The lists from wdi_create_list() that are live, see device_list.h
+static struct device_lists device_lists = { NULL, 0 };
+
+// Devices of the system, read through SetupAPI and Cfgmgr32
+PF_TYPE(WINAPI, CONFIGRET, CM_Get_Device_IDA, (DEVINST, PCHAR, ULONG, ULONG));
+struct setupapi_context {
+	HDEVINFO dev_info;
+	SP_DEVINFO_DATA dev_info_data;
+	HANDLE hCfgmgr32;
+	CM_Get_Device_IDA_t pfCM_Get_Device_IDA;
+};
+
+static void* setupapi_open(void* param)
+{
+	PF_DECL_LIBRARY(Cfgmgr32);
+	PF_DECL(CM_Get_Device_IDA);
+	struct setupapi_context* ctx;
+
+	PF_LOAD_LIBRARY(Cfgmgr32);
+	PF_INIT_OR_OUT(CM_Get_Device_IDA, Cfgmgr32);
+	ctx = (struct setupapi_context*)calloc(1, sizeof(struct setupapi_context));
+	if (ctx == NULL) {
+		goto out;
+	}
+	// List all connected USB devices
+	ctx->dev_info = SetupDiGetClassDevsA(NULL, "USB", NULL, DIGCF_PRESENT|DIGCF_ALLCLASSES);
+	if (ctx->dev_info == INVALID_HANDLE_VALUE) {
+		free(ctx);
+		goto out;
+	}
+	ctx->hCfgmgr32 = hCfgmgr32;
+	ctx->pfCM_Get_Device_IDA = pfCM_Get_Device_IDA;
+	return ctx;
+
+out:
+	PF_FREE_LIBRARY(Cfgmgr32);
+	return NULL;
+}
+
+static void setupapi_close(void* context)
+{
+	struct setupapi_context* ctx = (struct setupapi_context*)context;
+
+	SetupDiDestroyDeviceInfoList(ctx->dev_info);
+	FreeLibrary(ctx->hCfgmgr32);
+	free(ctx);
+}
+
+static int setupapi_get_devnode(void* context, unsigned int index)
+{
+	struct setupapi_context* ctx = (struct setupapi_context*)context;
+
+	ctx->dev_info_data.cbSize = sizeof(ctx->dev_info_data);
+	return SetupDiEnumDeviceInfo(ctx->dev_info, index, &ctx->dev_info_data);
+}
+
+static int setupapi_get_property(void* context, enum device_property property, char* buf, size_t size)
 {
-	if (di == NULL) {
-		return;
-	}
-	safe_free(di->desc);
-	safe_free(di->driver);
-	safe_free(di->device_id);
-	safe_free(di->hardware_id);
-	safe_free(di->compatible_id);
-	safe_free(di->upper_filter);
-	safe_free(di);
+	struct setupapi_context* ctx = (struct setupapi_context*)context;
+	wchar_t desc[MAX_DESC_LENGTH];
+	DWORD reg_type, spdrp, value_size;
+	ULONG devprop_type;
+	HKEY key;
+	LONG r;
+
+	switch (property) {
+	case DEVICE_PROPERTY_DRIVER_VERSION:
+		key = SetupDiOpenDevRegKey(ctx->dev_info, &ctx->dev_info_data, DICS_FLAG_GLOBAL, 0, DIREG_DRV, KEY_READ);
+		if (key == INVALID_HANDLE_VALUE) {
+			return 0;
+		}
+		// The value is not necessarily NUL terminated
+		value_size = (DWORD)size - 1;
+		r = RegQueryValueExA(key, "DriverVersion", NULL, &reg_type, (BYTE*)buf, &value_size);
+		RegCloseKey(key);
+		if ((r != ERROR_SUCCESS) || (reg_type != REG_SZ)) {
+			return 0;
+		}
+		buf[value_size] = 0;
+		return 1;
+	// The descriptions are read as UTF-16, as they may not be representable in the system codepage
+	case DEVICE_PROPERTY_BUS_DESC:
+		return SetupDiGetDevicePropertyW(ctx->dev_info, &ctx->dev_info_data, &DEVPKEY_Device_BusReportedDeviceDesc,
+			&devprop_type, (BYTE*)desc, sizeof(desc), NULL, 0) && (wchar_to_utf8_no_alloc(desc, buf, (int)size) != 0);
+	case DEVICE_PROPERTY_DESC:
+		return SetupDiGetDeviceRegistryPropertyW(ctx->dev_info, &ctx->dev_info_data, SPDRP_DEVICEDESC,
+			&reg_type, (BYTE*)desc, sizeof(desc), NULL) && (wchar_to_utf8_no_alloc(desc, buf, (int)size) != 0);
+	case DEVICE_PROPERTY_DRIVER:
+		spdrp = SPDRP_DRIVER;
+		break;
+	case DEVICE_PROPERTY_SERVICE:
+		spdrp = SPDRP_SERVICE;
+		break;
+	case DEVICE_PROPERTY_HARDWARE_ID:
+		spdrp = SPDRP_HARDWAREID;
+		break;
+	case DEVICE_PROPERTY_COMPATIBLE_ID:
+		spdrp = SPDRP_COMPATIBLEIDS;
+		break;
+	case DEVICE_PROPERTY_UPPER_FILTER:
+		spdrp = SPDRP_UPPERFILTERS;
+		break;
+	default:
+		return 0;
+	}
+	// For REG_MULTI_SZ, the first string is what we get as a regular string
+	return SetupDiGetDeviceRegistryPropertyA(ctx->dev_info, &ctx->dev_info_data, spdrp,
+		&reg_type, (BYTE*)buf, (DWORD)size, NULL);
+}
+
+static int setupapi_get_device_id(void* context, char* buf, size_t size)
+{
+	struct setupapi_context* ctx = (struct setupapi_context*)context;
+
+	return (ctx->pfCM_Get_Device_IDA(ctx->dev_info_data.DevInst, buf, (ULONG)size, 0) == CR_SUCCESS);
+}
+
+static const struct device_source device_system = {
+	setupapi_open,
+	setupapi_close,
+	setupapi_get_devnode,
+	setupapi_get_property,
+	setupapi_get_device_id
+};
+
+/*
+ * Replace the devices of the system with the ones of a snapshot, in the device list,
+ * or restore them if path is NULL
+ */
+int LIBWDI_API wdi_load_device_snapshot(const char* path, unsigned int latency)
+{
+	int r, l;
+	DWORD size;
+	char* data = NULL;
+	struct device_snapshot* snapshot = NULL;
+
+	if (path != NULL) {
+		snapshot = (struct device_snapshot*)calloc(1, sizeof(struct device_snapshot));
+		if (snapshot == NULL) {
+			return WDI_ERROR_RESOURCE;
+		}
+		r = read_file(path, DEVICE_SNAPSHOT_MAX_SIZE, &data, &size, NULL);
+		if (r != WDI_SUCCESS) {
+			free(snapshot);
+			return r;
+		}
+		l = device_snapshot_parse(data, size, snapshot);
+		if (l != 0) {
+			r = WDI_ERROR_RESOURCE;
+			if (l > 0) {
+				wdi_err("'%s' is invalid at line %d", path, l);
+				r = WDI_ERROR_INVALID_PARAM;
+			}
+			free(data);
+			free(snapshot);
+			return r;
+		}
+		snapshot->latency = latency;
+		wdi_info("loaded %d devices from '%s'", (int)snapshot->nb_devices, path);
+	}
+	if (device_snapshot != NULL) {
+		device_snapshot_free(device_snapshot);
+		free(device_snapshot);
+	}
+	safe_free(device_snapshot_data);
+	device_snapshot = snapshot;
+	device_snapshot_data = data;
+	return WDI_SUCCESS;
+}
+
+// Record the devices of the system to a snapshot
+int LIBWDI_API wdi_save_device_snapshot(const char* path)
+{
+	int r = WDI_SUCCESS;
+	void* context;
+	FILE* fd;
+
+	if (path == NULL) {
+		return WDI_ERROR_INVALID_PARAM;
+	}
+	context = device_system.open(NULL);
+	if (context == NULL) {
+		return WDI_ERROR_NO_DEVICE;
+	}
+	fd = fopenU(path, "w");
+	if (fd == NULL) {
+		wdi_err("could not create '%s'", path);
+		device_system.close(context);
+		return WDI_ERROR_ACCESS;
+	}
+	if ((device_snapshot_write(fd, &device_system, context) != 0) | (fclose(fd) != 0)) {
+		wdi_err("could not write '%s'", path);
+		r = WDI_ERROR_IO;
+	}
+	device_system.close(context);
+	return r;
 }
 
 // List USB devices
 int LIBWDI_API wdi_create_list(struct wdi_device_info** list,
 							   struct wdi_options_create_list* options)
 {
-	PF_DECL_LIBRARY(Cfgmgr32);
-	PF_TYPE_DECL(WINAPI, CONFIGRET, CM_Get_Device_IDA, (DEVINST, PCHAR, ULONG, ULONG));
-
 	int r;
-	unsigned i, j, tmp;
+	unsigned i;
 	unsigned unknown_count = 1;
-	DWORD size, reg_type;
-	ULONG devprop_type;
-	CONFIGRET cr;
-	HDEVINFO dev_info;
-	SP_DEVINFO_DATA dev_info_data;
-	HKEY key;
-	char *prefix[3] = {"VID_", "PID_", "MI_"};
+	const struct device_source* source = (device_snapshot != NULL) ? &device_replay : &device_system;
+	void* context;
 	char *token, *end;
 	char strbuf[STR_BUFFER_SIZE], drv_version[] = "xxxxx.xxxxx.xxxxx.xxxxx";
-	wchar_t desc[MAX_DESC_LENGTH];
-	struct wdi_device_info *start = NULL, *cur = NULL, *device_info = NULL;
-	// NOTE: Don't forget to update the list of hubs in zadig.c (system_name[]) when adding new entries below
-	const char* usbhub_name[] = { "usbhub", "usbhub3", "usb3hub", "nusb3hub", "rusb3hub", "flxhcih", "tihub3",
-		"etronhub3", "viahub3", "asmthub3", "iusb3hub", "vusb3hub", "amdhub30", "vhhub" };
-	const char usbccgp_name[] = "usbccgp";
-	BOOL is_hub, is_composite_parent, has_vid;
+	char driver[STR_BUFFER_SIZE], hardware_id[STR_BUFFER_SIZE], compatible_id[STR_BUFFER_SIZE];
+	char upper_filter[STR_BUFFER_SIZE], device_id[STR_BUFFER_SIZE];
+	// Room for MAX_DESC_LENGTH UTF-16 units, as UTF-8
+	char desc[3*MAX_DESC_LENGTH];
+	struct wdi_device_info device_info, *cur = NULL, *dev;
+	struct wdi_device_id id;
+	struct device_list_block* blocks = NULL;
+	BOOL is_hub, is_composite_parent, error = FALSE;
 
 	MUTEX_START;
 
@@ -710,74 +1137,43 @@ int LIBWDI_API wdi_create_list(struct wdi_device_info** list,
 
 	*list = NULL;
 
-	PF_LOAD_LIBRARY(Cfgmgr32);
-	r = WDI_ERROR_RESOURCE;
-	PF_INIT_OR_OUT(CM_Get_Device_IDA, Cfgmgr32);
-
-	// List all connected USB devices
-	dev_info = SetupDiGetClassDevsA(NULL, "USB", NULL, DIGCF_PRESENT|DIGCF_ALLCLASSES);
-	if (dev_info == INVALID_HANDLE_VALUE) {
+	context = source->open(device_snapshot);
+	if (context == NULL) {
 		r = WDI_ERROR_NO_DEVICE;
 		goto out;
 	}
 
 	// Find the ones that are driverless
-	for (i = 0; ; i++) {
-		// Free any invalid previously allocated struct
-		free_di(device_info);
-
-		dev_info_data.cbSize = sizeof(dev_info_data);
-		if (!SetupDiEnumDeviceInfo(dev_info, i, &dev_info_data)) {
-			break;
-		}
-
-		// Allocate a driver_info struct to store our data
-		device_info = (struct wdi_device_info*)calloc(1, sizeof(struct wdi_device_info));
-		if (device_info == NULL) {
-			wdi_destroy_list(start);
-			SetupDiDestroyDeviceInfoList(dev_info);
-			r = WDI_ERROR_RESOURCE;
-			goto out;
-		}
+	for (i = 0; source->get_devnode(context, i); i++) {
+		// The device is only copied to the list once we know that we keep it
+		memset(&device_info, 0, sizeof(device_info));
 
 		// SPDRP_DRIVER seems to do a better job at detecting driverless devices than
 		// SPDRP_INSTALL_STATE
 		drv_version[0] = 0;
-		if (SetupDiGetDeviceRegistryPropertyA(dev_info, &dev_info_data, SPDRP_DRIVER,
-			&reg_type, (BYTE*)strbuf, STR_BUFFER_SIZE, &size)) {
+		if (source->get_property(context, DEVICE_PROPERTY_DRIVER, strbuf, sizeof(strbuf))) {
 			if ((options == NULL) || (!options->list_all)) {
 				continue;
 			}
 			// While we have the driver key, pick up the driver version
-			key = SetupDiOpenDevRegKey(dev_info, &dev_info_data, DICS_FLAG_GLOBAL, 0, DIREG_DRV, KEY_READ);
-			size = sizeof(drv_version);
-			if (key != INVALID_HANDLE_VALUE) {
-				RegQueryValueExA(key, "DriverVersion", NULL, &reg_type, (BYTE*)drv_version, &size);
+			if (!source->get_property(context, DEVICE_PROPERTY_DRIVER_VERSION, drv_version, sizeof(drv_version))) {
+				drv_version[0] = 0;
 			}
 		}
 
 		// Eliminate USB hubs by checking the driver string
-		strbuf[0] = 0;
-		if (!SetupDiGetDeviceRegistryPropertyA(dev_info, &dev_info_data, SPDRP_SERVICE,
-			&reg_type, (BYTE*)strbuf, STR_BUFFER_SIZE, &size)) {
-			device_info->driver = NULL;
-		} else {
-			device_info->driver = safe_strdup(strbuf);
-		}
-		is_hub = FALSE;
-		for (j=0; j<ARRAYSIZE(usbhub_name); j++) {
-			if (safe_stricmp(strbuf, usbhub_name[j]) == 0) {
-				is_hub = TRUE;
-				break;
-			}
+		driver[0] = 0;
+		if (source->get_property(context, DEVICE_PROPERTY_SERVICE, driver, sizeof(driver))) {
+			device_info.driver = driver;
 		}
+		is_hub = (wdi_get_driver_class(driver) == WDI_DRIVER_CLASS_HUB);
 		if (is_hub && ((options == NULL) || (!options->list_hubs))) {
 			continue;
 		}
 		// Also eliminate composite devices parent drivers, as replacing these drivers
 		// is a bad idea
 		is_composite_parent = FALSE;
-		if (safe_stricmp(strbuf, usbccgp_name) == 0) {
+		if (wdi_get_driver_class(driver) == WDI_DRIVER_CLASS_COMPOSITE) {
 			if ((options == NULL) || (!options->list_hubs)) {
 				continue;
 			}
@@ -785,306 +1181,695 @@ int LIBWDI_API wdi_create_list(struct wdi_device_info** list,
 		}
 
 		// Retrieve the first hardware ID
-		if (SetupDiGetDeviceRegistryPropertyA(dev_info, &dev_info_data, SPDRP_HARDWAREID,
-			&reg_type, (BYTE*)strbuf, STR_BUFFER_SIZE, &size)) {
-			wdi_dbg("Hardware ID: %s", strbuf);
+		if (source->get_property(context, DEVICE_PROPERTY_HARDWARE_ID, hardware_id, sizeof(hardware_id))) {
+			wdi_dbg("Hardware ID: %s", hardware_id);
 		} else {
 			wdi_err("could not get hardware ID");
-			strbuf[0] = 0;
+			hardware_id[0] = 0;
 		}
 		// We assume that the first one (REG_MULTI_SZ) is the one we are interested in
-		device_info->hardware_id = safe_strdup(strbuf);
+		device_info.hardware_id = hardware_id;
 
 		// Retrieve the first Compatible ID
-		if (SetupDiGetDeviceRegistryPropertyA(dev_info, &dev_info_data, SPDRP_COMPATIBLEIDS,
-			&reg_type, (BYTE*)strbuf, STR_BUFFER_SIZE, &size)) {
-			wdi_dbg("Compatible ID: %s", strbuf);
+		if (source->get_property(context, DEVICE_PROPERTY_COMPATIBLE_ID, compatible_id, sizeof(compatible_id))) {
+			wdi_dbg("Compatible ID: %s", compatible_id);
 		} else {
-			strbuf[0] = 0;
+			compatible_id[0] = 0;
 		}
 		// We assume that the first one (REG_MULTI_SZ) is the one we are interested in
-		device_info->compatible_id = safe_strdup(strbuf);
+		device_info.compatible_id = compatible_id;
 
 		// Lookup the upper filter
-		if (!SetupDiGetDeviceRegistryPropertyA(dev_info, &dev_info_data, SPDRP_UPPERFILTERS,
-			&reg_type, (BYTE*)strbuf, STR_BUFFER_SIZE, &size)) {
-			device_info->upper_filter = NULL;
-		} else {
-			wdi_dbg("Upper filter: %s", strbuf);
-			device_info->upper_filter = safe_strdup(strbuf);
+		if (source->get_property(context, DEVICE_PROPERTY_UPPER_FILTER, upper_filter, sizeof(upper_filter))) {
+			wdi_dbg("Upper filter: %s", upper_filter);
+			device_info.upper_filter = upper_filter;
 		}
 
 		// Convert driver version string to integer
-		device_info->driver_version = 0;
 		if (drv_version[0] != 0) {
 			wdi_dbg("Driver version: %s", drv_version);
-			token = strtok(drv_version, ".");
-			while (token != NULL) {
-				device_info->driver_version <<= 16;
-				device_info->driver_version += atoi(token);
-				token = strtok(NULL, ".");
+			for (token = drv_version; ; token = end + 1) {
+				device_info.driver_version <<= 16;
+				device_info.driver_version += strtoul(token, &end, 10);
+				if (*end != '.') {
+					break;
+				}
 			}
-		} else if (device_info->driver != NULL) {
+		} else if (device_info.driver != NULL) {
 			// Only produce a warning for non-driverless devices
 			wdi_warn("could not read driver version");
 		}
 
 		// Retrieve device ID. This is needed to re-enumerate our device and force
 		// the final driver installation
-		cr = pfCM_Get_Device_IDA(dev_info_data.DevInst, strbuf, STR_BUFFER_SIZE, 0);
-		if (cr != CR_SUCCESS) {
-			wdi_err("could not retrieve simple path for device %d: CR error %d", i, cr);
+		if (!source->get_device_id(context, device_id, sizeof(device_id))) {
+			wdi_err("could not retrieve simple path for device %d", i);
 			continue;
 		} else {
 			wdi_dbg("%s USB device (%d): %s",
-				device_info->driver?device_info->driver:"Driverless", i, strbuf);
+				device_info.driver?device_info.driver:"Driverless", i, device_id);
 		}
-		device_info->device_id = safe_strdup(strbuf);
+		device_info.device_id = device_id;
 
 		// The information we want ("Bus reported device description") is accessed
 		// through DEVPKEY_Device_BusReportedDeviceDesc
-		if (!SetupDiGetDevicePropertyW(dev_info, &dev_info_data, &DEVPKEY_Device_BusReportedDeviceDesc,
-			&devprop_type, (BYTE*)desc, 2*MAX_DESC_LENGTH, &size, 0)) {
+		if (!source->get_property(context, DEVICE_PROPERTY_BUS_DESC, desc, sizeof(desc))) {
 			// fallback to SPDRP_DEVICEDESC (USB hubs still use it)
-			if (!SetupDiGetDeviceRegistryPropertyW(dev_info, &dev_info_data, SPDRP_DEVICEDESC,
-				&reg_type, (BYTE*)desc, 2*MAX_DESC_LENGTH, &size)) {
-				wdi_dbg("could not read device description for %d: %s",
-					i, windows_error_str(0));
-				safe_swprintf(desc, MAX_DESC_LENGTH, L"Unknown Device #%d", unknown_count++);
+			if (!source->get_property(context, DEVICE_PROPERTY_DESC, desc, sizeof(desc))) {
+				wdi_dbg("could not read device description for %d", i);
+				static_sprintf(desc, "Unknown Device #%d", unknown_count++);
 			}
 		}
 
-		device_info->is_composite = FALSE;	// non composite by default
-		device_info->mi = 0;
-		token = strtok (strbuf, "\\#&");
-		has_vid = FALSE;
-		while(token != NULL) {
-			for (j = 0; j < 3; j++) {
-				if (safe_strncmp(token, prefix[j], safe_strlen(prefix[j])) == 0) {
-					switch(j) {
-					case 0:
-						if (sscanf(token, "VID_%04X", &tmp) != 1) {
-							wdi_err("could not convert VID string");
-						} else {
-							device_info->vid = (unsigned short)tmp;
-						}
-						has_vid = TRUE;
-						break;
-					case 1:
-						if (sscanf(token, "PID_%04X", &tmp) != 1) {
-							wdi_err("could not convert PID string");
-						} else {
-							device_info->pid = (unsigned short)tmp;
-						}
-						break;
-					case 2:
-						if (sscanf(token, "MI_%02X", &tmp) != 1) {
-							wdi_err("could not convert MI string");
-						} else {
-							device_info->is_composite = TRUE;
-							device_info->mi = (unsigned char)tmp;
-							if ((wcslen(desc) + sizeof(" (Interface ###)")) < MAX_DESC_LENGTH) {
-								_snwprintf(&desc[wcslen(desc)], sizeof(" (Interface ###)"),
-									L" (Interface %d)", device_info->mi);
-							}
-						}
-						break;
-					default:
-						wdi_err("unexpected case");
-						break;
-					}
-				}
+		if (parse_device_id(device_id, &id) != WDI_SUCCESS) {
+			wdi_err("could not parse device ID %s", device_id);
+		}
+		device_info.vid = id.vid;
+		device_info.pid = id.pid;
+		if (id.has_mi) {
+			device_info.is_composite = TRUE;
+			device_info.mi = id.mi;
+			if ((strlen(desc) + sizeof(" (Interface ###)")) < sizeof(desc)) {
+				_snprintf(&desc[strlen(desc)], sizeof(" (Interface ###)"),
+					" (Interface %d)", device_info.mi);
 			}
-			token = strtok (NULL, "\\#&");
 		}
 
-		// Eliminate root hubs (no VID/PID => 0 from calloc)
-		if ( (is_hub) && (!has_vid) ) {
+		// Eliminate root hubs (no VID/PID)
+		if ( (is_hub) && (!id.has_vid) ) {
 			continue;
 		}
 
 		// Add a suffix for composite parents
 		if ( (is_composite_parent)
-		  && ((wcslen(desc) + sizeof(" (Composite Parent)")) < MAX_DESC_LENGTH) ) {
-			_snwprintf(&desc[wcslen(desc)], sizeof(" (Composite Parent)"),
-				L" (Composite Parent)");
+		  && ((strlen(desc) + sizeof(" (Composite Parent)")) < sizeof(desc)) ) {
+			static_strcat(desc, " (Composite Parent)");
 		}
 
-		device_info->desc = wchar_to_utf8(desc);
-
 		// Remove trailing whitespaces
-		if ((device_info->desc != NULL) && (options != NULL) && (options->trim_whitespaces)) {
-			end = device_info->desc + safe_strlen(device_info->desc);
-			while ((end != device_info->desc) && isspace(*(end-1))) {
+		if ((options != NULL) && (options->trim_whitespaces)) {
+			end = desc + strlen(desc);
+			while ((end != desc) && isspace((unsigned char)*(end-1))) {
 				--end;
 			}
 			*end = 0;
 		}
+		device_info.desc = desc;
 
-		wdi_dbg("Device description: '%s'", device_info->desc);
+		wdi_dbg("Device description: '%s'", device_info.desc);
 
-		// Only at this stage do we know we have a valid current element
-		if (cur == NULL) {
-			start = device_info;
-		} else {
-			cur->next = device_info;
+		// Only at this stage do we know we have a valid element, which we add to the list
+		dev = (struct wdi_device_info*)device_list_alloc(&blocks, sizeof(struct wdi_device_info), TRUE);
+		if (dev == NULL) {
+			error = TRUE;
+			break;
+		}
+		*dev = device_info;
+		dev->desc = device_list_strdup(&blocks, device_info.desc, &error);
+		dev->driver = device_list_strdup(&blocks, device_info.driver, &error);
+		dev->device_id = device_list_strdup(&blocks, device_info.device_id, &error);
+		dev->hardware_id = device_list_strdup(&blocks, device_info.hardware_id, &error);
+		dev->compatible_id = device_list_strdup(&blocks, device_info.compatible_id, &error);
+		dev->upper_filter = device_list_strdup(&blocks, device_info.upper_filter, &error);
+		if (error) {
+			break;
 		}
-		cur = device_info;
-		// Ensure that we don't free a valid structure
-		device_info = NULL;
+		if (cur != NULL) {
+			cur->next = dev;
+		}
+		cur = dev;
 	}
 
-	SetupDiDestroyDeviceInfoList(dev_info);
+	source->close(context);
 
-	*list = start;
-	r = (*list == NULL) ? WDI_ERROR_NO_DEVICE : WDI_SUCCESS;
+	if (error) {
+		free_device_list(blocks);
+		r = WDI_ERROR_RESOURCE;
+		goto out;
+	}
+	if (blocks == NULL) {
+		r = WDI_ERROR_NO_DEVICE;
+		goto out;
+	}
+	// The first device is the first allocation of the blocks
+	add_device_list(&device_lists, blocks);
+	*list = (struct wdi_device_info*)DEVICE_LIST_DATA(blocks);
+	r = WDI_SUCCESS;
 out:
-	PF_FREE_LIBRARY(Cfgmgr32);
 	CloseHandle(mutex);
 	return r;
 }
 
+int LIBWDI_API wdi_parse_device_id(const char* id, struct wdi_device_id* device_id)
+{
+	if (device_id == NULL) {
+		return WDI_ERROR_INVALID_PARAM;
+	}
+	return parse_device_id(id, device_id);
+}
+
 int LIBWDI_API wdi_destroy_list(struct wdi_device_info* list)
 {
-	struct wdi_device_info *tmp;
+	struct device_list_block* blocks;
 
-	MUTEX_START;
+	if (list == NULL) {
+		return WDI_SUCCESS;
+	}
+	// The strings of the devices are part of the blocks, so they go with them
+	blocks = remove_device_list(&device_lists, list);
+	if (blocks == NULL) {
+		wdi_err("not a list from wdi_create_list(), or already destroyed");
+		return WDI_ERROR_INVALID_PARAM;
+	}
+	free_device_list(blocks);
+	return WDI_SUCCESS;
+}
+
+// check if an existing file has the same content as an embedded resource
+static BOOL is_resource_extracted(int res, const char* filename)
+{
+	HANDLE handle;
+	LARGE_INTEGER size;
+	unsigned char* buffer = NULL;
+	DWORD size_read;
+	BOOL r = FALSE;
 
-	while(list != NULL) {
-		tmp = list;
-		list = list->next;
-		free_di(tmp);
+	handle = CreateFileU(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (handle == INVALID_HANDLE_VALUE) {
+		return FALSE;
 	}
-	CloseHandle(mutex);
+	if ( (!GetFileSizeEx(handle, &size)) || (size.QuadPart != (LONGLONG)resource[res].size) ) {
+		goto out;
+	}
+	// The file has the expected size, so compare its hash with the one from embedded.h
+	buffer = (unsigned char*)malloc(resource[res].size + 1);
+	if ( (buffer == NULL) || (!ReadFile(handle, buffer, (DWORD)resource[res].size, &size_read, NULL))
+	  || (size_read != resource[res].size) ) {
+		goto out;
+	}
+	r = (xxh64(buffer, resource[res].size) == resource[res].hash);
+out:
+	safe_free(buffer);
+	CloseHandle(handle);
+	return r;
+}
+
+// write an embedded resource to a new file
+static int create_resource_file(int res, const char* filename, unsigned char* write_buffer)
+{
+	HANDLE handle;
+	int r;
+
+	handle = create_file_as_userU(filename, GENERIC_WRITE);
+	if (handle == INVALID_HANDLE_VALUE) {
+		wdi_err("failed to create file '%s' (%s)", filename, windows_error_str(0));
+		return WDI_ERROR_RESOURCE;
+	}
+	r = write_resource(res, handle, write_buffer);
+	CloseHandle(handle);
+	if (r != WDI_SUCCESS) {
+		wdi_err("failed to extract file '%s'", filename);
+	}
+	return r;
+}
+
+// the temporary name under which a file is created before it replaces filename, in the
+// same directory, and kept short, so that it fits wherever filename does
+static void get_temp_name(const char* filename, char* tmp_file)
+{
+	const char* name;
+
+	name = strrchr(filename, '\\');
+	name = (name == NULL) ? filename : name + 1;
+	safe_sprintf(tmp_file, MAX_PATH, "%.*s~%lx.tmp", (int)(name - filename), filename,
+		(unsigned long)GetCurrentThreadId());
+}
+
+// return the number of hardlinks of an existing file, or 0 if it doesn't exist
+static DWORD get_link_count(const char* filename)
+{
+	HANDLE handle;
+	BY_HANDLE_FILE_INFORMATION info;
+	DWORD nb_links = 0;
+
+	handle = CreateFileU(filename, FILE_READ_ATTRIBUTES, FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE,
+		NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (handle == INVALID_HANDLE_VALUE) {
+		return 0;
+	}
+	if (GetFileInformationByHandle(handle, &info)) {
+		nb_links = info.nNumberOfLinks;
+	}
+	CloseHandle(handle);
+	return nb_links;
+}
+
+// write an embedded resource to a file, which replaces any existing one
+// An existing file that has other hardlinks, such as one linked from a store entry, must
+// not be truncated in place, so the resource is then written under a temporary name,
+// which is renamed once complete
+static int extract_resource(int res, const char* filename, unsigned char* write_buffer)
+{
+	char tmp_file[MAX_PATH];
+	int r;
+
+	if (get_link_count(filename) <= 1) {
+		return create_resource_file(res, filename, write_buffer);
+	}
+	get_temp_name(filename, tmp_file);
+	r = create_resource_file(res, tmp_file, write_buffer);
+	if ((r == WDI_SUCCESS) && (!MoveFileExU(tmp_file, filename, MOVEFILE_REPLACE_EXISTING))) {
+		wdi_err("failed to replace '%s' (%s)", filename, windows_error_str(0));
+		r = WDI_ERROR_RESOURCE;
+	}
+	if (r != WDI_SUCCESS) {
+		DeleteFileU(tmp_file);
+	}
+	return r;
+}
+
+// make sure that an embedded resource is present in a content-addressed store, where
+// it is named after its hashes, and return its path in store_file (MAX_PATH)
+static int add_resource_to_store(int res, const char* store_path, char* store_file,
+								 unsigned char* write_buffer)
+{
+	char key[2*sizeof(resource[0].sha256)+1], tmp_file[MAX_PATH];
+	size_t i;
+	int r;
+
+	// The SHA-256 is the Authenticode one for PE files, which doesn't cover their
+	// signature, so the XXH64 of the whole content is added to the key
+	for (i=0; i<sizeof(resource[0].sha256); i++) {
+		sprintf(&key[2*i], "%02x", resource[res].sha256[i]);
+	}
+	// leave room for the temporary file suffix
+	if (safe_strlen(store_path) + sizeof(key) + 17 > MAX_PATH - 16) {
+		wdi_err("store path is too long: '%s'", store_path);
+		return WDI_ERROR_RESOURCE;
+	}
+	safe_sprintf(store_file, MAX_PATH, "%s\\%s-%016" PRIx64, store_path, key, resource[res].hash);
+	// An entry can be modified through any of its links, so its content is checked
+	if (is_resource_extracted(res, store_file)) {
+		return WDI_SUCCESS;
+	}
+
+	// Entries are renamed into place once complete, so that other threads or processes
+	// using the same store never see a partial file. A modified entry is replaced, but
+	// the files that were already linked to it are left as they are.
+	safe_sprintf(tmp_file, MAX_PATH, "%s.%lu.tmp", store_file, (unsigned long)GetCurrentThreadId());
+	r = create_resource_file(res, tmp_file, write_buffer);
+	if (r != WDI_SUCCESS) {
+		DeleteFileU(tmp_file);
+		return r;
+	}
+	if (!MoveFileExU(tmp_file, store_file, MOVEFILE_REPLACE_EXISTING)) {
+		// Another thread or process may have added the entry, and still have it open
+		if (!is_resource_extracted(res, store_file)) {
+			wdi_err("could not add '%s' to the store (%s)", store_file, windows_error_str(0));
+			r = WDI_ERROR_RESOURCE;
+		}
+		DeleteFileU(tmp_file);
+	}
+	return r;
+}
+
+// Shared state of the threads of extract_binaries()
+struct extract_context {
+	const char* path;
+	const char* store_path;
+	BOOL incremental;
+	uint8_t* extracted;
+	struct log_buffer* logs;	// messages of each resource, logged once all the threads are done
+	volatile LONG nb_written;
+	volatile LONG nb_skipped;
+	volatile LONG nb_linked;
+	volatile LONG nb_copied;
+};
+
+// extract a single resource, either directly or through the store
+static int extract_binary(struct extract_context* ectx, int res, unsigned char* write_buffer)
+{
+	char filename[MAX_PATH], store_file[MAX_PATH], tmp_file[MAX_PATH];
+	BOOL linked;
+	int r;
+
+	if ( (safe_strlen(ectx->path) + safe_strlen(resource[res].subdir) + safe_strlen(resource[res].name)) > (MAX_PATH - 3)) {
+		wdi_err("qualified path is too long: '%s\\%s\\%s'", ectx->path, resource[res].subdir, resource[res].name);
+		return WDI_ERROR_RESOURCE;
+	}
+	static_sprintf(filename, "%s\\%s\\%s", ectx->path, resource[res].subdir, resource[res].name);
+
+	if ((ectx->incremental) && (is_resource_extracted(res, filename))) {
+		wdi_dbg("'%s' is unchanged - skipped", filename);
+		InterlockedIncrement(&ectx->nb_skipped);
+		ectx->extracted[res] = 1;
+		return WDI_SUCCESS;
+	}
+
+	if (ectx->store_path == NULL) {
+		r = extract_resource(res, filename, write_buffer);
+		if (r == WDI_SUCCESS) {
+			InterlockedIncrement(&ectx->nb_written);
+			ectx->extracted[res] = 1;
+		}
+		return r;
+	}
+
+	r = add_resource_to_store(res, ectx->store_path, store_file, write_buffer);
+	if (r != WDI_SUCCESS) {
+		return r;
+	}
+	// The store entry was checked, or written, so the file has the embedded content
+	// A hardlink can't replace an existing file, so it is created, or the entry copied,
+	// under a temporary name, and the existing file is only replaced once that succeeded
+	get_temp_name(filename, tmp_file);
+	DeleteFileU(tmp_file);
+	linked = CreateHardLinkU(tmp_file, store_file, NULL);
+	if (!linked) {
+		// e.g. if the store is on a different volume, or on a FAT file system
+		wdi_dbg("could not link '%s' (%s) - copying instead", filename, windows_error_str(0));
+		if (!CopyFileU(store_file, tmp_file, FALSE)) {
+			wdi_err("failed to copy '%s' to '%s' (%s)", store_file, filename, windows_error_str(0));
+			DeleteFileU(tmp_file);
+			return WDI_ERROR_RESOURCE;
+		}
+	}
+	if (!MoveFileExU(tmp_file, filename, MOVEFILE_REPLACE_EXISTING)) {
+		wdi_err("failed to replace '%s' (%s)", filename, windows_error_str(0));
+		DeleteFileU(tmp_file);
+		return WDI_ERROR_RESOURCE;
+	}
+	InterlockedIncrement(linked ? &ectx->nb_linked : &ectx->nb_copied);
+	ectx->extracted[res] = 1;
 	return WDI_SUCCESS;
 }
 
+// called by the threads of extract_run(), which must not log directly
+static int extract_item(void* context, int res, unsigned char* write_buffer)
+{
+	struct extract_context* ectx = (struct extract_context*)context;
+	int r;
+
+	// Ignore tokenizer files
+	if (resource[res].subdir[0] == 0) {
+		return WDI_SUCCESS;
+	}
+	wdi_log_defer(&ectx->logs[res]);
+	r = extract_binary(ectx, res, write_buffer);
+	wdi_log_defer(NULL);
+	return r;
+}
+
 // extract the embedded binary resources
-static int extract_binaries(const char* path)
+// if options->incremental_extraction is set, files that are already present with the
+// same content are skipped, and if options->store_path is set, files are hardlinked
+// from the store, or copied if they can't be
+// the files are written in parallel, by the threads of extract_run(), whose messages
+// are only logged once they are all done
+// extracted, which holds nb_resources flags, is set for each file whose content is
+// known to match the embedded one, as it was written, or checked
+static int extract_binaries(const char* path, struct wdi_options_prepare_driver* options,
+							uint8_t* extracted)
 {
-	FILE *fd;
-	char filename[MAX_PATH];
-	int i, r;
+	char dirname[MAX_PATH];
+	struct extract_context ectx;
+	unsigned char* write_buffer[EXTRACT_MAX_THREADS] = { NULL };
+	int i, j, nb_files = 0, nb_threads, r;
+
+	memset(&ectx, 0, sizeof(ectx));
+	ectx.path = path;
+	ectx.store_path = (options != NULL) ? options->store_path : NULL;
+	ectx.incremental = (options != NULL) && (options->incremental_extraction);
+	ectx.extracted = extracted;
+	memset(extracted, 0, nb_resources);
+
+	if (ectx.store_path != NULL) {
+		r = check_dir(ectx.store_path, TRUE);
+		if (r != WDI_SUCCESS) {
+			return r;
+		}
+	}
 
+	// Create each subdirectory once, before any of the files are written
 	for (i=0; i<nb_resources; i++) {
 		// Ignore tokenizer files
 		if (resource[i].subdir[0] == 0) {
 			continue;
 		}
-		safe_strcpy(filename, MAX_PATH, path);
-		safe_strcat(filename, MAX_PATH, "\\");
-		safe_strcat(filename, MAX_PATH, resource[i].subdir);
-
-		r = check_dir(filename, TRUE);
+		nb_files++;
+		for (j=0; j<i; j++) {
+			if (strcmp(resource[j].subdir, resource[i].subdir) == 0) {
+				break;
+			}
+		}
+		if (j < i) {
+			continue;
+		}
+		safe_strcpy(dirname, MAX_PATH, path);
+		safe_strcat(dirname, MAX_PATH, "\\");
+		safe_strcat(dirname, MAX_PATH, resource[i].subdir);
+		r = check_dir(dirname, TRUE);
 		if (r != WDI_SUCCESS) {
 			return r;
 		}
-		safe_strcat(filename, MAX_PATH, "\\");
-		safe_strcat(filename, MAX_PATH, resource[i].name);
+	}
 
-		if ( (safe_strlen(path) + safe_strlen(resource[i].subdir) + safe_strlen(resource[i].name)) > (MAX_PATH - 3)) {
-			wdi_err("qualified path is too long: '%s'", filename);
-			return WDI_ERROR_RESOURCE;
+	// The files are written by a small pool of threads, with a buffer each
+	nb_threads = extract_nb_threads(nb_files);
+	for (i = 0; i < nb_threads; i++) {
+		write_buffer[i] = (unsigned char*)malloc(EXTRACT_BUFFER_SIZE);
+		if (write_buffer[i] == NULL) {
+			break;
+		}
+	}
+	nb_threads = i;
+	ectx.logs = (struct log_buffer*)calloc(nb_resources, sizeof(struct log_buffer));
+	if ((ectx.logs == NULL) || (nb_threads == 0)) {
+		wdi_err("could not allocate the extraction buffers");
+		r = WDI_ERROR_RESOURCE;
+		goto out;
+	}
+	r = extract_run(extract_item, &ectx, nb_resources, write_buffer, nb_threads);
+	for (i = 0; i < nb_resources; i++) {
+		wdi_log_flush(&ectx.logs[i]);
+	}
+	if (r != WDI_SUCCESS) {
+		goto out;
+	}
+
+	if (ectx.store_path != NULL) {
+		wdi_info("successfully extracted driver files to %s (%d linked from %s, %d copied, %d unchanged)",
+			path, (int)ectx.nb_linked, ectx.store_path, (int)ectx.nb_copied, (int)ectx.nb_skipped);
+	} else if (ectx.incremental) {
+		wdi_info("successfully extracted driver files to %s (%d written, %d unchanged)",
+			path, (int)ectx.nb_written, (int)ectx.nb_skipped);
+	} else {
+		wdi_info("successfully extracted driver files to %s", path);
+	}
+
+out:
+	for (i = 0; i < EXTRACT_MAX_THREADS; i++) {
+		safe_free(write_buffer[i]);
+	}
+	safe_free(ectx.logs);
+	return r;
+}
+
+// Set the replacement value of an inf tag, for the current wdi_prepare_driver() call
+static BOOL set_inf_value(struct prepare_context* ctx, int tag, const char* format, ...)
+{
+	va_list args;
+	int size;
+
+	va_start(args, format);
+	size = _vscprintf(format, args);
+	va_end(args);
+	if (size < 0) {
+		return FALSE;
+	}
+	safe_free(ctx->values[tag]);
+	ctx->values[tag] = (char*)malloc(size + 1);
+	if (ctx->values[tag] == NULL) {
+		return FALSE;
+	}
+	va_start(args, format);
+	safe_vsnprintf(ctx->values[tag], size + 1, format, args);
+	va_end(args);
+	return TRUE;
+}
+
+// compiles a tokenizer resource stored in resource.h into *tmpl, unless already done
+// Concurrent calls may compile the same template, in which case only the first one is kept
+static long load_template(struct prepare_context* ctx, const char* resource_name,
+					   token_template_t** tmpl)
+{
+	int i;
+	const unsigned char* data;
+	token_matcher_t* matcher;
+	token_template_t* compiled;
+
+	if (*tmpl == NULL) {
+		if (inf_matcher == NULL) {
+			matcher = tokenize_compile_names(inf_tags, "#", "#");
+			if (matcher == NULL) {
+				return -ERROR_NOT_ENOUGH_MEMORY;
+			}
+			if (InterlockedCompareExchangePointer((PVOID*)&inf_matcher, matcher, NULL) != NULL) {
+				tokenize_free(matcher);
+			}
+		}
+		// Tokenizer files are the ones without a subdir
+		i = find_resource("", resource_name);
+		if (i < 0) {
+			return -ERROR_RESOURCE_DATA_NOT_FOUND;
+		}
+		data = get_resource_data(i, &ctx->res_buffer, &ctx->res_buffer_size);
+		if (data == NULL) {
+			return -ERROR_RESOURCE_DATA_NOT_FOUND;
 		}
+		compiled = tokenize_compile_template((const char*)data, (long)resource[i].size, inf_matcher);
+		if (compiled == NULL) {
+			return -ERROR_NOT_ENOUGH_MEMORY;
+		}
+		if (InterlockedCompareExchangePointer((PVOID*)tmpl, compiled, NULL) != NULL) {
+			tokenize_free_template(compiled);
+		}
+	}
+	return 0;
+}
+
+// tokenizes a resource stored in resource.h into a newly allocated buffer
+static long tokenize_internal(struct prepare_context* ctx, const char* resource_name,
+					   token_template_t** tmpl, char** dst)
+{
+	long r;
+
+	r = load_template(ctx, resource_name, tmpl);
+	if (r < 0) {
+		return r;
+	}
+	return tokenize_render(*tmpl, (const char* const*)ctx->values, dst);
+}
+
+// sinks for write_inf()
+static int write_to_handle(void* context, const unsigned char* data, size_t size)
+{
+	DWORD size_written;
+
+	if ((!WriteFile((HANDLE)context, data, (DWORD)size, &size_written, NULL)) || (size_written != size)) {
+		return -1;
+	}
+	return 0;
+}
+
+static int write_to_utf16le(void* context, const char* src, long count)
+{
+	return utf16le_write((struct utf16le_writer*)context, src, (size_t)count);
+}
 
-		fd = fopen_as_userU(filename, "w");
-		if (fd == NULL) {
-			wdi_err("failed to create file '%s' (%s)", filename, windows_error_str(0));
-			return WDI_ERROR_RESOURCE;
-		}
+// tokenizes the inf template of the driver straight into inf_path
+// Converting to UTF-16 is the only way to get devices using a non-English locale
+// to display properly in device manager. UTF-8 will not do.
+static int write_inf(struct prepare_context* ctx, const char* inf_path)
+{
+	struct utf16le_writer writer;
+	HANDLE handle;
+	long size;
 
-		fwrite(resource[i].data, 1, resource[i].size, fd);
-		fclose(fd);
+	size = load_template(ctx, inf_template[ctx->driver_type], &inf_compiled[ctx->driver_type]);
+	if (size < 0) {
+		wdi_err("could not tokenize inf file (%ld)", size);
+		return WDI_ERROR_ACCESS;
+	}
+
+	handle = create_file_as_userU(inf_path, GENERIC_WRITE);
+	if (handle == INVALID_HANDLE_VALUE) {
+		wdi_err("failed to create file: %s", inf_path);
+		return WDI_ERROR_ACCESS;
+	}
+	utf16le_writer_init(&writer, write_to_handle, handle, TRUE);
+	size = tokenize_render_to(inf_compiled[ctx->driver_type], (const char* const*)ctx->values,
+		write_to_utf16le, &writer);
+	if ((size > 0) && (utf16le_writer_flush(&writer) != 0)) {
+		size = -ERROR_WRITE_FAULT;
+	}
+	CloseHandle(handle);
+	if (size <= 0) {
+		wdi_err("could not tokenize inf file (%ld)", size);
+		DeleteFileU(inf_path);
+		return WDI_ERROR_ACCESS;
 	}
+	return WDI_SUCCESS;
+}
+
+#define CAT_LIST_MAX_ENTRIES 16
+// Check that an inf name is valid, and that the cat name can be derived from it
+static int check_inf_name(const char* inf_name)
+{
+	const char* inf_ext = ".inf";
 
-	wdi_info("successfully extracted driver files to %s", path);
+	if (inf_name == NULL) {
+		wdi_err("one of the required parameter is NULL");
+		return WDI_ERROR_INVALID_PARAM;
+	}
+	if (strcmp(inf_name+safe_strlen(inf_name)-4, inf_ext) != 0) {
+		wdi_err("inf name provided must have a '.inf' extension");
+		return WDI_ERROR_INVALID_PARAM;
+	}
 	return WDI_SUCCESS;
 }
 
-// tokenizes a resource stored in resource.h
-static long tokenize_internal(const char* resource_name, char** dst, const token_entity_t* token_entities,
-					   const char* tok_prefix, const char* tok_suffix, int recursive)
+// Free the values of a context, but not the context itself
+static void free_prepare_context(struct prepare_context* ctx)
 {
 	int i;
 
-	for (i=0; i<nb_resources; i++) {
-		// Ignore driver files
-		if (resource[i].subdir[0] != 0) {
-			continue;
-		}
-		if (strcmp(resource[i].name, resource_name) == 0) {
-			return tokenize_string(resource[i].data, (long)resource[i].size,
-				dst, token_entities, tok_prefix, tok_suffix, recursive);
-		}
+	for (i = 0; i < NB_INF_TAGS; i++) {
+		safe_free(ctx->values[i]);
 	}
-	return -ERROR_RESOURCE_DATA_NOT_FOUND;
+	safe_free(ctx->res_buffer);
+	ctx->res_buffer_size = 0;
+	safe_free(ctx->extracted);
 }
 
-#define CAT_LIST_MAX_ENTRIES 16
-// Create an inf and extract coinstallers in the directory pointed by path
-int LIBWDI_API wdi_prepare_driver(struct wdi_device_info* device_info, const char* path,
-								  const char* inf_name, struct wdi_options_prepare_driver* options)
+// Set up a context with the destination path, the driver type and the inf values
+// that don't depend on the device, so that it can be used for a whole batch
+static int init_prepare_context(struct prepare_context* ctx, const char* path,
+								struct wdi_options_prepare_driver* options)
 {
-	const wchar_t bom = 0xFEFF;
 #if defined(ENABLE_DEBUG_LOGGING) || defined(INCLUDE_DEBUG_LOGGING)
 	const char* driver_display_name[WDI_NB_DRIVERS] = { "WinUSB", "libusb0.sys", "libusbK.sys", "Generic USB CDC", "user driver" };
 #endif
-	const char* inf_ext = ".inf";
-	const char* vendor_name = NULL;
-	const char* cat_list[CAT_LIST_MAX_ENTRIES+1];
-	char drv_path[MAX_PATH], inf_path[MAX_PATH], cat_path[MAX_PATH], hw_id[40], cert_subject[64];
-	char *strguid, *token, *cat_name = NULL, *dst = NULL, *cat_in_copy = NULL;
-	wchar_t *wdst = NULL;
-	int i, nb_entries, driver_type = WDI_WINUSB, r = WDI_ERROR_OTHER;
-	long inf_file_size, cat_file_size;
-	BOOL is_android_device = FALSE;
-	FILE* fd;
-	GUID guid;
+	int r, driver_type = WDI_WINUSB;
+	VS_FIXEDFILEINFO driver_version = { 0 };
 	SYSTEMTIME system_time;
 	FILETIME file_time, local_time;
 
-	MUTEX_START;
-
-	GET_WINDOWS_VERSION;
-	if (nWindowsVersion < WINDOWS_7) {
-		wdi_err("this version of Windows is no longer supported");
-		r = WDI_ERROR_NOT_SUPPORTED;
-		goto out;
-	}
-
-	if ((device_info == NULL) || (inf_name == NULL)) {
-		wdi_err("one of the required parameter is NULL");
-		r = WDI_ERROR_INVALID_PARAM;
-		goto out;
-	}
-
-	// Check the inf file provided and create the cat file name
-	if (strcmp(inf_name+safe_strlen(inf_name)-4, inf_ext) != 0) {
-		wdi_err("inf name provided must have a '.inf' extension");
-		r = WDI_ERROR_INVALID_PARAM;
-		goto out;
+	ctx->options = options;
+	ctx->extracted = (uint8_t*)calloc(nb_resources, 1);
+	if (ctx->extracted == NULL) {
+		return WDI_ERROR_RESOURCE;
 	}
 
 	if (path != NULL) {
-		static_strcpy(drv_path, path);
+		static_strcpy(ctx->drv_path, path);
 	} else {
 		// Try to use the user's temp dir
 		char* tmp = getenvU("TEMP");
 		if (tmp == NULL) {
 			wdi_err("no path provided and unable to use TEMP");
-			r = WDI_ERROR_INVALID_PARAM;
-			goto out;
+			return WDI_ERROR_INVALID_PARAM;
 		} else {
-			static_strcpy(drv_path, tmp);
+			static_strcpy(ctx->drv_path, tmp);
 			free(tmp);
-			wdi_info("no path provided - extracting to '%s'", drv_path);
+			wdi_info("no path provided - extracting to '%s'", ctx->drv_path);
 		}
 	}
 
 	// Try to create directory if it doesn't exist
-	r = check_dir(drv_path, TRUE);
+	r = check_dir(ctx->drv_path, TRUE);
 	if (r != WDI_SUCCESS) {
-		goto out;
+		return r;
 	}
 
 	if (options != NULL) {
@@ -1094,13 +1879,12 @@ int LIBWDI_API wdi_prepare_driver(struct wdi_device_info* device_info, const cha
 	// Ensure driver_type is what we expect
 	if ( (driver_type < 0) || (driver_type > WDI_USER) ) {
 		wdi_err("unknown type");
-		r = WDI_ERROR_INVALID_PARAM;
-		goto out;
+		return WDI_ERROR_INVALID_PARAM;
 	}
 
-	if (!wdi_is_driver_supported(driver_type, &driver_version[driver_type])) {
+	if (!wdi_is_driver_supported(driver_type, &driver_version)) {
 		for (driver_type=0; driver_type<WDI_NB_DRIVERS; driver_type++) {
-			if (wdi_is_driver_supported(driver_type, NULL)) {
+			if (wdi_is_driver_supported(driver_type, &driver_version)) {
 				wdi_warn("unsupported or no driver type specified, will use %s",
 					driver_display_name[driver_type]);
 				break;
@@ -1108,94 +1892,133 @@ int LIBWDI_API wdi_prepare_driver(struct wdi_device_info* device_info, const cha
 		}
 		if (driver_type == WDI_NB_DRIVERS) {
 			wdi_warn("program assertion failed - no driver supported");
-			r = WDI_ERROR_NOT_FOUND;
-			goto out;
+			return WDI_ERROR_NOT_FOUND;
 		}
 	}
+	ctx->driver_type = driver_type;
 
 	// If the target is libusb-win32 and we have the K DLLs, add them to the inf
 	if ((driver_type == WDI_LIBUSB0) && (wdi_is_driver_supported(WDI_LIBUSBK, NULL))) {
 		wdi_info("K driver available - adding the libusbK DLLs to the libusb-win32 inf");
-		static_strcpy(inf_entities[LK_COMMA].replace, ",");
-		static_strcpy(inf_entities[LK_DLL].replace, "libusbk.dll");
-		static_strcpy(inf_entities[LK_X86_DLL].replace, "libusbk_x86.dll");
-		static_strcpy(inf_entities[LK_EQ_X86].replace, "= 1,x86");
-		static_strcpy(inf_entities[LK_EQ_X64].replace, "= 1,amd64");
+		if ( (!set_inf_value(ctx, LK_COMMA, ","))
+		  || (!set_inf_value(ctx, LK_DLL, "libusbk.dll"))
+		  || (!set_inf_value(ctx, LK_X86_DLL, "libusbk_x86.dll"))
+		  || (!set_inf_value(ctx, LK_EQ_X86, "= 1,x86"))
+		  || (!set_inf_value(ctx, LK_EQ_X64, "= 1,amd64")) ) {
+			return WDI_ERROR_RESOURCE;
+		}
 	}
 
-	// For custom drivers, as we cannot autogenerate the inf, simply extract binaries
 	if (driver_type == WDI_USER) {
-		wdi_info("custom driver - extracting binaries only (no inf/cat creation)");
-		r = extract_binaries(drv_path);
-		goto out;
+		return WDI_SUCCESS;
 	}
 
-	if (device_info->desc == NULL) {
-		wdi_err("no device ID was given for the device - aborting");
-		r = WDI_ERROR_INVALID_PARAM;
-		goto out;
+	// Set the WDF and KMDF versions for WinUSB and libusbK
+	if ( (!set_inf_value(ctx, WDF_VERSION, "%05d", WDF_VER))
+	  || (!set_inf_value(ctx, KMDF_VERSION, "%d.%d", WDF_VER/1000, WDF_VER%1000)) ) {
+		return WDI_ERROR_RESOURCE;
 	}
 
-	r = extract_binaries(drv_path);
-	if (r != WDI_SUCCESS) {
-		goto out;
+	// Write the date and version data
+	file_time.dwHighDateTime = driver_version.dwFileDateMS;
+	file_time.dwLowDateTime = driver_version.dwFileDateLS;
+	if ( ((file_time.dwHighDateTime == 0) && (file_time.dwLowDateTime == 0))
+	  || (!FileTimeToLocalFileTime(&file_time, &local_time))
+	  || (!FileTimeToSystemTime(&local_time, &system_time)) ) {
+		GetLocalTime(&system_time);
+	}
+	if ( (!set_inf_value(ctx, DRIVER_DATE,
+		"%02d/%02d/%04d", system_time.wMonth, system_time.wDay, system_time.wYear))
+	  || (!set_inf_value(ctx, DRIVER_VERSION, "%d.%d.%d.%d",
+		(int)driver_version.dwFileVersionMS>>16, (int)driver_version.dwFileVersionMS&0xFFFF,
+		(int)driver_version.dwFileVersionLS>>16, (int)driver_version.dwFileVersionLS&0xFFFF)) ) {
+		return WDI_ERROR_RESOURCE;
+	}
+	return WDI_SUCCESS;
+}
+
+// Create the inf and cat files of a device, in a directory where the driver
+// binaries have already been extracted by extract_binaries()
+static int prepare_device(struct prepare_context* ctx, struct wdi_device_info* device_info,
+						  const char* inf_name)
+{
+	const char* vendor_name = NULL;
+	const char* cat_list[CAT_LIST_MAX_ENTRIES+1];
+	char inf_path[MAX_PATH], cat_path[MAX_PATH], hw_id[40], cert_subject[64];
+	char guid_string[MAX_GUID_STRING_LENGTH];
+	char *strguid, *token, *end, *next, *cat_name = NULL, *dst = NULL;
+	int r, nb_entries, driver_type = ctx->driver_type;
+	long cat_file_size;
+	BOOL is_android_device = FALSE;
+	GUID guid;
+	struct wdi_options_prepare_driver* options = ctx->options;
+
+	// Extra check, in case somebody modifies our code
+	if ((driver_type < 0) || (driver_type >= WDI_USER)) {
+		wdi_err("program assertion failed - driver type index out of range");
+		return WDI_ERROR_OTHER;
 	}
 
 	// Populate the inf and cat names & paths
-	if ( (strlen(drv_path) >= MAX_PATH) || (strlen(inf_name) >= MAX_PATH) ||
-		 ((strlen(drv_path) + strlen(inf_name)) > (MAX_PATH - 2)) ) {
-		wdi_err("qualified path for inf file is too long: '%s\\%s", drv_path, inf_name);
-		r = WDI_ERROR_RESOURCE;
-		goto out;
+	if ( (strlen(ctx->drv_path) >= MAX_PATH) || (strlen(inf_name) >= MAX_PATH) ||
+		 ((strlen(ctx->drv_path) + strlen(inf_name)) > (MAX_PATH - 2)) ) {
+		wdi_err("qualified path for inf file is too long: '%s\\%s", ctx->drv_path, inf_name);
+		return WDI_ERROR_RESOURCE;
 	}
-	safe_strcpy(inf_path, sizeof(inf_path), drv_path);
+	safe_strcpy(inf_path, sizeof(inf_path), ctx->drv_path);
 	safe_strcat(inf_path, sizeof(inf_path), "\\");
 	safe_strcat(inf_path, sizeof(inf_path), inf_name);
 	safe_strcpy(cat_path, sizeof(cat_path), inf_path);
 	if (safe_strlen(cat_path) < 4) {
 		wdi_err("qualified path for inf file is too short: '%s", cat_path);
-		r = WDI_ERROR_RESOURCE;
-		goto out;
+		return WDI_ERROR_RESOURCE;
 	}
 	cat_path[safe_strlen(cat_path)-3] = 'c';
 	cat_path[safe_strlen(cat_path)-2] = 'a';
 	cat_path[safe_strlen(cat_path)-1] = 't';
 
-	static_strcpy(inf_entities[INF_FILENAME].replace, inf_name);
 	cat_name = safe_strdup(inf_name);
 	if (cat_name == NULL) {
-		r = WDI_ERROR_RESOURCE;
-		goto out;
+		return WDI_ERROR_RESOURCE;
 	}
 	cat_name[safe_strlen(inf_name)-3] = 'c';
 	cat_name[safe_strlen(inf_name)-2] = 'a';
 	cat_name[safe_strlen(inf_name)-1] = 't';
-	static_strcpy(inf_entities[CAT_FILENAME].replace, cat_name);
+	if ( (!set_inf_value(ctx, INF_FILENAME, "%s", inf_name))
+	  || (!set_inf_value(ctx, CAT_FILENAME, "%s", cat_name)) ) {
+		safe_free(cat_name);
+		return WDI_ERROR_RESOURCE;
+	}
 	safe_free(cat_name);
 
 	// Populate the Device Description and Hardware ID
-	static_strcpy(inf_entities[DEVICE_DESCRIPTION].replace, device_info->desc);
+	if (!set_inf_value(ctx, DEVICE_DESCRIPTION, "%s", device_info->desc)) {
+		return WDI_ERROR_RESOURCE;
+	}
 	if ((options != NULL) && (options->use_wcid_driver)) {
-		static_strcpy(inf_entities[DEVICE_HARDWARE_ID].replace, ms_compat_id[driver_type]);
-		static_strcpy(inf_entities[USE_DEVICE_INTERFACE_GUID].replace, "NoDeviceInterfaceGUID");
+		if ( (!set_inf_value(ctx, DEVICE_HARDWARE_ID, "%s", ms_compat_id[driver_type]))
+		  || (!set_inf_value(ctx, USE_DEVICE_INTERFACE_GUID, "NoDeviceInterfaceGUID")) ) {
+			return WDI_ERROR_RESOURCE;
+		}
 	} else {
 		if (device_info->is_composite) {
-			static_sprintf(inf_entities[DEVICE_HARDWARE_ID].replace, "VID_%04X&PID_%04X&MI_%02X",
-				device_info->vid, device_info->pid, device_info->mi);
+			if (!set_inf_value(ctx, DEVICE_HARDWARE_ID, "VID_%04X&PID_%04X&MI_%02X",
+				device_info->vid, device_info->pid, device_info->mi)) {
+				return WDI_ERROR_RESOURCE;
+			}
 		} else {
-			static_sprintf(inf_entities[DEVICE_HARDWARE_ID].replace, "VID_%04X&PID_%04X",
-				device_info->vid, device_info->pid);
+			if (!set_inf_value(ctx, DEVICE_HARDWARE_ID, "VID_%04X&PID_%04X",
+				device_info->vid, device_info->pid)) {
+				return WDI_ERROR_RESOURCE;
+			}
+		}
+		if (!set_inf_value(ctx, USE_DEVICE_INTERFACE_GUID, "AddDeviceInterfaceGUID")) {
+			return WDI_ERROR_RESOURCE;
 		}
-		static_strcpy(inf_entities[USE_DEVICE_INTERFACE_GUID].replace, "AddDeviceInterfaceGUID");
 	}
 
 	// Find out if we have an Android device
-	for (i=0; i<ARRAYSIZE(android_device); i++) {
-		if ((android_device[i].vid == device_info->vid) && (android_device[i].pid == device_info->pid)) {
-			is_android_device = TRUE;
-			break;
-		}
-	}
+	is_android_device = ((get_device_quirks(device_info->vid, device_info->pid) & DEVICE_QUIRK_ANDROID) != 0);
 
 	// Populate the Device Interface GUID
 	if ((options != NULL) && (options->use_wcid_driver)) {
@@ -1207,134 +2030,305 @@ int LIBWDI_API wdi_prepare_driver(struct wdi_device_info* device_info, const cha
 		strguid = (char*)android_device_guid;
 	} else {
 		IGNORE_RETVAL(CoCreateGuid(&guid));
-		strguid = guid_to_string(guid);
+		strguid = guid_to_string(guid, guid_string);
+	}
+	if (!set_inf_value(ctx, DEVICE_INTERFACE_GUID, "%s", strguid)) {
+		return WDI_ERROR_RESOURCE;
 	}
-	static_sprintf(inf_entities[DEVICE_INTERFACE_GUID].replace, "%s", strguid);
 
 	// Resolve the Manufacturer (Vendor Name)
 	if ((options != NULL) && (options->vendor_name != NULL)) {
-		static_strcpy(inf_entities[DEVICE_MANUFACTURER].replace, options->vendor_name);
+		vendor_name = options->vendor_name;
 	} else {
 		vendor_name = wdi_get_vendor_name(device_info->vid);
 		if (vendor_name == NULL) {
 			vendor_name = "(Undefined Vendor)";
 		}
-		static_strcpy(inf_entities[DEVICE_MANUFACTURER].replace, vendor_name);
+	}
+	if (!set_inf_value(ctx, DEVICE_MANUFACTURER, "%s", vendor_name)) {
+		return WDI_ERROR_RESOURCE;
 	}
 
-	// Set the WDF and KMDF versions for WinUSB and libusbK
-	static_sprintf(inf_entities[WDF_VERSION].replace, "%05d", WDF_VER);
-	static_sprintf(inf_entities[KMDF_VERSION].replace, "%d.%d", WDF_VER/1000, WDF_VER%1000);
+	// Tokenize the file
+	r = write_inf(ctx, inf_path);
+	if (r != WDI_SUCCESS) {
+		return r;
+	}
+	wdi_info("successfully created '%s'", inf_path);
 
-	// Extra check, in case somebody modifies our code
-	if ((driver_type < 0) && (driver_type >= WDI_USER)) {
-		wdi_err("program assertion failed - driver_version[] index out of range");
-		r = WDI_ERROR_OTHER;
-		goto out;
+	if (!IsUserAnAdmin()) {
+		wdi_info("No .cat file generated (missing elevated privileges)");
+		return WDI_SUCCESS;
 	}
 
-	// Write the date and version data
-	file_time.dwHighDateTime = driver_version[driver_type].dwFileDateMS;
-	file_time.dwLowDateTime = driver_version[driver_type].dwFileDateLS;
-	if ( ((file_time.dwHighDateTime == 0) && (file_time.dwLowDateTime == 0))
-	  || (!FileTimeToLocalFileTime(&file_time, &local_time))
-	  || (!FileTimeToSystemTime(&local_time, &system_time)) ) {
-		GetLocalTime(&system_time);
+	// Try to create and self-sign the cat file to remove security prompts
+	if ((options != NULL) && (options->disable_cat)) {
+		wdi_info(".cat generation disabled by user");
+		return WDI_SUCCESS;
 	}
-	static_sprintf(inf_entities[DRIVER_DATE].replace,
-		"%02d/%02d/%04d", system_time.wMonth, system_time.wDay, system_time.wYear);
-	static_sprintf(inf_entities[DRIVER_VERSION].replace, "%d.%d.%d.%d",
-		(int)driver_version[driver_type].dwFileVersionMS>>16, (int)driver_version[driver_type].dwFileVersionMS&0xFFFF,
-		(int)driver_version[driver_type].dwFileVersionLS>>16, (int)driver_version[driver_type].dwFileVersionLS&0xFFFF);
+	wdi_info("Creating and self-signing a .cat file...");
 
-	// Tokenize the file
-	if ((inf_file_size = tokenize_internal(inf_template[driver_type],
-		&dst, inf_entities, "#", "#", 0)) > 0) {
-		fd = fopen_as_userU(inf_path, "w");
-		if (fd == NULL) {
-			wdi_err("failed to create file: %s", inf_path);
-			r = WDI_ERROR_ACCESS;
-			goto out;
-		}
-		// Converting to UTF-16 is the only way to get devices using a
-		// non-English locale to display properly in device manager. UTF-8 will not do.
-		wdst = utf8_to_wchar(dst);
-		if (wdst == NULL) {
-			wdi_err("could not convert '%s' to UTF-16", dst);
-			safe_free(dst);
-			r = WDI_ERROR_RESOURCE;
-			goto out;
+	// Tokenize the cat file (for WDF version)
+	if ((cat_file_size = tokenize_internal(ctx, cat_template[driver_type],
+		&cat_compiled[driver_type], &dst)) <= 0) {
+		wdi_err("could not tokenize cat file (%ld)", cat_file_size);
+		return WDI_ERROR_ACCESS;
+	}
+
+	// Build the filename list, from the lines of the cat file. Unlike strtok(), this can
+	// run from several threads at once
+	nb_entries = 0;
+	for (token = dst; *token != 0; token = next) {
+		end = token + strcspn(token, "\n\r");
+		next = (*end != 0) ? end + 1 : end;
+		// Eliminate leading, trailing spaces & comments (#...)
+		while ((token < end) && isspace((unsigned char)*token)) token++;
+		while ((end > token) && isspace((unsigned char)end[-1])) end--;
+		*end = 0;
+		if ((*token == '#') || (*token == 0)) continue;
+		cat_list[nb_entries++] = token;
+		if (nb_entries >= CAT_LIST_MAX_ENTRIES) {
+			wdi_warn("more than %d cat entries - ignoring the rest", CAT_LIST_MAX_ENTRIES);
+			break;
 		}
-		fwrite(&bom, 2, 1, fd);	// Write the BOM
-		fwrite(wdst, 2, wcslen(wdst), fd);
-		fclose(fd);
-		safe_free(wdst);
-		safe_free(dst);
-	} else {
-		wdi_err("could not tokenize inf file (%d)", inf_file_size);
-		r = WDI_ERROR_ACCESS;
+	}
+
+	// Add the inf name to our list
+	cat_list[nb_entries++] = inf_name;
+
+	// the DEVICE_HARDWARE_ID is either "VID_####&PID_####[&MI_##]" or the MS Compatible ID
+	static_sprintf(hw_id, "USB\\%s", ctx->values[DEVICE_HARDWARE_ID]);
+	static_sprintf(cert_subject, "CN=%s (libwdi autogenerated)", hw_id);
+
+	// Failures on the following aren't fatal errors
+	if (!CreateCat(cat_path, hw_id, ctx->drv_path, cat_list, nb_entries, ctx->extracted)) {
+		wdi_warn("could not create cat file");
+	} else if ((options != NULL) && (!options->disable_signing) && (!SelfSignFile(cat_path,
+		(options->cert_subject != NULL)?options->cert_subject:cert_subject))) {
+		wdi_warn("could not sign cat file");
+	}
+	safe_free(dst);
+	return WDI_SUCCESS;
+}
+
+// Create an inf and extract coinstallers in the directory pointed by path
+int LIBWDI_API wdi_prepare_driver(struct wdi_device_info* device_info, const char* path,
+								  const char* inf_name, struct wdi_options_prepare_driver* options)
+{
+	struct prepare_context ctx = { { NULL } };
+	int r;
+
+	// All the state of a call is kept in ctx and on the stack, and the parts that
+	// must be serialized, such as self-signing, are locked where they happen, so
+	// that packages can be prepared concurrently in different directories.
+
+	GET_WINDOWS_VERSION;
+	if (nWindowsVersion < WINDOWS_7) {
+		wdi_err("this version of Windows is no longer supported");
+		return WDI_ERROR_NOT_SUPPORTED;
+	}
+
+	if (device_info == NULL) {
+		wdi_err("one of the required parameter is NULL");
+		return WDI_ERROR_INVALID_PARAM;
+	}
+
+	r = check_inf_name(inf_name);
+	if (r != WDI_SUCCESS) {
+		return r;
+	}
+
+	r = init_prepare_context(&ctx, path, options);
+	if (r != WDI_SUCCESS) {
 		goto out;
 	}
-	wdi_info("successfully created '%s'", inf_path);
 
-	if (IsUserAnAdmin()) {
-		// Try to create and self-sign the cat file to remove security prompts
-		if ((options != NULL) && (options->disable_cat)) {
-			wdi_info(".cat generation disabled by user");
-			r = WDI_SUCCESS;
-			goto out;
-		}
-		wdi_info("Creating and self-signing a .cat file...");
+	// For custom drivers, as we cannot autogenerate the inf, simply extract binaries
+	if (ctx.driver_type == WDI_USER) {
+		wdi_info("custom driver - extracting binaries only (no inf/cat creation)");
+		r = extract_binaries(ctx.drv_path, options, ctx.extracted);
+		goto out;
+	}
 
-		// Tokenize the cat file (for WDF version)
-		if ((cat_file_size = tokenize_internal(cat_template[driver_type],
-			&dst, inf_entities, "#", "#", 0)) <= 0) {
-			wdi_err("could not tokenize inf file (%d)", inf_file_size);
-			r = WDI_ERROR_ACCESS;
-			goto out;
-		}
+	if (device_info->desc == NULL) {
+		wdi_err("no device ID was given for the device - aborting");
+		r = WDI_ERROR_INVALID_PARAM;
+		goto out;
+	}
+
+	r = extract_binaries(ctx.drv_path, options, ctx.extracted);
+	if (r != WDI_SUCCESS) {
+		goto out;
+	}
+
+	r = prepare_device(&ctx, device_info, inf_name);
+
+out:
+	free_prepare_context(&ctx);
+	return r;
+}
+
+// Shared state of the threads of wdi_prepare_driver_batch()
+struct prepare_batch {
+	const struct prepare_context* ctx;
+	struct wdi_prepare_driver_device* devices;
+	int nb_devices;
+	volatile LONG next_device;
+	struct log_buffer* logs;	// messages of each device, logged once all the threads are done
+};
 
-		// Build the filename list
-		nb_entries = 0;
-		token = strtok(dst, "\n\r");
-		do {
-			// Eliminate leading, trailing spaces & comments (#...)
-			while (isspace(*token)) token++;
-			while (strlen(token) && isspace(token[strlen(token)-1]))
-				token[strlen(token)-1] = 0;
-			if ((*token == '#') || (*token == 0)) continue;
-			cat_list[nb_entries++] = token;
-			if (nb_entries >= CAT_LIST_MAX_ENTRIES) {
-				wdi_warn("more than %d cat entries - ignoring the rest", CAT_LIST_MAX_ENTRIES);
+static DWORD WINAPI prepare_batch_thread(LPVOID param)
+{
+	struct prepare_batch* batch = (struct prepare_batch*)param;
+	struct prepare_context ctx;
+	int i, tag;
+
+	while ((i = (int)InterlockedIncrement(&batch->next_device) - 1) < batch->nb_devices) {
+		if (batch->devices[i].status != WDI_SUCCESS) {
+			continue;
+		}
+		wdi_log_defer(&batch->logs[i]);
+		// Each device gets its own copy of the values that are shared by the batch
+		memset(&ctx, 0, sizeof(ctx));
+		static_strcpy(ctx.drv_path, batch->ctx->drv_path);
+		ctx.driver_type = batch->ctx->driver_type;
+		ctx.options = batch->ctx->options;
+		// The flags of the extraction are shared, and freed with batch->ctx
+		ctx.extracted = batch->ctx->extracted;
+		for (tag = 0; tag < NB_INF_TAGS; tag++) {
+			if ((batch->ctx->values[tag] != NULL) && (!set_inf_value(&ctx, tag, "%s", batch->ctx->values[tag]))) {
+				batch->devices[i].status = WDI_ERROR_RESOURCE;
 				break;
 			}
-		} while ((token = strtok(NULL, "\n\r")) != NULL);
+		}
+		if (batch->devices[i].status == WDI_SUCCESS) {
+			batch->devices[i].status = prepare_device(&ctx, batch->devices[i].device_info,
+				batch->devices[i].inf_name);
+		}
+		ctx.extracted = NULL;
+		free_prepare_context(&ctx);
+		wdi_log_defer(NULL);
+	}
+	return 0;
+}
 
-		// Add the inf name to our list
-		cat_list[nb_entries++] = inf_name;
+#define PREPARE_BATCH_MAX_THREADS 32
+// Create the infs of a set of devices in the directory pointed by path, with the
+// driver binaries, that are shared by all the devices, extracted only once
+int LIBWDI_API wdi_prepare_driver_batch(struct wdi_prepare_driver_device* devices, int nb_devices,
+								  const char* path, struct wdi_options_prepare_driver* options)
+{
+	struct prepare_context ctx = { { NULL } };
+	struct prepare_batch batch = { NULL };
+	HANDLE thread[PREPARE_BATCH_MAX_THREADS];
+	SYSTEM_INFO si;
+	int i, j, nb_threads, nb_started = 0, r;
+
+	GET_WINDOWS_VERSION;
+	if (nWindowsVersion < WINDOWS_7) {
+		wdi_err("this version of Windows is no longer supported");
+		return WDI_ERROR_NOT_SUPPORTED;
+	}
 
-		// the DEVICE_HARDWARE_ID is either "VID_####&PID_####[&MI_##]" or the MS Compatible ID
-		static_sprintf(hw_id, "USB\\%s", ((options != NULL) && (options->use_wcid_driver))?
-			ms_compat_id[driver_type]:inf_entities[DEVICE_HARDWARE_ID].replace);
-		static_sprintf(cert_subject, "CN=%s (libwdi autogenerated)", hw_id);
+	if ((devices == NULL) || (nb_devices <= 0)) {
+		wdi_err("one of the required parameter is NULL");
+		return WDI_ERROR_INVALID_PARAM;
+	}
 
-		// Failures on the following aren't fatal errors
-		if (!CreateCat(cat_path, hw_id, drv_path, cat_list, nb_entries)) {
-			wdi_warn("could not create cat file");
-		} else if ((options != NULL) && (!options->disable_signing) && (!SelfSignFile(cat_path,
-			(options->cert_subject != NULL)?options->cert_subject:cert_subject))) {
-			wdi_warn("could not sign cat file");
+	// Invalid devices get their own status, without failing the whole batch
+	for (i = 0; i < nb_devices; i++) {
+		devices[i].status = check_inf_name(devices[i].inf_name);
+		if ((devices[i].status == WDI_SUCCESS) && (devices[i].device_info == NULL)) {
+			wdi_err("one of the required parameter is NULL");
+			devices[i].status = WDI_ERROR_INVALID_PARAM;
 		}
-		safe_free(cat_in_copy);
-		safe_free(dst);
-	} else {
-		wdi_info("No .cat file generated (missing elevated privileges)");
 	}
-	r = WDI_SUCCESS;
+	// Devices with the same inf name would overwrite each other's inf and cat
+	for (i = 1; i < nb_devices; i++) {
+		for (j = 0; (j < i) && (devices[i].status == WDI_SUCCESS); j++) {
+			if ((devices[j].status == WDI_SUCCESS) && (_stricmp(devices[i].inf_name, devices[j].inf_name) == 0)) {
+				wdi_err("inf name '%s' of device #%d is already used by device #%d", devices[i].inf_name, i, j);
+				devices[i].status = WDI_ERROR_INVALID_PARAM;
+			}
+		}
+	}
+
+	r = init_prepare_context(&ctx, path, options);
+	if (r != WDI_SUCCESS) {
+		goto out;
+	}
+
+	// For custom drivers, as we cannot autogenerate the inf, simply extract binaries
+	if (ctx.driver_type == WDI_USER) {
+		wdi_info("custom driver - extracting binaries only (no inf/cat creation)");
+		r = extract_binaries(ctx.drv_path, options, ctx.extracted);
+		goto out;
+	}
+
+	for (i = 0; i < nb_devices; i++) {
+		if ((devices[i].status == WDI_SUCCESS) && (devices[i].device_info->desc == NULL)) {
+			wdi_err("no device ID was given for device #%d", i);
+			devices[i].status = WDI_ERROR_INVALID_PARAM;
+		}
+	}
+
+	r = extract_binaries(ctx.drv_path, options, ctx.extracted);
+	if (r != WDI_SUCCESS) {
+		goto out;
+	}
+
+	// The infs and cats are independent, so prepare them in parallel
+	batch.logs = (struct log_buffer*)calloc(nb_devices, sizeof(struct log_buffer));
+	if (batch.logs == NULL) {
+		r = WDI_ERROR_RESOURCE;
+		goto out;
+	}
+	batch.ctx = &ctx;
+	batch.devices = devices;
+	batch.nb_devices = nb_devices;
+	batch.next_device = 0;
+	GetSystemInfo(&si);
+	nb_threads = min((int)si.dwNumberOfProcessors, nb_devices);
+	nb_threads = min(max(nb_threads, 1), PREPARE_BATCH_MAX_THREADS);
+	for (i = 0; i < nb_threads; i++) {
+		thread[nb_started] = CreateThread(NULL, 0, prepare_batch_thread, &batch, 0, NULL);
+		if (thread[nb_started] == NULL) {
+			wdi_warn("could not create thread: %s", windows_error_str(0));
+			continue;
+		}
+		nb_started++;
+	}
+	if (nb_started == 0) {
+		// Prepare the devices from this thread then
+		prepare_batch_thread(&batch);
+	}
+	for (i = 0; i < nb_started; i++) {
+		WaitForSingleObject(thread[i], INFINITE);
+		CloseHandle(thread[i]);
+	}
+	for (i = 0; i < nb_devices; i++) {
+		wdi_log_flush(&batch.logs[i]);
+	}
 
 out:
-	CloseHandle(mutex);
-	return r;
+	safe_free(batch.logs);
+	free_prepare_context(&ctx);
+	if (r != WDI_SUCCESS) {
+		// A failure of the batch applies to all the devices that were valid
+		for (i = 0; i < nb_devices; i++) {
+			if (devices[i].status == WDI_SUCCESS) {
+				devices[i].status = r;
+			}
+		}
+		return r;
+	}
+	// Report the first device that failed, if any
+	for (i = 0; i < nb_devices; i++) {
+		if (devices[i].status != WDI_SUCCESS) {
+			return devices[i].status;
+		}
+	}
+	return WDI_SUCCESS;
 }
 
 // Handle messages received from the elevated installer through the pipe
@@ -1747,6 +2741,9 @@ int LIBWDI_API wdi_install_trusted_certificate(const char* cert_name,
 	int i, r;
 	HWND hWnd = NULL;
 	BOOL disable_warning = FALSE;
+	unsigned char* cert_buffer = NULL;
+	size_t cert_buffer_size = 0;
+	const unsigned char* cert_data;
 
 	GET_WINDOWS_VERSION;
 	if (nWindowsVersion < WINDOWS_7) {
@@ -1761,12 +2758,8 @@ int LIBWDI_API wdi_install_trusted_certificate(const char* cert_name,
 	}
 
 	if (IsUserAnAdmin()) {
-		for (i=0; i<nb_resources; i++) {
-			if (safe_strcmp(cert_name, resource[i].name) == 0) {
-				break;
-			}
-		}
-		if (i == nb_resources) {
+		i = find_resource(NULL, cert_name);
+		if (i < 0) {
 			wdi_err("unable to locate certificate '%s' in embedded resources", cert_name);
 			r = WDI_ERROR_NOT_FOUND;
 			goto out;
@@ -1777,7 +2770,12 @@ int LIBWDI_API wdi_install_trusted_certificate(const char* cert_name,
 			disable_warning = options->disable_warning;
 		}
 
-		if (!AddCertToTrustedPublisher((BYTE*)resource[i].data, (DWORD)resource[i].size, disable_warning, hWnd)) {
+		cert_data = get_resource_data(i, &cert_buffer, &cert_buffer_size);
+		if (cert_data == NULL) {
+			r = WDI_ERROR_RESOURCE;
+			goto out;
+		}
+		if (!AddCertToTrustedPublisher((BYTE*)cert_data, (DWORD)resource[i].size, disable_warning, hWnd)) {
 			wdi_warn("could not add certificate '%s' as Trusted Publisher", cert_name);
 			r = WDI_ERROR_RESOURCE;
 			goto out;
@@ -1790,6 +2788,7 @@ int LIBWDI_API wdi_install_trusted_certificate(const char* cert_name,
 	wdi_err("this call must be run with elevated privileges");
 	r = WDI_ERROR_NEEDS_ADMIN;
 out:
+	safe_free(cert_buffer);
 	return r;
 }
 
@@ -25,6 +25,12 @@
  */
 #define WDI_MAX_STRLEN		200
 
+/*
+ * Version of the API, which is increased when applications need to be updated
+ * 2: the strings of the devices of a list belong to the list (see wdi_destroy_list())
+ */
+#define LIBWDI_API_VERSION	2
+
 #if defined(DLL_EXPORT)
 #define LIBWDI_EXP __declspec(dllexport)
 #else
@@ -54,6 +60,21 @@ enum wdi_driver_type {
 	WDI_NB_DRIVERS	// Total number of drivers in the enum
 };
 
+/*
+ * Class of a driver (service), as returned by wdi_get_driver_class()
+ */
+enum wdi_driver_class {
+	WDI_DRIVER_CLASS_UNKNOWN,
+	/** One of the drivers that libwdi installs (WinUSB, libusb0, libusbK, usbser) */
+	WDI_DRIVER_CLASS_LIBWDI,
+	/** A system driver, that should not be replaced */
+	WDI_DRIVER_CLASS_SYSTEM,
+	/** A USB hub driver, which is also a system driver */
+	WDI_DRIVER_CLASS_HUB,
+	/** The composite parent driver (usbccgp), which is also a system driver */
+	WDI_DRIVER_CLASS_COMPOSITE
+};
+
 /*
  * Log level
  */
@@ -170,6 +191,36 @@ struct wdi_device_info {
 	UINT64 driver_version;
 };
 
+/*
+ * Fields of a USB device ID (USB\VID_xxxx&PID_xxxx&MI_xx\<instance>) or hardware ID
+ * (USB\VID_xxxx&PID_xxxx&REV_xxxx&MI_xx), as returned by wdi_parse_device_id()
+ */
+struct wdi_device_id {
+	/** Whether each of the fields below was found */
+	BOOL has_vid;
+	BOOL has_pid;
+	BOOL has_rev;
+	BOOL has_mi;
+	/** USB VID */
+	unsigned short vid;
+	/** USB PID */
+	unsigned short pid;
+	/** Device revision (BCD) */
+	unsigned short rev;
+	/** Composite USB interface number */
+	unsigned char mi;
+	/** (Optional) Enumerator, such as "USB", within the parsed string, and not NUL terminated. NULL if unused */
+	const char* enumerator;
+	/** Length of the enumerator */
+	size_t enumerator_length;
+	/** (Optional) Instance ID, within the parsed string, and not NUL terminated. NULL if unused */
+	const char* instance;
+	/** Length of the instance ID */
+	size_t instance_length;
+	/** Whether the instance ID is the serial number of the device, rather than one that Windows made up */
+	BOOL is_serial;
+};
+
 /*
  * Optional settings, used by libwdi functions
  */
@@ -201,6 +252,22 @@ struct wdi_options_prepare_driver {
 	char* cert_subject;
 	/** Install a generic driver, for WCID devices, to allow for automated installation */
 	BOOL use_wcid_driver;
+	/** Only extract the driver files that are missing or differ from the ones already in the path */
+	BOOL incremental_extraction;
+	/** (Optional) Directory where each driver file is stored once, under its hash, and hardlinked from
+	  * the extraction path, or copied if it can't be linked. Modifying a linked file in place also
+	  * modifies its store entry, which is then rewritten the next time that it is needed */
+	char* store_path;
+};
+
+// wdi_prepare_driver_batch devices:
+struct wdi_prepare_driver_device {
+	/** Device to create an inf for */
+	struct wdi_device_info* device_info;
+	/** Name of the inf file to create, which must be unique in the batch */
+	const char* inf_name;
+	/** Result of the preparation for this device, set by wdi_prepare_driver_batch() */
+	int status;
 };
 
 // wdi_install_driver options:
@@ -243,6 +310,60 @@ LIBWDI_EXP BOOL LIBWDI_API wdi_is_file_embedded(const char* path, const char* na
  */
 LIBWDI_EXP const char* LIBWDI_API wdi_get_vendor_name(unsigned short vid);
 
+/*
+ * Retrieve the full Product name from a Vendor ID (VID) and Product ID (PID)
+ */
+LIBWDI_EXP const char* LIBWDI_API wdi_get_product_name(unsigned short vid, unsigned short pid);
+
+/*
+ * Retrieve the name of a USB class, or of one of its subclasses or protocols
+ * subclass and protocol can be -1, to only look up the class or the subclass
+ */
+LIBWDI_EXP const char* LIBWDI_API wdi_get_class_name(int class_code, int subclass, int protocol);
+
+/*
+ * Find the vendors which name contains pattern, case insensitively, and write up to
+ * max_vids of their VIDs to vids, best matches first: exact names, then names that
+ * start with pattern, then names with a word that starts with pattern, then the rest,
+ * shortest names first. Returns the number of VIDs written, or a WDI error code.
+ */
+LIBWDI_EXP int LIBWDI_API wdi_find_vendors(const char* pattern, unsigned short* vids, int max_vids);
+
+/*
+ * Load a usb.ids file (http://www.linux-usb.org/usb.ids), which names then take precedence
+ * over the built-in ones, and which is reloaded if modified. Call with NULL to unload it.
+ * Names returned from a usb.ids file remain valid until the next call to this function,
+ * as every version of the file that was reloaded is kept until then. It can be called while
+ * other threads look names up, but the names that they got may then be freed at any time.
+ */
+LIBWDI_EXP int LIBWDI_API wdi_load_usb_ids(const char* path);
+
+/*
+ * Return the class (enum wdi_driver_class) of a driver, from its service name
+ */
+LIBWDI_EXP int LIBWDI_API wdi_get_driver_class(const char* driver);
+
+/*
+ * Parse the enumerator, VID, PID, REV, MI and instance ID of a device or hardware ID, without any
+ * allocation. Returns WDI_ERROR_INVALID_PARAM if one of these fields is invalid, in which
+ * case the others are still parsed.
+ */
+LIBWDI_EXP int LIBWDI_API wdi_parse_device_id(const char* id, struct wdi_device_id* device_id);
+
+/*
+ * Record the USB devices of the system to a snapshot file, which can be loaded with
+ * wdi_load_device_snapshot(), e.g. to profile wdi_create_list() on another machine
+ */
+LIBWDI_EXP int LIBWDI_API wdi_save_device_snapshot(const char* path);
+
+/*
+ * Have wdi_create_list() list the devices of a snapshot, rather than the ones of the
+ * system, or restore the system devices if path is NULL. Each of the calls that the
+ * snapshot replaces is made to take latency microseconds. This function must not
+ * be issued concurrently with wdi_create_list().
+ */
+LIBWDI_EXP int LIBWDI_API wdi_load_device_snapshot(const char* path, unsigned int latency);
+
 /*
  * Return a wdi_device_info list of USB devices
  * parameter: driverless_only - boolean
@@ -252,15 +373,35 @@ LIBWDI_EXP int LIBWDI_API wdi_create_list(struct wdi_device_info** list,
 
 /*
  * Release a wdi_device_info list allocated by the previous call
+ * The devices and their strings are allocated along with the list, and released with it,
+ * so the application must not free them. It may point the strings of a device to strings
+ * of its own, which it keeps ownership of, and must free after this call if needed.
+ * Returns WDI_ERROR_INVALID_PARAM for a list that was not returned by wdi_create_list(),
+ * or that was already released.
  */
 LIBWDI_EXP int LIBWDI_API wdi_destroy_list(struct wdi_device_info* list);
 
 /*
  * Create an inf file for a specific device
+ * This call is reentrant, and can be used concurrently for different paths
+ * When a logger is registered, the messages of the threads other than the one of
+ * the logger window are dropped while the logger pipe is full
  */
 LIBWDI_EXP int LIBWDI_API wdi_prepare_driver(struct wdi_device_info* device_info, const char* path,
 								  const char* inf_name, struct wdi_options_prepare_driver* options);
 
+/*
+ * Create the inf files of a set of devices, for the same driver, in a single path
+ * The driver files are extracted once, and the infs and cats are created in parallel
+ * Returns WDI_SUCCESS if all the devices were prepared, or the first error otherwise,
+ * with the result for each device in its status field. A device whose inf name is
+ * already used by an earlier device fails with WDI_ERROR_INVALID_PARAM
+ * The messages of each device are logged in order, from the calling thread, once all
+ * the devices are done
+ */
+LIBWDI_EXP int LIBWDI_API wdi_prepare_driver_batch(struct wdi_prepare_driver_device* devices, int nb_devices,
+								  const char* path, struct wdi_options_prepare_driver* options);
+
 /*
  * Install a driver for a specific device
  */
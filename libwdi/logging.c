@@ -31,6 +31,8 @@
 #include <io.h>
 #include <fcntl.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "libwdi.h"
 #include "logging.h"
@@ -41,14 +43,29 @@ static HANDLE logger_wr_handle = INVALID_HANDLE_VALUE;
 static HWND logger_dest = NULL;
 static UINT logger_msg = 0;
 // Detect spurious log readouts
-static unsigned log_messages_pending = 0;
+static volatile LONG log_messages_pending = 0;
 // Keep track of how many bytes are in the pipe
-static DWORD log_messages_pipe_size = 0;
+static volatile LONG log_messages_pipe_size = 0;
+// Serializes the writes to the pipe, as any thread may log
+static volatile LONG logger_lock = 0;
 // Global debug level
 static int global_log_level = WDI_LOG_LEVEL_INFO;
+// When set, the messages of the current thread are kept there instead of being logged
+static THREAD_LOCAL struct log_buffer* deferred_log = NULL;
 
 extern char *windows_error_str(uint32_t retval);
 
+static __inline void lock_logger(void)
+{
+	while (InterlockedCompareExchange(&logger_lock, 1, 0) != 0)
+		SwitchToThread();
+}
+
+static __inline void unlock_logger(void)
+{
+	InterlockedExchange(&logger_lock, 0);
+}
+
 static void write_to_pipe(const char* buffer, DWORD size, enum wdi_log_level level)
 {
 	DWORD written;
@@ -62,16 +79,28 @@ static void write_to_pipe(const char* buffer, DWORD size, enum wdi_log_level lev
 	// See http://msdn.microsoft.com/en-us/library/aa365150.aspx
 	// If we are about to overflow, we deplete the pipe queue by issuing a bunch of
 	// SendMessage, which forces the messages to be processed (as opposed to PostMessage)
-	if (((log_messages_pipe_size + size) > LOGGER_PIPE_SIZE) && (log_messages_pending > 0)) {
+	// Only the thread of the destination window can do so: any other thread could wait
+	// on a window that waits on it, so its messages are dropped while the pipe is full
+	if ( ((log_messages_pipe_size + (LONG)size) > LOGGER_PIPE_SIZE) && (log_messages_pending > 0)
+	  && (GetWindowThreadProcessId(logger_dest, NULL) == GetCurrentThreadId()) ) {
 		while (log_messages_pending > 0)
 			SendMessage(logger_dest, logger_msg, (WPARAM)level, 0);
+	}
+
+	lock_logger();
+	if ((log_messages_pipe_size + (LONG)size) > LOGGER_PIPE_SIZE) {
+		if (log_messages_pending > 0) {
+			unlock_logger();
+			return;
+		}
 		// Just in case
-		log_messages_pipe_size = 0;
+		InterlockedExchange(&log_messages_pipe_size, 0);
 	}
 	if (WriteFile(logger_wr_handle, buffer, size, &written, NULL))
-		log_messages_pipe_size += written;
-	log_messages_pending++;
+		InterlockedExchangeAdd(&log_messages_pipe_size, (LONG)written);
+	InterlockedIncrement(&log_messages_pending);
 	PostMessage(logger_dest, logger_msg, (WPARAM)level, 0);
+	unlock_logger();
 }
 
 static void pipe_wdi_log_v(enum wdi_log_level level,
@@ -173,13 +202,49 @@ static void console_wdi_log_v(enum wdi_log_level level,
 
 }
 
+// Each message is stored as its level, followed by the NUL terminated function and text
+static void deferred_wdi_log_v(enum wdi_log_level level,
+	const char *function, const char *format, va_list args)
+{
+	char buffer[LOGBUF_SIZE];
+	size_t size, function_size, new_size;
+	char* data;
+
+#ifndef ENABLE_DEBUG_LOGGING
+	if (level < global_log_level)
+		return;
+#endif
+
+	// Messages that don't fit are truncated
+	safe_vsnprintf(buffer, LOGBUF_SIZE, format, args);
+	buffer[LOGBUF_SIZE-1] = 0;
+	size = strlen(buffer) + 1;
+	function_size = strlen(function) + 1;
+
+	if (deferred_log->size + 1 + function_size + size > deferred_log->max_size) {
+		new_size = max(2 * deferred_log->max_size, deferred_log->size + 1 + function_size + size + LOGBUF_SIZE);
+		data = (char*)realloc(deferred_log->data, new_size);
+		if (data == NULL)
+			return;
+		deferred_log->data = data;
+		deferred_log->max_size = new_size;
+	}
+	deferred_log->data[deferred_log->size++] = (char)level;
+	memcpy(&deferred_log->data[deferred_log->size], function, function_size);
+	deferred_log->size += function_size;
+	memcpy(&deferred_log->data[deferred_log->size], buffer, size);
+	deferred_log->size += size;
+}
+
 void wdi_log(enum wdi_log_level level,
 	const char *function, const char *format, ...)
 {
 	va_list args;
 
 	va_start (args, format);
-	if (logger_dest != NULL) {
+	if (deferred_log != NULL) {
+		deferred_wdi_log_v(level, function, format, args);
+	} else if (logger_dest != NULL) {
 		pipe_wdi_log_v(level, function, format, args);
 	} else {
 		console_wdi_log_v(level, function, format, args);
@@ -187,6 +252,42 @@ void wdi_log(enum wdi_log_level level,
 	va_end (args);
 }
 
+/*
+ * Keep the messages of the current thread in buffer, or log them again if buffer is NULL
+ * Worker threads should not log directly, as the logger window belongs to the thread
+ * that waits for them, so that it can't deplete the pipe, and their messages would
+ * be interleaved and dropped whenever the pipe is full
+ */
+void wdi_log_defer(struct log_buffer* buffer)
+{
+	deferred_log = buffer;
+}
+
+/*
+ * Log the messages kept in buffer, in order, and free them
+ */
+void wdi_log_flush(struct log_buffer* buffer)
+{
+	enum wdi_log_level level;
+	const char *function, *message;
+	size_t pos = 0;
+
+	if (buffer == NULL)
+		return;
+	while (pos < buffer->size) {
+		level = (enum wdi_log_level)buffer->data[pos++];
+		function = &buffer->data[pos];
+		pos += strlen(function) + 1;
+		message = &buffer->data[pos];
+		pos += strlen(message) + 1;
+		wdi_log(level, function, "%s", message);
+	}
+	free(buffer->data);
+	buffer->data = NULL;
+	buffer->size = 0;
+	buffer->max_size = 0;
+}
+
 // Create a synchronous pipe for messaging
 static int create_logger(DWORD buffsize)
 {
@@ -218,7 +319,7 @@ static int create_logger(DWORD buffsize)
 		return WDI_ERROR_RESOURCE;
 	}
 
-	log_messages_pending = 0;
+	InterlockedExchange(&log_messages_pending, 0);
 
 	return WDI_SUCCESS;
 }
@@ -322,15 +423,15 @@ int LIBWDI_API wdi_read_logger(char* buffer, DWORD buffer_size, DWORD* message_s
 		r = WDI_SUCCESS;
 		goto out;
 	}
-	log_messages_pending--;
+	InterlockedDecrement(&log_messages_pending);
 
 	if (ReadFile(logger_rd_handle, (void*)buffer, buffer_size, message_size, NULL)) {
-		log_messages_pipe_size -= *message_size;
+		InterlockedExchangeAdd(&log_messages_pipe_size, -(LONG)*message_size);
 		r = WDI_SUCCESS;
 		goto out;
 	}
 
-	log_messages_pipe_size -= *message_size;
+	InterlockedExchangeAdd(&log_messages_pipe_size, -(LONG)*message_size);
 	*message_size = 0;
 	err = GetLastError();
 	if ((err == ERROR_INSUFFICIENT_BUFFER) || (err == ERROR_MORE_DATA)) {
@@ -33,11 +33,21 @@
 #if defined(_MSC_VER)
 #define safe_vsnprintf(buf, size, format, arg) _vsnprintf_s(buf, size, _TRUNCATE, format, arg)
 #define safe_snprintf(buf, size, ...) _snprintf_s(buf, size, _TRUNCATE, __VA_ARGS__)
+#define THREAD_LOCAL __declspec(thread)
 #else
 #define safe_vsnprintf vsnprintf
 #define safe_snprintf snprintf
+#define THREAD_LOCAL __thread
 #endif
 
+// Log messages of a worker thread, that are kept until the calling thread, which
+// may own the logger window, emits them with wdi_log_flush()
+struct log_buffer {
+	char* data;
+	size_t size;
+	size_t max_size;
+};
+
 
 #if !defined(_MSC_VER) || _MSC_VER > 1200
 
@@ -91,3 +101,5 @@ void inline wdi_dbg(const char *format, ...)
 #endif /* !defined(_MSC_VER) || _MSC_VER > 1200 */
 
 extern void wdi_log(enum wdi_log_level level, const char *function, const char *format, ...);
+extern void wdi_log_defer(struct log_buffer* buffer);
+extern void wdi_log_flush(struct log_buffer* buffer);
@@ -0,0 +1,268 @@
+/*
+ * lz4.h: minimal LZ4 block compression, used for the embedded resources
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * This header is shared by the embedder, which compresses the resources on the
+ * build host, and by the library, which decompresses them on extraction.
+ *
+ * The data uses the standard LZ4 block format (https://github.com/lz4/lz4), split
+ * into chunks of up to LZ4_CHUNK_SIZE uncompressed bytes that can be decompressed
+ * independently, so that a resource can be streamed through a fixed size buffer.
+ * Each chunk is prefixed by its 32 bit little endian size, with LZ4_CHUNK_STORED
+ * set if the chunk is stored as is, because it could not be compressed.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#define LZ4_CHUNK_SIZE      0x10000
+#define LZ4_CHUNK_STORED    0x80000000
+#define LZ4_HASH_LOG        12
+#define LZ4_MIN_MATCH       4
+#define LZ4_MAX_OFFSET      0xFFFF
+// The last match must start at least 12 bytes before the end of the block
+#define LZ4_MF_LIMIT        12
+// And the last 5 bytes of a block are always literals
+#define LZ4_LAST_LITERALS   5
+
+// Maximum size of the compressed data for size bytes of input
+#define lz4_chunks_bound(size) ((size) + (size)/255 + 16 + 4*((size)/LZ4_CHUNK_SIZE + 1))
+
+static __inline uint32_t lz4_read32(const unsigned char* p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static __inline void lz4_write32(unsigned char* p, uint32_t v)
+{
+	p[0] = (unsigned char)v;
+	p[1] = (unsigned char)(v >> 8);
+	p[2] = (unsigned char)(v >> 16);
+	p[3] = (unsigned char)(v >> 24);
+}
+
+static __inline unsigned char* lz4_write_length(unsigned char* op, size_t len)
+{
+	for (; len >= 255; len -= 255)
+		*op++ = 255;
+	*op++ = (unsigned char)len;
+	return op;
+}
+
+static __inline unsigned char* lz4_write_sequence(unsigned char* op, const unsigned char* literals,
+	size_t nb_literals, size_t offset, size_t match_len)
+{
+	unsigned char* token = op++;
+
+	if (nb_literals >= 15) {
+		*token = 15 << 4;
+		op = lz4_write_length(op, nb_literals - 15);
+	} else {
+		*token = (unsigned char)(nb_literals << 4);
+	}
+	memcpy(op, literals, nb_literals);
+	op += nb_literals;
+	if (match_len == 0)	// last sequence
+		return op;
+	*op++ = (unsigned char)offset;
+	*op++ = (unsigned char)(offset >> 8);
+	match_len -= LZ4_MIN_MATCH;
+	if (match_len >= 15) {
+		*token |= 15;
+		op = lz4_write_length(op, match_len - 15);
+	} else {
+		*token |= (unsigned char)match_len;
+	}
+	return op;
+}
+
+/*
+ * Greedy LZ4 block compressor. dst must be at least size + size/255 + 16 bytes.
+ * Returns the size of the compressed block.
+ */
+static __inline size_t lz4_compress_block(const unsigned char* src, size_t size, unsigned char* dst)
+{
+	uint32_t table[1 << LZ4_HASH_LOG];
+	const unsigned char *ip = src, *anchor = src, *match, *mf_limit, *match_limit;
+	unsigned char* op = dst;
+	uint32_t h, seq;
+	size_t len;
+
+	if (size > LZ4_MF_LIMIT) {
+		// Only compute the limits when they are within the block
+		mf_limit = src + size - LZ4_MF_LIMIT;
+		match_limit = src + size - LZ4_LAST_LITERALS;
+		// Positions are stored +1, so that 0 means unused
+		memset(table, 0, sizeof(table));
+		while (ip < mf_limit) {
+			seq = lz4_read32(ip);
+			h = (seq * 2654435761U) >> (32 - LZ4_HASH_LOG);
+			match = (table[h] == 0) ? NULL : src + table[h] - 1;
+			table[h] = (uint32_t)(ip - src) + 1;
+			if ((match == NULL) || (ip - match > LZ4_MAX_OFFSET) || (lz4_read32(match) != seq)) {
+				ip++;
+				continue;
+			}
+			for (len = LZ4_MIN_MATCH; (ip + len < match_limit) && (match[len] == ip[len]); len++);
+			op = lz4_write_sequence(op, anchor, ip - anchor, ip - match, len);
+			ip += len;
+			anchor = ip;
+		}
+	}
+	op = lz4_write_sequence(op, anchor, src + size - anchor, 0, 0);
+	return op - dst;
+}
+
+/*
+ * Safe LZ4 block decompressor, that never reads or writes out of bounds.
+ * Returns the size of the decompressed data, or -1 on error.
+ */
+static __inline int lz4_decompress_block(const unsigned char* src, size_t src_size,
+	unsigned char* dst, size_t dst_size)
+{
+	const unsigned char *ip = src, *ip_end = src + src_size;
+	unsigned char *op = dst, *op_end = dst + dst_size;
+	size_t len, offset;
+	unsigned char token, b;
+
+	while (ip < ip_end) {
+		token = *ip++;
+		len = token >> 4;
+		if (len == 15) {
+			do {
+				if (ip >= ip_end)
+					return -1;
+				b = *ip++;
+				len += b;
+			} while (b == 255);
+		}
+		if ((len > (size_t)(ip_end - ip)) || (len > (size_t)(op_end - op)))
+			return -1;
+		memcpy(op, ip, len);
+		op += len;
+		ip += len;
+		if (ip == ip_end)	// last sequence
+			break;
+
+		if (ip_end - ip < 2)
+			return -1;
+		offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if ((offset == 0) || (offset > (size_t)(op - dst)))
+			return -1;
+		len = token & 0x0F;
+		if (len == 15) {
+			do {
+				if (ip >= ip_end)
+					return -1;
+				b = *ip++;
+				len += b;
+			} while (b == 255);
+		}
+		len += LZ4_MIN_MATCH;
+		if (len > (size_t)(op_end - op))
+			return -1;
+		// Matches may overlap with the data being written, so copy byte by byte
+		for (; len > 0; len--, op++)
+			*op = *(op - offset);
+	}
+	return (int)(op - dst);
+}
+
+/*
+ * Compress size bytes from src into chunks. dst must be at least lz4_chunks_bound(size).
+ * Returns the compressed size.
+ */
+static __inline size_t lz4_compress_chunks(const unsigned char* src, size_t size, unsigned char* dst)
+{
+	size_t pos, chunk_size, compressed_size;
+	unsigned char* op = dst;
+
+	for (pos = 0; pos < size; pos += chunk_size) {
+		chunk_size = size - pos;
+		if (chunk_size > LZ4_CHUNK_SIZE)
+			chunk_size = LZ4_CHUNK_SIZE;
+		compressed_size = lz4_compress_block(&src[pos], chunk_size, op + 4);
+		if (compressed_size >= chunk_size) {
+			memcpy(op + 4, &src[pos], chunk_size);
+			lz4_write32(op, (uint32_t)chunk_size | LZ4_CHUNK_STORED);
+			op += 4 + chunk_size;
+		} else {
+			lz4_write32(op, (uint32_t)compressed_size);
+			op += 4 + compressed_size;
+		}
+	}
+	return op - dst;
+}
+
+/*
+ * Decompress the chunk at *src into dst, which holds dst_size bytes, and advance
+ * *src to the next chunk. A chunk never decompresses to more than LZ4_CHUNK_SIZE.
+ * Returns the size of the decompressed chunk, or -1 on error, including when the
+ * chunk does not fit in dst.
+ */
+static __inline int lz4_decompress_chunk(const unsigned char** src, const unsigned char* src_end,
+	unsigned char* dst, size_t dst_size)
+{
+	uint32_t chunk_size;
+	int r;
+
+	if (dst_size > LZ4_CHUNK_SIZE)
+		dst_size = LZ4_CHUNK_SIZE;
+
+	if (src_end - *src < 4)
+		return -1;
+	chunk_size = lz4_read32(*src);
+	*src += 4;
+	if ((chunk_size & ~LZ4_CHUNK_STORED) > (uint32_t)(src_end - *src))
+		return -1;
+	if (chunk_size & LZ4_CHUNK_STORED) {
+		chunk_size &= ~LZ4_CHUNK_STORED;
+		if (chunk_size > dst_size)
+			return -1;
+		memcpy(dst, *src, chunk_size);
+		r = (int)chunk_size;
+	} else {
+		r = lz4_decompress_block(*src, chunk_size, dst, dst_size);
+	}
+	*src += chunk_size;
+	return r;
+}
+
+/*
+ * Decompress a whole set of chunks into dst, which must be at least dst_size.
+ * Returns the size of the decompressed data, or -1 on error.
+ */
+static __inline int lz4_decompress_chunks(const unsigned char* src, size_t src_size,
+	unsigned char* dst, size_t dst_size)
+{
+	const unsigned char* src_end = src + src_size;
+	size_t pos = 0;
+	int r;
+
+	while (src < src_end) {
+		// The decompressor checks its bounds, so the last chunk goes in place too
+		r = lz4_decompress_chunk(&src, src_end, &dst[pos], dst_size - pos);
+		if (r < 0)
+			return -1;
+		pos += r;
+	}
+	return (int)pos;
+}
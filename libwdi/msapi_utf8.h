@@ -21,6 +21,7 @@
  */
 #include <windows.h>
 #include <stdio.h>
+#include <string.h>
 #include <shlobj.h>
 #include <ctype.h>
 #include <commdlg.h>
@@ -34,6 +35,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <psapi.h>
+#include "transcode.h"
 
 #pragma once
 #if defined(_MSC_VER)
@@ -48,10 +50,6 @@ extern "C" {
 #define _LTEXT(txt) L##txt
 #define LTEXT(txt) _LTEXT(txt)
 
-#define wchar_to_utf8_no_alloc(wsrc, dest, dest_size) \
-	WideCharToMultiByte(CP_UTF8, 0, wsrc, -1, dest, dest_size, NULL, NULL)
-#define utf8_to_wchar_no_alloc(src, wdest, wdest_size) \
-	MultiByteToWideChar(CP_UTF8, 0, src, -1, wdest, wdest_size)
 #define Edit_ReplaceSelU(hCtrl, str) ((void)SendMessageLU(hCtrl, EM_REPLACESEL, (WPARAM)FALSE, str))
 #define ComboBox_AddStringU(hCtrl, str) ((int)(DWORD)SendMessageLU(hCtrl, CB_ADDSTRING, (WPARAM)FALSE, str))
 #define ComboBox_InsertStringU(hCtrl, index, str) ((int)(DWORD)SendMessageLU(hCtrl, CB_INSERTSTRING, (WPARAM)index, str))
@@ -77,82 +75,109 @@ extern "C" {
 #define wfree(p) sfree(w ## p)
 
 /*
- * Converts an UTF-16 string to UTF8 (allocate returned string)
- * Returns NULL on error
+ * Converts a NUL-terminated UTF-16 string to UTF8, into a buffer of dest_size bytes.
+ * Same as WideCharToMultiByte(CP_UTF8, 0, wsrc, -1, dest, dest_size, NULL, NULL):
+ * returns the size of the output, including the NUL terminator, or 0 on error.
+ * If dest_size is 0, only the size is returned.
  */
-static __inline char* wchar_to_utf8(const wchar_t* wstr)
+static __inline int wchar_to_utf8_no_alloc(const wchar_t* wsrc, char* dest, int dest_size)
+{
+	size_t size;
+
+	if ((wsrc == NULL) || (dest_size < 0) || ((dest == NULL) && (dest_size != 0))) {
+		SetLastError(ERROR_INVALID_PARAMETER);
+		return 0;
+	}
+	size = utf16_to_utf8((const uint16_t*)wsrc, wcslen(wsrc) + 1, dest, (size_t)dest_size);
+	if ((dest_size != 0) && (size > (size_t)dest_size)) {
+		SetLastError(ERROR_INSUFFICIENT_BUFFER);
+		return 0;
+	}
+	return (int)size;
+}
+
+/*
+ * Converts a NUL-terminated UTF8 string to UTF-16, into a buffer of wdest_size chars.
+ * Same as MultiByteToWideChar(CP_UTF8, 0, src, -1, wdest, wdest_size):
+ * returns the size of the output, including the NUL terminator, or 0 on error.
+ * If wdest_size is 0, only the size is returned.
+ */
+static __inline int utf8_to_wchar_no_alloc(const char* src, wchar_t* wdest, int wdest_size)
 {
-	int size = 0;
+	size_t size;
+
+	if ((src == NULL) || (wdest_size < 0) || ((wdest == NULL) && (wdest_size != 0))) {
+		SetLastError(ERROR_INVALID_PARAMETER);
+		return 0;
+	}
+	size = utf8_to_utf16(src, strlen(src) + 1, (uint16_t*)wdest, (size_t)wdest_size);
+	if ((wdest_size != 0) && (size > (size_t)wdest_size)) {
+		SetLastError(ERROR_INSUFFICIENT_BUFFER);
+		return 0;
+	}
+	return (int)size;
+}
+
+/*
+* Converts an non NUL-terminated UTF-16 string of length len to UTF8 (allocate returned string)
+* If wlen is -1, the string is NUL-terminated
+* Returns NULL on error
+*/
+static __inline char* wchar_len_to_utf8(const wchar_t* wstr, int wlen)
+{
+	size_t len, size;
 	char* str = NULL;
 
-	// Find out the size we need to allocate for our converted string
-	size = WideCharToMultiByte(CP_UTF8, 0, wstr, -1, NULL, 0, NULL, NULL);
-	if (size <= 1)	// An empty string would be size 1
+	if (wstr == NULL)
 		return NULL;
+	len = (wlen < 0) ? (wcslen(wstr) + 1) : (size_t)wlen;
 
-	if ((str = (char*)calloc(size, 1)) == NULL)
+	// Allocate for the worst case (3 bytes per UTF-16 unit), so that we only convert once
+	if ((str = (char*)malloc(3 * len + 1)) == NULL)
 		return NULL;
-
-	if (wchar_to_utf8_no_alloc(wstr, str, size) != size) {
+	size = utf16_to_utf8((const uint16_t*)wstr, len, str, 3 * len);
+	if (size <= 1) {	// An empty string would be size 1
 		sfree(str);
 		return NULL;
 	}
-
+	str[size] = 0;
 	return str;
 }
 
+/*
+ * Converts an UTF-16 string to UTF8 (allocate returned string)
+ * Returns NULL on error
+ */
+static __inline char* wchar_to_utf8(const wchar_t* wstr)
+{
+	return wchar_len_to_utf8(wstr, -1);
+}
+
 /*
  * Converts an UTF8 string to UTF-16 (allocate returned string)
  * Returns NULL on error
  */
 static __inline wchar_t* utf8_to_wchar(const char* str)
 {
-	int size = 0;
+	size_t len, size;
 	wchar_t* wstr = NULL;
 
 	if (str == NULL)
 		return NULL;
+	len = strlen(str) + 1;
 
-	// Find out the size we need to allocate for our converted string
-	size = MultiByteToWideChar(CP_UTF8, 0, str, -1, NULL, 0);
-	if (size <= 1)	// An empty string would be size 1
-		return NULL;
-
-	if ((wstr = (wchar_t*)calloc(size, sizeof(wchar_t))) == NULL)
+	// A UTF-16 string never has more units than its UTF-8 version has bytes,
+	// so we can allocate upfront and only convert once
+	if ((wstr = (wchar_t*)malloc(len * sizeof(wchar_t))) == NULL)
 		return NULL;
-
-	if (utf8_to_wchar_no_alloc(str, wstr, size) != size) {
+	size = utf8_to_utf16(str, len, (uint16_t*)wstr, len);
+	if (size <= 1) {	// An empty string would be size 1
 		sfree(wstr);
 		return NULL;
 	}
 	return wstr;
 }
 
-/*
-* Converts an non NUL-terminated UTF-16 string of length len to UTF8 (allocate returned string)
-* Returns NULL on error
-*/
-static __inline char* wchar_len_to_utf8(const wchar_t* wstr, int wlen)
-{
-	int size = 0;
-	char* str = NULL;
-
-	// Find out the size we need to allocate for our converted string
-	size = WideCharToMultiByte(CP_UTF8, 0, wstr, wlen, NULL, 0, NULL, NULL);
-	if (size <= 1)	// An empty string would be size 1
-		return NULL;
-
-	if ((str = (char*)calloc(size, 1)) == NULL)
-		return NULL;
-
-	if (WideCharToMultiByte(CP_UTF8, 0, wstr, wlen, str, size, NULL, NULL) != size) {
-		sfree(str);
-		return NULL;
-	}
-
-	return str;
-}
-
 static __inline DWORD FormatMessageU(DWORD dwFlags, LPCVOID lpSource, DWORD dwMessageId,
 									 DWORD dwLanguageId, char* lpBuffer, DWORD nSize, va_list *Arguments)
 {
@@ -491,6 +516,35 @@ static __inline BOOL DeleteFileU(const char* lpFileName)
 	return ret;
 }
 
+static __inline BOOL MoveFileExU(const char* lpExistingFileName, const char* lpNewFileName, DWORD dwFlags)
+{
+	BOOL ret = FALSE;
+	DWORD err = ERROR_INVALID_DATA;
+	wconvert(lpExistingFileName);
+	wconvert(lpNewFileName);
+	ret = MoveFileExW(wlpExistingFileName, wlpNewFileName, dwFlags);
+	err = GetLastError();
+	wfree(lpExistingFileName);
+	wfree(lpNewFileName);
+	SetLastError(err);
+	return ret;
+}
+
+static __inline BOOL CreateHardLinkU(const char* lpFileName, const char* lpExistingFileName,
+									 LPSECURITY_ATTRIBUTES lpSecurityAttributes)
+{
+	BOOL ret = FALSE;
+	DWORD err = ERROR_INVALID_DATA;
+	wconvert(lpFileName);
+	wconvert(lpExistingFileName);
+	ret = CreateHardLinkW(wlpFileName, wlpExistingFileName, lpSecurityAttributes);
+	err = GetLastError();
+	wfree(lpFileName);
+	wfree(lpExistingFileName);
+	SetLastError(err);
+	return ret;
+}
+
 static __inline BOOL PathFileExistsU(char* szPath)
 {
 	BOOL ret;
@@ -694,6 +748,19 @@ static __inline DWORD GetFileAttributesU(const char* lpFileName)
 	return ret;
 }
 
+static __inline BOOL GetFileAttributesExU(const char* lpFileName, GET_FILEEX_INFO_LEVELS fInfoLevelId,
+										   LPVOID lpFileInformation)
+{
+	BOOL ret = FALSE;
+	DWORD err = ERROR_INVALID_DATA;
+	wconvert(lpFileName);
+	ret = GetFileAttributesExW(wlpFileName, fInfoLevelId, lpFileInformation);
+	err = GetLastError();
+	wfree(lpFileName);
+	SetLastError(err);
+	return ret;
+}
+
 static __inline int SHCreateDirectoryExU(HWND hwnd, const char* pszPath, SECURITY_ATTRIBUTES *psa)
 {
 	int ret = ERROR_INVALID_DATA;
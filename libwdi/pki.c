@@ -376,13 +376,14 @@ typedef BOOL (WINAPI *CryptCATAdminCalcHashFromFileHandle_t)(
 );
 
 extern char *windows_error_str(uint32_t retval);
+extern const uint8_t* get_embedded_cat_hash(const uint8_t* extracted, const char* subdir, const char* name, uint64_t size);
 
 /*
  * FormatMessage does not handle PKI errors
  */
 char* winpki_error_str(uint32_t retval)
 {
-	static char error_string[64];
+	static THREAD_LOCAL char error_string[64];
 	uint32_t error_code = retval ? retval : GetLastError();
 
 	if ((error_code >> 16) != 0x8009)
@@ -930,12 +931,21 @@ BOOL SelfSignFile(LPCSTR szFileName, LPCSTR szCertSubject)
 	CRYPT_INTEGER_BLOB oidSpOpusInfoBlob, oidStatementTypeBlob;
 	BYTE pbOidSpOpusInfo[] = SP_OPUS_INFO_DATA;
 	BYTE pbOidStatementType[] = STATEMENT_TYPE_DATA;
+	HANDLE hMutex = NULL;
 
 	PF_INIT_OR_OUT(SignerSignEx, MSSign32);
 	PF_INIT_OR_OUT(SignerFreeSignerContext, MSSign32);
 	PF_INIT_OR_OUT(CertFreeCertificateContext, Crypt32);
 	PF_INIT_OR_OUT(CertCloseStore, Crypt32);
 
+	// The key container is machine wide, and its key is deleted once we are done,
+	// so files must be signed one at a time, including across processes
+	hMutex = CreateMutexA(NULL, FALSE, "Global\\libwdi_SelfSignFile");
+	if ((hMutex == NULL) || (WaitForSingleObject(hMutex, INFINITE) == WAIT_FAILED)) {
+		wdi_warn("could not acquire signing mutex: %s", windows_error_str(0));
+		goto out;
+	}
+
 	// Delete any previous certificate with the same subject
 	RemoveCertFromStore(szCertSubject, "Root");
 	RemoveCertFromStore(szCertSubject, "TrustedPublisher");
@@ -1026,6 +1036,10 @@ out:
 		pfSignerFreeSignerContext(pSignerContext);
 	if (pCertContext != NULL)
 		pfCertFreeCertificateContext(pCertContext);
+	if (hMutex != NULL) {
+		ReleaseMutex(hMutex);
+		CloseHandle(hMutex);
+	}
 	PF_FREE_LIBRARY(MSSign32);
 	PF_FREE_LIBRARY(Crypt32);
 	return r;
@@ -1215,18 +1229,20 @@ static BOOL GetFullPath(LPCSTR szSrc, LPSTR szDst, DWORD dwDstSize)
 }
 
 // Modified from http://www.zemris.fer.hr/predmeti/os1/misc/Unix2Win.htm
-static CHAR szInitialDir[MAX_PATH];		// We need a global variable
-static void ScanDirAndHash(HANDLE hCat, LPCSTR szDirName, LPSTR* szFileList, DWORD cFileList)
+static void ScanDirAndHash(HANDLE hCat, LPCSTR szInitialDir, LPCSTR szDirName, LPSTR* szFileList, DWORD cFileList,
+	const uint8_t* pbExtracted)
 {
 	CHAR szDir[MAX_PATH+1];
 	CHAR szSubDir[MAX_PATH+1];
 	CHAR szEntry[MAX_PATH];
+	CHAR szName[MAX_PATH];
 	CHAR szFilePath[MAX_PATH];
 	WCHAR wszDir[MAX_PATH+1];
 	HANDLE hList;
 	WIN32_FIND_DATAW FileData;
 	DWORD i;
 	BYTE pbHash[SHA1_HASH_LENGTH];
+	const uint8_t* pbEmbeddedHash;
 
 	// Get the proper directory path
 	if ( (strlen(szInitialDir) + strlen(szDirName) + 4) > sizeof(szDir) ) {
@@ -1245,6 +1261,7 @@ static void ScanDirAndHash(HANDLE hCat, LPCSTR szDirName, LPSTR* szFileList, DWO
 	do {
 		// Check the object is a directory or not
 		WideCharToMultiByte(CP_UTF8, 0, FileData.cFileName, -1, szEntry, MAX_PATH, NULL, NULL);
+		static_strcpy(szName, szEntry);	// keep the original case, for the embedded hash lookup
 		if (FileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
 			if ( (strcmp(szEntry, ".") != 0)
 			  && (strcmp(szEntry, "..") != 0)) {
@@ -1255,16 +1272,21 @@ static void ScanDirAndHash(HANDLE hCat, LPCSTR szDirName, LPSTR* szFileList, DWO
 					return;
 				}
 				static_sprintf(szSubDir, "%s%c%s", szDirName, '\\', szEntry);
-				ScanDirAndHash(hCat, szSubDir, szFileList, cFileList);
+				ScanDirAndHash(hCat, szInitialDir, szSubDir, szFileList, cFileList, pbExtracted);
 			}
 		} else {
 			for (i=0; i<cFileList; i++) {
 				_strlwr(szEntry);	// must be lowercase for comparison
 				if (strcmp(szEntry, szFileList[i]) == 0) {
 					static_sprintf(szFilePath, "%s%s%c%s", szInitialDir, szDirName, '\\', szEntry);
-					// TODO: check return value
-					if ( (CalcHash(pbHash, szFilePath)) && AddFileHash(hCat, szEntry, pbHash) ) {
-						wdi_info("added hash for '%s'",  szFilePath);
+					// Files this call extracted from the library have their hash precomputed
+					pbEmbeddedHash = get_embedded_cat_hash(pbExtracted, (szDirName[0] == '\\') ? &szDirName[1] : szDirName,
+						szName, ((uint64_t)FileData.nFileSizeHigh << 32) | FileData.nFileSizeLow);
+					if (pbEmbeddedHash != NULL) {
+						memcpy(pbHash, pbEmbeddedHash, SHA1_HASH_LENGTH);
+					}
+					if ( ((pbEmbeddedHash != NULL) || (CalcHash(pbHash, szFilePath))) && AddFileHash(hCat, szEntry, pbHash) ) {
+						wdi_info("added %shash for '%s'", (pbEmbeddedHash != NULL) ? "precomputed " : "", szFilePath);
 					} else {
 						wdi_warn("could not add hash for '%s' - ignored", szFilePath);
 					}
@@ -1279,9 +1301,11 @@ static void ScanDirAndHash(HANDLE hCat, LPCSTR szDirName, LPSTR* szFileList, DWO
 
 /*
  * Create a cat file for driver package signing, and add any listed matching file found in the
- * szSearchDir directory
+ * szSearchDir directory. pbExtracted flags the embedded resources that were just extracted to
+ * szSearchDir, for which the precomputed hashes can be used (see get_embedded_cat_hash()).
  */
-BOOL CreateCat(LPCSTR szCatPath, LPCSTR szHWID, LPCSTR szSearchDir, LPCSTR* szFileList, DWORD cFileList)
+BOOL CreateCat(LPCSTR szCatPath, LPCSTR szHWID, LPCSTR szSearchDir, LPCSTR* szFileList, DWORD cFileList,
+	const uint8_t* pbExtracted)
 {
 	PF_DECL_LOAD_LIBRARY(WinTrust);
 	PF_DECL(CryptCATOpen);
@@ -1299,6 +1323,7 @@ BOOL CreateCat(LPCSTR szCatPath, LPCSTR szHWID, LPCSTR szSearchDir, LPCSTR* szFi
 	// From the inf2cat /os parameter - doesn't seem to be used by the OS though...
 	LPCWSTR wszOS = L"7_X86,7_X64,8_X86,8_X64,8_ARM,10_X86,10_X64,10_ARM";
 	LPSTR * szLocalFileList;
+	CHAR szInitialDir[MAX_PATH];
 
 	PF_INIT_OR_OUT(CryptCATOpen, WinTrust);
 	PF_INIT_OR_OUT(CryptCATClose, WinTrust);
@@ -1348,7 +1373,7 @@ BOOL CreateCat(LPCSTR szCatPath, LPCSTR szHWID, LPCSTR szSearchDir, LPCSTR* szFi
 		else
 			_strlwr(szLocalFileList[i]);
 	}
-	ScanDirAndHash(hCat, "", szLocalFileList, cFileList);
+	ScanDirAndHash(hCat, szInitialDir, "", szLocalFileList, cFileList, pbExtracted);
 	for (i=0; i<cFileList; i++){
 		free(szLocalFileList[i]);
 	}
@@ -0,0 +1,70 @@
+/*
+ * resource_index.h: lookup of the embedded resources by name
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * embedder.c sorts the indexes of the resources by name, then by subdir, then by order,
+ * in resource_index[], so that a resource is found with a binary search on its name.
+ * The lookup is kept apart from libwdi.c, so that it can be tested and benchmarked on
+ * its own.
+ */
+#pragma once
+
+#include <string.h>
+
+/*
+ * Return the index of the resource named name in subdir, or, if subdir is NULL, of the
+ * first resource named name, or -1 if there is none
+ * table holds nb_entries resources, whose indexes are sorted in sorted, as above. The
+ * includer must define struct res, with subdir and name members, first.
+ */
+static __inline int resource_index_find(const struct res* table, const int* sorted, int nb_entries,
+	const char* subdir, const char* name)
+{
+	int lo = 0, hi = nb_entries, mid, r, i, res = -1;
+
+	if (name == NULL) {
+		return -1;
+	}
+	// Find the first index entry that is not lower than name
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (strcmp(table[sorted[mid]].name, name) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	// Entries with the same name are sorted by subdir, then by resource order
+	for (i = lo; (i < nb_entries) && (strcmp(table[sorted[i]].name, name) == 0); i++) {
+		if (subdir == NULL) {
+			if ((res < 0) || (sorted[i] < res)) {
+				res = sorted[i];
+			}
+			continue;
+		}
+		r = strcmp(table[sorted[i]].subdir, subdir);
+		if (r == 0) {
+			return sorted[i];
+		}
+		if (r > 0) {
+			break;
+		}
+	}
+	return res;
+}
@@ -69,39 +69,245 @@ BOOL grow_strcpy(char** DstPtr, char** DstPtrOrig, long* DstPos, long* DstAllocS
 	return TRUE;
 }
 
-// replaces tokens in text.
+struct _token_matcher_t
+{
+	const token_entity_t* token_entities; // NULL if compiled from a list of names
+	const char** names;
+	char* tok_prefix;
+	long tok_prefix_size;
+	char* tok_suffix;
+	long tok_suffix_size;
+	long max_match_length;
+	unsigned long hash_mask;
+	long* match_lengths;
+	long* hash_table; // indexes in names, or -1 for empty slots
+};
+
+// FNV-1a hash of a token name
+static unsigned long hash_token(const char* s, long len)
+{
+	unsigned long h = 2166136261UL;
+	while (len-- > 0)
+	{
+		h ^= (unsigned char)*s++;
+		h *= 16777619UL;
+	}
+	return h;
+}
+
+// finds the first occurrence of str in [s, s+len)
+static const char* find_string(const char* s, long len, const char* str, long str_size)
+{
+	const char* end = s + len - str_size;
+	const char* p;
+
+	while ((s <= end) && ((p = memchr(s, str[0], end - s + 1)) != NULL))
+	{
+		if (memcmp(p + 1, str + 1, str_size - 1) == 0)
+			return p;
+		s = p + 1;
+	}
+	return NULL;
+}
+
+void tokenize_free(token_matcher_t* matcher)
+{
+	if (!matcher)
+		return;
+	free(matcher->names);
+	free(matcher->tok_prefix);
+	free(matcher->tok_suffix);
+	free(matcher->match_lengths);
+	free(matcher->hash_table);
+	free(matcher);
+}
+
+// builds the hash table of a matcher, once its names are set.
+static BOOL compile_names(token_matcher_t* matcher, long nb_names,
+				   const char* tok_prefix, const char* tok_suffix)
+{
+	unsigned long h, hash_size;
+	long i;
+
+	matcher->tok_prefix_size = (long)strlen(tok_prefix);
+	matcher->tok_suffix_size = (long)strlen(tok_suffix);
+	matcher->tok_prefix = malloc(matcher->tok_prefix_size + 1);
+	matcher->tok_suffix = malloc(matcher->tok_suffix_size + 1);
+	if (!matcher->tok_prefix || !matcher->tok_suffix)
+		return FALSE;
+	memcpy(matcher->tok_prefix, tok_prefix, matcher->tok_prefix_size + 1);
+	memcpy(matcher->tok_suffix, tok_suffix, matcher->tok_suffix_size + 1);
+
+	// keep the hash table at most half full
+	for (hash_size = 16; hash_size < 2 * (unsigned long)nb_names; hash_size <<= 1);
+	matcher->hash_mask = hash_size - 1;
+	matcher->hash_table = malloc(hash_size * sizeof(long));
+	matcher->match_lengths = malloc((nb_names + 1) * sizeof(long));
+	if (!matcher->hash_table || !matcher->match_lengths)
+		return FALSE;
+	memset(matcher->hash_table, 0xFF, hash_size * sizeof(long));
+
+	for (i = 0; i < nb_names; i++)
+	{
+		// tokens end at the first suffix, so a name that contains one can never match
+		if (strstr(matcher->names[i], tok_suffix))
+			return FALSE;
+		matcher->match_lengths[i] = (long)strlen(matcher->names[i]);
+		if (matcher->match_lengths[i] > matcher->max_match_length)
+			matcher->max_match_length = matcher->match_lengths[i];
+
+		for (h = hash_token(matcher->names[i], matcher->match_lengths[i]) & matcher->hash_mask;
+			matcher->hash_table[h] >= 0; h = (h + 1) & matcher->hash_mask)
+		{
+			// as with a linear search, the first of duplicate tokens wins
+			if (strcmp(matcher->names[matcher->hash_table[h]], matcher->names[i]) == 0)
+				break;
+		}
+		if (matcher->hash_table[h] < 0)
+			matcher->hash_table[h] = i;
+	}
+	return TRUE;
+}
+
+// compiles a match/replace token list into a matcher, where tokens are looked
+// up by hashing the name between tok_prefix and the first tok_suffix.
+// Returns: NULL on error, including if a token name contains the suffix.
+// NOTE: The matcher must be freed with tokenize_free().
+token_matcher_t* tokenize_compile(const token_entity_t* token_entities, // match/replace token list
+				   const char* tok_prefix, // the token prefix exmpl:"$("
+				   const char* tok_suffix) // the token suffix exmpl:")"
+{
+	token_matcher_t* matcher;
+	long i, nb_entities;
+
+	if (!token_entities || !tok_prefix || !tok_suffix || !tok_prefix[0] || !tok_suffix[0])
+		return NULL;
+
+	matcher = calloc(1, sizeof(token_matcher_t));
+	if (!matcher)
+		return NULL;
+	matcher->token_entities = token_entities;
+	for (nb_entities = 0; token_entities[nb_entities].match; nb_entities++);
+	matcher->names = malloc((nb_entities + 1) * sizeof(char*));
+	if (!matcher->names)
+		goto error;
+	for (i = 0; i < nb_entities; i++)
+		matcher->names[i] = token_entities[i].match;
+
+	if (compile_names(matcher, nb_entities, tok_prefix, tok_suffix))
+		return matcher;
+
+error:
+	tokenize_free(matcher);
+	return NULL;
+}
+
+// compiles a NULL terminated list of token names into a matcher, for use with
+// tokenize_render(), where the replacement values are provided on each call.
+// Returns: NULL on error, including if a token name contains the suffix.
+// NOTE: The matcher must be freed with tokenize_free().
+token_matcher_t* tokenize_compile_names(const char* const* names, // token names
+				   const char* tok_prefix, // the token prefix exmpl:"$("
+				   const char* tok_suffix) // the token suffix exmpl:")"
+{
+	token_matcher_t* matcher;
+	long nb_names;
+
+	if (!names || !tok_prefix || !tok_suffix || !tok_prefix[0] || !tok_suffix[0])
+		return NULL;
+
+	matcher = calloc(1, sizeof(token_matcher_t));
+	if (!matcher)
+		return NULL;
+	for (nb_names = 0; names[nb_names]; nb_names++);
+	matcher->names = malloc((nb_names + 1) * sizeof(char*));
+	if (matcher->names)
+	{
+		memcpy((void*)matcher->names, names, (nb_names + 1) * sizeof(char*));
+		if (compile_names(matcher, nb_names, tok_prefix, tok_suffix))
+			return matcher;
+	}
+	tokenize_free(matcher);
+	return NULL;
+}
+
+// looks up the token name [src, src+len) in a matcher
+// Returns: the index of the token, or -1 if not found.
+static long find_token(const token_matcher_t* matcher, const char* src, long len)
+{
+	unsigned long h;
+	long i;
+
+	for (h = hash_token(src, len) & matcher->hash_mask; (i = matcher->hash_table[h]) >= 0;
+		h = (h + 1) & matcher->hash_mask)
+	{
+		if ((matcher->match_lengths[i] == len) && (memcmp(matcher->names[i], src, len) == 0))
+			return i;
+	}
+	return -1;
+}
+
+// finds the next token of a matcher in [src, src+src_count).
+// Returns: the index of the matching token, or -1 if there are no tokens left.
+// *literal_length is set to the length of the text before the token, or to
+// src_count if there are none, and *token_length to the length of the token,
+// including its prefix and suffix.
+static long next_token(const token_matcher_t* matcher, const char* src,
+				   long src_count, long* literal_length, long* token_length)
+{
+	long match;
+	const char* src_end = src + src_count;
+	const char* p = src;
+	const char* match_start;
+	const char* match_end;
+	const char* name;
+
+	while ((src_end - p) > (matcher->tok_prefix_size + matcher->tok_suffix_size))
+	{
+		// search for a token prefix that leaves room for a suffix
+		match_start = find_string(p, (long)(src_end - p) - matcher->tok_suffix_size,
+			matcher->tok_prefix, matcher->tok_prefix_size);
+		if (!match_start) break;
+		name = match_start + matcher->tok_prefix_size;
+
+		// the token name runs up to the first suffix, and can't be longer than the longest match
+		match_end = find_string(name, (long)safe_min(src_end - name, matcher->max_match_length + matcher->tok_suffix_size),
+			matcher->tok_suffix, matcher->tok_suffix_size);
+		match = match_end ? find_token(matcher, name, (long)(match_end - name)) : -1;
+		if (match >= 0)
+		{
+			*literal_length = (long)(match_start - src);
+			*token_length = (long)(match_end - match_start) + matcher->tok_suffix_size;
+			return match;
+		}
+		// No matches were found; leave the prefix as-is.
+		p = name;
+	}
+	*literal_length = src_count;
+	*token_length = 0;
+	return -1;
+}
+
+// replaces tokens in text, using a compiled matcher.
 // Returns: less than 0 on error, 0 if src is empty,
 //          number of chars written to dst on success.
 // NOTE: On success dst must be freed by the calling function.
-long tokenize_string(const char* src, // text to bo tokenized
+long tokenize_string_compiled(const char* src, // text to bo tokenized
 				   long src_count, // length of src
 				   char** dst, // destination buffer (must be freed)
-				   const token_entity_t* token_entities, // match/replace token list
-				   const char* tok_prefix, // the token prefix exmpl:"$("
-				   const char* tok_suffix, // the token suffix exmpl:")"
+				   const token_matcher_t* matcher, // compiled match/replace token list
 				   int recursive) // allows tokenzing tokens in tokens
 {
 	const token_entity_t* next_match;
-	long match_replace_pos;
-	const char* match_start;
-	long tok_prefix_size;
-	long tok_suffix_size;
-	int match_found;
-	long match_length;
-	long replace_length;
+	long i;
+	long literal_length;
+	long token_length;
 	long dst_pos;
 	long dst_alloc_size;
 	char* pDst;
 	long match_count;
 
-	if (!src || !dst || !token_entities || !src_count || !tok_prefix || !tok_suffix)
-		return -ERROR_BAD_ARGUMENTS;
-
-	tok_prefix_size = (long)strlen(tok_prefix);
-	tok_suffix_size = (long)strlen(tok_suffix);
-
-	// token prefix and suffix markers is required
-	if (!tok_prefix_size || !tok_suffix_size)
+	if (!src || !dst || !matcher || !matcher->token_entities || !src_count)
 		return -ERROR_BAD_ARGUMENTS;
 
 	// if the src buffer count <= 0 assume it is null terminated
@@ -119,89 +325,27 @@ long tokenize_string(const char* src, // text to bo tokenized
 
 	match_count=0;
 
-	while(src_count > (tok_prefix_size + tok_suffix_size))
+	while (src_count > 0)
 	{
-		// search for a token prefix
-		match_start = src;
-		while(match_start && strncmp(match_start, tok_prefix, tok_prefix_size) != 0)
-		{
-			match_start++;
-			if ((match_start + tok_prefix_size + tok_suffix_size) > (src+src_count))
-			{
-				match_start = NULL;
-				break;
-			}
-		}
-		if (!match_start) break;
+		i = next_token(matcher, src, src_count, &literal_length, &token_length);
 
-		// found a token prefix
-		match_replace_pos=0;
-		match_found=0;
-		match_length = (long)(match_start-src);
-
-		// copy all the text up to the tok_prefix start from src to dst.
-		if (!grow_strcpy(&pDst, dst, &dst_pos, &dst_alloc_size, src, match_length))
+		// copy all the text up to the token from src to dst.
+		if (!grow_strcpy(&pDst, dst, &dst_pos, &dst_alloc_size, src, literal_length))
 		{
 			return -ERROR_NOT_ENOUGH_MEMORY;
 		}
+		if (i < 0) break;
+		next_match = &matcher->token_entities[i];
 
-		src+=match_length+tok_prefix_size;
-		src_count-=(match_length+tok_prefix_size);
-
-		// iterate through the match/replace tokens
-		while ((next_match=&token_entities[match_replace_pos++]))
-		{
-			// the match and replace fields must both be set
-			if (!next_match->match || (match_replace_pos == 0 && next_match->replace[0] == 0))
-			{
-				break;
-			}
-			match_length=(long)strlen(next_match->match);
-
-			// if this token will be longer than what's left in src buffer, skip it.
-			if (src_count < (match_length+tok_suffix_size))
-				continue; // not found
-
-			// check for a match suffix
-			if (strncmp(src+match_length,tok_suffix,tok_suffix_size)!=0)
-				continue; // not found
-
-			if (strncmp(src,next_match->match,match_length)==0)
-			{
-				// found a valid token match
-				replace_length=(long)strlen(next_match->replace);
-
-				if (!grow_strcpy(&pDst, dst, &dst_pos, &dst_alloc_size,
-					next_match->replace, replace_length))
-				{
-					return -ERROR_NOT_ENOUGH_MEMORY;
-				}
-
-				src+=match_length+tok_suffix_size;
-				src_count-=(match_length+tok_suffix_size);
-				match_found=1;
-				match_count++;
-				break;
-			}
-		}
-		if (!match_found)
-		{
-			// No matches were found; leave it as-is.
-			if (!grow_strcpy(&pDst, dst, &dst_pos, &dst_alloc_size,
-				tok_prefix, tok_prefix_size))
-			{
-				return -ERROR_NOT_ENOUGH_MEMORY;
-			}
-		}
-	}
-
-	match_length=src_count;
-	if (match_length > 0)
-	{
-		if (!grow_strcpy(&pDst, dst, &dst_pos, &dst_alloc_size, src, match_length))
+		// found a valid token match
+		if (!grow_strcpy(&pDst, dst, &dst_pos, &dst_alloc_size,
+			next_match->replace, (long)strlen(next_match->replace)))
 		{
 			return -ERROR_NOT_ENOUGH_MEMORY;
 		}
+		src+=literal_length+token_length;
+		src_count-=(literal_length+token_length);
+		match_count++;
 	}
 	// grow_strcpy is aware an extra char is always needed for null.
 	pDst[dst_pos]='\0';
@@ -210,8 +354,7 @@ long tokenize_string(const char* src, // text to bo tokenized
 	{
 		// if recursive mode is true, keep re-tokenizing until no matches are found
 		*dst = NULL;
-		dst_pos = tokenize_string(pDst,dst_pos,dst,
-			token_entities,tok_prefix,tok_suffix,recursive);
+		dst_pos = tokenize_string_compiled(pDst,dst_pos,dst,matcher,recursive);
 
 		// free the old dst buffer
 		free(pDst);
@@ -220,6 +363,177 @@ long tokenize_string(const char* src, // text to bo tokenized
 	return dst_pos;
 }
 
+struct _token_segment_t
+{
+	long literal_offset; // offset of the literal text in the template
+	long literal_length;
+	long token; // index of the token that follows the literal text, or -1 for none
+};
+
+struct _token_template_t
+{
+	const token_matcher_t* matcher;
+	char* text;
+	long nb_segments;
+	struct _token_segment_t* segments;
+};
+
+void tokenize_free_template(token_template_t* tmpl)
+{
+	if (!tmpl)
+		return;
+	free(tmpl->text);
+	free(tmpl->segments);
+	free(tmpl);
+}
+
+// splits text into literal segments and tokens, for tokenize_render().
+// Returns: NULL on error.
+// NOTE: The template must be freed with tokenize_free_template(), and
+//       must not outlive the matcher.
+token_template_t* tokenize_compile_template(const char* src, // text to be tokenized
+				   long src_count, // length of src
+				   const token_matcher_t* matcher) // compiled match/replace token list
+{
+	token_template_t* tmpl;
+	long pos, literal_length, token_length, max_segments;
+
+	if (!src || !matcher)
+		return NULL;
+
+	// if the src buffer count < 0 assume it is null terminated
+	if (src_count < 0) src_count = (long)strlen(src);
+
+	tmpl = calloc(1, sizeof(token_template_t));
+	if (!tmpl)
+		return NULL;
+	tmpl->matcher = matcher;
+	// there can't be more tokens than prefixes
+	max_segments = src_count / (matcher->tok_prefix_size + matcher->tok_suffix_size) + 1;
+	tmpl->text = malloc(src_count + 1);
+	tmpl->segments = malloc(max_segments * sizeof(struct _token_segment_t));
+	if (!tmpl->text || !tmpl->segments)
+	{
+		tokenize_free_template(tmpl);
+		return NULL;
+	}
+	memcpy(tmpl->text, src, src_count);
+	tmpl->text[src_count] = '\0';
+
+	for (pos = 0; pos < src_count; pos += literal_length + token_length)
+	{
+		tmpl->segments[tmpl->nb_segments].token = next_token(matcher, &src[pos],
+			src_count - pos, &literal_length, &token_length);
+		tmpl->segments[tmpl->nb_segments].literal_offset = pos;
+		tmpl->segments[tmpl->nb_segments].literal_length = literal_length;
+		if (tmpl->segments[tmpl->nb_segments++].token < 0) break;
+	}
+	return tmpl;
+}
+
+// renders a compiled template into a single buffer, that is allocated to the
+// exact size of the output. values holds the replacement of each token, in the
+// order of the names of the matcher, or NULL for an empty replacement.
+// Returns: less than 0 on error, number of chars written to dst on success.
+// NOTE: On success dst must be freed by the calling function.
+long tokenize_render(const token_template_t* tmpl, const char* const* values, char** dst)
+{
+	const struct _token_segment_t* segment;
+	long i, length, dst_size = 0;
+	char* pDst;
+
+	if (!tmpl || !values || !dst)
+		return -ERROR_BAD_ARGUMENTS;
+
+	for (i = 0; i < tmpl->nb_segments; i++)
+	{
+		segment = &tmpl->segments[i];
+		dst_size += segment->literal_length;
+		if ((segment->token >= 0) && (values[segment->token] != NULL))
+			dst_size += (long)strlen(values[segment->token]);
+	}
+
+	*dst = pDst = malloc(dst_size + 1);
+	if (!pDst)
+		return -ERROR_NOT_ENOUGH_MEMORY;
+
+	for (i = 0; i < tmpl->nb_segments; i++)
+	{
+		segment = &tmpl->segments[i];
+		memcpy(pDst, &tmpl->text[segment->literal_offset], segment->literal_length);
+		pDst += segment->literal_length;
+		if ((segment->token >= 0) && (values[segment->token] != NULL))
+		{
+			length = (long)strlen(values[segment->token]);
+			memcpy(pDst, values[segment->token], length);
+			pDst += length;
+		}
+	}
+	*pDst = '\0';
+	return dst_size;
+}
+
+// renders a compiled template through a callback, that is called in order with
+// each literal and replacement value, so that the output doesn't have to be
+// held in memory. values is the same as for tokenize_render().
+// Returns: less than 0 on error, or if the callback failed,
+//          number of chars rendered on success.
+long tokenize_render_to(const token_template_t* tmpl, const char* const* values,
+				   token_write_t write, void* context)
+{
+	const struct _token_segment_t* segment;
+	long i, length, dst_size = 0;
+
+	if (!tmpl || !values || !write)
+		return -ERROR_BAD_ARGUMENTS;
+
+	for (i = 0; i < tmpl->nb_segments; i++)
+	{
+		segment = &tmpl->segments[i];
+		if (segment->literal_length > 0)
+		{
+			if (write(context, &tmpl->text[segment->literal_offset], segment->literal_length))
+				return -ERROR_WRITE_FAULT;
+			dst_size += segment->literal_length;
+		}
+		if ((segment->token >= 0) && (values[segment->token] != NULL))
+		{
+			length = (long)strlen(values[segment->token]);
+			if ((length > 0) && (write(context, values[segment->token], length)))
+				return -ERROR_WRITE_FAULT;
+			dst_size += length;
+		}
+	}
+	return dst_size;
+}
+
+// replaces tokens in text.
+// Returns: less than 0 on error, 0 if src is empty,
+//          number of chars written to dst on success.
+// NOTE: On success dst must be freed by the calling function.
+long tokenize_string(const char* src, // text to bo tokenized
+				   long src_count, // length of src
+				   char** dst, // destination buffer (must be freed)
+				   const token_entity_t* token_entities, // match/replace token list
+				   const char* tok_prefix, // the token prefix exmpl:"$("
+				   const char* tok_suffix, // the token suffix exmpl:")"
+				   int recursive) // allows tokenzing tokens in tokens
+{
+	token_matcher_t* matcher;
+	long r;
+
+	if (!src || !dst || !token_entities || !src_count || !tok_prefix || !tok_suffix)
+		return -ERROR_BAD_ARGUMENTS;
+
+	// use tokenize_compile() and tokenize_string_compiled() for repeated calls
+	matcher = tokenize_compile(token_entities, tok_prefix, tok_suffix);
+	if (!matcher)
+		return -ERROR_BAD_ARGUMENTS;
+	r = tokenize_string_compiled(src, src_count, dst, matcher, recursive);
+	tokenize_free(matcher);
+	return r;
+}
+
 // tokenizes a resource stored in the current module.
 long tokenize_resource(LPCSTR resource_name,
 					 LPCSTR resource_type,
@@ -28,6 +28,27 @@ typedef struct _token_entity_t
 	char replace[1024];
 }token_entity_t;
 
+// Matcher compiled from a token_entity_t list or a list of token names, that can
+// be reused for as long as the list exists. Only the names are compiled, so the
+// replace fields can be updated between calls.
+typedef struct _token_matcher_t token_matcher_t;
+
+token_matcher_t* tokenize_compile(const token_entity_t* token_entities,
+						 const char* tok_prefix,
+						 const char* tok_suffix);
+
+token_matcher_t* tokenize_compile_names(const char* const* names,
+						 const char* tok_prefix,
+						 const char* tok_suffix);
+
+void tokenize_free(token_matcher_t* matcher);
+
+long tokenize_string_compiled(const char* src,
+						 long src_count,
+						 char** dst,
+						 const token_matcher_t* matcher,
+						 int recursive);
+
 long tokenize_string(const char* src,
 						 long src_count,
 						 char** dst,
@@ -36,6 +57,26 @@ long tokenize_string(const char* src,
 						 const char* tok_suffix,
 						 int recursive);
 
+// Template compiled from a text and a matcher, that can be rendered repeatedly
+// with different replacement values. Tokens are not recursive.
+typedef struct _token_template_t token_template_t;
+
+token_template_t* tokenize_compile_template(const char* src,
+						 long src_count,
+						 const token_matcher_t* matcher);
+
+void tokenize_free_template(token_template_t* tmpl);
+
+long tokenize_render(const token_template_t* tmpl, const char* const* values, char** dst);
+
+// Called by tokenize_render_to() with each piece of the output. Returns 0 on success.
+typedef int (*token_write_t)(void* context, const char* src, long count);
+
+long tokenize_render_to(const token_template_t* tmpl,
+						 const char* const* values,
+						 token_write_t write,
+						 void* context);
+
 long tokenize_resource(LPCSTR resource_name,
 					 LPCSTR resource_type,
 					 char** dst,
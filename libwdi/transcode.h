@@ -0,0 +1,296 @@
+/*
+ * transcode.h: portable UTF-8 <-> UTF-16 conversion
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Replacement for the MultiByteToWideChar() and WideCharToMultiByte() calls of
+ * msapi_utf8.h, that converts in a single pass, without calling into the system.
+ *
+ * Most of the strings we convert (paths, hardware IDs, registry values, log
+ * messages) are ASCII, so runs of ASCII characters are converted 16 or 32 at a
+ * time with SSE2 or AVX2, when the compiler targets them, and one at a time
+ * otherwise. Invalid input is handled the same way as Windows does for CP_UTF8:
+ * each maximal invalid subpart of a UTF-8 sequence, and each unpaired surrogate,
+ * is replaced with U+FFFD.
+ *
+ * UTF-16 is handled as uint16_t, in native byte order, so that this code does not
+ * depend on the size of wchar_t.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__AVX2__)
+#define TRANSCODE_AVX2
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define TRANSCODE_SSE2
+#include <emmintrin.h>
+#endif
+
+#define TRANSCODE_REPLACEMENT_CHAR  0xFFFD
+
+/*
+ * Convert the ASCII characters at the start of src, up to size, to UTF-16.
+ * Returns the number of characters converted.
+ */
+static __inline size_t ascii_to_utf16(const unsigned char* src, size_t size, uint16_t* dst)
+{
+	size_t i = 0;
+#if defined(TRANSCODE_AVX2)
+	__m256i v;
+#endif
+#if defined(TRANSCODE_SSE2)
+	__m128i w, zero = _mm_setzero_si128();
+#endif
+
+#if defined(TRANSCODE_AVX2)
+	for (; i + 32 <= size; i += 32) {
+		v = _mm256_loadu_si256((const __m256i*)&src[i]);
+		if (_mm256_movemask_epi8(v) != 0) {
+			break;
+		}
+		_mm256_storeu_si256((__m256i*)&dst[i], _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+		_mm256_storeu_si256((__m256i*)&dst[i + 16], _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+	}
+#endif
+#if defined(TRANSCODE_SSE2)
+	for (; i + 16 <= size; i += 16) {
+		w = _mm_loadu_si128((const __m128i*)&src[i]);
+		if (_mm_movemask_epi8(w) != 0) {
+			break;
+		}
+		_mm_storeu_si128((__m128i*)&dst[i], _mm_unpacklo_epi8(w, zero));
+		_mm_storeu_si128((__m128i*)&dst[i + 8], _mm_unpackhi_epi8(w, zero));
+	}
+#endif
+	for (; (i < size) && (src[i] < 0x80); i++) {
+		dst[i] = src[i];
+	}
+	return i;
+}
+
+/*
+ * Convert the ASCII characters at the start of src, up to size, to UTF-8.
+ * Returns the number of characters converted.
+ */
+static __inline size_t utf16_to_ascii(const uint16_t* src, size_t size, unsigned char* dst)
+{
+	size_t i = 0;
+#if defined(TRANSCODE_AVX2)
+	__m256i a, b, mask256 = _mm256_set1_epi16((short)0xFF80);
+#endif
+#if defined(TRANSCODE_SSE2)
+	__m128i c, d, mask = _mm_set1_epi16((short)0xFF80), zero = _mm_setzero_si128();
+#endif
+
+#if defined(TRANSCODE_AVX2)
+	for (; i + 32 <= size; i += 32) {
+		a = _mm256_loadu_si256((const __m256i*)&src[i]);
+		b = _mm256_loadu_si256((const __m256i*)&src[i + 16]);
+		if (!_mm256_testz_si256(_mm256_or_si256(a, b), mask256)) {
+			break;
+		}
+		// The pack works on each 128 bit lane, so the 64 bit quarters must be reordered
+		_mm256_storeu_si256((__m256i*)&dst[i],
+			_mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+	}
+#endif
+#if defined(TRANSCODE_SSE2)
+	for (; i + 16 <= size; i += 16) {
+		c = _mm_loadu_si128((const __m128i*)&src[i]);
+		d = _mm_loadu_si128((const __m128i*)&src[i + 8]);
+		if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(c, d), mask), zero)) != 0xFFFF) {
+			break;
+		}
+		_mm_storeu_si128((__m128i*)&dst[i], _mm_packus_epi16(c, d));
+	}
+#endif
+	for (; (i < size) && (src[i] < 0x80); i++) {
+		dst[i] = (unsigned char)src[i];
+	}
+	return i;
+}
+
+/*
+ * Decode the UTF-8 sequence at *src, which must be before end, and advance *src
+ * past it, or past its maximal invalid subpart, in which case U+FFFD is returned.
+ */
+static __inline uint32_t utf8_decode(const unsigned char** src, const unsigned char* end)
+{
+	const unsigned char* p = *src;
+	unsigned char c = *p++, lower = 0x80, upper = 0xBF;
+	uint32_t code_point;
+	int nb_remaining;
+
+	if (c < 0x80) {
+		*src = p;
+		return c;
+	}
+	// The range of the second byte excludes overlong encodings,
+	// surrogates and values past U+10FFFF
+	if ((c >= 0xC2) && (c <= 0xDF)) {
+		code_point = c & 0x1F;
+		nb_remaining = 1;
+	} else if ((c >= 0xE0) && (c <= 0xEF)) {
+		code_point = c & 0x0F;
+		nb_remaining = 2;
+		if (c == 0xE0) {
+			lower = 0xA0;
+		} else if (c == 0xED) {
+			upper = 0x9F;
+		}
+	} else if ((c >= 0xF0) && (c <= 0xF4)) {
+		code_point = c & 0x07;
+		nb_remaining = 3;
+		if (c == 0xF0) {
+			lower = 0x90;
+		} else if (c == 0xF4) {
+			upper = 0x8F;
+		}
+	} else {
+		*src = p;
+		return TRANSCODE_REPLACEMENT_CHAR;
+	}
+	for (; nb_remaining > 0; nb_remaining--) {
+		if ((p >= end) || (*p < lower) || (*p > upper)) {
+			*src = p;
+			return TRANSCODE_REPLACEMENT_CHAR;
+		}
+		code_point = (code_point << 6) | (*p++ & 0x3F);
+		lower = 0x80;
+		upper = 0xBF;
+	}
+	*src = p;
+	return code_point;
+}
+
+/*
+ * Convert size bytes of UTF-8 from src into at most dst_size UTF-16 units at dst.
+ * dst can be NULL, to only compute the size of the output.
+ * Returns the number of units of the whole output, which is larger than dst_size
+ * if it was truncated. A unit is never written past dst_size.
+ */
+static __inline size_t utf8_to_utf16(const char* src, size_t size, uint16_t* dst, size_t dst_size)
+{
+	const unsigned char* p = (const unsigned char*)src;
+	const unsigned char* end = p + size;
+	size_t n = 0, run;
+	uint32_t c;
+
+	if (dst == NULL) {
+		dst_size = 0;
+	}
+	while (p < end) {
+		// Only look for a run of ASCII when there is one, as most non-ASCII text has none
+		if ((*p < 0x80) && (n < dst_size)) {
+			run = ascii_to_utf16(p, (size_t)(end - p) < (dst_size - n) ? (size_t)(end - p) : (dst_size - n), &dst[n]);
+			p += run;
+			n += run;
+			if (p >= end) {
+				break;
+			}
+		}
+		c = utf8_decode(&p, end);
+		if (c >= 0x10000) {
+			if (n + 2 <= dst_size) {
+				c -= 0x10000;
+				dst[n] = (uint16_t)(0xD800 | (c >> 10));
+				dst[n + 1] = (uint16_t)(0xDC00 | (c & 0x3FF));
+			} else if (n < dst_size) {
+				// Don't write half of a surrogate pair, if only one unit is left
+				dst_size = n;
+			}
+			n += 2;
+		} else {
+			if (n < dst_size) {
+				dst[n] = (uint16_t)c;
+			}
+			n++;
+		}
+	}
+	return n;
+}
+
+/*
+ * Convert size units of UTF-16 from src into at most dst_size bytes of UTF-8 at dst.
+ * dst can be NULL, to only compute the size of the output.
+ * Returns the number of bytes of the whole output, which is larger than dst_size if
+ * it was truncated. Multibyte sequences are never split.
+ */
+static __inline size_t utf16_to_utf8(const uint16_t* src, size_t size, char* dst, size_t dst_size)
+{
+	const uint16_t* p = src;
+	const uint16_t* end = src + size;
+	unsigned char* d = (unsigned char*)dst;
+	size_t n = 0, run, len;
+	uint32_t c;
+
+	if (dst == NULL) {
+		dst_size = 0;
+	}
+	while (p < end) {
+		if ((*p < 0x80) && (n < dst_size)) {
+			run = utf16_to_ascii(p, (size_t)(end - p) < (dst_size - n) ? (size_t)(end - p) : (dst_size - n), &d[n]);
+			p += run;
+			n += run;
+			if (p >= end) {
+				break;
+			}
+		}
+		c = *p++;
+		if ((c >= 0xD800) && (c <= 0xDBFF) && (p < end) && (*p >= 0xDC00) && (*p <= 0xDFFF)) {
+			c = 0x10000 + ((c - 0xD800) << 10) + (*p++ - 0xDC00);
+		} else if ((c >= 0xD800) && (c <= 0xDFFF)) {
+			c = TRANSCODE_REPLACEMENT_CHAR;
+		}
+		len = (c < 0x80) ? 1 : ((c < 0x800) ? 2 : ((c < 0x10000) ? 3 : 4));
+		if (n + len > dst_size) {
+			// Stop writing, but keep counting
+			if (n < dst_size) {
+				dst_size = n;
+			}
+			n += len;
+			continue;
+		}
+		switch (len) {
+		case 1:
+			d[n] = (unsigned char)c;
+			break;
+		case 2:
+			d[n] = (unsigned char)(0xC0 | (c >> 6));
+			d[n + 1] = (unsigned char)(0x80 | (c & 0x3F));
+			break;
+		case 3:
+			d[n] = (unsigned char)(0xE0 | (c >> 12));
+			d[n + 1] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+			d[n + 2] = (unsigned char)(0x80 | (c & 0x3F));
+			break;
+		default:
+			d[n] = (unsigned char)(0xF0 | (c >> 18));
+			d[n + 1] = (unsigned char)(0x80 | ((c >> 12) & 0x3F));
+			d[n + 2] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+			d[n + 3] = (unsigned char)(0x80 | (c & 0x3F));
+			break;
+		}
+		n += len;
+	}
+	return n;
+}
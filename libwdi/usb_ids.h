@@ -0,0 +1,542 @@
+/*
+ * usb_ids.h: USB vendor, product and class names lookup
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * The names from http://www.linux-usb.org/usb.ids are looked up in tables that
+ * hold the sorted IDs, and the offset of their names in a single block of text.
+ * These tables are either generated at build time, by vid_data.sh, or built at
+ * runtime, by indexing a usb.ids file in place, in which case the names are the
+ * lines of the file, terminated where they end.
+ *
+ * The products of each vendor are a sorted slice of the product arrays, and the
+ * classes, subclasses and protocols are keyed as:
+ *   (class << 24) | (subclass << 16) | (protocol << 8) | level
+ * where level is 1 for a class, 2 for a subclass and 3 for a protocol.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+struct usb_ids_table {
+	const char* names;
+	size_t nb_vendors;
+	size_t nb_products;
+	size_t nb_classes;
+	const uint16_t* vendor_id;
+	const uint32_t* vendor_name;
+	// Index of the first product of each vendor, followed by nb_products
+	const uint32_t* vendor_product;
+	const uint16_t* product_id;
+	const uint32_t* product_name;
+	const uint32_t* class_id;
+	const uint32_t* class_name;
+};
+
+// Built-in table, generated by vid_data.sh
+extern const struct usb_ids_table usb_ids_builtin;
+
+// Branchless binary searches, as the result of the comparisons is unpredictable
+static __inline int usb_ids_find16(const uint16_t* id, size_t n, uint16_t value)
+{
+	const uint16_t* base = id;
+	size_t half;
+
+	if (n == 0) {
+		return -1;
+	}
+	while (n > 1) {
+		half = n / 2;
+		base = (base[half] <= value) ? &base[half] : base;
+		n -= half;
+	}
+	return (*base == value) ? (int)(base - id) : -1;
+}
+
+static __inline int usb_ids_find32(const uint32_t* id, size_t n, uint32_t value)
+{
+	const uint32_t* base = id;
+	size_t half;
+
+	if (n == 0) {
+		return -1;
+	}
+	while (n > 1) {
+		half = n / 2;
+		base = (base[half] <= value) ? &base[half] : base;
+		n -= half;
+	}
+	return (*base == value) ? (int)(base - id) : -1;
+}
+
+static __inline const char* usb_ids_vendor_name(const struct usb_ids_table* t, uint16_t vid)
+{
+	int i = usb_ids_find16(t->vendor_id, t->nb_vendors, vid);
+
+	return (i < 0) ? NULL : t->names + t->vendor_name[i];
+}
+
+static __inline const char* usb_ids_product_name(const struct usb_ids_table* t, uint16_t vid, uint16_t pid)
+{
+	int i, j;
+
+	i = usb_ids_find16(t->vendor_id, t->nb_vendors, vid);
+	if (i < 0) {
+		return NULL;
+	}
+	j = usb_ids_find16(&t->product_id[t->vendor_product[i]],
+		t->vendor_product[i + 1] - t->vendor_product[i], pid);
+	return (j < 0) ? NULL : t->names + t->product_name[t->vendor_product[i] + j];
+}
+
+/*
+ * subclass and protocol can be -1, to only look up the class or the subclass
+ */
+static __inline const char* usb_ids_class_name(const struct usb_ids_table* t, int class_code,
+	int subclass, int protocol)
+{
+	int i;
+	uint32_t key;
+
+	if ((class_code < 0) || (class_code > 0xff) || (subclass > 0xff) || (protocol > 0xff)
+	  || ((subclass < 0) && (protocol >= 0))) {
+		return NULL;
+	}
+	key = ((uint32_t)class_code << 24) | 1;
+	if (subclass >= 0) {
+		key = ((uint32_t)class_code << 24) | ((uint32_t)subclass << 16) | 2;
+	}
+	if (protocol >= 0) {
+		key = ((uint32_t)class_code << 24) | ((uint32_t)subclass << 16) | ((uint32_t)protocol << 8) | 3;
+	}
+	i = usb_ids_find32(t->class_id, t->nb_classes, key);
+	return (i < 0) ? NULL : t->names + t->class_name[i];
+}
+
+/*
+ * Return the value of the nb_digits hexadecimal ID at the start of s, if it is
+ * followed by the two spaces that separate it from its name, or -1 otherwise
+ */
+static __inline int usb_ids_parse_id(const char* s, int nb_digits)
+{
+	int i, value = 0;
+
+	for (i = 0; i < nb_digits; i++) {
+		value <<= 4;
+		if ((s[i] >= '0') && (s[i] <= '9')) {
+			value |= s[i] - '0';
+		} else if ((s[i] >= 'a') && (s[i] <= 'f')) {
+			value |= s[i] - 'a' + 10;
+		} else if ((s[i] >= 'A') && (s[i] <= 'F')) {
+			value |= s[i] - 'A' + 10;
+		} else {
+			return -1;
+		}
+	}
+	return ((s[i] == ' ') && (s[i + 1] == ' ')) ? value : -1;
+}
+
+// Reallocate one of the arrays of a table, keeping it as is on failure
+static __inline void* usb_ids_grow(void* array, size_t capacity, size_t element_size, int* error)
+{
+	void* p = realloc(array, capacity * element_size);
+
+	if (p == NULL) {
+		*error = 1;
+		return array;
+	}
+	return p;
+}
+
+static __inline void usb_ids_free(struct usb_ids_table* t)
+{
+	free((void*)t->vendor_id);
+	free((void*)t->vendor_name);
+	free((void*)t->vendor_product);
+	free((void*)t->product_id);
+	free((void*)t->product_name);
+	free((void*)t->class_id);
+	free((void*)t->class_name);
+	memset(t, 0, sizeof(*t));
+}
+
+/*
+ * Index size bytes of usb.ids data in a single pass. The data is modified, as
+ * each line is NUL terminated, so it must be writable up to data[size] included,
+ * and it must outlive the table, as the names are not copied.
+ * Lines of other lists, comments, and duplicate IDs (along with the products of
+ * a duplicate vendor) are ignored.
+ * Returns 0 on success, in which case the table must be freed with usb_ids_free(),
+ * -1 if memory could not be allocated, or the number of the first line that is
+ * not sorted.
+ */
+static __inline int usb_ids_parse(char* data, size_t size, struct usb_ids_table* table)
+{
+	enum { USB_IDS_VENDORS, USB_IDS_CLASSES, USB_IDS_OTHER } section = USB_IDS_VENDORS;
+	char *line, *eol, *end = data + size;
+	uint16_t *vendor_id = NULL, *product_id = NULL;
+	uint32_t *vendor_name = NULL, *vendor_product = NULL, *product_name = NULL;
+	uint32_t *class_id = NULL, *class_name = NULL, key = 0;
+	size_t nb_vendors = 0, nb_products = 0, nb_classes = 0;
+	size_t vendor_capacity = 1024, product_capacity = 16384, class_capacity = 256;
+	int r = -1, error = 0, line_nr = 0, skip_vendor = 0, id, class_code = 0, subclass = 0;
+
+	memset(table, 0, sizeof(*table));
+	vendor_id = (uint16_t*)usb_ids_grow(NULL, vendor_capacity, sizeof(uint16_t), &error);
+	vendor_name = (uint32_t*)usb_ids_grow(NULL, vendor_capacity, sizeof(uint32_t), &error);
+	vendor_product = (uint32_t*)usb_ids_grow(NULL, vendor_capacity + 1, sizeof(uint32_t), &error);
+	product_id = (uint16_t*)usb_ids_grow(NULL, product_capacity, sizeof(uint16_t), &error);
+	product_name = (uint32_t*)usb_ids_grow(NULL, product_capacity, sizeof(uint32_t), &error);
+	class_id = (uint32_t*)usb_ids_grow(NULL, class_capacity, sizeof(uint32_t), &error);
+	class_name = (uint32_t*)usb_ids_grow(NULL, class_capacity, sizeof(uint32_t), &error);
+	if (error) {
+		goto out;
+	}
+
+	data[size] = 0;
+	for (line = data; line < end; line = eol + 1) {
+		line_nr++;
+		eol = (char*)memchr(line, '\n', end - line);
+		if (eol == NULL) {
+			eol = end;
+		}
+		*eol = 0;
+		if ((eol > line) && (eol[-1] == '\r')) {
+			eol[-1] = 0;
+		}
+		if ((line[0] == 0) || (line[0] == '#')) {
+			continue;
+		}
+
+		if (line[0] != '\t') {
+			// Vendor: "vvvv  name"
+			if ((section == USB_IDS_VENDORS) && ((id = usb_ids_parse_id(line, 4)) >= 0)) {
+				if ((nb_vendors > 0) && (id <= vendor_id[nb_vendors - 1])) {
+					if (id != vendor_id[nb_vendors - 1]) {
+						r = line_nr;
+						goto out;
+					}
+					skip_vendor = 1;
+					continue;
+				}
+				if (nb_vendors == vendor_capacity) {
+					vendor_capacity *= 2;
+					vendor_id = (uint16_t*)usb_ids_grow(vendor_id, vendor_capacity, sizeof(uint16_t), &error);
+					vendor_name = (uint32_t*)usb_ids_grow(vendor_name, vendor_capacity, sizeof(uint32_t), &error);
+					vendor_product = (uint32_t*)usb_ids_grow(vendor_product, vendor_capacity + 1, sizeof(uint32_t), &error);
+					if (error) {
+						goto out;
+					}
+				}
+				vendor_id[nb_vendors] = (uint16_t)id;
+				vendor_name[nb_vendors] = (uint32_t)(line + 6 - data);
+				vendor_product[nb_vendors] = (uint32_t)nb_products;
+				nb_vendors++;
+				skip_vendor = 0;
+				continue;
+			}
+			// Class: "C cc  name", followed by its subclasses and protocols
+			if ((line[0] == 'C') && (line[1] == ' ') && ((id = usb_ids_parse_id(&line[2], 2)) >= 0)) {
+				section = USB_IDS_CLASSES;
+				class_code = id;
+				key = ((uint32_t)class_code << 24) | 1;
+			} else {
+				section = USB_IDS_OTHER;
+				continue;
+			}
+		} else if (section == USB_IDS_VENDORS) {
+			// Product: "<tab>pppp  name"
+			id = usb_ids_parse_id(&line[1], 4);
+			if ((id < 0) || (nb_vendors == 0) || (skip_vendor)) {
+				continue;
+			}
+			if ((nb_products > vendor_product[nb_vendors - 1]) && (id <= product_id[nb_products - 1])) {
+				if (id != product_id[nb_products - 1]) {
+					r = line_nr;
+					goto out;
+				}
+				continue;
+			}
+			if (nb_products == product_capacity) {
+				product_capacity *= 2;
+				product_id = (uint16_t*)usb_ids_grow(product_id, product_capacity, sizeof(uint16_t), &error);
+				product_name = (uint32_t*)usb_ids_grow(product_name, product_capacity, sizeof(uint32_t), &error);
+				if (error) {
+					goto out;
+				}
+			}
+			product_id[nb_products] = (uint16_t)id;
+			product_name[nb_products] = (uint32_t)(line + 7 - data);
+			nb_products++;
+			continue;
+		} else if (section == USB_IDS_CLASSES) {
+			// Subclass: "<tab>ss  name" or protocol: "<tab><tab>pp  name"
+			if ((id = usb_ids_parse_id(&line[1], 2)) >= 0) {
+				subclass = id;
+				key = ((uint32_t)class_code << 24) | ((uint32_t)subclass << 16) | 2;
+			} else if ((line[1] == '\t') && ((id = usb_ids_parse_id(&line[2], 2)) >= 0)) {
+				key = ((uint32_t)class_code << 24) | ((uint32_t)subclass << 16) | ((uint32_t)id << 8) | 3;
+			} else {
+				continue;
+			}
+		} else {
+			continue;
+		}
+
+		// Class, subclass or protocol
+		if ((nb_classes > 0) && (key <= class_id[nb_classes - 1])) {
+			r = line_nr;
+			goto out;
+		}
+		if (nb_classes == class_capacity) {
+			class_capacity *= 2;
+			class_id = (uint32_t*)usb_ids_grow(class_id, class_capacity, sizeof(uint32_t), &error);
+			class_name = (uint32_t*)usb_ids_grow(class_name, class_capacity, sizeof(uint32_t), &error);
+			if (error) {
+				goto out;
+			}
+		}
+		class_id[nb_classes] = key;
+		class_name[nb_classes] = (uint32_t)(strstr(line, "  ") + 2 - data);
+		nb_classes++;
+	}
+	vendor_product[nb_vendors] = (uint32_t)nb_products;
+	r = 0;
+
+out:
+	table->names = data;
+	table->nb_vendors = nb_vendors;
+	table->nb_products = nb_products;
+	table->nb_classes = nb_classes;
+	table->vendor_id = vendor_id;
+	table->vendor_name = vendor_name;
+	table->vendor_product = vendor_product;
+	table->product_id = product_id;
+	table->product_name = product_name;
+	table->class_id = class_id;
+	table->class_name = class_name;
+	if (r != 0) {
+		usb_ids_free(table);
+	}
+	return r;
+}
+
+/*
+ * Trigram index of the vendor names, to find the vendors that contain a string
+ * without going through all of them. For each trigram of lowercase characters,
+ * sorted, it lists the indexes of the vendors which name contains it.
+ * Patterns too short for a trigram are searched in a lowercase copy of all the
+ * names at once.
+ */
+struct usb_ids_index {
+	size_t nb_trigrams;
+	uint32_t* trigram;
+	// Start of the vendors of each trigram, followed by the total number of entries
+	uint32_t* vendor_start;
+	uint16_t* vendor;
+	// The lowercase vendor names, in order, each followed by a '\n', and the start of
+	// each of them, followed by the size of the names
+	char* lowercase;
+	uint32_t* name_start;
+};
+
+#define USB_IDS_TOLOWER(c) ((((c) >= 'A') && ((c) <= 'Z')) ? ((c) - 'A' + 'a') : (c))
+#define USB_IDS_TRIGRAM(s) (((uint32_t)(unsigned char)USB_IDS_TOLOWER((s)[0]) << 16) | \
+	((uint32_t)(unsigned char)USB_IDS_TOLOWER((s)[1]) << 8) | (uint32_t)(unsigned char)USB_IDS_TOLOWER((s)[2]))
+
+static __inline int usb_ids_compare64(const void* a, const void* b)
+{
+	uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+
+	return (x > y) - (x < y);
+}
+
+static __inline void usb_ids_free_index(struct usb_ids_index* index)
+{
+	free(index->trigram);
+	free(index->vendor_start);
+	free(index->vendor);
+	free(index->lowercase);
+	free(index->name_start);
+	memset(index, 0, sizeof(*index));
+}
+
+/*
+ * Build the trigram index of the vendor names of a table
+ * Returns 0 on success, or -1 if memory could not be allocated.
+ */
+static __inline int usb_ids_build_index(const struct usb_ids_table* t, struct usb_ids_index* index)
+{
+	uint64_t* entry;
+	size_t i, j, n = 0, nb_entries = 0, len;
+	const char* name;
+
+	memset(index, 0, sizeof(*index));
+	// Collect the (trigram, vendor) pairs, and sort them, to group them by trigram
+	for (i = 0; i < t->nb_vendors; i++) {
+		len = strlen(t->names + t->vendor_name[i]);
+		nb_entries += (len >= 3) ? len - 2 : 0;
+	}
+	entry = (uint64_t*)malloc((nb_entries + 1) * sizeof(uint64_t));
+	if (entry == NULL) {
+		return -1;
+	}
+	for (i = 0; i < t->nb_vendors; i++) {
+		name = t->names + t->vendor_name[i];
+		for (j = 0; (name[j] != 0) && (name[j + 1] != 0) && (name[j + 2] != 0); j++) {
+			entry[n++] = ((uint64_t)USB_IDS_TRIGRAM(&name[j]) << 16) | i;
+		}
+	}
+	qsort(entry, n, sizeof(uint64_t), usb_ids_compare64);
+
+	index->trigram = (uint32_t*)malloc((n + 1) * sizeof(uint32_t));
+	index->vendor_start = (uint32_t*)malloc((n + 1) * sizeof(uint32_t));
+	index->vendor = (uint16_t*)malloc((n + 1) * sizeof(uint16_t));
+	if ((index->trigram == NULL) || (index->vendor_start == NULL) || (index->vendor == NULL)) {
+		free(entry);
+		usb_ids_free_index(index);
+		return -1;
+	}
+	for (i = 0, j = 0; i < n; i++) {
+		// Skip the trigrams that appear more than once in the same name
+		if ((i > 0) && (entry[i] == entry[i - 1])) {
+			continue;
+		}
+		if ((i == 0) || ((entry[i] >> 16) != (entry[i - 1] >> 16))) {
+			index->trigram[index->nb_trigrams] = (uint32_t)(entry[i] >> 16);
+			index->vendor_start[index->nb_trigrams++] = (uint32_t)j;
+		}
+		index->vendor[j++] = (uint16_t)entry[i];
+	}
+	index->vendor_start[index->nb_trigrams] = (uint32_t)j;
+	free(entry);
+
+	for (i = 0, len = 0; i < t->nb_vendors; i++) {
+		len += strlen(t->names + t->vendor_name[i]) + 1;
+	}
+	index->lowercase = (char*)malloc(len + 1);
+	index->name_start = (uint32_t*)malloc((t->nb_vendors + 1) * sizeof(uint32_t));
+	if ((index->lowercase == NULL) || (index->name_start == NULL)) {
+		usb_ids_free_index(index);
+		return -1;
+	}
+	for (i = 0, n = 0; i < t->nb_vendors; i++) {
+		index->name_start[i] = (uint32_t)n;
+		for (name = t->names + t->vendor_name[i]; *name != 0; name++) {
+			index->lowercase[n++] = (char)USB_IDS_TOLOWER(*name);
+		}
+		index->lowercase[n++] = '\n';
+	}
+	index->name_start[i] = (uint32_t)n;
+	index->lowercase[n] = 0;
+	return 0;
+}
+
+/*
+ * Return how well a lowercase name matches a lowercase pattern, from 0 for an exact
+ * match, 1 for a name that starts with it, 2 for a word that starts with it, to 3 for
+ * any other match, or -1 if the name doesn't contain the pattern.
+ */
+static __inline int usb_ids_match_level(const char* name, size_t name_len, const char* pattern, size_t len)
+{
+	size_t i;
+	int level = -1;
+
+	for (i = 0; i + len <= name_len; i++) {
+		if ((name[i] != pattern[0]) || (memcmp(&name[i + 1], &pattern[1], len - 1) != 0)) {
+			continue;
+		}
+		if (i == 0) {
+			return (name_len == len) ? 0 : 1;
+		}
+		// Past the start of the name, a word start is the best we can get
+		if (((unsigned char)name[i - 1] < 0x80) && !isalnum((unsigned char)name[i - 1])) {
+			return 2;
+		}
+		level = 3;
+	}
+	return level;
+}
+
+// Add vendor k to the matches, if its name contains pattern, and return the number of matches
+static __inline size_t usb_ids_add_match(const struct usb_ids_table* t, const struct usb_ids_index* index,
+	size_t k, const char* pattern, size_t len, uint32_t* match, size_t n)
+{
+	size_t name_len = index->name_start[k + 1] - index->name_start[k] - 1;
+	int level = usb_ids_match_level(&index->lowercase[index->name_start[k]], name_len, pattern, len);
+
+	if (level >= 0) {
+		name_len = (name_len < 255) ? name_len : 255;
+		match[n++] = ((uint32_t)level << 24) | ((uint32_t)name_len << 16) | t->vendor_id[k];
+	}
+	return n;
+}
+
+/*
+ * Find the vendors which name contains a lowercase pattern, using the trigrams of
+ * the index if the pattern is long enough, or its lowercase names otherwise.
+ * Each match is written to match as (level << 24) | (min(name length, 255) << 16) | vid,
+ * so that sorting the matches puts the best ones first, then the shortest names.
+ * match must have room for t->nb_vendors entries. Returns the number of matches.
+ */
+static __inline size_t usb_ids_find_vendors(const struct usb_ids_table* t, const struct usb_ids_index* index,
+	const char* pattern, uint32_t* match)
+{
+	size_t i, len = strlen(pattern), nb_candidates, n = 0;
+	const uint16_t* candidate = NULL;
+	const char* p;
+	int k;
+
+	// No name holds the separator of the lowercase names
+	if ((len == 0) || (strchr(pattern, '\n') != NULL)) {
+		return 0;
+	}
+	if (len < 3) {
+		// Each name that holds a match is ranked, then the search resumes at the next one
+		i = 0;
+		p = strstr(index->lowercase, pattern);
+		while (p != NULL) {
+			while (index->name_start[i + 1] <= (size_t)(p - index->lowercase)) {
+				i++;
+			}
+			n = usb_ids_add_match(t, index, i++, pattern, len, match, n);
+			p = strstr(&index->lowercase[index->name_start[i]], pattern);
+		}
+		return n;
+	}
+	// Only the vendors with the least common trigram of the pattern can match
+	nb_candidates = t->nb_vendors + 1;
+	for (i = 0; i + 2 < len; i++) {
+		k = usb_ids_find32(index->trigram, index->nb_trigrams, USB_IDS_TRIGRAM(&pattern[i]));
+		if (k < 0) {
+			return 0;
+		}
+		if (index->vendor_start[k + 1] - index->vendor_start[k] < nb_candidates) {
+			candidate = &index->vendor[index->vendor_start[k]];
+			nb_candidates = index->vendor_start[k + 1] - index->vendor_start[k];
+		}
+	}
+	for (i = 0; i < nb_candidates; i++) {
+		n = usb_ids_add_match(t, index, candidate[i], pattern, len, match, n);
+	}
+	return n;
+}
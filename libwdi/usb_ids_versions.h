@@ -0,0 +1,172 @@
+/*
+ * usb_ids_versions.h: versions of a usb.ids file, that are reloaded when it is modified
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * When the usb.ids file loaded with wdi_load_usb_ids() is modified, it is reloaded, and
+ * the new version becomes the current one. Every version is kept until the file is loaded
+ * again or unloaded, as the names that were returned from them may still be in use.
+ * Only the current version gets new users, under the lock, so a version that was replaced
+ * with wdi_load_usb_ids() and has no users can't get any, and can be freed. A version that
+ * is still in use then is freed on a later call, once it no longer is.
+ */
+#pragma once
+
+#include <stdlib.h>
+#include <windows.h>
+#include "usb_ids.h"
+
+struct usb_ids_file {
+	struct usb_ids_file* previous;
+	struct usb_ids_table table;
+	struct usb_ids_index index;
+	char* data;
+	char* path;
+	FILETIME last_write_time;
+	volatile LONG nb_users;
+};
+
+struct usb_ids_versions {
+	// The current version, followed by the ones it replaced
+	struct usb_ids_file* current;
+	// The versions that were replaced with wdi_load_usb_ids() while still in use
+	struct usb_ids_file* unloaded;
+	// Protects the lists, and the use counts of the current version
+	volatile LONG lock;
+};
+
+static __inline void usb_ids_free_file(struct usb_ids_file* file)
+{
+	usb_ids_free(&file->table);
+	usb_ids_free_index(&file->index);
+	free(file->data);
+	free(file->path);
+	free(file);
+}
+
+static __inline void usb_ids_lock(struct usb_ids_versions* v)
+{
+	while (InterlockedCompareExchange(&v->lock, 1, 0) != 0) {
+		SwitchToThread();
+	}
+}
+
+static __inline void usb_ids_unlock(struct usb_ids_versions* v)
+{
+	InterlockedExchange(&v->lock, 0);
+}
+
+/*
+ * Return the current version, if any, and count the caller as one of its users, until
+ * it calls usb_ids_release()
+ */
+static __inline struct usb_ids_file* usb_ids_acquire(struct usb_ids_versions* v)
+{
+	struct usb_ids_file* file;
+
+	usb_ids_lock(v);
+	file = v->current;
+	if (file != NULL) {
+		InterlockedIncrement(&file->nb_users);
+	}
+	usb_ids_unlock(v);
+	return file;
+}
+
+static __inline void usb_ids_release(struct usb_ids_file* file)
+{
+	if (file != NULL) {
+		InterlockedDecrement(&file->nb_users);
+	}
+}
+
+// Move the unloaded versions without users to the returned list, under the lock
+static __inline struct usb_ids_file* usb_ids_collect_unused(struct usb_ids_versions* v)
+{
+	struct usb_ids_file *f, **link, *unused = NULL;
+
+	link = &v->unloaded;
+	while (*link != NULL) {
+		f = *link;
+		if (f->nb_users == 0) {
+			*link = f->previous;
+			f->previous = unused;
+			unused = f;
+		} else {
+			link = &f->previous;
+		}
+	}
+	return unused;
+}
+
+static __inline void usb_ids_free_list(struct usb_ids_file* list)
+{
+	struct usb_ids_file* f;
+
+	while (list != NULL) {
+		f = list->previous;
+		usb_ids_free_file(list);
+		list = f;
+	}
+}
+
+/*
+ * Make file, which was reloaded from reloaded_from, the current version
+ * Returns FALSE, and leaves file to the caller, if reloaded_from is no longer current,
+ * as the file was loaded again, or unloaded, in the meantime
+ */
+static __inline BOOL usb_ids_add_version(struct usb_ids_versions* v, struct usb_ids_file* file,
+	struct usb_ids_file* reloaded_from)
+{
+	struct usb_ids_file* unused;
+
+	usb_ids_lock(v);
+	if (v->current != reloaded_from) {
+		usb_ids_unlock(v);
+		return FALSE;
+	}
+	file->previous = v->current;
+	v->current = file;
+	unused = usb_ids_collect_unused(v);
+	usb_ids_unlock(v);
+	usb_ids_free_list(unused);
+	return TRUE;
+}
+
+/*
+ * Replace all the versions with file, which may be NULL, and free the ones that
+ * have no users
+ */
+static __inline void usb_ids_replace(struct usb_ids_versions* v, struct usb_ids_file* file)
+{
+	struct usb_ids_file *f, *unused;
+
+	if (file != NULL) {
+		file->previous = NULL;
+	}
+	usb_ids_lock(v);
+	if (v->current != NULL) {
+		for (f = v->current; f->previous != NULL; f = f->previous);
+		f->previous = v->unloaded;
+		v->unloaded = v->current;
+	}
+	v->current = file;
+	unused = usb_ids_collect_unused(v);
+	usb_ids_unlock(v);
+	usb_ids_free_list(unused);
+}
@@ -0,0 +1,181 @@
+/*
+ * utf16le.h: streaming UTF-8 to UTF-16LE transcoding
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * The inf files must be written as UTF-16 for non-English device descriptions to
+ * display properly in Device Manager. This writer transcodes UTF-8 text, that can
+ * be provided in any number of pieces, into little endian UTF-16 units, through a
+ * fixed size buffer that is handed to a sink whenever it is full.
+ *
+ * The decoding is done by utf8_decode(), from transcode.h, so invalid sequences are
+ * replaced with U+FFFD the same way as by the other conversions. The output does not
+ * depend on the size of wchar_t, so this can also be used on the build host.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "transcode.h"
+
+#define UTF16LE_BUFFER_SIZE         4096
+#define UTF16LE_BOM                 0xFEFF
+
+// Called with each chunk of UTF-16LE data. Returns 0 on success.
+typedef int (*utf16le_sink_t)(void* context, const unsigned char* data, size_t size);
+
+struct utf16le_writer {
+	utf16le_sink_t sink;
+	void* sink_context;
+	// Start of a UTF-8 sequence that was split across calls
+	unsigned char pending[4];
+	size_t nb_pending;
+	int error;
+	size_t pos;
+	unsigned char buffer[UTF16LE_BUFFER_SIZE];
+};
+
+static __inline int utf16le_flush_buffer(struct utf16le_writer* w)
+{
+	if ((w->pos != 0) && (w->error == 0)) {
+		w->error = w->sink(w->sink_context, w->buffer, w->pos);
+	}
+	w->pos = 0;
+	return w->error;
+}
+
+static __inline void utf16le_put_unit(struct utf16le_writer* w, uint32_t unit)
+{
+	if (w->pos + 2 > sizeof(w->buffer)) {
+		utf16le_flush_buffer(w);
+	}
+	w->buffer[w->pos++] = (unsigned char)unit;
+	w->buffer[w->pos++] = (unsigned char)(unit >> 8);
+}
+
+static __inline void utf16le_put_code_point(struct utf16le_writer* w, uint32_t c)
+{
+	if (c >= 0x10000) {
+		c -= 0x10000;
+		utf16le_put_unit(w, 0xD800 | (c >> 10));
+		utf16le_put_unit(w, 0xDC00 | (c & 0x3FF));
+	} else {
+		utf16le_put_unit(w, c);
+	}
+}
+
+// Length of the UTF-8 sequence that starts with c, or 1 if c can't start one
+static __inline size_t utf16le_sequence_length(unsigned char c)
+{
+	if ((c >= 0xC2) && (c <= 0xDF))
+		return 2;
+	if ((c >= 0xE0) && (c <= 0xEF))
+		return 3;
+	if ((c >= 0xF0) && (c <= 0xF4))
+		return 4;
+	return 1;
+}
+
+/*
+ * Decode the sequence at *src. Returns 0 if it was cut short by end, so that the
+ * caller can wait for the rest of it, without advancing *src.
+ */
+static __inline int utf16le_decode(struct utf16le_writer* w, const unsigned char** src,
+	const unsigned char* end)
+{
+	const unsigned char* p = *src;
+	uint32_t c = utf8_decode(&p, end);
+
+	// utf8_decode() only reaches end on an invalid sequence if the sequence is too short
+	if ((c == TRANSCODE_REPLACEMENT_CHAR) && (p == end)
+	  && ((size_t)(p - *src) < utf16le_sequence_length(**src))) {
+		return 0;
+	}
+	utf16le_put_code_point(w, c);
+	*src = p;
+	return 1;
+}
+
+/*
+ * Initialize a writer that hands its output to sink, optionally starting with a BOM
+ */
+static __inline void utf16le_writer_init(struct utf16le_writer* w, utf16le_sink_t sink,
+	void* sink_context, int bom)
+{
+	w->sink = sink;
+	w->sink_context = sink_context;
+	w->nb_pending = 0;
+	w->error = 0;
+	w->pos = 0;
+	if (bom) {
+		utf16le_put_unit(w, UTF16LE_BOM);
+	}
+}
+
+/*
+ * Transcode size bytes of UTF-8. Sequences may be split across calls.
+ * Returns 0 on success, or the first error returned by the sink.
+ */
+static __inline int utf16le_write(struct utf16le_writer* w, const char* src, size_t size)
+{
+	const unsigned char* p = (const unsigned char*)src;
+	const unsigned char* end = p + size;
+	const unsigned char* q;
+	size_t len;
+
+	// Complete the sequence that the previous call ended with
+	if ((w->nb_pending != 0) && (p < end)) {
+		len = utf16le_sequence_length(w->pending[0]) - w->nb_pending;
+		if (len > size) {
+			len = size;
+		}
+		memcpy(&w->pending[w->nb_pending], p, len);
+		q = w->pending;
+		if (!utf16le_decode(w, &q, &w->pending[w->nb_pending + len])) {
+			w->nb_pending += len;
+			return w->error;
+		}
+		// The pending bytes were all valid, so at least these were consumed
+		p += (size_t)(q - w->pending) - w->nb_pending;
+		w->nb_pending = 0;
+	}
+	while ((p < end) && (w->error == 0)) {
+		if (*p < 0x80) {
+			utf16le_put_unit(w, *p++);
+		} else if (!utf16le_decode(w, &p, end)) {
+			w->nb_pending = (size_t)(end - p);
+			memcpy(w->pending, p, w->nb_pending);
+			break;
+		}
+	}
+	return w->error;
+}
+
+/*
+ * Write out any buffered data, terminating an incomplete sequence if needed
+ * Returns 0 on success, or the first error returned by the sink.
+ */
+static __inline int utf16le_writer_flush(struct utf16le_writer* w)
+{
+	if (w->nb_pending != 0) {
+		w->nb_pending = 0;
+		utf16le_put_code_point(w, TRANSCODE_REPLACEMENT_CHAR);
+	}
+	return utf16le_flush_buffer(w);
+}
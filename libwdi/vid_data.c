@@ -1,5 +1,5 @@
 /*
- * USB vendors, by VID
+ * USB vendors, products and classes, by ID
  * This file is autogenerated from http://www.linux-usb.org/usb.ids
  * See http://www.linux-usb.org/usb-ids.html to submit new VIDs or PIDs
  *
@@ -19,3031 +19,4111 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
-#include <stdlib.h>
-#include "libwdi.h"
-
-struct vendor_name {
-	unsigned short vid;
-	const char* name;
-};
+#include <stdint.h>
+#include "usb_ids.h"
 
 /*
  * http://www.linux-usb.org/usb.ids
  * Version: 2018.07.03
+ * These tables only hold the vendors of that version, which vid_data.sh rejects: run it,
+ * with a complete usb.ids, for the products and classes to have built-in names
  */
-static struct vendor_name usb_vendor[] = {
-	{ 0x0001, "Fry's Electronics" },
-	{ 0x0002, "Ingram" },
-	{ 0x0003, "Club Mac" },
-	{ 0x0004, "Nebraska Furniture Mart" },
-	{ 0x0011, "Unknown" },
-	{ 0x0053, "Planex" },
-	{ 0x0078, "Microntek" },
-	{ 0x0079, "DragonRise Inc." },
-	{ 0x0085, "Boeye Technology Co., Ltd." },
-	{ 0x0105, "Trust International B.V." },
-	{ 0x0127, "IBP" },
-	{ 0x0145, "Unknown" },
-	{ 0x017c, "MLK" },
-	{ 0x0200, "TP-Link" },
-	{ 0x0204, "Chipsbank Microelectronics Co., Ltd" },
-	{ 0x0218, "Hangzhou Worlde" },
-	{ 0x02ad, "HUMAX Co., Ltd." },
-	{ 0x0303, "Mini Automation Controller" },
-	{ 0x0324, "OCZ Technology Inc" },
-	{ 0x0325, "OCZ Technology Inc" },
-	{ 0x0386, "LTS" },
-	{ 0x03d9, "Shenzhen Sinote Tech-Electron Co., Ltd" },
-	{ 0x03da, "Bernd Walter Computer Technology" },
-	{ 0x03e7, "Intel" },
-	{ 0x03e8, "EndPoints, Inc." },
-	{ 0x03e9, "Thesys Microelectronics" },
-	{ 0x03ea, "Data Broadcasting Corp." },
-	{ 0x03eb, "Atmel Corp." },
-	{ 0x03ec, "Iwatsu America, Inc." },
-	{ 0x03ed, "Mitel Corp." },
-	{ 0x03ee, "Mitsumi" },
-	{ 0x03f0, "HP, Inc" },
-	{ 0x03f1, "Genoa Technology" },
-	{ 0x03f2, "Oak Technology, Inc." },
-	{ 0x03f3, "Adaptec, Inc." },
-	{ 0x03f4, "Diebold, Inc." },
-	{ 0x03f5, "Siemens Electromechanical" },
-	{ 0x03f8, "Epson Imaging Technology Center" },
-	{ 0x03f9, "KeyTronic Corp." },
-	{ 0x03fb, "OPTi, Inc." },
-	{ 0x03fc, "Elitegroup Computer Systems" },
-	{ 0x03fd, "Xilinx, Inc." },
-	{ 0x03fe, "Farallon Comunications" },
-	{ 0x0400, "National Semiconductor Corp." },
-	{ 0x0401, "National Registry, Inc." },
-	{ 0x0402, "ALi Corp." },
-	{ 0x0403, "Future Technology Devices International, Ltd" },
-	{ 0x0404, "NCR Corp." },
-	{ 0x0405, "Synopsys, Inc." },
-	{ 0x0406, "Fujitsu-ICL Computers" },
-	{ 0x0407, "Fujitsu Personal Systems, Inc." },
-	{ 0x0408, "Quanta Computer, Inc." },
-	{ 0x0409, "NEC Corp." },
-	{ 0x040a, "Kodak Co." },
-	{ 0x040b, "Weltrend Semiconductor" },
-	{ 0x040c, "VTech Computers, Ltd" },
-	{ 0x040d, "VIA Technologies, Inc." },
-	{ 0x040e, "MCCI" },
-	{ 0x040f, "Echo Speech Corp." },
-	{ 0x0411, "BUFFALO INC. (formerly MelCo., Inc.)" },
-	{ 0x0412, "Award Software International" },
-	{ 0x0413, "Leadtek Research, Inc." },
-	{ 0x0414, "Giga-Byte Technology Co., Ltd" },
-	{ 0x0416, "Winbond Electronics Corp." },
-	{ 0x0417, "Symbios Logic" },
-	{ 0x0418, "AST Research" },
-	{ 0x0419, "Samsung Info. Systems America, Inc." },
-	{ 0x041a, "Phoenix Technologies, Ltd" },
-	{ 0x041b, "d'TV" },
-	{ 0x041d, "S3, Inc." },
-	{ 0x041e, "Creative Technology, Ltd" },
-	{ 0x041f, "LCS Telegraphics" },
-	{ 0x0420, "Chips and Technologies" },
-	{ 0x0421, "Nokia Mobile Phones" },
-	{ 0x0422, "ADI Systems, Inc." },
-	{ 0x0423, "Computer Access Technology Corp." },
-	{ 0x0424, "Standard Microsystems Corp." },
-	{ 0x0425, "Motorola Semiconductors HK, Ltd" },
-	{ 0x0426, "Integrated Device Technology, Inc." },
-	{ 0x0427, "Motorola Electronics Taiwan, Ltd" },
-	{ 0x0428, "Advanced Gravis Computer Tech, Ltd" },
-	{ 0x0429, "Cirrus Logic" },
-	{ 0x042a, "Ericsson Austrian, AG" },
-	{ 0x042b, "Intel Corp." },
-	{ 0x042c, "Innovative Semiconductors, Inc." },
-	{ 0x042d, "Micronics" },
-	{ 0x042e, "Acer, Inc." },
-	{ 0x042f, "Molex, Inc." },
-	{ 0x0430, "Sun Microsystems, Inc." },
-	{ 0x0431, "Itac Systems, Inc." },
-	{ 0x0432, "Unisys Corp." },
-	{ 0x0433, "Alps Electric, Inc." },
-	{ 0x0434, "Samsung Info. Systems America, Inc." },
-	{ 0x0435, "Hyundai Electronics America" },
-	{ 0x0436, "Taugagreining HF" },
-	{ 0x0437, "Framatome Connectors USA" },
-	{ 0x0438, "Advanced Micro Devices, Inc." },
-	{ 0x0439, "Voice Technologies Group" },
-	{ 0x043d, "Lexmark International, Inc." },
-	{ 0x043e, "LG Electronics USA, Inc." },
-	{ 0x043f, "RadiSys Corp." },
-	{ 0x0440, "Eizo Nanao Corp." },
-	{ 0x0441, "Winbond Systems Lab." },
-	{ 0x0442, "Ericsson, Inc." },
-	{ 0x0443, "Gateway, Inc." },
-	{ 0x0445, "Lucent Technologies, Inc." },
-	{ 0x0446, "NMB Technologies Corp." },
-	{ 0x0447, "Momentum Microsystems" },
-	{ 0x0449, "Duta Multi Robotik" },
-	{ 0x044a, "Shamrock Tech. Co., Ltd" },
-	{ 0x044b, "WSI" },
-	{ 0x044c, "CCL/ITRI" },
-	{ 0x044d, "Siemens Nixdorf AG" },
-	{ 0x044e, "Alps Electric Co., Ltd" },
-	{ 0x044f, "ThrustMaster, Inc." },
-	{ 0x0450, "DFI, Inc." },
-	{ 0x0451, "Texas Instruments, Inc." },
-	{ 0x0452, "Mitsubishi Electronics America, Inc." },
-	{ 0x0453, "CMD Technology" },
-	{ 0x0454, "Vobis Microcomputer AG" },
-	{ 0x0455, "Telematics International, Inc." },
-	{ 0x0456, "Analog Devices, Inc." },
-	{ 0x0457, "Silicon Integrated Systems Corp." },
-	{ 0x0458, "KYE Systems Corp. (Mouse Systems)" },
-	{ 0x0459, "Adobe Systems, Inc." },
-	{ 0x045a, "SONICblue, Inc." },
-	{ 0x045b, "Hitachi, Ltd" },
-	{ 0x045d, "Nortel Networks, Ltd" },
-	{ 0x045e, "Microsoft Corp." },
-	{ 0x0460, "Ace Cad Enterprise Co., Ltd" },
-	{ 0x0461, "Primax Electronics, Ltd" },
-	{ 0x0463, "MGE UPS Systems" },
-	{ 0x0464, "AMP/Tycoelectronics Corp." },
-	{ 0x0467, "AT&T Paradyne" },
-	{ 0x0468, "Wieson Technologies Co., Ltd" },
-	{ 0x046a, "Cherry GmbH" },
-	{ 0x046b, "American Megatrends, Inc." },
-	{ 0x046c, "Toshiba Corp., Digital Media Equipment" },
-	{ 0x046d, "Logitech, Inc." },
-	{ 0x046e, "Behavior Tech. Computer Corp." },
-	{ 0x046f, "Crystal Semiconductor" },
-	{ 0x0471, "Philips (or NXP)" },
-	{ 0x0472, "Chicony Electronics Co., Ltd" },
-	{ 0x0473, "Sanyo Information Business Co., Ltd" },
-	{ 0x0474, "Sanyo Electric Co., Ltd" },
-	{ 0x0475, "Relisys/Teco Information System" },
-	{ 0x0476, "AESP" },
-	{ 0x0477, "Seagate Technology, Inc." },
-	{ 0x0478, "Connectix Corp." },
-	{ 0x0479, "Advanced Peripheral Laboratories" },
-	{ 0x047a, "Semtech Corp." },
-	{ 0x047b, "Silitek Corp." },
-	{ 0x047c, "Dell Computer Corp." },
-	{ 0x047d, "Kensington" },
-	{ 0x047e, "Agere Systems, Inc. (Lucent)" },
-	{ 0x047f, "Plantronics, Inc." },
-	{ 0x0480, "Toshiba America Inc" },
-	{ 0x0481, "Zenith Data Systems" },
-	{ 0x0482, "Kyocera Corp." },
-	{ 0x0483, "STMicroelectronics" },
-	{ 0x0484, "Specialix" },
-	{ 0x0485, "Nokia Monitors" },
-	{ 0x0486, "ASUS Computers, Inc." },
-	{ 0x0487, "Stewart Connector" },
-	{ 0x0488, "Cirque Corp." },
-	{ 0x0489, "Foxconn / Hon Hai" },
-	{ 0x048a, "S-MOS Systems, Inc." },
-	{ 0x048c, "Alps Electric Ireland, Ltd" },
-	{ 0x048d, "Integrated Technology Express, Inc." },
-	{ 0x048f, "Eicon Tech." },
-	{ 0x0490, "United Microelectronics Corp." },
-	{ 0x0491, "Capetronic" },
-	{ 0x0492, "Samsung SemiConductor, Inc." },
-	{ 0x0493, "MAG Technology Co., Ltd" },
-	{ 0x0495, "ESS Technology, Inc." },
-	{ 0x0496, "Micron Electronics" },
-	{ 0x0497, "Smile International" },
-	{ 0x0498, "Capetronic (Kaohsiung) Corp." },
-	{ 0x0499, "Yamaha Corp." },
-	{ 0x049a, "Gandalf Technologies, Ltd" },
-	{ 0x049b, "Curtis Computer Products" },
-	{ 0x049c, "Acer Advanced Labs, Inc." },
-	{ 0x049d, "VLSI Technology" },
-	{ 0x049f, "Compaq Computer Corp." },
-	{ 0x04a0, "Digital Equipment Corp." },
-	{ 0x04a1, "SystemSoft Corp." },
-	{ 0x04a2, "FirePower Systems" },
-	{ 0x04a3, "Trident Microsystems, Inc." },
-	{ 0x04a4, "Hitachi, Ltd" },
-	{ 0x04a5, "Acer Peripherals Inc. (now BenQ Corp.)" },
-	{ 0x04a6, "Nokia Display Products" },
-	{ 0x04a7, "Visioneer" },
-	{ 0x04a8, "Multivideo Labs, Inc." },
-	{ 0x04a9, "Canon, Inc." },
-	{ 0x04aa, "DaeWoo Telecom, Ltd" },
-	{ 0x04ab, "Chromatic Research" },
-	{ 0x04ac, "Micro Audiometrics Corp." },
-	{ 0x04ad, "Dooin Electronics" },
-	{ 0x04af, "Winnov L.P." },
-	{ 0x04b0, "Nikon Corp." },
-	{ 0x04b1, "Pan International" },
-	{ 0x04b3, "IBM Corp." },
-	{ 0x04b4, "Cypress Semiconductor Corp." },
-	{ 0x04b5, "ROHM LSI Systems USA, LLC" },
-	{ 0x04b6, "Hint Corp." },
-	{ 0x04b7, "Compal Electronics, Inc." },
-	{ 0x04b8, "Seiko Epson Corp." },
-	{ 0x04b9, "Rainbow Technologies, Inc." },
-	{ 0x04ba, "Toucan Systems, Ltd" },
-	{ 0x04bb, "I-O Data Device, Inc." },
-	{ 0x04bd, "Toshiba Electronics Taiwan Corp." },
-	{ 0x04be, "Telia Research AB" },
-	{ 0x04bf, "TDK Corp." },
-	{ 0x04c1, "U.S. Robotics (3Com)" },
-	{ 0x04c2, "Methode Electronics Far East PTE, Ltd" },
-	{ 0x04c3, "Maxi Switch, Inc." },
-	{ 0x04c4, "Lockheed Martin Energy Research" },
-	{ 0x04c5, "Fujitsu, Ltd" },
-	{ 0x04c6, "Toshiba America Electronic Components" },
-	{ 0x04c7, "Micro Macro Technologies" },
-	{ 0x04c8, "Konica Corp." },
-	{ 0x04ca, "Lite-On Technology Corp." },
-	{ 0x04cb, "Fuji Photo Film Co., Ltd" },
-	{ 0x04cc, "ST-Ericsson" },
-	{ 0x04cd, "Tatung Co. Of America" },
-	{ 0x04ce, "ScanLogic Corp." },
-	{ 0x04cf, "Myson Century, Inc." },
-	{ 0x04d0, "Digi International" },
-	{ 0x04d1, "ITT Canon" },
-	{ 0x04d2, "Altec Lansing Technologies" },
-	{ 0x04d3, "VidUS, Inc." },
-	{ 0x04d4, "LSI Logic, Inc." },
-	{ 0x04d5, "Forte Technologies, Inc." },
-	{ 0x04d6, "Mentor Graphics" },
-	{ 0x04d7, "Oki Semiconductor" },
-	{ 0x04d8, "Microchip Technology, Inc." },
-	{ 0x04d9, "Holtek Semiconductor, Inc." },
-	{ 0x04da, "Panasonic (Matsushita)" },
-	{ 0x04db, "Hypertec Pty, Ltd" },
-	{ 0x04dc, "Huan Hsin Holdings, Ltd" },
-	{ 0x04dd, "Sharp Corp." },
-	{ 0x04de, "MindShare, Inc." },
-	{ 0x04df, "Interlink Electronics" },
-	{ 0x04e1, "Iiyama North America, Inc." },
-	{ 0x04e2, "Exar Corp." },
-	{ 0x04e3, "Zilog, Inc." },
-	{ 0x04e4, "ACC Microelectronics" },
-	{ 0x04e5, "Promise Technology" },
-	{ 0x04e6, "SCM Microsystems, Inc." },
-	{ 0x04e7, "Elo TouchSystems" },
-	{ 0x04e8, "Samsung Electronics Co., Ltd" },
-	{ 0x04e9, "PC-Tel, Inc." },
-	{ 0x04ea, "Brooktree Corp." },
-	{ 0x04eb, "Northstar Systems, Inc." },
-	{ 0x04ec, "Tokyo Electron Device, Ltd" },
-	{ 0x04ed, "Annabooks" },
-	{ 0x04ef, "Pacific Electronic International, Inc." },
-	{ 0x04f0, "Daewoo Electronics Co., Ltd" },
-	{ 0x04f1, "Victor Company of Japan, Ltd" },
-	{ 0x04f2, "Chicony Electronics Co., Ltd" },
-	{ 0x04f3, "Elan Microelectronics Corp." },
-	{ 0x04f4, "Harting Elektronik, Inc." },
-	{ 0x04f5, "Fujitsu-ICL Systems, Inc." },
-	{ 0x04f6, "Norand Corp." },
-	{ 0x04f7, "Newnex Technology Corp." },
-	{ 0x04f8, "FuturePlus Systems" },
-	{ 0x04f9, "Brother Industries, Ltd" },
-	{ 0x04fa, "Dallas Semiconductor" },
-	{ 0x04fb, "Biostar Microtech International Corp." },
-	{ 0x04fc, "Sunplus Technology Co., Ltd" },
-	{ 0x04fd, "Soliton Systems, K.K." },
-	{ 0x04fe, "PFU, Ltd" },
-	{ 0x04ff, "E-CMOS Corp." },
-	{ 0x0500, "Siam United Hi-Tech" },
-	{ 0x0501, "Fujikura DDK, Ltd" },
-	{ 0x0502, "Acer, Inc." },
-	{ 0x0503, "Hitachi America, Ltd" },
-	{ 0x0504, "Hayes Microcomputer Products" },
-	{ 0x0506, "3Com Corp." },
-	{ 0x0507, "Hosiden Corp." },
-	{ 0x0508, "Clarion Co., Ltd" },
-	{ 0x0509, "Aztech Systems, Ltd" },
-	{ 0x050a, "Cinch Connectors" },
-	{ 0x050b, "Cable System International" },
-	{ 0x050c, "InnoMedia, Inc." },
-	{ 0x050d, "Belkin Components" },
-	{ 0x050e, "Neon Technology, Inc." },
-	{ 0x050f, "KC Technology, Inc." },
-	{ 0x0510, "Sejin Electron, Inc." },
-	{ 0x0511, "N'Able (DataBook) Technologies, Inc." },
-	{ 0x0512, "Hualon Microelectronics Corp." },
-	{ 0x0513, "digital-X, Inc." },
-	{ 0x0514, "FCI Electronics" },
-	{ 0x0515, "ACTC" },
-	{ 0x0516, "Longwell Electronics" },
-	{ 0x0517, "Butterfly Communications" },
-	{ 0x0518, "EzKEY Corp." },
-	{ 0x0519, "Star Micronics Co., Ltd" },
-	{ 0x051a, "WYSE Technology" },
-	{ 0x051b, "Silicon Graphics" },
-	{ 0x051c, "Shuttle, Inc." },
-	{ 0x051d, "American Power Conversion" },
-	{ 0x051e, "Scientific Atlanta, Inc." },
-	{ 0x051f, "IO Systems (Elite Electronics), Inc." },
-	{ 0x0520, "Taiwan Semiconductor Manufacturing Co." },
-	{ 0x0521, "Airborn Connectors" },
-	{ 0x0522, "Advanced Connectek, Inc." },
-	{ 0x0523, "ATEN GmbH" },
-	{ 0x0524, "Sola Electronics" },
-	{ 0x0525, "Netchip Technology, Inc." },
-	{ 0x0526, "Temic MHS S.A." },
-	{ 0x0527, "ALTRA" },
-	{ 0x0528, "ATI Technologies, Inc." },
-	{ 0x0529, "Aladdin Knowledge Systems" },
-	{ 0x052a, "Crescent Heart Software" },
-	{ 0x052b, "Tekom Technologies, Inc." },
-	{ 0x052c, "Canon Information Systems, Inc." },
-	{ 0x052d, "Avid Electronics Corp." },
-	{ 0x052e, "Standard Microsystems Corp." },
-	{ 0x052f, "Unicore Software, Inc." },
-	{ 0x0530, "American Microsystems, Inc." },
-	{ 0x0531, "Wacom Technology Corp." },
-	{ 0x0532, "Systech Corp." },
-	{ 0x0533, "Alcatel Mobile Phones" },
-	{ 0x0534, "Motorola, Inc." },
-	{ 0x0535, "LIH TZU Electric Co., Ltd" },
-	{ 0x0536, "Hand Held Products (Welch Allyn, Inc.)" },
-	{ 0x0537, "Inventec Corp." },
-	{ 0x0538, "Caldera International, Inc. (SCO)" },
-	{ 0x0539, "Shyh Shiun Terminals Co., Ltd" },
-	{ 0x053a, "PrehKeyTec GmbH" },
-	{ 0x053b, "Global Village Communication" },
-	{ 0x053c, "Institut of Microelectronic & Mechatronic Systems" },
-	{ 0x053d, "Silicon Architect" },
-	{ 0x053e, "Mobility Electronics" },
-	{ 0x053f, "Synopsys, Inc." },
-	{ 0x0540, "UniAccess AB" },
-	{ 0x0541, "Sirf Technology, Inc." },
-	{ 0x0543, "ViewSonic Corp." },
-	{ 0x0544, "Cristie Electronics, Ltd" },
-	{ 0x0545, "Xirlink, Inc." },
-	{ 0x0546, "Polaroid Corp." },
-	{ 0x0547, "Anchor Chips, Inc." },
-	{ 0x0548, "Tyan Computer Corp." },
-	{ 0x0549, "Pixera Corp." },
-	{ 0x054a, "Fujitsu Microelectronics, Inc." },
-	{ 0x054b, "New Media Corp." },
-	{ 0x054c, "Sony Corp." },
-	{ 0x054d, "Try Corp." },
-	{ 0x054e, "Proside Corp." },
-	{ 0x054f, "WYSE Technology Taiwan" },
-	{ 0x0550, "Fuji Xerox Co., Ltd" },
-	{ 0x0551, "CompuTrend Systems, Inc." },
-	{ 0x0552, "Philips Monitors" },
-	{ 0x0553, "STMicroelectronics Imaging Division (VLSI Vision)" },
-	{ 0x0554, "Dictaphone Corp." },
-	{ 0x0555, "ANAM S&T Co., Ltd" },
-	{ 0x0556, "Asahi Kasei Microsystems Co., Ltd" },
-	{ 0x0557, "ATEN International Co., Ltd" },
-	{ 0x0558, "Truevision, Inc." },
-	{ 0x0559, "Cadence Design Systems, Inc." },
-	{ 0x055a, "Kenwood USA" },
-	{ 0x055b, "KnowledgeTek, Inc." },
-	{ 0x055c, "Proton Electronic Ind." },
-	{ 0x055d, "Samsung Electro-Mechanics Co." },
-	{ 0x055e, "CTX Opto-Electronics Corp." },
-	{ 0x055f, "Mustek Systems, Inc." },
-	{ 0x0560, "Interface Corp." },
-	{ 0x0561, "Oasis Design, Inc." },
-	{ 0x0562, "Telex Communications, Inc." },
-	{ 0x0563, "Immersion Corp." },
-	{ 0x0564, "Kodak Digital Product Center, Japan Ltd. (formerly Chinon Industries Inc.)" },
-	{ 0x0565, "Peracom Networks, Inc." },
-	{ 0x0566, "Monterey International Corp." },
-	{ 0x0567, "Xyratex International, Ltd" },
-	{ 0x0568, "Quartz Ingenierie" },
-	{ 0x0569, "SegaSoft" },
-	{ 0x056a, "Wacom Co., Ltd" },
-	{ 0x056b, "Decicon, Inc." },
-	{ 0x056c, "eTEK Labs" },
-	{ 0x056d, "EIZO Corp." },
-	{ 0x056e, "Elecom Co., Ltd" },
-	{ 0x056f, "Korea Data Systems Co., Ltd" },
-	{ 0x0570, "Epson America" },
-	{ 0x0571, "Interex, Inc." },
-	{ 0x0572, "Conexant Systems (Rockwell), Inc." },
-	{ 0x0573, "Zoran Co. Personal Media Division (Nogatech)" },
-	{ 0x0574, "City University of Hong Kong" },
-	{ 0x0575, "Philips Creative Display Solutions" },
-	{ 0x0576, "BAFO/Quality Computer Accessories" },
-	{ 0x0577, "ELSA" },
-	{ 0x0578, "Intrinsix Corp." },
-	{ 0x0579, "GVC Corp." },
-	{ 0x057a, "Samsung Electronics America" },
-	{ 0x057b, "Y-E Data, Inc." },
-	{ 0x057c, "AVM GmbH" },
-	{ 0x057d, "Shark Multimedia, Inc." },
-	{ 0x057e, "Nintendo Co., Ltd" },
-	{ 0x057f, "QuickShot, Ltd" },
-	{ 0x0580, "Denron, Inc." },
-	{ 0x0581, "Racal Data Group" },
-	{ 0x0582, "Roland Corp." },
-	{ 0x0583, "Padix Co., Ltd (Rockfire)" },
-	{ 0x0584, "RATOC System, Inc." },
-	{ 0x0585, "FlashPoint Technology, Inc." },
-	{ 0x0586, "ZyXEL Communications Corp." },
-	{ 0x0587, "America Kotobuki Electronics Industries, Inc." },
-	{ 0x0588, "Sapien Design" },
-	{ 0x0589, "Victron" },
-	{ 0x058a, "Nohau Corp." },
-	{ 0x058b, "Infineon Technologies" },
-	{ 0x058c, "In Focus Systems" },
-	{ 0x058d, "Micrel Semiconductor" },
-	{ 0x058e, "Tripath Technology, Inc." },
-	{ 0x058f, "Alcor Micro Corp." },
-	{ 0x0590, "Omron Corp." },
-	{ 0x0591, "Questra Consulting" },
-	{ 0x0592, "Powerware Corp." },
-	{ 0x0593, "Incite" },
-	{ 0x0594, "Princeton Graphic Systems" },
-	{ 0x0595, "Zoran Microelectronics, Ltd" },
-	{ 0x0596, "MicroTouch Systems, Inc." },
-	{ 0x0597, "Trisignal Communications" },
-	{ 0x0598, "Niigata Canotec Co., Inc." },
-	{ 0x0599, "Brilliance Semiconductor, Inc." },
-	{ 0x059a, "Spectrum Signal Processing, Inc." },
-	{ 0x059b, "Iomega Corp." },
-	{ 0x059c, "A-Trend Technology Co., Ltd" },
-	{ 0x059d, "Advanced Input Devices" },
-	{ 0x059e, "Intelligent Instrumentation" },
-	{ 0x059f, "LaCie, Ltd" },
-	{ 0x05a0, "Vetronix Corp." },
-	{ 0x05a1, "USC Corp." },
-	{ 0x05a2, "Fuji Film Microdevices Co., Ltd" },
-	{ 0x05a3, "ARC International" },
-	{ 0x05a4, "Ortek Technology, Inc." },
-	{ 0x05a5, "Sampo Technology Corp." },
-	{ 0x05a6, "Cisco Systems, Inc." },
-	{ 0x05a7, "Bose Corp." },
-	{ 0x05a8, "Spacetec IMC Corp." },
-	{ 0x05a9, "OmniVision Technologies, Inc." },
-	{ 0x05aa, "Utilux South China, Ltd" },
-	{ 0x05ab, "In-System Design" },
-	{ 0x05ac, "Apple, Inc." },
-	{ 0x05ad, "Y.C. Cable U.S.A., Inc." },
-	{ 0x05ae, "Synopsys, Inc." },
-	{ 0x05af, "Jing-Mold Enterprise Co., Ltd" },
-	{ 0x05b0, "Fountain Technologies, Inc." },
-	{ 0x05b1, "First International Computer, Inc." },
-	{ 0x05b4, "LG Semicon Co., Ltd" },
-	{ 0x05b5, "Dialogic Corp." },
-	{ 0x05b6, "Proxima Corp." },
-	{ 0x05b7, "Medianix Semiconductor, Inc." },
-	{ 0x05b8, "Agiler, Inc." },
-	{ 0x05b9, "Philips Research Laboratories" },
-	{ 0x05ba, "DigitalPersona, Inc." },
-	{ 0x05bb, "Grey Cell Systems" },
-	{ 0x05bc, "3G Green Green Globe Co., Ltd" },
-	{ 0x05bd, "RAFI GmbH & Co. KG" },
-	{ 0x05be, "Tyco Electronics (Raychem)" },
-	{ 0x05bf, "S & S Research" },
-	{ 0x05c0, "Keil Software" },
-	{ 0x05c1, "Kawasaki Microelectronics, Inc." },
-	{ 0x05c2, "Media Phonics (Suisse) S.A." },
-	{ 0x05c5, "Digi International, Inc." },
-	{ 0x05c6, "Qualcomm, Inc." },
-	{ 0x05c7, "Qtronix Corp." },
-	{ 0x05c8, "Cheng Uei Precision Industry Co., Ltd (Foxlink)" },
-	{ 0x05c9, "Semtech Corp." },
-	{ 0x05ca, "Ricoh Co., Ltd" },
-	{ 0x05cb, "PowerVision Technologies, Inc." },
-	{ 0x05cc, "ELSA AG" },
-	{ 0x05cd, "Silicom, Ltd" },
-	{ 0x05ce, "sci-worx GmbH" },
-	{ 0x05cf, "Sung Forn Co., Ltd" },
-	{ 0x05d0, "GE Medical Systems Lunar" },
-	{ 0x05d1, "Brainboxes, Ltd" },
-	{ 0x05d2, "Wave Systems Corp." },
-	{ 0x05d3, "Tohoku Ricoh Co., Ltd" },
-	{ 0x05d5, "Super Gate Technology Co., Ltd" },
-	{ 0x05d6, "Philips Semiconductors, CICT" },
-	{ 0x05d7, "Thomas & Betts Corp." },
-	{ 0x05d8, "Ultima Electronics Corp." },
-	{ 0x05d9, "Axiohm Transaction Solutions" },
-	{ 0x05da, "Microtek International, Inc." },
-	{ 0x05db, "Sun Corp. (Suntac?)" },
-	{ 0x05dc, "Lexar Media, Inc." },
-	{ 0x05dd, "Delta Electronics, Inc." },
-	{ 0x05df, "Silicon Vision, Inc." },
-	{ 0x05e0, "Symbol Technologies" },
-	{ 0x05e1, "Syntek Semiconductor Co., Ltd" },
-	{ 0x05e2, "ElecVision, Inc." },
-	{ 0x05e3, "Genesys Logic, Inc." },
-	{ 0x05e4, "Red Wing Corp." },
-	{ 0x05e5, "Fuji Electric Co., Ltd" },
-	{ 0x05e6, "Keithley Instruments" },
-	{ 0x05e8, "ICC, Inc." },
-	{ 0x05e9, "Kawasaki LSI" },
-	{ 0x05eb, "FFC, Ltd" },
-	{ 0x05ec, "COM21, Inc." },
-	{ 0x05ee, "Cytechinfo Inc." },
-	{ 0x05ef, "AVB, Inc. [anko?]" },
-	{ 0x05f0, "Canopus Co., Ltd" },
-	{ 0x05f1, "Compass Communications" },
-	{ 0x05f2, "Dexin Corp., Ltd" },
-	{ 0x05f3, "PI Engineering, Inc." },
-	{ 0x05f5, "Unixtar Technology, Inc." },
-	{ 0x05f6, "AOC International" },
-	{ 0x05f7, "RFC Distribution(s) PTE, Ltd" },
-	{ 0x05f9, "PSC Scanning, Inc." },
-	{ 0x05fa, "Siemens Telecommunications Systems, Ltd" },
-	{ 0x05fc, "Harman" },
-	{ 0x05fd, "InterAct, Inc." },
-	{ 0x05fe, "Chic Technology Corp." },
-	{ 0x05ff, "LeCroy Corp." },
-	{ 0x0600, "Barco Display Systems" },
-	{ 0x0601, "Jazz Hipster Corp." },
-	{ 0x0602, "Vista Imaging, Inc." },
-	{ 0x0603, "Novatek Microelectronics Corp." },
-	{ 0x0604, "Jean Co., Ltd" },
-	{ 0x0605, "Anchor C&C Co., Ltd" },
-	{ 0x0606, "Royal Information Electronics Co., Ltd" },
-	{ 0x0607, "Bridge Information Co., Ltd" },
-	{ 0x0608, "Genrad Ads" },
-	{ 0x0609, "SMK Manufacturing, Inc." },
-	{ 0x060a, "Worthington Data Solutions, Inc." },
-	{ 0x060b, "Solid Year" },
-	{ 0x060c, "EEH Datalink GmbH" },
-	{ 0x060d, "Auctor Corp." },
-	{ 0x060e, "Transmonde Technologies, Inc." },
-	{ 0x060f, "Joinsoon Electronics Mfg. Co., Ltd" },
-	{ 0x0610, "Costar Electronics, Inc." },
-	{ 0x0611, "Totoku Electric Co., Ltd" },
-	{ 0x0613, "TransAct Technologies, Inc." },
-	{ 0x0614, "Bio-Rad Laboratories" },
-	{ 0x0615, "Quabbin Wire & Cable Co., Inc." },
-	{ 0x0616, "Future Techno Designs PVT, Ltd" },
-	{ 0x0617, "Swiss Federal Insitute of Technology" },
-	{ 0x0618, "MacAlly" },
-	{ 0x0619, "Seiko Instruments, Inc." },
-	{ 0x061a, "Veridicom International, Inc." },
-	{ 0x061b, "Promptus Communications, Inc." },
-	{ 0x061c, "Act Labs, Ltd" },
-	{ 0x061d, "Quatech, Inc." },
-	{ 0x061e, "Nissei Electric Co." },
-	{ 0x0620, "Alaris, Inc." },
-	{ 0x0621, "ODU-Steckverbindungssysteme GmbH & Co. KG" },
-	{ 0x0622, "Iotech, Inc." },
-	{ 0x0623, "Littelfuse, Inc." },
-	{ 0x0624, "Avocent Corp." },
-	{ 0x0625, "TiMedia Technology Co., Ltd" },
-	{ 0x0626, "Nippon Systems Development Co., Ltd" },
-	{ 0x0627, "Adomax Technology Co., Ltd" },
-	{ 0x0628, "Tasking Software, Inc." },
-	{ 0x0629, "Zida Technologies, Ltd" },
-	{ 0x062a, "MosArt Semiconductor Corp." },
-	{ 0x062b, "Greatlink Electronics Taiwan, Ltd" },
-	{ 0x062c, "Institute for Information Industry" },
-	{ 0x062d, "Taiwan Tai-Hao Enterprises Co., Ltd" },
-	{ 0x062e, "Mainsuper Enterprises Co., Ltd" },
-	{ 0x062f, "Sin Sheng Terminal & Machine, Inc." },
-	{ 0x0631, "JUJO Electronics Corp." },
-	{ 0x0633, "Cyrix Corp." },
-	{ 0x0634, "Micron Technology, Inc." },
-	{ 0x0635, "Methode Electronics, Inc." },
-	{ 0x0636, "Sierra Imaging, Inc." },
-	{ 0x0638, "Avision, Inc." },
-	{ 0x0639, "Chrontel, Inc." },
-	{ 0x063a, "Techwin Corp." },
-	{ 0x063b, "Taugagreining HF" },
-	{ 0x063c, "Yamaichi Electronics Co., Ltd (Sakura)" },
-	{ 0x063d, "Fong Kai Industrial Co., Ltd" },
-	{ 0x063e, "RealMedia Technology, Inc." },
-	{ 0x063f, "New Technology Cable, Ltd" },
-	{ 0x0640, "Hitex Development Tools" },
-	{ 0x0641, "Woods Industries, Inc." },
-	{ 0x0642, "VIA Medical Corp." },
-	{ 0x0644, "TEAC Corp." },
-	{ 0x0645, "Who? Vision Systems, Inc." },
-	{ 0x0646, "UMAX" },
-	{ 0x0647, "Acton Research Corp." },
-	{ 0x0648, "Inside Out Networks" },
-	{ 0x0649, "Weli Science Co., Ltd" },
-	{ 0x064b, "Analog Devices, Inc. (White Mountain DSP)" },
-	{ 0x064c, "Ji-Haw Industrial Co., Ltd" },
-	{ 0x064d, "TriTech Microelectronics, Ltd" },
-	{ 0x064e, "Suyin Corp." },
-	{ 0x064f, "WIBU-Systems AG" },
-	{ 0x0650, "Dynapro Systems" },
-	{ 0x0651, "Likom Technology Sdn. Bhd." },
-	{ 0x0652, "Stargate Solutions, Inc." },
-	{ 0x0653, "CNF, Inc." },
-	{ 0x0654, "Granite Microsystems, Inc." },
-	{ 0x0655, "Space Shuttle Hi-Tech Co., Ltd" },
-	{ 0x0656, "Glory Mark Electronic, Ltd" },
-	{ 0x0657, "Tekcon Electronics Corp." },
-	{ 0x0658, "Sigma Designs, Inc." },
-	{ 0x0659, "Aethra" },
-	{ 0x065a, "Optoelectronics Co., Ltd" },
-	{ 0x065b, "Tracewell Systems" },
-	{ 0x065e, "Silicon Graphics" },
-	{ 0x065f, "Good Way Technology Co., Ltd & GWC technology Inc." },
-	{ 0x0660, "TSAY-E (BVI) International, Inc." },
-	{ 0x0661, "Hamamatsu Photonics K.K." },
-	{ 0x0662, "Kansai Electric Co., Ltd" },
-	{ 0x0663, "Topmax Electronic Co., Ltd" },
-	{ 0x0664, "ET&T Technology Co., Ltd." },
-	{ 0x0665, "Cypress Semiconductor" },
-	{ 0x0667, "Aiwa Co., Ltd" },
-	{ 0x0668, "WordWand" },
-	{ 0x0669, "Oce' Printing Systems GmbH" },
-	{ 0x066a, "Total Technologies, Ltd" },
-	{ 0x066b, "Linksys, Inc." },
-	{ 0x066d, "Entrega, Inc." },
-	{ 0x066e, "Acer Semiconductor America, Inc." },
-	{ 0x066f, "SigmaTel, Inc." },
-	{ 0x0670, "Sequel Imaging" },
-	{ 0x0672, "Labtec, Inc." },
-	{ 0x0673, "HCL" },
-	{ 0x0674, "Key Mouse Electronic Enterprise Co., Ltd" },
-	{ 0x0675, "DrayTek Corp." },
-	{ 0x0676, "Teles AG" },
-	{ 0x0677, "Aiwa Co., Ltd" },
-	{ 0x0678, "ACard Technology Corp." },
-	{ 0x067b, "Prolific Technology, Inc." },
-	{ 0x067c, "Efficient Networks, Inc." },
-	{ 0x067d, "Hohner Corp." },
-	{ 0x067e, "Intermec Technologies Corp." },
-	{ 0x067f, "Virata, Ltd" },
-	{ 0x0680, "Realtek Semiconductor Corp., CPP Div. (Avance Logic)" },
-	{ 0x0681, "Siemens Information and Communication Products" },
-	{ 0x0682, "Victor Company of Japan, Ltd" },
-	{ 0x0684, "Actiontec Electronics, Inc." },
-	{ 0x0685, "ZD Incorporated" },
-	{ 0x0686, "Minolta Co., Ltd" },
-	{ 0x068a, "Pertech, Inc." },
-	{ 0x068b, "Potrans International, Inc." },
-	{ 0x068e, "CH Products, Inc." },
-	{ 0x0690, "Golden Bridge Electech, Inc." },
-	{ 0x0693, "Hagiwara Sys-Com Co., Ltd" },
-	{ 0x0694, "Lego Group" },
-	{ 0x0698, "Chuntex (CTX)" },
-	{ 0x0699, "Tektronix, Inc." },
-	{ 0x069a, "Askey Computer Corp." },
-	{ 0x069b, "Thomson, Inc." },
-	{ 0x069d, "Hughes Network Systems (HNS)" },
-	{ 0x069e, "Welcat Inc." },
-	{ 0x069f, "Allied Data Technologies BV" },
-	{ 0x06a2, "Topro Technology, Inc." },
-	{ 0x06a3, "Saitek PLC" },
-	{ 0x06a4, "Xiamen Doowell Electron Co., Ltd" },
-	{ 0x06a5, "Divio" },
-	{ 0x06a7, "MicroStore, Inc." },
-	{ 0x06a8, "Topaz Systems, Inc." },
-	{ 0x06a9, "Westell" },
-	{ 0x06aa, "Sysgration, Ltd" },
-	{ 0x06ac, "Fujitsu Laboratories of America, Inc." },
-	{ 0x06ad, "Greatland Electronics Taiwan, Ltd" },
-	{ 0x06ae, "Professional Multimedia Testing Centre" },
-	{ 0x06af, "Harting, Inc. of North America" },
-	{ 0x06b8, "Pixela Corp." },
-	{ 0x06b9, "Alcatel Telecom" },
-	{ 0x06ba, "Smooth Cord & Connector Co., Ltd" },
-	{ 0x06bb, "EDA, Inc." },
-	{ 0x06bc, "Oki Data Corp." },
-	{ 0x06bd, "AGFA-Gevaert NV" },
-	{ 0x06be, "AME Optimedia Technology Co., Ltd" },
-	{ 0x06bf, "Leoco Corp." },
-	{ 0x06c2, "Phidgets Inc. (formerly GLAB)" },
-	{ 0x06c4, "Bizlink International Corp." },
-	{ 0x06c5, "Hagenuk, GmbH" },
-	{ 0x06c6, "Infowave Software, Inc." },
-	{ 0x06c8, "SIIG, Inc." },
-	{ 0x06c9, "Taxan (Europe), Ltd" },
-	{ 0x06ca, "Newer Technology, Inc." },
-	{ 0x06cb, "Synaptics, Inc." },
-	{ 0x06cc, "Terayon Communication Systems" },
-	{ 0x06cd, "Keyspan" },
-	{ 0x06ce, "Contec" },
-	{ 0x06cf, "SpheronVR AG" },
-	{ 0x06d0, "LapLink, Inc." },
-	{ 0x06d1, "Daewoo Electronics Co., Ltd" },
-	{ 0x06d3, "Mitsubishi Electric Corp." },
-	{ 0x06d4, "Cisco Systems" },
-	{ 0x06d5, "Toshiba" },
-	{ 0x06d6, "Aashima Technology B.V." },
-	{ 0x06d7, "Network Computing Devices (NCD)" },
-	{ 0x06d8, "Technical Marketing Research, Inc." },
-	{ 0x06da, "Phoenixtec Power Co., Ltd" },
-	{ 0x06db, "Paradyne" },
-	{ 0x06dc, "Foxlink Image Technology Co., Ltd" },
-	{ 0x06de, "Heisei Electronics Co., Ltd" },
-	{ 0x06e0, "Multi-Tech Systems, Inc." },
-	{ 0x06e1, "ADS Technologies, Inc." },
-	{ 0x06e4, "Alcatel Microelectronics" },
-	{ 0x06e6, "Tiger Jet Network, Inc." },
-	{ 0x06ea, "Sirius Technologies" },
-	{ 0x06eb, "PC Expert Tech. Co., Ltd" },
-	{ 0x06ef, "I.A.C. Geometrische Ingenieurs B.V." },
-	{ 0x06f0, "T.N.C Industrial Co., Ltd" },
-	{ 0x06f1, "Opcode Systems, Inc." },
-	{ 0x06f2, "Emine Technology Co." },
-	{ 0x06f6, "Wintrend Technology Co., Ltd" },
-	{ 0x06f7, "Wailly Technology Ltd" },
-	{ 0x06f8, "Guillemot Corp." },
-	{ 0x06f9, "ASYST electronic d.o.o." },
-	{ 0x06fa, "HSD S.r.L" },
-	{ 0x06fc, "Motorola Semiconductor Products Sector" },
-	{ 0x06fd, "Boston Acoustics" },
-	{ 0x06fe, "Gallant Computer, Inc." },
-	{ 0x0701, "Supercomal Wire & Cable SDN. BHD." },
-	{ 0x0703, "Bvtech Industry, Inc." },
-	{ 0x0705, "NKK Corp." },
-	{ 0x0706, "Ariel Corp." },
-	{ 0x0707, "Standard Microsystems Corp." },
-	{ 0x0708, "Putercom Co., Ltd" },
-	{ 0x0709, "Silicon Systems, Ltd (SSL)" },
-	{ 0x070a, "Oki Electric Industry Co., Ltd" },
-	{ 0x070d, "Comoss Electronic Co., Ltd" },
-	{ 0x070e, "Excel Cell Electronic Co., Ltd" },
-	{ 0x0710, "Connect Tech, Inc." },
-	{ 0x0711, "Magic Control Technology Corp." },
-	{ 0x0713, "Interval Research Corp." },
-	{ 0x0714, "NewMotion, Inc." },
-	{ 0x0717, "ZNK Corp." },
-	{ 0x0718, "Imation Corp." },
-	{ 0x0719, "Tremon Enterprises Co., Ltd" },
-	{ 0x071b, "Domain Technologies, Inc." },
-	{ 0x071c, "Xionics Document Technologies, Inc." },
-	{ 0x071d, "Eicon Networks Corp." },
-	{ 0x071e, "Ariston Technologies" },
-	{ 0x0720, "Keyence Corp." },
-	{ 0x0723, "Centillium Communications Corp." },
-	{ 0x0726, "Vanguard International Semiconductor-America" },
-	{ 0x0729, "Amitm" },
-	{ 0x072e, "Sunix Co., Ltd" },
-	{ 0x072f, "Advanced Card Systems, Ltd" },
-	{ 0x0731, "Susteen, Inc." },
-	{ 0x0732, "Goldfull Electronics & Telecommunications Corp." },
-	{ 0x0733, "ViewQuest Technologies, Inc." },
-	{ 0x0734, "Lasat Communications A/S" },
-	{ 0x0735, "Asuscom Network" },
-	{ 0x0736, "Lorom Industrial Co., Ltd" },
-	{ 0x0738, "Mad Catz, Inc." },
-	{ 0x073a, "Chaplet Systems, Inc." },
-	{ 0x073b, "Suncom Technologies" },
-	{ 0x073c, "Industrial Electronic Engineers, Inc." },
-	{ 0x073d, "Eutron S.p.a." },
-	{ 0x073e, "NEC, Inc." },
-	{ 0x0742, "Stollmann" },
-	{ 0x0745, "Syntech Information Co., Ltd" },
-	{ 0x0746, "Onkyo Corp." },
-	{ 0x0747, "Labway Corp." },
-	{ 0x0748, "Strong Man Enterprise Co., Ltd" },
-	{ 0x0749, "EVer Electronics Corp." },
-	{ 0x074a, "Ming Fortune Industry Co., Ltd" },
-	{ 0x074b, "Polestar Tech. Corp." },
-	{ 0x074c, "C-C-C Group PLC" },
-	{ 0x074d, "Micronas GmbH" },
-	{ 0x074e, "Digital Stream Corp." },
-	{ 0x0755, "Aureal Semiconductor" },
-	{ 0x0757, "Network Technologies, Inc." },
-	{ 0x0758, "Carl Zeiss Microscopy GmbH" },
-	{ 0x075b, "Sophisticated Circuits, Inc." },
-	{ 0x0763, "M-Audio" },
-	{ 0x0764, "Cyber Power System, Inc." },
-	{ 0x0765, "X-Rite, Inc." },
-	{ 0x0766, "Jess-Link Products Co., Ltd" },
-	{ 0x0767, "Tokheim Corp." },
-	{ 0x0768, "Camtel Technology Corp." },
-	{ 0x0769, "Surecom Technology Corp." },
-	{ 0x076a, "Smart Technology Enablers, Inc." },
-	{ 0x076b, "OmniKey AG" },
-	{ 0x076c, "Partner Tech" },
-	{ 0x076d, "Denso Corp." },
-	{ 0x076e, "Kuan Tech Enterprise Co., Ltd" },
-	{ 0x076f, "Jhen Vei Electronic Co., Ltd" },
-	{ 0x0770, "Welch Allyn, Inc - Medical Division" },
-	{ 0x0771, "Observator Instruments BV" },
-	{ 0x0772, "Your data Our Care" },
-	{ 0x0774, "AmTRAN Technology Co., Ltd" },
-	{ 0x0775, "Longshine Electronics Corp." },
-	{ 0x0776, "Inalways Corp." },
-	{ 0x0777, "Comda Enterprise Corp." },
-	{ 0x0778, "Volex, Inc." },
-	{ 0x0779, "Fairchild Semiconductor" },
-	{ 0x077a, "Sankyo Seiki Mfg. Co., Ltd" },
-	{ 0x077b, "Linksys" },
-	{ 0x077c, "Forward Electronics Co., Ltd" },
-	{ 0x077d, "Griffin Technology" },
-	{ 0x077f, "Well Excellent & Most Corp." },
-	{ 0x0780, "Sagem Monetel GmbH" },
-	{ 0x0781, "SanDisk Corp." },
-	{ 0x0782, "Trackerball" },
-	{ 0x0783, "C3PO" },
-	{ 0x0784, "Vivitar, Inc." },
-	{ 0x0785, "NTT-ME" },
-	{ 0x0789, "Logitec Corp." },
-	{ 0x078b, "Happ Controls, Inc." },
-	{ 0x078c, "GTCO/CalComp" },
-	{ 0x078e, "Brincom, Inc." },
-	{ 0x0790, "Pro-Image Manufacturing Co., Ltd" },
-	{ 0x0791, "Copartner Wire and Cable Mfg. Corp." },
-	{ 0x0792, "Axis Communications AB" },
-	{ 0x0793, "Wha Yu Industrial Co., Ltd" },
-	{ 0x0794, "ABL Electronics Corp." },
-	{ 0x0795, "RealChip, Inc." },
-	{ 0x0796, "Certicom Corp." },
-	{ 0x0797, "Grandtech Semiconductor Corp." },
-	{ 0x0798, "Optelec" },
-	{ 0x0799, "Altera" },
-	{ 0x079b, "Sagem" },
-	{ 0x079d, "Alfadata Computer Corp." },
-	{ 0x07a1, "Digicom S.p.A." },
-	{ 0x07a2, "National Technical Systems" },
-	{ 0x07a3, "Onnto Corp." },
-	{ 0x07a4, "Be, Inc." },
-	{ 0x07a6, "ADMtek, Inc." },
-	{ 0x07aa, "Corega K.K." },
-	{ 0x07ab, "Freecom Technologies" },
-	{ 0x07af, "Microtech" },
-	{ 0x07b0, "Trust Technologies" },
-	{ 0x07b1, "IMP, Inc." },
-	{ 0x07b2, "Motorola BCS, Inc." },
-	{ 0x07b3, "Plustek, Inc." },
-	{ 0x07b4, "Olympus Optical Co., Ltd" },
-	{ 0x07b5, "Mega World International, Ltd" },
-	{ 0x07b6, "Marubun Corp." },
-	{ 0x07b7, "TIME Interconnect, Ltd" },
-	{ 0x07b8, "AboCom Systems Inc" },
-	{ 0x07bc, "Canon Computer Systems, Inc." },
-	{ 0x07bd, "Webgear, Inc." },
-	{ 0x07be, "Veridicom" },
-	{ 0x07c0, "Code Mercenaries Hard- und Software GmbH" },
-	{ 0x07c1, "Keisokugiken" },
-	{ 0x07c4, "Datafab Systems, Inc." },
-	{ 0x07c5, "APG Cash Drawer" },
-	{ 0x07c6, "ShareWave, Inc." },
-	{ 0x07c7, "Powertech Industrial Co., Ltd" },
-	{ 0x07c8, "B.U.G., Inc." },
-	{ 0x07c9, "Allied Telesyn International" },
-	{ 0x07ca, "AVerMedia Technologies, Inc." },
-	{ 0x07cb, "Kingmax Technology, Inc." },
-	{ 0x07cc, "Carry Computer Eng., Co., Ltd" },
-	{ 0x07cd, "Elektor" },
-	{ 0x07cf, "Casio Computer Co., Ltd" },
-	{ 0x07d0, "Dazzle" },
-	{ 0x07d1, "D-Link System" },
-	{ 0x07d2, "Aptio Products, Inc." },
-	{ 0x07d3, "Cyberdata Corp." },
-	{ 0x07d5, "Radiant Systems" },
-	{ 0x07d7, "GCC Technologies, Inc." },
-	{ 0x07da, "Arasan Chip Systems" },
-	{ 0x07de, "Diamond Multimedia" },
-	{ 0x07df, "David Electronics Co., Ltd" },
-	{ 0x07e0, "NCP engineering GmbH" },
-	{ 0x07e1, "Ambient Technologies, Inc." },
-	{ 0x07e2, "Elmeg GmbH & Co., Ltd" },
-	{ 0x07e3, "Planex Communications, Inc." },
-	{ 0x07e4, "Movado Enterprise Co., Ltd" },
-	{ 0x07e5, "QPS, Inc." },
-	{ 0x07e6, "Allied Cable Corp." },
-	{ 0x07e7, "Mirvo Toys, Inc." },
-	{ 0x07e8, "Labsystems" },
-	{ 0x07ea, "Iwatsu Electric Co., Ltd" },
-	{ 0x07eb, "Double-H Technology Co., Ltd" },
-	{ 0x07ec, "Taiyo Electric Wire & Cable Co., Ltd" },
-	{ 0x07ee, "Torex Retail (formerly Logware)" },
-	{ 0x07ef, "STSN" },
-	{ 0x07f2, "Microcomputer Applications, Inc." },
-	{ 0x07f6, "Circuit Assembly Corp." },
-	{ 0x07f7, "Century Corp." },
-	{ 0x07f9, "Dotop Technology, Inc." },
-	{ 0x07fa, "DrayTek Corp." },
-	{ 0x07fc, "Thomann" },
-	{ 0x07fd, "Mark of the Unicorn" },
-	{ 0x07ff, "Unknown" },
-	{ 0x0801, "MagTek" },
-	{ 0x0802, "Mako Technologies, LLC" },
-	{ 0x0803, "Zoom Telephonics, Inc." },
-	{ 0x0809, "Genicom Technology, Inc." },
-	{ 0x080a, "Evermuch Technology Co., Ltd" },
-	{ 0x080b, "Cross Match Technologies" },
-	{ 0x080c, "Datalogic S.p.A." },
-	{ 0x080d, "Teco Image Systems Co., Ltd" },
-	{ 0x0810, "Personal Communication Systems, Inc." },
-	{ 0x0813, "Mattel, Inc." },
-	{ 0x0819, "eLicenser" },
-	{ 0x081a, "MG Logic" },
-	{ 0x081b, "Indigita Corp." },
-	{ 0x081c, "Mipsys" },
-	{ 0x081e, "AlphaSmart, Inc." },
-	{ 0x0822, "Reudo Corp." },
-	{ 0x0825, "GC Protronics" },
-	{ 0x0826, "Data Transit" },
-	{ 0x0827, "BroadLogic, Inc." },
-	{ 0x0828, "Sato Corp." },
-	{ 0x0829, "DirecTV Broadband, Inc. (Telocity)" },
-	{ 0x082d, "Handspring" },
-	{ 0x0830, "Palm, Inc." },
-	{ 0x0832, "Kouwell Electronics Corp." },
-	{ 0x0833, "Sourcenext Corp." },
-	{ 0x0835, "Action Star Enterprise Co., Ltd" },
-	{ 0x0836, "TrekStor" },
-	{ 0x0839, "Samsung Techwin Co., Ltd" },
-	{ 0x083a, "Accton Technology Corp." },
-	{ 0x083f, "Global Village" },
-	{ 0x0840, "Argosy Research, Inc." },
-	{ 0x0841, "Rioport.com, Inc." },
-	{ 0x0844, "Welland Industrial Co., Ltd" },
-	{ 0x0846, "NetGear, Inc." },
-	{ 0x084d, "Minton Optic Industry Co., Inc." },
-	{ 0x084e, "KB Gear" },
-	{ 0x084f, "Empeg" },
-	{ 0x0850, "Fast Point Technologies, Inc." },
-	{ 0x0851, "Macronix International Co., Ltd" },
-	{ 0x0852, "CSEM" },
-	{ 0x0853, "Topre Corporation" },
-	{ 0x0854, "ActiveWire, Inc." },
-	{ 0x0856, "B&B Electronics" },
-	{ 0x0858, "Hitachi Maxell, Ltd" },
-	{ 0x0859, "Minolta Systems Laboratory, Inc." },
-	{ 0x085a, "Xircom" },
-	{ 0x085c, "ColorVision, Inc." },
-	{ 0x0862, "Teletrol Systems, Inc." },
-	{ 0x0863, "Filanet Corp." },
-	{ 0x0864, "NetGear, Inc." },
-	{ 0x0867, "Data Translation, Inc." },
-	{ 0x086a, "Emagic Soft- und Hardware GmbH" },
-	{ 0x086c, "DeTeWe - Deutsche Telephonwerke AG & Co." },
-	{ 0x086e, "System TALKS, Inc." },
-	{ 0x086f, "MEC IMEX, Inc." },
-	{ 0x0870, "Metricom" },
-	{ 0x0871, "SanDisk, Inc." },
-	{ 0x0873, "Xpeed, Inc." },
-	{ 0x0874, "A-Tec Subsystem, Inc." },
-	{ 0x0879, "Comtrol Corp." },
-	{ 0x087c, "Adesso/Kbtek America, Inc." },
-	{ 0x087d, "Jaton Corp." },
-	{ 0x087e, "Fujitsu Computer Products of America" },
-	{ 0x087f, "QualCore Logic Inc." },
-	{ 0x0880, "APT Technologies, Inc." },
-	{ 0x0883, "Recording Industry Association of America (RIAA)" },
-	{ 0x0885, "Boca Research, Inc." },
-	{ 0x0886, "XAC Automation Corp." },
-	{ 0x0887, "Hannstar Electronics Corp." },
-	{ 0x088a, "TechTools" },
-	{ 0x088b, "MassWorks, Inc." },
-	{ 0x088c, "Swecoin AB" },
-	{ 0x088e, "iLok" },
-	{ 0x0892, "DioGraphy, Inc." },
-	{ 0x0894, "TSI Incorporated" },
-	{ 0x0897, "Lauterbach" },
-	{ 0x089c, "United Technologies Research Cntr." },
-	{ 0x089d, "Icron Technologies Corp." },
-	{ 0x089e, "NST Co., Ltd" },
-	{ 0x089f, "Primex Aerospace Co." },
-	{ 0x08a5, "e9, Inc." },
-	{ 0x08a6, "Toshiba TEC" },
-	{ 0x08a8, "Andrea Electronics" },
-	{ 0x08a9, "CWAV Inc." },
-	{ 0x08ac, "Macraigor Systems LLC" },
-	{ 0x08ae, "Macally (Mace Group, Inc.)" },
-	{ 0x08b0, "Metrohm" },
-	{ 0x08b4, "Sorenson Vision, Inc." },
-	{ 0x08b7, "NATSU" },
-	{ 0x08b8, "J. Gordon Electronic Design, Inc." },
-	{ 0x08b9, "RadioShack Corp. (Tandy)" },
-	{ 0x08bb, "Texas Instruments" },
-	{ 0x08bd, "Citizen Watch Co., Ltd" },
-	{ 0x08c3, "Precise Biometrics" },
-	{ 0x08c4, "Proxim, Inc." },
-	{ 0x08c7, "Key Nice Enterprise Co., Ltd" },
-	{ 0x08c8, "2Wire, Inc." },
-	{ 0x08c9, "Nippon Telegraph and Telephone Corp." },
-	{ 0x08ca, "Aiptek International, Inc." },
-	{ 0x08cd, "Jue Hsun Ind. Corp." },
-	{ 0x08ce, "Long Well Electronics Corp." },
-	{ 0x08cf, "Productivity Enhancement Products" },
-	{ 0x08d1, "smartBridges, Inc." },
-	{ 0x08d3, "Virtual Ink" },
-	{ 0x08d4, "Fujitsu Siemens Computers" },
-	{ 0x08d8, "IXXAT Automation GmbH" },
-	{ 0x08d9, "Increment P Corp." },
-	{ 0x08dd, "Billionton Systems, Inc." },
-	{ 0x08de, "?" },
-	{ 0x08df, "Spyrus, Inc." },
-	{ 0x08e3, "Olitec, Inc." },
-	{ 0x08e4, "Pioneer Corp." },
-	{ 0x08e5, "Litronic" },
-	{ 0x08e6, "Gemalto (was Gemplus)" },
-	{ 0x08e7, "Pan-International Wire & Cable" },
-	{ 0x08e8, "Integrated Memory Logic" },
-	{ 0x08e9, "Extended Systems, Inc." },
-	{ 0x08ea, "Ericsson, Inc., Blue Ridge Labs" },
-	{ 0x08ec, "M-Systems Flash Disk Pioneers" },
-	{ 0x08ed, "MediaTek Inc." },
-	{ 0x08ee, "CCSI/Hesso" },
-	{ 0x08f0, "Corex Technologies" },
-	{ 0x08f1, "CTI Electronics Corp." },
-	{ 0x08f2, "Gotop Information Inc." },
-	{ 0x08f5, "SysTec Co., Ltd" },
-	{ 0x08f6, "Logic 3 International, Ltd" },
-	{ 0x08f7, "Vernier" },
-	{ 0x08f8, "Keen Top International Enterprise Co., Ltd" },
-	{ 0x08f9, "Wipro Technologies" },
-	{ 0x08fa, "Caere" },
-	{ 0x08fb, "Socket Communications" },
-	{ 0x08fc, "Sicon Cable Technology Co., Ltd" },
-	{ 0x08fd, "Digianswer A/S" },
-	{ 0x08ff, "AuthenTec, Inc." },
-	{ 0x0900, "Pinnacle Systems, Inc." },
-	{ 0x0901, "VST Technologies" },
-	{ 0x0906, "Faraday Technology Corp." },
-	{ 0x0908, "Siemens AG" },
-	{ 0x0909, "Audio-Technica Corp." },
-	{ 0x090a, "Trumpion Microelectronics, Inc." },
-	{ 0x090b, "Neurosmith" },
-	{ 0x090c, "Silicon Motion, Inc. - Taiwan (formerly Feiya Technology Corp.)" },
-	{ 0x090d, "Multiport Computer Vertriebs GmbH" },
-	{ 0x090e, "Shining Technology, Inc." },
-	{ 0x090f, "Fujitsu Devices, Inc." },
-	{ 0x0910, "Alation Systems, Inc." },
-	{ 0x0911, "Philips Speech Processing" },
-	{ 0x0912, "Voquette, Inc." },
-	{ 0x0915, "GlobeSpan, Inc." },
-	{ 0x0917, "SmartDisk Corp." },
-	{ 0x0919, "Tiger Electronics" },
-	{ 0x091e, "Garmin International" },
-	{ 0x0920, "Echelon Co." },
-	{ 0x0921, "GoHubs, Inc." },
-	{ 0x0922, "Dymo-CoStar Corp." },
-	{ 0x0923, "IC Media Corp." },
-	{ 0x0924, "Xerox" },
-	{ 0x0925, "Lakeview Research" },
-	{ 0x0927, "Summus, Ltd" },
-	{ 0x0928, "PLX Technology, Inc. (formerly Oxford Semiconductor, Ltd)" },
-	{ 0x0929, "American Biometric Co." },
-	{ 0x092a, "Toshiba Information & Industrial Sys. And Services" },
-	{ 0x092b, "Sena Technologies, Inc." },
-	{ 0x092f, "Northern Embedded Science/CAVNEX" },
-	{ 0x0930, "Toshiba Corp." },
-	{ 0x0931, "Harmonic Data Systems, Ltd" },
-	{ 0x0932, "Crescentec Corp." },
-	{ 0x0933, "Quantum Corp." },
-	{ 0x0934, "Spirent Communications" },
-	{ 0x0936, "NuTesla" },
-	{ 0x0939, "Lumberg, Inc." },
-	{ 0x093a, "Pixart Imaging, Inc." },
-	{ 0x093b, "Plextor Corp." },
-	{ 0x093c, "Intrepid Control Systems, Inc." },
-	{ 0x093d, "InnoSync, Inc." },
-	{ 0x093e, "J.S.T. Mfg. Co., Ltd" },
-	{ 0x093f, "Olympia Telecom Vertriebs GmbH" },
-	{ 0x0940, "Japan Storage Battery Co., Ltd" },
-	{ 0x0941, "Photobit Corp." },
-	{ 0x0942, "i2Go.com, LLC" },
-	{ 0x0943, "HCL Technologies India Private, Ltd" },
-	{ 0x0944, "KORG, Inc." },
-	{ 0x0945, "Pasco Scientific" },
-	{ 0x0948, "Kronauer music in digital" },
-	{ 0x094b, "Linkup Systems Corp." },
-	{ 0x094d, "Cable Television Laboratories" },
-	{ 0x094f, "Yano" },
-	{ 0x0951, "Kingston Technology" },
-	{ 0x0954, "RPM Systems Corp." },
-	{ 0x0955, "NVIDIA Corp." },
-	{ 0x0956, "BSquare Corp." },
-	{ 0x0957, "Agilent Technologies, Inc." },
-	{ 0x0958, "CompuLink Research, Inc." },
-	{ 0x0959, "Cologne Chip AG" },
-	{ 0x095a, "Portsmith" },
-	{ 0x095b, "Medialogic Corp." },
-	{ 0x095c, "K-Tec Electronics" },
-	{ 0x095d, "Polycom, Inc." },
-	{ 0x0964, "BITRAN" },
-	{ 0x0967, "Acer NeWeb Corp." },
-	{ 0x0968, "Catalyst Enterprises, Inc." },
-	{ 0x096e, "Feitian Technologies, Inc." },
-	{ 0x0971, "Gretag-Macbeth AG" },
-	{ 0x0973, "Schlumberger" },
-	{ 0x0974, "Datagraphix, a business unit of Anacomp" },
-	{ 0x0975, "OL'E Communications, Inc." },
-	{ 0x0976, "Adirondack Wire & Cable" },
-	{ 0x0977, "Lightsurf Technologies" },
-	{ 0x0978, "Beckhoff GmbH" },
-	{ 0x0979, "Jeilin Technology Corp., Ltd" },
-	{ 0x097a, "Minds At Work LLC" },
-	{ 0x097b, "Knudsen Engineering, Ltd" },
-	{ 0x097c, "Marunix Co., Ltd" },
-	{ 0x097d, "Rosun Technologies, Inc." },
-	{ 0x097e, "Biopac Systems Inc." },
-	{ 0x097f, "Barun Electronics Co., Ltd" },
-	{ 0x0981, "Oak Technology, Ltd" },
-	{ 0x0984, "Apricorn" },
-	{ 0x0985, "cab Produkttechnik GmbH & Co KG" },
-	{ 0x0986, "Matsushita Electric Works, Ltd." },
-	{ 0x098c, "Vitana Corp." },
-	{ 0x098d, "INDesign" },
-	{ 0x098e, "Integrated Intellectual Property, Inc." },
-	{ 0x098f, "Kenwood TMI Corp." },
-	{ 0x0993, "Gemstar eBook Group, Ltd" },
-	{ 0x0996, "Integrated Telecom Express, Inc." },
-	{ 0x099a, "Zippy Technology Corp." },
-	{ 0x099e, "Trimble Navigation, Ltd" },
-	{ 0x09a3, "PairGain Technologies" },
-	{ 0x09a4, "Contech Research, Inc." },
-	{ 0x09a5, "VCON Telecommunications" },
-	{ 0x09a6, "Poinchips" },
-	{ 0x09a7, "Data Transmission Network Corp." },
-	{ 0x09a8, "Lin Shiung Enterprise Co., Ltd" },
-	{ 0x09a9, "Smart Card Technologies Co., Ltd" },
-	{ 0x09aa, "Intersil Corp." },
-	{ 0x09ab, "Japan Cash Machine Co., Ltd." },
-	{ 0x09ae, "Tripp Lite" },
-	{ 0x09b2, "Franklin Electronic Publishers, Inc." },
-	{ 0x09b3, "Altius Solutions, Inc." },
-	{ 0x09b4, "MDS Telephone Systems" },
-	{ 0x09b5, "Celltrix Technology Co., Ltd" },
-	{ 0x09bc, "Grundig" },
-	{ 0x09be, "MySmart.Com" },
-	{ 0x09bf, "Auerswald GmbH & Co. KG" },
-	{ 0x09c0, "Genpix Electronics, LLC" },
-	{ 0x09c1, "Arris Interactive LLC" },
-	{ 0x09c2, "Nisca Corp." },
-	{ 0x09c3, "ActivCard, Inc." },
-	{ 0x09c4, "ACTiSYS Corp." },
-	{ 0x09c5, "Memory Corp." },
-	{ 0x09ca, "BMC Messsysteme GmbH" },
-	{ 0x09cb, "FLIR Systems" },
-	{ 0x09cc, "Workbit Corp." },
-	{ 0x09cd, "Psion Dacom Home Networks, Ltd" },
-	{ 0x09ce, "City Electronics, Ltd" },
-	{ 0x09cf, "Electronics Testing Center, Taiwan" },
-	{ 0x09d1, "NeoMagic, Inc." },
-	{ 0x09d2, "Vreelin Engineering, Inc." },
-	{ 0x09d3, "Com One" },
-	{ 0x09d7, "NovAtel Inc." },
-	{ 0x09d8, "ELATEC" },
-	{ 0x09d9, "KRF Tech, Ltd" },
-	{ 0x09da, "A4Tech Co., Ltd." },
-	{ 0x09db, "Measurement Computing Corp." },
-	{ 0x09dc, "Aimex Corp." },
-	{ 0x09dd, "Fellowes, Inc." },
-	{ 0x09df, "Addonics Technologies Corp." },
-	{ 0x09e1, "Intellon Corp." },
-	{ 0x09e5, "Jo-Dan International, Inc." },
-	{ 0x09e6, "Silutia, Inc." },
-	{ 0x09e7, "Real 3D, Inc." },
-	{ 0x09e8, "AKAI  Professional M.I. Corp." },
-	{ 0x09e9, "Chen-Source, Inc." },
-	{ 0x09eb, "IM Networks, Inc." },
-	{ 0x09ef, "Xitel" },
-	{ 0x09f3, "GoFlight, Inc." },
-	{ 0x09f5, "AresCom" },
-	{ 0x09f6, "RocketChips, Inc." },
-	{ 0x09f7, "Edu-Science (H.K.), Ltd" },
-	{ 0x09f8, "SoftConnex Technologies, Inc." },
-	{ 0x09f9, "Bay Associates" },
-	{ 0x09fa, "Mtek Vision" },
-	{ 0x09fb, "Altera" },
-	{ 0x09ff, "Gain Technology Corp." },
-	{ 0x0a00, "Liquid Audio" },
-	{ 0x0a01, "ViA, Inc." },
-	{ 0x0a05, "Unknown Manufacturer" },
-	{ 0x0a07, "Ontrak Control Systems Inc." },
-	{ 0x0a0b, "Cybex Computer Products Co." },
-	{ 0x0a0d, "Servergy, Inc" },
-	{ 0x0a11, "Xentec, Inc." },
-	{ 0x0a12, "Cambridge Silicon Radio, Ltd" },
-	{ 0x0a13, "Telebyte, Inc." },
-	{ 0x0a14, "Spacelabs Medical, Inc." },
-	{ 0x0a15, "Scalar Corp." },
-	{ 0x0a16, "Trek Technology (S) PTE, Ltd" },
-	{ 0x0a17, "Pentax Corp." },
-	{ 0x0a18, "Heidelberger Druckmaschinen AG" },
-	{ 0x0a19, "Hua Geng Technologies, Inc." },
-	{ 0x0a21, "Medtronic Physio Control Corp." },
-	{ 0x0a22, "Century Semiconductor USA, Inc." },
-	{ 0x0a27, "Datacard Group" },
-	{ 0x0a2c, "AK-Modul-Bus Computer GmbH" },
-	{ 0x0a34, "TG3 Electronics, Inc." },
-	{ 0x0a35, "Radikal Technologies" },
-	{ 0x0a39, "Gilat Satellite Networks, Ltd" },
-	{ 0x0a3a, "PentaMedia Co., Ltd" },
-	{ 0x0a3c, "NTT DoCoMo, Inc." },
-	{ 0x0a3d, "Varo Vision" },
-	{ 0x0a3f, "Swissonic AG" },
-	{ 0x0a43, "Boca Systems, Inc." },
-	{ 0x0a46, "Davicom Semiconductor, Inc." },
-	{ 0x0a47, "Hirose Electric" },
-	{ 0x0a48, "I/O Interconnect" },
-	{ 0x0a4a, "Ploytec GmbH" },
-	{ 0x0a4b, "Fujitsu Media Devices, Ltd" },
-	{ 0x0a4c, "Computex Co., Ltd" },
-	{ 0x0a4d, "Evolution Electronics, Ltd" },
-	{ 0x0a4e, "Steinberg Soft-und Hardware GmbH" },
-	{ 0x0a4f, "Litton Systems, Inc." },
-	{ 0x0a50, "Mimaki Engineering Co., Ltd" },
-	{ 0x0a51, "Sony Electronics, Inc." },
-	{ 0x0a52, "Jebsee Electronics Co., Ltd" },
-	{ 0x0a53, "Portable Peripheral Co., Ltd" },
-	{ 0x0a5a, "Electronics For Imaging, Inc." },
-	{ 0x0a5b, "EAsics NV" },
-	{ 0x0a5c, "Broadcom Corp." },
-	{ 0x0a5d, "Diatrend Corp." },
-	{ 0x0a5f, "Zebra" },
-	{ 0x0a62, "MPMan" },
-	{ 0x0a66, "ClearCube Technology" },
-	{ 0x0a67, "Medeli Electronics Co., Ltd" },
-	{ 0x0a68, "Comaide Corp." },
-	{ 0x0a69, "Chroma ate, Inc." },
-	{ 0x0a6b, "Green House Co., Ltd" },
-	{ 0x0a6c, "Integrated Circuit Systems, Inc." },
-	{ 0x0a6d, "UPS Manufacturing" },
-	{ 0x0a6e, "Benwin" },
-	{ 0x0a6f, "Core Technology, Inc." },
-	{ 0x0a70, "International Game Technology" },
-	{ 0x0a71, "VIPColor Technologies USA, Inc." },
-	{ 0x0a72, "Sanwa Denshi" },
-	{ 0x0a73, "Mackie Designs" },
-	{ 0x0a7d, "NSTL, Inc." },
-	{ 0x0a7e, "Octagon Systems Corp." },
-	{ 0x0a80, "Rexon Technology Corp., Ltd" },
-	{ 0x0a81, "Chesen Electronics Corp." },
-	{ 0x0a82, "Syscan" },
-	{ 0x0a83, "NextComm, Inc." },
-	{ 0x0a84, "Maui Innovative Peripherals" },
-	{ 0x0a85, "Idexx Labs" },
-	{ 0x0a86, "NITGen Co., Ltd" },
-	{ 0x0a89, "Aktiv" },
-	{ 0x0a8d, "Picturetel" },
-	{ 0x0a8e, "Japan Aviation Electronics Industry, Ltd" },
-	{ 0x0a90, "Candy Technology Co., Ltd" },
-	{ 0x0a91, "Globlink Technology, Inc." },
-	{ 0x0a92, "EGO SYStems, Inc." },
-	{ 0x0a93, "C Technologies AB" },
-	{ 0x0a94, "Intersense" },
-	{ 0x0aa3, "Lava Computer Mfg., Inc." },
-	{ 0x0aa4, "Develco Elektronik" },
-	{ 0x0aa5, "First International Digital" },
-	{ 0x0aa6, "Perception Digital, Ltd" },
-	{ 0x0aa7, "Wincor Nixdorf International GmbH" },
-	{ 0x0aa8, "TriGem Computer, Inc." },
-	{ 0x0aa9, "Baromtec Co." },
-	{ 0x0aaa, "Japan CBM Corp." },
-	{ 0x0aab, "Vision Shape Europe SA" },
-	{ 0x0aac, "iCompression, Inc." },
-	{ 0x0aad, "Rohde & Schwarz GmbH & Co. KG" },
-	{ 0x0aae, "NEC infrontia Corp. (Nitsuko)" },
-	{ 0x0aaf, "Digitalway Co., Ltd" },
-	{ 0x0ab0, "Arrow Strong Electronics Co., Ltd" },
-	{ 0x0ab1, "FEIG ELECTRONIC GmbH" },
-	{ 0x0aba, "Ellisys" },
-	{ 0x0abe, "Stereo-Link" },
-	{ 0x0abf, "Diolan" },
-	{ 0x0ac3, "Sanyo Semiconductor Company Micro" },
-	{ 0x0ac4, "Leco Corp." },
-	{ 0x0ac5, "I & C Corp." },
-	{ 0x0ac6, "Singing Electrons, Inc." },
-	{ 0x0ac7, "Panwest Corp." },
-	{ 0x0ac8, "Z-Star Microelectronics Corp." },
-	{ 0x0ac9, "Micro Solutions, Inc." },
-	{ 0x0aca, "OPEN Networks Ltd" },
-	{ 0x0acc, "Koga Electronics Co." },
-	{ 0x0acd, "ID Tech" },
-	{ 0x0ace, "ZyDAS" },
-	{ 0x0acf, "Intoto, Inc." },
-	{ 0x0ad0, "Intellix Corp." },
-	{ 0x0ad1, "Remotec Technology, Ltd" },
-	{ 0x0ad2, "Service & Quality Technology Co., Ltd" },
-	{ 0x0ada, "Data Encryption Systems Ltd." },
-	{ 0x0ae3, "Allion Computer, Inc." },
-	{ 0x0ae4, "Taito Corp." },
-	{ 0x0ae7, "Neodym Systems, Inc." },
-	{ 0x0ae8, "System Support Co., Ltd" },
-	{ 0x0ae9, "North Shore Circuit Design L.L.P." },
-	{ 0x0aea, "SciEssence, LLC" },
-	{ 0x0aeb, "TTP Communications, Ltd" },
-	{ 0x0aec, "Neodio Technologies Corp." },
-	{ 0x0af0, "Option" },
-	{ 0x0af6, "Silver I Co., Ltd" },
-	{ 0x0af7, "B2C2, Inc." },
-	{ 0x0af9, "Hama, Inc." },
-	{ 0x0afa, "DMC Co., Ltd." },
-	{ 0x0afc, "Zaptronix Ltd" },
-	{ 0x0afd, "Tateno Dennou, Inc." },
-	{ 0x0afe, "Cummins Engine Co." },
-	{ 0x0aff, "Jump Zone Network Products, Inc." },
-	{ 0x0b00, "INGENICO" },
-	{ 0x0b05, "ASUSTek Computer, Inc." },
-	{ 0x0b0b, "Datamax-O'Neil" },
-	{ 0x0b0c, "Todos AB" },
-	{ 0x0b0d, "ProjectLab" },
-	{ 0x0b0e, "GN Netcom" },
-	{ 0x0b0f, "AVID Technology" },
-	{ 0x0b10, "Pcally" },
-	{ 0x0b11, "I Tech Solutions Co., Ltd" },
-	{ 0x0b1e, "Electronic Warfare Assoc., Inc. (EWA)" },
-	{ 0x0b1f, "Insyde Software Corp." },
-	{ 0x0b20, "TransDimension, Inc." },
-	{ 0x0b21, "Yokogawa Electric Corp." },
-	{ 0x0b22, "Japan System Development Co., Ltd" },
-	{ 0x0b23, "Pan-Asia Electronics Co., Ltd" },
-	{ 0x0b24, "Link Evolution Corp." },
-	{ 0x0b27, "Ritek Corp." },
-	{ 0x0b28, "Kenwood Corp." },
-	{ 0x0b2c, "Village Center, Inc." },
-	{ 0x0b30, "PNY Technologies, Inc." },
-	{ 0x0b33, "Contour Design, Inc." },
-	{ 0x0b37, "Hitachi ULSI Systems Co., Ltd" },
-	{ 0x0b38, "Gear Head" },
-	{ 0x0b39, "Omnidirectional Control Technology, Inc." },
-	{ 0x0b3a, "IPaxess" },
-	{ 0x0b3b, "Tekram Technology Co., Ltd" },
-	{ 0x0b3c, "Olivetti Techcenter" },
-	{ 0x0b3e, "Kikusui Electronics Corp." },
-	{ 0x0b41, "Hal Corp." },
-	{ 0x0b43, "Play.com, Inc." },
-	{ 0x0b47, "Sportbug.com, Inc." },
-	{ 0x0b48, "TechnoTrend AG" },
-	{ 0x0b49, "ASCII Corp." },
-	{ 0x0b4b, "Pine Corp. Ltd." },
-	{ 0x0b4d, "Graphtec America, Inc." },
-	{ 0x0b4e, "Musical Electronics, Ltd" },
-	{ 0x0b50, "Dumpries Co., Ltd" },
-	{ 0x0b51, "Comfort Keyboard Co." },
-	{ 0x0b52, "Colorado MicroDisplay, Inc." },
-	{ 0x0b54, "Sinbon Electronics Co., Ltd" },
-	{ 0x0b56, "TYI Systems, Ltd" },
-	{ 0x0b57, "Beijing HanwangTechnology Co., Ltd" },
-	{ 0x0b59, "Lake Communications, Ltd" },
-	{ 0x0b5a, "Corel Corp." },
-	{ 0x0b5f, "Green Electronics Co., Ltd" },
-	{ 0x0b60, "Nsine, Ltd" },
-	{ 0x0b61, "NEC Viewtechnology, Ltd" },
-	{ 0x0b62, "Orange Micro, Inc." },
-	{ 0x0b63, "ADLink Technology, Inc." },
-	{ 0x0b64, "Wonderful Wire Cable Co., Ltd" },
-	{ 0x0b65, "Expert Magnetics Corp." },
-	{ 0x0b66, "Cybiko Inc." },
-	{ 0x0b67, "Fairbanks Scales" },
-	{ 0x0b69, "CacheVision" },
-	{ 0x0b6a, "Maxim Integrated Products" },
-	{ 0x0b6f, "Nagano Japan Radio Co., Ltd" },
-	{ 0x0b70, "PortalPlayer, Inc." },
-	{ 0x0b71, "SHIN-EI Sangyo Co., Ltd" },
-	{ 0x0b72, "Embedded Wireless Technology Co., Ltd" },
-	{ 0x0b73, "Computone Corp." },
-	{ 0x0b75, "Roland DG Corp." },
-	{ 0x0b79, "Sunrise Telecom, Inc." },
-	{ 0x0b7a, "Zeevo, Inc." },
-	{ 0x0b7b, "Taiko Denki Co., Ltd" },
-	{ 0x0b7c, "ITRAN Communications, Ltd" },
-	{ 0x0b7d, "Astrodesign, Inc." },
-	{ 0x0b81, "id3 Technologies" },
-	{ 0x0b84, "Rextron Technology, Inc." },
-	{ 0x0b85, "Elkat Electronics, Sdn., Bhd." },
-	{ 0x0b86, "Exputer Systems, Inc." },
-	{ 0x0b87, "Plus-One I & T, Inc." },
-	{ 0x0b88, "Sigma Koki Co., Ltd, Technology Center" },
-	{ 0x0b89, "Advanced Digital Broadcast, Ltd" },
-	{ 0x0b8c, "SMART Technologies Inc." },
-	{ 0x0b95, "ASIX Electronics Corp." },
-	{ 0x0b96, "Sewon Telecom" },
-	{ 0x0b97, "O2 Micro, Inc." },
-	{ 0x0b98, "Playmates Toys, Inc." },
-	{ 0x0b99, "Audio International, Inc." },
-	{ 0x0b9b, "Dipl.-Ing. Stefan Kunde" },
-	{ 0x0b9d, "Softprotec Co." },
-	{ 0x0b9f, "Chippo Technologies" },
-	{ 0x0baf, "U.S. Robotics" },
-	{ 0x0bb0, "Concord Camera Corp." },
-	{ 0x0bb1, "Infinilink Corp." },
-	{ 0x0bb2, "Ambit Microsystems Corp." },
-	{ 0x0bb3, "Ofuji Technology" },
-	{ 0x0bb4, "HTC (High Tech Computer Corp.)" },
-	{ 0x0bb5, "Murata Manufacturing Co., Ltd" },
-	{ 0x0bb6, "Network Alchemy" },
-	{ 0x0bb7, "Joytech Computer Co., Ltd" },
-	{ 0x0bb8, "Hitachi Semiconductor and Devices Sales Co., Ltd" },
-	{ 0x0bb9, "Eiger M&C Co., Ltd" },
-	{ 0x0bba, "ZAccess Systems" },
-	{ 0x0bbb, "General Meters Corp." },
-	{ 0x0bbc, "Assistive Technology, Inc." },
-	{ 0x0bbd, "System Connection, Inc." },
-	{ 0x0bc0, "Knilink Technology, Inc." },
-	{ 0x0bc1, "Fuw Yng Electronics Co., Ltd" },
-	{ 0x0bc2, "Seagate RSS LLC" },
-	{ 0x0bc3, "IPWireless, Inc." },
-	{ 0x0bc4, "Microcube Corp." },
-	{ 0x0bc5, "JCN Co., Ltd" },
-	{ 0x0bc6, "ExWAY, Inc." },
-	{ 0x0bc7, "X10 Wireless Technology, Inc." },
-	{ 0x0bc8, "Telmax Communications" },
-	{ 0x0bc9, "ECI Telecom, Ltd" },
-	{ 0x0bca, "Startek Engineering, Inc." },
-	{ 0x0bcb, "Perfect Technic Enterprise Co., Ltd" },
-	{ 0x0bd7, "Andrew Pargeter & Associates" },
-	{ 0x0bda, "Realtek Semiconductor Corp." },
-	{ 0x0bdb, "Ericsson Business Mobile Networks BV" },
-	{ 0x0bdc, "Y Media Corp." },
-	{ 0x0bdd, "Orange PCS" },
-	{ 0x0be2, "Kanda Tsushin Kogyo Co., Ltd" },
-	{ 0x0be3, "TOYO Corp." },
-	{ 0x0be4, "Elka International, Ltd" },
-	{ 0x0be5, "DOME imaging systems, Inc." },
-	{ 0x0be6, "Dong Guan Humen Wonderful Wire Cable Factory" },
-	{ 0x0bed, "MEI" },
-	{ 0x0bee, "LTK Industries, Ltd" },
-	{ 0x0bef, "Way2Call Communications" },
-	{ 0x0bf0, "Pace Micro Technology PLC" },
-	{ 0x0bf1, "Intracom S.A." },
-	{ 0x0bf2, "Konexx" },
-	{ 0x0bf6, "Addonics Technologies, Inc." },
-	{ 0x0bf7, "Sunny Giken, Inc." },
-	{ 0x0bf8, "Fujitsu Siemens Computers" },
-	{ 0x0bfd, "Kvaser AB" },
-	{ 0x0c00, "FireFly Mouse Mat" },
-	{ 0x0c04, "MOTO Development Group, Inc." },
-	{ 0x0c05, "Appian Graphics" },
-	{ 0x0c06, "Hasbro Games, Inc." },
-	{ 0x0c07, "Infinite Data Storage, Ltd" },
-	{ 0x0c08, "Agate" },
-	{ 0x0c09, "Comjet Information System" },
-	{ 0x0c0a, "Highpoint Technologies, Inc." },
-	{ 0x0c0b, "Dura Micro, Inc. (Acomdata)" },
-	{ 0x0c12, "Zeroplus" },
-	{ 0x0c15, "Iris Graphics" },
-	{ 0x0c16, "Gyration, Inc." },
-	{ 0x0c17, "Cyberboard A/S" },
-	{ 0x0c18, "SynerTek Korea, Inc." },
-	{ 0x0c19, "cyberPIXIE, Inc." },
-	{ 0x0c1a, "Silicon Motion, Inc." },
-	{ 0x0c1b, "MIPS Technologies" },
-	{ 0x0c1c, "Hang Zhou Silan Electronics Co., Ltd" },
-	{ 0x0c22, "Tally Printer Corp." },
-	{ 0x0c23, "Lernout + Hauspie" },
-	{ 0x0c24, "Taiyo Yuden" },
-	{ 0x0c25, "Sampo Corp." },
-	{ 0x0c26, "Prolific Technology Inc." },
-	{ 0x0c27, "RFIDeas, Inc" },
-	{ 0x0c2e, "Metrologic Instruments" },
-	{ 0x0c30, "Mutoh Industries Ltd" },
-	{ 0x0c35, "Eagletron, Inc." },
-	{ 0x0c36, "E Ink Corp." },
-	{ 0x0c37, "e.Digital" },
-	{ 0x0c38, "Der An Electric Wire & Cable Co., Ltd" },
-	{ 0x0c39, "IFR" },
-	{ 0x0c3a, "Furui Precise Component (Kunshan) Co., Ltd" },
-	{ 0x0c3b, "Komatsu, Ltd" },
-	{ 0x0c3c, "Radius Co., Ltd" },
-	{ 0x0c3d, "Innocom, Inc." },
-	{ 0x0c3e, "Nextcell, Inc." },
-	{ 0x0c44, "Motorola iDEN" },
-	{ 0x0c45, "Microdia" },
-	{ 0x0c46, "WaveRider Communications, Inc." },
-	{ 0x0c4a, "ALGE-TIMING GmbH" },
-	{ 0x0c4b, "Reiner SCT Kartensysteme GmbH" },
-	{ 0x0c4c, "Needham's Electronics" },
-	{ 0x0c52, "Sealevel Systems, Inc." },
-	{ 0x0c53, "ViewPLUS, Inc." },
-	{ 0x0c54, "Glory, Ltd" },
-	{ 0x0c55, "Spectrum Digital, Inc." },
-	{ 0x0c56, "Billion Bright, Ltd" },
-	{ 0x0c57, "Imaginative Design Operation Co., Ltd" },
-	{ 0x0c58, "Vidar Systems Corp." },
-	{ 0x0c59, "Dong Guan Shinko Wire Co., Ltd" },
-	{ 0x0c5a, "TRS International Mfg., Inc." },
-	{ 0x0c5e, "Xytronix Research & Design" },
-	{ 0x0c60, "Apogee Electronics Corp." },
-	{ 0x0c62, "Chant Sincere Co., Ltd" },
-	{ 0x0c63, "Toko, Inc." },
-	{ 0x0c64, "Signality System Engineering Co., Ltd" },
-	{ 0x0c65, "Eminence Enterprise Co., Ltd" },
-	{ 0x0c66, "Rexon Electronics Corp." },
-	{ 0x0c67, "Concept Telecom, Ltd" },
-	{ 0x0c6a, "ACS" },
-	{ 0x0c6c, "JETI Technische Instrumente GmbH" },
-	{ 0x0c70, "MCT Elektronikladen" },
-	{ 0x0c72, "PEAK System" },
-	{ 0x0c74, "Optronic Laboratories Inc." },
-	{ 0x0c76, "JMTek, LLC." },
-	{ 0x0c77, "Sipix Group, Ltd" },
-	{ 0x0c78, "Detto Corp." },
-	{ 0x0c79, "NuConnex Technologies Pte., Ltd" },
-	{ 0x0c7a, "Wing-Span Enterprise Co., Ltd" },
-	{ 0x0c86, "NDA Technologies, Inc." },
-	{ 0x0c88, "Kyocera Wireless Corp." },
-	{ 0x0c89, "Honda Tsushin Kogyo Co., Ltd" },
-	{ 0x0c8a, "Pathway Connectivity, Inc." },
-	{ 0x0c8b, "Wavefly Corp." },
-	{ 0x0c8c, "Coactive Networks" },
-	{ 0x0c8d, "Tempo" },
-	{ 0x0c8e, "Cesscom Co., Ltd" },
-	{ 0x0c8f, "Applied Microsystems" },
-	{ 0x0c94, "Cryptera" },
-	{ 0x0c98, "Berkshire Products, Inc." },
-	{ 0x0c99, "Innochips Co., Ltd" },
-	{ 0x0c9a, "Hanwool Robotics Corp." },
-	{ 0x0c9b, "Jobin Yvon, Inc." },
-	{ 0x0c9d, "SemTek" },
-	{ 0x0ca2, "Zyfer" },
-	{ 0x0ca3, "Sega Corp." },
-	{ 0x0ca4, "ST&T Instrument Corp." },
-	{ 0x0ca5, "BAE Systems Canada, Inc." },
-	{ 0x0ca6, "Castles Technology Co., Ltd" },
-	{ 0x0ca7, "Information Systems Laboratories" },
-	{ 0x0cad, "Motorola CGISS" },
-	{ 0x0cae, "Ascom Business Systems, Ltd" },
-	{ 0x0caf, "Buslink" },
-	{ 0x0cb0, "Flying Pig Systems" },
-	{ 0x0cb1, "Innovonics, Inc." },
-	{ 0x0cb6, "Celestix Networks, Pte., Ltd" },
-	{ 0x0cb7, "Singatron Enterprise Co., Ltd" },
-	{ 0x0cb8, "Opticis Co., Ltd" },
-	{ 0x0cba, "Trust Electronic (Shanghai) Co., Ltd" },
-	{ 0x0cbb, "Shanghai Darong Electronics Co., Ltd" },
-	{ 0x0cbc, "Palmax Technology Co., Ltd" },
-	{ 0x0cbd, "Pentel Co., Ltd (Electronics Equipment Div.)" },
-	{ 0x0cbe, "Keryx Technologies, Inc." },
-	{ 0x0cbf, "Union Genius Computer Co., Ltd" },
-	{ 0x0cc0, "Kuon Yi Industrial Corp." },
-	{ 0x0cc1, "Given Imaging, Ltd" },
-	{ 0x0cc2, "Timex Corp." },
-	{ 0x0cc3, "Rimage Corp." },
-	{ 0x0cc4, "emsys GmbH" },
-	{ 0x0cc5, "Sendo" },
-	{ 0x0cc6, "Intermagic Corp." },
-	{ 0x0cc8, "Technotools Corp." },
-	{ 0x0cc9, "BroadMAX Technologies, Inc." },
-	{ 0x0cca, "Amphenol" },
-	{ 0x0ccb, "SKNet Co., Ltd" },
-	{ 0x0ccc, "Domex Technology Corp." },
-	{ 0x0ccd, "TerraTec Electronic GmbH" },
-	{ 0x0cd4, "Bang Olufsen" },
-	{ 0x0cd5, "LabJack Corporation" },
-	{ 0x0cd6, "Scheidt & Bachmann" },
-	{ 0x0cd7, "NewChip S.r.l." },
-	{ 0x0cd8, "JS Digitech, Inc." },
-	{ 0x0cd9, "Hitachi Shin Din Cable, Ltd" },
-	{ 0x0cde, "Z-Com" },
-	{ 0x0ce5, "Validation Technologies International" },
-	{ 0x0ce9, "Pico Technology" },
-	{ 0x0cf1, "e-Conn Electronic Co., Ltd" },
-	{ 0x0cf2, "ENE Technology, Inc." },
-	{ 0x0cf3, "Qualcomm Atheros Communications" },
-	{ 0x0cf4, "Fomtex Corp." },
-	{ 0x0cf5, "Cellink Co., Ltd" },
-	{ 0x0cf6, "Compucable Corp." },
-	{ 0x0cf7, "ishoni Networks" },
-	{ 0x0cf8, "Clarisys, Inc." },
-	{ 0x0cf9, "Central System Research Co., Ltd" },
-	{ 0x0cfa, "Inviso, Inc." },
-	{ 0x0cfc, "Minolta-QMS, Inc." },
-	{ 0x0cff, "SAFA MEDIA Co., Ltd." },
-	{ 0x0d06, "telos EDV Systementwicklung GmbH" },
-	{ 0x0d08, "UTStarcom" },
-	{ 0x0d0b, "Contemporary Controls" },
-	{ 0x0d0c, "Astron Electronics Co., Ltd" },
-	{ 0x0d0d, "MKNet Corp." },
-	{ 0x0d0e, "Hybrid Networks, Inc." },
-	{ 0x0d0f, "Feng Shin Cable Co., Ltd" },
-	{ 0x0d10, "Elastic Networks" },
-	{ 0x0d11, "Maspro Denkoh Corp." },
-	{ 0x0d12, "Hansol Electronics, Inc." },
-	{ 0x0d13, "BMF Corp." },
-	{ 0x0d14, "Array Comm, Inc." },
-	{ 0x0d15, "OnStream b.v." },
-	{ 0x0d16, "Hi-Touch Imaging Technologies Co., Ltd" },
-	{ 0x0d17, "NALTEC, Inc." },
-	{ 0x0d18, "coaXmedia" },
-	{ 0x0d19, "Hank Connection Industrial Co., Ltd" },
-	{ 0x0d28, "NXP" },
-	{ 0x0d32, "Leo Hui Electric Wire & Cable Co., Ltd" },
-	{ 0x0d33, "AirSpeak, Inc." },
-	{ 0x0d34, "Rearden Steel Technologies" },
-	{ 0x0d35, "Dah Kun Co., Ltd" },
-	{ 0x0d3a, "Posiflex Technologies, Inc." },
-	{ 0x0d3c, "Sri Cable Technology, Ltd" },
-	{ 0x0d3d, "Tangtop Technology Co., Ltd" },
-	{ 0x0d3e, "Fitcom, inc." },
-	{ 0x0d3f, "MTS Systems Corp." },
-	{ 0x0d40, "Ascor, Inc." },
-	{ 0x0d41, "Ta Yun Terminals Industrial Co., Ltd" },
-	{ 0x0d42, "Full Der Co., Ltd" },
-	{ 0x0d46, "Kobil Systems GmbH" },
-	{ 0x0d48, "Promethean Limited" },
-	{ 0x0d49, "Maxtor" },
-	{ 0x0d4a, "NF Corp." },
-	{ 0x0d4b, "Grape Systems, Inc." },
-	{ 0x0d4c, "Tedas AG" },
-	{ 0x0d4d, "Coherent, Inc." },
-	{ 0x0d4e, "Agere Systems Netherland BV" },
-	{ 0x0d4f, "EADS Airbus France" },
-	{ 0x0d50, "Cleware GmbH" },
-	{ 0x0d51, "Volex (Asia) Pte., Ltd" },
-	{ 0x0d53, "HMI Co., Ltd" },
-	{ 0x0d54, "Holon Corp." },
-	{ 0x0d55, "ASKA Technologies, Inc." },
-	{ 0x0d56, "AVLAB Technology, Inc." },
-	{ 0x0d57, "Solomon Microtech, Ltd" },
-	{ 0x0d5c, "SMC Networks, Inc." },
-	{ 0x0d5e, "Myacom, Ltd" },
-	{ 0x0d5f, "CSI, Inc." },
-	{ 0x0d60, "IVL Technologies, Ltd" },
-	{ 0x0d61, "Meilu Electronics (Shenzhen) Co., Ltd" },
-	{ 0x0d62, "Darfon Electronics Corp." },
-	{ 0x0d63, "Fritz Gegauf AG" },
-	{ 0x0d64, "DXG Technology Corp." },
-	{ 0x0d65, "KMJP Co., Ltd" },
-	{ 0x0d66, "TMT" },
-	{ 0x0d67, "Advanet, Inc." },
-	{ 0x0d68, "Super Link Electronics Co., Ltd" },
-	{ 0x0d69, "NSI" },
-	{ 0x0d6a, "Megapower International Corp." },
-	{ 0x0d6b, "And-Or Logic" },
-	{ 0x0d70, "Try Computer Co., Ltd" },
-	{ 0x0d71, "Hirakawa Hewtech Corp." },
-	{ 0x0d72, "Winmate Communication, Inc." },
-	{ 0x0d73, "Hit's Communications, Inc." },
-	{ 0x0d76, "MFP Korea, Inc." },
-	{ 0x0d77, "Power Sentry/Newpoint" },
-	{ 0x0d78, "Japan Distributor Corp." },
-	{ 0x0d7a, "MARX Datentechnik GmbH" },
-	{ 0x0d7b, "Wellco Technology Co., Ltd" },
-	{ 0x0d7c, "Taiwan Line Tek Electronic Co., Ltd" },
-	{ 0x0d7d, "Phison Electronics Corp." },
-	{ 0x0d7e, "American Computer & Digital Components" },
-	{ 0x0d7f, "Essential Reality LLC" },
-	{ 0x0d80, "H.R. Silvine Electronics, Inc." },
-	{ 0x0d81, "TechnoVision" },
-	{ 0x0d83, "Think Outside, Inc." },
-	{ 0x0d87, "Dolby Laboratories Inc." },
-	{ 0x0d89, "Oz Software" },
-	{ 0x0d8a, "King Jim Co., Ltd" },
-	{ 0x0d8b, "Ascom Telecommunications, Ltd" },
-	{ 0x0d8c, "C-Media Electronics, Inc." },
-	{ 0x0d8d, "Promotion & Display Technology, Ltd" },
-	{ 0x0d8e, "Global Sun Technology, Inc." },
-	{ 0x0d8f, "Pitney Bowes" },
-	{ 0x0d90, "Sure-Fire Electrical Corp." },
-	{ 0x0d96, "Skanhex Technology, Inc." },
-	{ 0x0d97, "Santa Barbara Instrument Group" },
-	{ 0x0d98, "Mars Semiconductor Corp." },
-	{ 0x0d99, "Trazer Technologies, Inc." },
-	{ 0x0d9a, "RTX AS" },
-	{ 0x0d9b, "Tat Shing Electrical Co." },
-	{ 0x0d9c, "Chee Chen Hi-Technology Co., Ltd" },
-	{ 0x0d9d, "Sanwa Supply, Inc." },
-	{ 0x0d9e, "Avaya" },
-	{ 0x0d9f, "Powercom Co., Ltd" },
-	{ 0x0da0, "Danger Research" },
-	{ 0x0da1, "Suzhou Peter's Precise Industrial Co., Ltd" },
-	{ 0x0da2, "Land Instruments International, Ltd" },
-	{ 0x0da3, "Nippon Electro-Sensory Devices Corp." },
-	{ 0x0da4, "Polar Electro Oy" },
-	{ 0x0da7, "IOGear, Inc." },
-	{ 0x0da8, "softDSP Co., Ltd" },
-	{ 0x0dab, "Cubig Group" },
-	{ 0x0dad, "Westover Scientific" },
-	{ 0x0db0, "Micro Star International" },
-	{ 0x0db1, "Wen Te Electronics Co., Ltd" },
-	{ 0x0db2, "Shian Hwi Plug Parts, Plastic Factory" },
-	{ 0x0db3, "Tekram Technology Co., Ltd" },
-	{ 0x0db4, "Chung Fu Chen Yeh Enterprise Corp." },
-	{ 0x0db5, "Access IS" },
-	{ 0x0db7, "ELCON Systemtechnik" },
-	{ 0x0dba, "Digidesign" },
-	{ 0x0dbc, "A&D Medical" },
-	{ 0x0dbe, "Jiuh Shiuh Precision Industry Co., Ltd" },
-	{ 0x0dbf, "Jess-Link International" },
-	{ 0x0dc0, "G7 Solutions (formerly Great Notions)" },
-	{ 0x0dc1, "Tamagawa Seiki Co., Ltd" },
-	{ 0x0dc3, "Athena Smartcard Solutions, Inc." },
-	{ 0x0dc4, "inXtron, Inc." },
-	{ 0x0dc5, "SDK Co., Ltd" },
-	{ 0x0dc6, "Precision Squared Technology Corp." },
-	{ 0x0dc7, "First Cable Line, Inc." },
-	{ 0x0dcd, "NetworkFab Corp." },
-	{ 0x0dd0, "Access Solutions" },
-	{ 0x0dd1, "Contek Electronics Co., Ltd" },
-	{ 0x0dd2, "Power Quotient International Co., Ltd" },
-	{ 0x0dd3, "MediaQ" },
-	{ 0x0dd4, "Custom Engineering SPA" },
-	{ 0x0dd5, "California Micro Devices" },
-	{ 0x0dd7, "Kocom Co., Ltd" },
-	{ 0x0dd8, "Netac Technology Co., Ltd" },
-	{ 0x0dd9, "HighSpeed Surfing" },
-	{ 0x0dda, "Integrated Circuit Solution, Inc." },
-	{ 0x0ddb, "Tamarack, Inc." },
-	{ 0x0ddd, "Datelink Technology Co., Ltd" },
-	{ 0x0dde, "Ubicom, Inc." },
-	{ 0x0de0, "BD Consumer Healthcare" },
-	{ 0x0de7, "USBmicro" },
-	{ 0x0dea, "UTECH Electronic (D.G.) Co., Ltd." },
-	{ 0x0ded, "Novasonics" },
-	{ 0x0dee, "Lifetime Memory Products" },
-	{ 0x0def, "Full Rise Electronic Co., Ltd" },
-	{ 0x0df4, "NET&SYS" },
-	{ 0x0df6, "Sitecom Europe B.V." },
-	{ 0x0df7, "Mobile Action Technology, Inc." },
-	{ 0x0dfa, "Toyo Communication Equipment Co., Ltd" },
-	{ 0x0dfc, "GeneralTouch Technology Co., Ltd" },
-	{ 0x0e03, "Nippon Systemware Co., Ltd" },
-	{ 0x0e08, "Winbest Technology Co., Ltd" },
-	{ 0x0e0b, "Amigo Technology Inc." },
-	{ 0x0e0c, "Gesytec" },
-	{ 0x0e0d, "PicoQuant GmbH" },
-	{ 0x0e0f, "VMware, Inc." },
-	{ 0x0e16, "JMTek, LLC" },
-	{ 0x0e17, "Walex Electronic, Ltd" },
-	{ 0x0e1a, "Unisys" },
-	{ 0x0e1b, "Crewave" },
-	{ 0x0e20, "Pegasus Technologies Ltd." },
-	{ 0x0e21, "Cowon Systems, Inc." },
-	{ 0x0e22, "Symbian Ltd." },
-	{ 0x0e23, "Liou Yuane Enterprise Co., Ltd" },
-	{ 0x0e25, "VinChip Systems, Inc." },
-	{ 0x0e26, "J-Phone East Co., Ltd" },
-	{ 0x0e30, "HeartMath LLC" },
-	{ 0x0e34, "Micro Computer Control Corp." },
-	{ 0x0e35, "3Pea Technologies, Inc." },
-	{ 0x0e36, "TiePie engineering" },
-	{ 0x0e38, "Stratitec, Inc." },
-	{ 0x0e39, "Smart Modular Technologies, Inc." },
-	{ 0x0e3a, "Neostar Technology Co., Ltd" },
-	{ 0x0e3b, "Mansella, Ltd" },
-	{ 0x0e41, "Line6, Inc." },
-	{ 0x0e44, "Sun-Riseful Technology Co., Ltd." },
-	{ 0x0e48, "Julia Corp., Ltd" },
-	{ 0x0e4a, "Shenzhen Bao Hing Electric Wire & Cable Mfr. Co." },
-	{ 0x0e4c, "Radica Games, Ltd" },
-	{ 0x0e50, "TechnoData Interware" },
-	{ 0x0e55, "Speed Dragon Multimedia, Ltd" },
-	{ 0x0e56, "Kingston Technology Company, Inc." },
-	{ 0x0e5a, "Active Co., Ltd" },
-	{ 0x0e5b, "Union Power Information Industrial Co., Ltd" },
-	{ 0x0e5c, "Bitland Information Technology Co., Ltd" },
-	{ 0x0e5d, "Neltron Industrial Co., Ltd" },
-	{ 0x0e5e, "Conwise Technology Co., Ltd." },
-	{ 0x0e66, "Hawking Technologies" },
-	{ 0x0e67, "Fossil, Inc." },
-	{ 0x0e6a, "Megawin Technology Co., Ltd" },
-	{ 0x0e6f, "Logic3" },
-	{ 0x0e70, "Tokyo Electronic Industry Co., Ltd" },
-	{ 0x0e72, "Hsi-Chin Electronics Co., Ltd" },
-	{ 0x0e75, "TVS Electronics, Ltd" },
-	{ 0x0e79, "Archos, Inc." },
-	{ 0x0e7b, "On-Tech Industry Co., Ltd" },
-	{ 0x0e7e, "Gmate, Inc." },
-	{ 0x0e82, "Ching Tai Electric Wire & Cable Co., Ltd" },
-	{ 0x0e83, "Shin An Wire & Cable Co." },
-	{ 0x0e8c, "Well Force Electronic Co., Ltd" },
-	{ 0x0e8d, "MediaTek Inc." },
-	{ 0x0e8f, "GreenAsia Inc." },
-	{ 0x0e90, "WiebeTech, LLC" },
-	{ 0x0e91, "VTech Engineering Canada, Ltd" },
-	{ 0x0e92, "C's Glory Enterprise Co., Ltd" },
-	{ 0x0e93, "eM Technics Co., Ltd" },
-	{ 0x0e95, "Future Technology Co., Ltd" },
-	{ 0x0e96, "Aplux Communications, Ltd" },
-	{ 0x0e97, "Fingerworks, Inc." },
-	{ 0x0e98, "Advanced Analogic Technologies, Inc." },
-	{ 0x0e99, "Parallel Dice Co., Ltd" },
-	{ 0x0e9a, "TA HSING Industries, Ltd" },
-	{ 0x0e9b, "ADTEC Corp." },
-	{ 0x0e9c, "Streamzap, Inc." },
-	{ 0x0e9f, "Tamura Corp." },
-	{ 0x0ea0, "Ours Technology, Inc." },
-	{ 0x0ea6, "Nihon Computer Co., Ltd" },
-	{ 0x0ea7, "MSL Enterprises Corp." },
-	{ 0x0ea8, "CenDyne, Inc." },
-	{ 0x0ead, "Humax Co., Ltd" },
-	{ 0x0eb0, "NovaTech" },
-	{ 0x0eb1, "WIS Technologies, Inc." },
-	{ 0x0eb2, "Y-S Electronic Co., Ltd" },
-	{ 0x0eb3, "Saint Technology Corp." },
-	{ 0x0eb7, "Endor AG" },
-	{ 0x0eb8, "Mettler Toledo" },
-	{ 0x0ebb, "Thermo Fisher Scientific" },
-	{ 0x0ebe, "VWeb Corp." },
-	{ 0x0ebf, "Omega Technology of Taiwan, Inc." },
-	{ 0x0ec0, "LHI Technology (China) Co., Ltd" },
-	{ 0x0ec1, "Abit Computer Corp." },
-	{ 0x0ec2, "Sweetray Industrial, Ltd" },
-	{ 0x0ec3, "Axell Co., Ltd" },
-	{ 0x0ec4, "Ballracing Developments, Ltd" },
-	{ 0x0ec5, "GT Information System Co., Ltd" },
-	{ 0x0ec6, "InnoVISION Multimedia, Ltd" },
-	{ 0x0ec7, "Theta Link Corp." },
-	{ 0x0ecd, "Lite-On IT Corp." },
-	{ 0x0ece, "TaiSol Electronics Co., Ltd" },
-	{ 0x0ecf, "Phogenix Imaging, LLC" },
-	{ 0x0ed1, "WinMaxGroup" },
-	{ 0x0ed2, "Kyoto Micro Computer Co., Ltd" },
-	{ 0x0ed3, "Wing-Tech Enterprise Co., Ltd" },
-	{ 0x0ed5, "Fiberbyte" },
-	{ 0x0eda, "Noriake Itron Corp." },
-	{ 0x0edf, "e-MDT Co., Ltd" },
-	{ 0x0ee0, "Shima Seiki Mfg., Ltd" },
-	{ 0x0ee1, "Sarotech Co., Ltd" },
-	{ 0x0ee2, "AMI Semiconductor, Inc." },
-	{ 0x0ee3, "ComTrue Technology Corp." },
-	{ 0x0ee4, "Sunrich Technology, Ltd" },
-	{ 0x0eee, "Digital Stream Technology, Inc." },
-	{ 0x0eef, "D-WAV Scientific Co., Ltd" },
-	{ 0x0ef0, "Hitachi Cable, Ltd" },
-	{ 0x0ef1, "Aichi Micro Intelligent Corp." },
-	{ 0x0ef2, "I/O Magic Corp." },
-	{ 0x0ef3, "Lynn Products, Inc." },
-	{ 0x0ef4, "DSI Datotech" },
-	{ 0x0ef5, "PointChips" },
-	{ 0x0ef6, "Yield Microelectronics Corp." },
-	{ 0x0ef7, "SM Tech Co., Ltd (Tulip)" },
-	{ 0x0efd, "Oasis Semiconductor" },
-	{ 0x0efe, "Wem Technology, Inc." },
-	{ 0x0f03, "Unitek UPS Systems" },
-	{ 0x0f06, "Visual Frontier Enterprise Co., Ltd" },
-	{ 0x0f08, "CSL Wire & Plug (Shen Zhen) Co." },
-	{ 0x0f0c, "CAS Corp." },
-	{ 0x0f0d, "Hori Co., Ltd" },
-	{ 0x0f0e, "Energy Full Corp." },
-	{ 0x0f0f, "Silego Technology Inc" },
-	{ 0x0f11, "LD Didactic GmbH" },
-	{ 0x0f12, "Mars Engineering Corp." },
-	{ 0x0f13, "Acetek Technology Co., Ltd" },
-	{ 0x0f14, "Ingenico" },
-	{ 0x0f18, "Finger Lakes Instrumentation" },
-	{ 0x0f19, "Oracom Co., Ltd" },
-	{ 0x0f1b, "Onset Computer Corp." },
-	{ 0x0f1c, "Funai Electric Co., Ltd" },
-	{ 0x0f1d, "Iwill Corp." },
-	{ 0x0f21, "IOI Technology Corp." },
-	{ 0x0f22, "Senior Industries, Inc." },
-	{ 0x0f23, "Leader Tech Manufacturer Co., Ltd" },
-	{ 0x0f24, "Flex-P Industries, Snd., Bhd." },
-	{ 0x0f2d, "ViPower, Inc." },
-	{ 0x0f2e, "Geniality Maple Technology Co., Ltd" },
-	{ 0x0f2f, "Priva Design Services" },
-	{ 0x0f30, "Jess Technology Co., Ltd" },
-	{ 0x0f31, "Chrysalis Development" },
-	{ 0x0f32, "YFC-BonEagle Electric Co., Ltd" },
-	{ 0x0f37, "Kokuyo Co., Ltd" },
-	{ 0x0f38, "Nien-Yi Industrial Corp." },
-	{ 0x0f39, "TG3 Electronics" },
-	{ 0x0f3d, "Airprime, Incorporated" },
-	{ 0x0f41, "RDC Semiconductor Co., Ltd" },
-	{ 0x0f42, "Nital Consulting Services, Inc." },
-	{ 0x0f44, "Polhemus" },
-	{ 0x0f4b, "St. John Technology Co., Ltd" },
-	{ 0x0f4c, "WorldWide Cable Opto Corp." },
-	{ 0x0f4d, "Microtune, Inc." },
-	{ 0x0f4e, "Freedom Scientific" },
-	{ 0x0f52, "Wing Key Electrical Co., Ltd" },
-	{ 0x0f53, "Dongguan White Horse Cable Factory, Ltd" },
-	{ 0x0f54, "Kawai Musical Instruments Mfg. Co., Ltd" },
-	{ 0x0f55, "AmbiCom, Inc." },
-	{ 0x0f5c, "Prairiecomm, Inc." },
-	{ 0x0f5d, "NewAge International, LLC" },
-	{ 0x0f5f, "Key Technology Corp." },
-	{ 0x0f60, "NTK, Ltd" },
-	{ 0x0f61, "Varian, Inc." },
-	{ 0x0f62, "Acrox Technologies Co., Ltd" },
-	{ 0x0f63, "LeapFrog Enterprises" },
-	{ 0x0f68, "Kobe Steel, Ltd" },
-	{ 0x0f69, "Dionex Corp." },
-	{ 0x0f6a, "Vibren Technologies, Inc." },
-	{ 0x0f6e, "INTELLIGENT SYSTEMS" },
-	{ 0x0f73, "DFI" },
-	{ 0x0f78, "Guntermann & Drunck GmbH" },
-	{ 0x0f7c, "DQ Technology, Inc." },
-	{ 0x0f7d, "NetBotz, Inc." },
-	{ 0x0f7e, "Fluke Corp." },
-	{ 0x0f88, "VTech Holdings, Ltd" },
-	{ 0x0f8b, "Yazaki Corp." },
-	{ 0x0f8c, "Young Generation International Corp." },
-	{ 0x0f8d, "Uniwill Computer Corp." },
-	{ 0x0f8e, "Kingnet Technology Co., Ltd" },
-	{ 0x0f8f, "Soma Networks" },
-	{ 0x0f97, "CviLux Corp." },
-	{ 0x0f98, "CyberBank Corp." },
-	{ 0x0f9c, "Hyun Won, Inc." },
-	{ 0x0f9e, "Lucent Technologies" },
-	{ 0x0fa3, "Starconn Electronic Co., Ltd" },
-	{ 0x0fa4, "ATL Technology" },
-	{ 0x0fa5, "Sotec Co., Ltd" },
-	{ 0x0fa7, "Epox Computer Co., Ltd" },
-	{ 0x0fa8, "Logic Controls, Inc." },
-	{ 0x0faf, "Winpoint Electronic Corp." },
-	{ 0x0fb0, "Haurtian Wire & Cable Co., Ltd" },
-	{ 0x0fb1, "Inclose Design, Inc." },
-	{ 0x0fb2, "Juan-Chern Industrial Co., Ltd" },
-	{ 0x0fb6, "Heber Ltd" },
-	{ 0x0fb8, "Wistron Corp." },
-	{ 0x0fb9, "AACom Corp." },
-	{ 0x0fba, "San Shing Electronics Co., Ltd" },
-	{ 0x0fbb, "Bitwise Systems, Inc." },
-	{ 0x0fc1, "Mitac Internatinal Corp." },
-	{ 0x0fc2, "Plug and Jack Industrial, Inc." },
-	{ 0x0fc5, "Delcom Engineering" },
-	{ 0x0fc6, "Dataplus Supplies, Inc." },
-	{ 0x0fca, "Research In Motion, Ltd." },
-	{ 0x0fce, "Sony Ericsson Mobile Communications AB" },
-	{ 0x0fcf, "Dynastream Innovations, Inc." },
-	{ 0x0fd0, "Tulip Computers B.V." },
-	{ 0x0fd1, "Giant Electronics Ltd." },
-	{ 0x0fd2, "Seac Banche" },
-	{ 0x0fd4, "Tenovis GmbH & Co., KG" },
-	{ 0x0fd5, "Direct Access Technology, Inc." },
-	{ 0x0fd9, "Elgato Systems GmbH" },
-	{ 0x0fda, "Quantec Networks GmbH" },
-	{ 0x0fdc, "Micro Plus" },
-	{ 0x0fde, "Oregon Scientific" },
-	{ 0x0fe0, "Osterhout Design Group" },
-	{ 0x0fe2, "Air Techniques" },
-	{ 0x0fe4, "IN-Tech Electronics, Ltd" },
-	{ 0x0fe5, "Greenconn (U.S.A.), Inc." },
-	{ 0x0fe6, "ICS Advent" },
-	{ 0x0fe9, "DVICO" },
-	{ 0x0fea, "United Computer Accessories" },
-	{ 0x0feb, "CRS Electronic Co., Ltd" },
-	{ 0x0fec, "UMC Electronics Co., Ltd" },
-	{ 0x0fed, "Access Co., Ltd" },
-	{ 0x0fee, "Xsido Corp." },
-	{ 0x0fef, "MJ Research, Inc." },
-	{ 0x0ff6, "Core Valley Co., Ltd" },
-	{ 0x0ff7, "CHI SHING Computer Accessories Co., Ltd" },
-	{ 0x0ffc, "Clavia DMI AB" },
-	{ 0x0ffd, "EarlySense" },
-	{ 0x0fff, "Aopen, Inc." },
-	{ 0x1000, "Speed Tech Corp." },
-	{ 0x1001, "Ritronics Components (S) Pte., Ltd" },
-	{ 0x1003, "Sigma Corp." },
-	{ 0x1004, "LG Electronics, Inc." },
-	{ 0x1005, "Apacer Technology, Inc." },
-	{ 0x1006, "iRiver, Ltd." },
-	{ 0x1009, "Emuzed, Inc." },
-	{ 0x100a, "AV Chaseway, Ltd" },
-	{ 0x100b, "Chou Chin Industrial Co., Ltd" },
-	{ 0x100d, "Netopia, Inc." },
-	{ 0x1010, "Fukuda Denshi Co., Ltd" },
-	{ 0x1011, "Mobile Media Tech." },
-	{ 0x1012, "SDKM Fibres, Wires & Cables Berhad" },
-	{ 0x1013, "TST-Touchless Sensor Technology AG" },
-	{ 0x1014, "Densitron Technologies PLC" },
-	{ 0x1015, "Softronics Pty., Ltd" },
-	{ 0x1016, "Xiamen Hung's Enterprise Co., Ltd" },
-	{ 0x1017, "Speedy Industrial Supplies, Pte., Ltd" },
-	{ 0x1019, "Elitegroup Computer Systems (ECS)" },
-	{ 0x1020, "Labtec" },
-	{ 0x1022, "Shinko Shoji Co., Ltd" },
-	{ 0x1025, "Hyper-Paltek" },
-	{ 0x1026, "Newly Corp." },
-	{ 0x1027, "Time Domain" },
-	{ 0x1028, "Inovys Corp." },
-	{ 0x1029, "Atlantic Coast Telesys" },
-	{ 0x102a, "Ramos Technology Co., Ltd" },
-	{ 0x102b, "Infotronic America, Inc." },
-	{ 0x102c, "Etoms Electronics Corp." },
-	{ 0x102d, "Winic Corp." },
-	{ 0x1031, "Comax Technology, Inc." },
-	{ 0x1032, "C-One Technology Corp." },
-	{ 0x1033, "Nucam Corp." },
-	{ 0x1038, "SteelSeries ApS" },
-	{ 0x1039, "devolo AG" },
-	{ 0x103a, "PSA" },
-	{ 0x103d, "Stanton" },
-	{ 0x1043, "iCreate Technologies Corp." },
-	{ 0x1044, "Chu Yuen Enterprise Co., Ltd" },
-	{ 0x1046, "Winbond Electronics Corp. [hex]" },
-	{ 0x1048, "Targus Group International" },
-	{ 0x104b, "Mylex / Buslogic" },
-	{ 0x104c, "AMCO TEC International, Inc." },
-	{ 0x104d, "Newport Corporation" },
-	{ 0x104f, "WB Electronics" },
-	{ 0x1050, "Yubico.com" },
-	{ 0x1053, "Immanuel Electronics Co., Ltd" },
-	{ 0x1054, "BMS International Beheer N.V." },
-	{ 0x1055, "Complex Micro Interconnection Co., Ltd" },
-	{ 0x1056, "Hsin Chen Ent Co., Ltd" },
-	{ 0x1057, "ON Semiconductor" },
-	{ 0x1058, "Western Digital Technologies, Inc." },
-	{ 0x1059, "Giesecke & Devrient GmbH" },
-	{ 0x105b, "Foxconn International, Inc." },
-	{ 0x105c, "Hong Ji Electric Wire & Cable (Dongguan) Co., Ltd" },
-	{ 0x105d, "Delkin Devices, Inc." },
-	{ 0x105e, "Valence Semiconductor Design, Ltd" },
-	{ 0x105f, "Chin Shong Enterprise Co., Ltd" },
-	{ 0x1060, "Easthome Industrial Co., Ltd" },
-	{ 0x1063, "Motorola Electronics Taiwan, Ltd [hex]" },
-	{ 0x1065, "CCYU Technology" },
-	{ 0x1068, "Micropi Elettronica" },
-	{ 0x106a, "Loyal Legend, Ltd" },
-	{ 0x106c, "Curitel Communications, Inc." },
-	{ 0x106d, "San Chieh Manufacturing, Ltd" },
-	{ 0x106e, "ConectL" },
-	{ 0x106f, "Money Controls" },
-	{ 0x1076, "GCT Semiconductor, Inc." },
-	{ 0x107b, "Gateway, Inc." },
-	{ 0x107d, "Arlec Australia, Ltd" },
-	{ 0x107e, "Midoriya Electric Co., Ltd" },
-	{ 0x107f, "KidzMouse, Inc." },
-	{ 0x1082, "Shin-Etsukaken Co., Ltd" },
-	{ 0x1083, "Canon Electronics, Inc." },
-	{ 0x1084, "Pantech Co., Ltd" },
-	{ 0x108a, "Chloride Power Protection" },
-	{ 0x108b, "Grand-tek Technology Co., Ltd" },
-	{ 0x108c, "Robert Bosch GmbH" },
-	{ 0x108e, "Lotes Co., Ltd." },
-	{ 0x1091, "Numerik Jena" },
-	{ 0x1099, "Surface Optics Corp." },
-	{ 0x109a, "DATASOFT Systems GmbH" },
-	{ 0x109b, "Hisense" },
-	{ 0x109f, "eSOL Co., Ltd" },
-	{ 0x10a0, "Hirotech, Inc." },
-	{ 0x10a3, "Mitsubishi Materials Corp." },
-	{ 0x10a9, "SK Teletech Co., Ltd" },
-	{ 0x10aa, "Cables To Go" },
-	{ 0x10ab, "USI Co., Ltd" },
-	{ 0x10ac, "Honeywell, Inc." },
-	{ 0x10ae, "Princeton Technology Corp." },
-	{ 0x10af, "Liebert Corp." },
-	{ 0x10b5, "Comodo (PLX?)" },
-	{ 0x10b8, "DiBcom" },
-	{ 0x10bb, "TM Technology, Inc." },
-	{ 0x10bc, "Dinging Technology Co., Ltd" },
-	{ 0x10bd, "TMT Technology, Inc." },
-	{ 0x10bf, "SmartHome" },
-	{ 0x10c3, "Universal Laser Systems, Inc." },
-	{ 0x10c4, "Cygnal Integrated Products, Inc." },
-	{ 0x10c5, "Sanei Electric, Inc." },
-	{ 0x10c6, "Intec, Inc." },
-	{ 0x10cb, "Eratech" },
-	{ 0x10cc, "GBM Connector Co., Ltd" },
-	{ 0x10cd, "Kycon, Inc." },
-	{ 0x10ce, "Silicon Labs" },
-	{ 0x10cf, "Velleman Components, Inc." },
-	{ 0x10d1, "Hottinger Baldwin Measurement" },
-	{ 0x10d2, "RayComposer - R. Adams" },
-	{ 0x10d4, "Man Boon Manufactory, Ltd" },
-	{ 0x10d5, "Uni Class Technology Co., Ltd" },
-	{ 0x10d6, "Actions Semiconductor Co., Ltd" },
-	{ 0x10de, "Authenex, Inc." },
-	{ 0x10df, "In-Win Development, Inc." },
-	{ 0x10e0, "Post-Op Video, Inc." },
-	{ 0x10e1, "CablePlus, Ltd" },
-	{ 0x10e2, "Nada Electronics, Ltd" },
-	{ 0x10ec, "Vast Technologies, Inc." },
-	{ 0x10f0, "Nexio Co., Ltd" },
-	{ 0x10f1, "Importek" },
-	{ 0x10f5, "Turtle Beach" },
-	{ 0x10fb, "Pictos Technologies, Inc." },
-	{ 0x10fd, "Anubis Electronics, Ltd" },
-	{ 0x10fe, "Thrane & Thrane" },
-	{ 0x1100, "VirTouch, Ltd" },
-	{ 0x1101, "EasyPass Industrial Co., Ltd" },
-	{ 0x1108, "Brightcom Technologies, Ltd" },
-	{ 0x110a, "Moxa Technologies Co., Ltd." },
-	{ 0x1110, "Analog Devices Canada, Ltd (Allied Telesyn)" },
-	{ 0x1111, "Pandora International Ltd." },
-	{ 0x1112, "YM ELECTRIC CO., Ltd" },
-	{ 0x1113, "Medion AG" },
-	{ 0x111e, "VSO Electric Co., Ltd" },
-	{ 0x112a, "RedRat" },
-	{ 0x112e, "Master Hill Electric Wire and Cable Co., Ltd" },
-	{ 0x112f, "Cellon International, Inc." },
-	{ 0x1130, "Tenx Technology, Inc." },
-	{ 0x1131, "Integrated System Solution Corp." },
-	{ 0x1132, "Toshiba Corp., Digital Media Equipment [hex]" },
-	{ 0x1136, "CTS Electronincs" },
-	{ 0x113c, "Arin Tech Co., Ltd" },
-	{ 0x113d, "Mapower Electronics Co., Ltd" },
-	{ 0x113f, "Integrated Biometrics, LLC" },
-	{ 0x1141, "V One Multimedia, Pte., Ltd" },
-	{ 0x1142, "CyberScan Technologies, Inc." },
-	{ 0x1145, "Japan Radio Company" },
-	{ 0x1146, "Shimane SANYO Electric Co., Ltd." },
-	{ 0x1147, "Ever Great Electric Wire and Cable Co., Ltd" },
-	{ 0x114b, "Sphairon Access Systems GmbH" },
-	{ 0x114c, "Tinius Olsen Testing Machine Co., Inc." },
-	{ 0x114d, "Alpha Imaging Technology Corp." },
-	{ 0x114f, "Wavecom" },
-	{ 0x115b, "Salix Technology Co., Ltd." },
-	{ 0x1162, "Secugen Corp." },
-	{ 0x1163, "DeLorme Publishing, Inc." },
-	{ 0x1164, "YUAN High-Tech Development Co., Ltd" },
-	{ 0x1165, "Telson Electronics Co., Ltd" },
-	{ 0x1166, "Bantam Interactive Technologies" },
-	{ 0x1167, "Salient Systems Corp." },
-	{ 0x1168, "BizConn International Corp." },
-	{ 0x116e, "Gigastorage Corp." },
-	{ 0x116f, "Silicon 10 Technology Corp." },
-	{ 0x1175, "Shengyih Steel Mold Co., Ltd" },
-	{ 0x117d, "Santa Electronic, Inc." },
-	{ 0x117e, "JNC, Inc." },
-	{ 0x1182, "Venture Corp., Ltd" },
-	{ 0x1183, "Compaq Computer Corp. [hex] (Digital Dream ?)" },
-	{ 0x1184, "Kyocera Elco Corp." },
-	{ 0x1188, "Bloomberg L.P." },
-	{ 0x1189, "Acer Communications & Multimedia" },
-	{ 0x118f, "You Yang Technology Co., Ltd" },
-	{ 0x1190, "Tripace" },
-	{ 0x1191, "Loyalty Founder Enterprise Co., Ltd" },
-	{ 0x1196, "Yankee Robotics, LLC" },
-	{ 0x1197, "Technoimagia Co., Ltd" },
-	{ 0x1198, "StarShine Technology Corp." },
-	{ 0x1199, "Sierra Wireless, Inc." },
-	{ 0x119a, "ZHAN QI Technology Co., Ltd" },
-	{ 0x119b, "ruwido austria GmbH" },
-	{ 0x11a0, "Chipcon AS" },
-	{ 0x11a3, "Technovas Co., Ltd" },
-	{ 0x11aa, "GlobalMedia Group, LLC" },
-	{ 0x11ab, "Exito Electronics Co., Ltd" },
-	{ 0x11ac, "Nike" },
-	{ 0x11b0, "ATECH FLASH TECHNOLOGY" },
-	{ 0x11be, "R&D International NV" },
-	{ 0x11c0, "Betop" },
-	{ 0x11c5, "Inmax" },
-	{ 0x11ca, "VeriFone Inc" },
-	{ 0x11db, "Topfield Co., Ltd." },
-	{ 0x11e6, "K.I. Technology Co. Ltd." },
-	{ 0x11f5, "Siemens AG" },
-	{ 0x11f6, "Prolific" },
-	{ 0x11f7, "Alcatel (?)" },
-	{ 0x1203, "TSC Auto ID Technology Co., Ltd" },
-	{ 0x1209, "InterBiometrics" },
-	{ 0x120e, "Hudson Soft Co., Ltd" },
-	{ 0x120f, "Magellan" },
-	{ 0x1210, "DigiTech" },
-	{ 0x121e, "Jungsoft Co., Ltd" },
-	{ 0x1220, "TC Electronic" },
-	{ 0x1221, "Unknown manufacturer" },
-	{ 0x1223, "SKYCABLE ENTERPRISE. CO., LTD." },
-	{ 0x1228, "Datapaq Limited" },
-	{ 0x1230, "Chipidea-Microelectronica, S.A." },
-	{ 0x1233, "Denver Electronics" },
-	{ 0x1234, "Brain Actuated Technologies" },
-	{ 0x1235, "Focusrite-Novation" },
-	{ 0x1241, "Belkin" },
-	{ 0x124a, "AirVast" },
-	{ 0x124b, "Nyko (Honey Bee)" },
-	{ 0x124c, "MXI - Memory Experts International, Inc." },
-	{ 0x125c, "Apogee Inc." },
-	{ 0x125f, "A-DATA Technology Co., Ltd." },
-	{ 0x1260, "Standard Microsystems Corp." },
-	{ 0x1264, "Covidien Energy-based Devices" },
-	{ 0x1266, "Pirelli Broadband Solutions" },
-	{ 0x1267, "Logic3 / SpectraVideo plc" },
-	{ 0x126c, "Aristocrat Technologies" },
-	{ 0x126d, "Bel Stewart" },
-	{ 0x126e, "Strobe Data, Inc." },
-	{ 0x126f, "TwinMOS" },
-	{ 0x1274, "Ensoniq" },
-	{ 0x1275, "Xaxero Marine Software Engineering, Ltd." },
-	{ 0x1278, "Starlight Xpress" },
-	{ 0x1283, "zebris Medical GmbH" },
-	{ 0x1286, "Marvell Semiconductor, Inc." },
-	{ 0x1291, "Qualcomm Flarion Technologies, Inc. / Leadtek Research, Inc." },
-	{ 0x1292, "Innomedia" },
-	{ 0x1293, "Belkin Components [hex]" },
-	{ 0x1294, "RISO KAGAKU CORP." },
-	{ 0x1297, "DekTec" },
-	{ 0x129b, "CyberTAN Technology" },
-	{ 0x12a7, "Trendchip Technologies Corp." },
-	{ 0x12ab, "Honey Bee Electronic International Ltd." },
-	{ 0x12b8, "Zhejiang Xinya Electronic Technology Co., Ltd." },
-	{ 0x12b9, "E28" },
-	{ 0x12ba, "Licensed by Sony Computer Entertainment America" },
-	{ 0x12bd, "Gembird" },
-	{ 0x12c4, "Autocue Group Ltd" },
-	{ 0x12cf, "DEXIN" },
-	{ 0x12d1, "Huawei Technologies Co., Ltd." },
-	{ 0x12d2, "LINE TECH INDUSTRIAL CO., LTD." },
-	{ 0x12d6, "EMS Dr. Thomas Wuensche" },
-	{ 0x12d7, "BETTER WIRE FACTORY CO., LTD." },
-	{ 0x12d8, "Araneus Information Systems Oy" },
-	{ 0x12e6, "Waldorf Music GmbH" },
-	{ 0x12ef, "Tapwave, Inc." },
-	{ 0x12f2, "ViewPlus Technologies, Inc." },
-	{ 0x12f5, "Dynamic System Electronics Corp." },
-	{ 0x12f7, "Memorex Products, Inc." },
-	{ 0x12fd, "AIN Comm. Technology Co., Ltd" },
-	{ 0x12ff, "Fascinating Electronics, Inc." },
-	{ 0x1307, "Transcend Information, Inc." },
-	{ 0x1308, "Shuttle, Inc." },
-	{ 0x1310, "Roper" },
-	{ 0x1312, "ICS Electronics" },
-	{ 0x1313, "ThorLabs" },
-	{ 0x131d, "Natural Point" },
-	{ 0x1325, "ams AG" },
-	{ 0x132a, "Envara Inc." },
-	{ 0x132b, "Konica Minolta" },
-	{ 0x133e, "Kemper Digital GmbH" },
-	{ 0x1342, "Mobility" },
-	{ 0x1343, "Citizen Systems" },
-	{ 0x1345, "Sino Lite Technology Corp." },
-	{ 0x1347, "Moravian Instruments" },
-	{ 0x1348, "Katsuragawa Electric Co., Ltd." },
-	{ 0x134c, "PanJit International Inc." },
-	{ 0x134e, "Digby's Bitpile, Inc. DBA D Bit" },
-	{ 0x1357, "P&E Microcomputer Systems" },
-	{ 0x135f, "Control Development Inc." },
-	{ 0x1366, "SEGGER" },
-	{ 0x136b, "STEC" },
-	{ 0x136e, "Andor Technology Ltd." },
-	{ 0x1370, "Swissbit" },
-	{ 0x1371, "CNet Technology Inc." },
-	{ 0x1376, "Vimtron Electronics Co., Ltd." },
-	{ 0x1377, "Sennheiser electronic GmbH & Co. KG" },
-	{ 0x137b, "SCAPS GmbH" },
-	{ 0x1385, "Netgear, Inc" },
-	{ 0x138a, "Validity Sensors, Inc." },
-	{ 0x138e, "Jungo LTD" },
-	{ 0x1390, "TOMTOM B.V." },
-	{ 0x1391, "IdealTEK, Inc." },
-	{ 0x1395, "Sennheiser Communications" },
-	{ 0x1397, "BEHRINGER International GmbH" },
-	{ 0x1398, "Q-tec" },
-	{ 0x13ad, "Baltech" },
-	{ 0x13b0, "PerkinElmer Optoelectronics" },
-	{ 0x13b1, "Linksys" },
-	{ 0x13b2, "Alesis" },
-	{ 0x13b3, "Nippon Dics Co., Ltd." },
-	{ 0x13ba, "PCPlay" },
-	{ 0x13be, "Ricoh Printing Systems, Ltd." },
-	{ 0x13ca, "JyeTai Precision Industrial Co., Ltd." },
-	{ 0x13cf, "Wisair Ltd." },
-	{ 0x13d0, "Techsan Electronics Co., Ltd." },
-	{ 0x13d1, "A-Max Technology Macao Commercial Offshore Co. Ltd." },
-	{ 0x13d2, "Shark Multimedia" },
-	{ 0x13d3, "IMC Networks" },
-	{ 0x13d7, "Guidance Software, Inc." },
-	{ 0x13dc, "ALEREON, INC." },
-	{ 0x13dd, "i.Tech Dynamic Limited" },
-	{ 0x13e1, "Kaibo Wire & Cable (Shenzhen) Co., Ltd." },
-	{ 0x13e5, "Rane" },
-	{ 0x13e6, "TechnoScope Co., Ltd." },
-	{ 0x13ea, "Hengstler" },
-	{ 0x13ec, "Zydacron" },
-	{ 0x13ee, "MosArt" },
-	{ 0x13fd, "Initio Corporation" },
-	{ 0x13fe, "Kingston Technology Company Inc." },
-	{ 0x1400, "Axxion Group Corp." },
-	{ 0x1402, "Bowe Bell & Howell" },
-	{ 0x1403, "Sitronix" },
-	{ 0x1409, "IDS Imaging Development Systems GmbH" },
-	{ 0x140e, "Telechips, Inc." },
-	{ 0x1410, "Novatel Wireless" },
-	{ 0x1415, "Nam Tai E&E Products Ltd. or OmniVision Technologies, Inc." },
-	{ 0x1419, "ABILITY ENTERPRISE CO., LTD." },
-	{ 0x1421, "Sensor Technology" },
-	{ 0x1424, "Posnet Polska S.A." },
-	{ 0x1429, "Vega Technologies Industrial (Austria) Co." },
-	{ 0x142a, "Thales E-Transactions" },
-	{ 0x142b, "Arbiter Systems, Inc." },
-	{ 0x1430, "RedOctane" },
-	{ 0x1431, "Pertech Resources, Inc." },
-	{ 0x1435, "Wistron NeWeb" },
-	{ 0x1436, "Denali Software, Inc." },
-	{ 0x143c, "Altek Corporation" },
-	{ 0x1443, "Digilent" },
-	{ 0x1446, "X.J.GROUP" },
-	{ 0x1451, "Force Dimension" },
-	{ 0x1452, "Dai Nippon Printing, Inc" },
-	{ 0x1453, "Radio Shack" },
-	{ 0x1456, "Extending Wire & Cable Co., Ltd." },
-	{ 0x1457, "First International Computer, Inc." },
-	{ 0x145f, "Trust" },
-	{ 0x1460, "Tatung Co." },
-	{ 0x1461, "Staccato Communications" },
-	{ 0x1462, "Micro Star International" },
-	{ 0x1472, "Huawei-3Com" },
-	{ 0x147a, "Formosa Industrial Computing, Inc." },
-	{ 0x147e, "Upek" },
-	{ 0x147f, "Hama GmbH & Co., KG" },
-	{ 0x1482, "Vaillant" },
-	{ 0x1484, "Elsa AG [hex]" },
-	{ 0x1485, "Silicom" },
-	{ 0x1487, "DSP Group, Ltd." },
-	{ 0x148e, "EVATRONIX SA" },
-	{ 0x148f, "Ralink Technology, Corp." },
-	{ 0x1491, "Futronic Technology Co. Ltd." },
-	{ 0x1493, "Suunto" },
-	{ 0x1497, "Panstrong Company Ltd." },
-	{ 0x1498, "Microtek International Inc." },
-	{ 0x149a, "Imagination Technologies" },
-	{ 0x14aa, "WideView Technology Inc." },
-	{ 0x14ad, "CTK Corporation" },
-	{ 0x14ae, "Printronix Inc." },
-	{ 0x14af, "ATP Electronics Inc." },
-	{ 0x14b0, "StarTech.com Ltd." },
-	{ 0x14b2, "Ralink Technology, Corp." },
-	{ 0x14c0, "Rockwell Automation, Inc." },
-	{ 0x14c2, "Gemlight Computer, Ltd" },
-	{ 0x14c8, "Zytronic" },
-	{ 0x14cd, "Super Top" },
-	{ 0x14d8, "JAMER INDUSTRIES CO., LTD." },
-	{ 0x14dd, "Raritan Computer, Inc." },
-	{ 0x14e0, "WiNRADiO Communications" },
-	{ 0x14e1, "Dialogue Technology Corp." },
-	{ 0x14e5, "SAIN Information & Communications Co., Ltd." },
-	{ 0x14ea, "Planex Communications" },
-	{ 0x14ed, "Shure Inc." },
-	{ 0x14f7, "TechniSat Digital GmbH" },
-	{ 0x1500, "Ellisys" },
-	{ 0x1501, "Pine-Tum Enterprise Co., Ltd." },
-	{ 0x1509, "First International Computer, Inc." },
-	{ 0x1513, "medMobile" },
-	{ 0x1514, "Actel" },
-	{ 0x1516, "CompUSA" },
-	{ 0x1518, "Cheshire Engineering Corp." },
-	{ 0x1519, "Comneon" },
-	{ 0x151f, "Opal Kelly Incorporated" },
-	{ 0x1520, "Bitwire Corp." },
-	{ 0x1524, "ENE Technology Inc" },
-	{ 0x1527, "Silicon Portals" },
-	{ 0x1529, "UBIQUAM Co., Ltd." },
-	{ 0x152a, "Thesycon Systemsoftware & Consulting GmbH" },
-	{ 0x152b, "MIR Srl" },
-	{ 0x152d, "JMicron Technology Corp. / JMicron USA Technology Corp." },
-	{ 0x152e, "LG (HLDS)" },
-	{ 0x1532, "Razer USA, Ltd" },
-	{ 0x153b, "TerraTec Electronic GmbH" },
-	{ 0x1546, "U-Blox AG" },
-	{ 0x1547, "SG Intec Ltd & Co KG" },
-	{ 0x154a, "Celectronic GmbH" },
-	{ 0x154b, "PNY" },
-	{ 0x154d, "ConnectCounty Holdings Berhad" },
-	{ 0x154e, "D&M Holdings, Inc. (Denon/Marantz)" },
-	{ 0x154f, "SNBC CO., Ltd" },
-	{ 0x1554, "Prolink Microsystems Corp." },
-	{ 0x1557, "OQO" },
-	{ 0x1568, "Sunf Pu Technology Co., Ltd" },
-	{ 0x156f, "Quantum Corporation" },
-	{ 0x1570, "ALLTOP TECHNOLOGY CO., LTD." },
-	{ 0x157b, "Ketron SRL" },
-	{ 0x157e, "TRENDnet" },
-	{ 0x1582, "Fiberline" },
-	{ 0x1587, "SMA Technologie AG" },
-	{ 0x158d, "Oakley Inc." },
-	{ 0x158e, "JDS Uniphase Corporation (JDSU)" },
-	{ 0x1598, "Kunshan Guoji Electronics Co., Ltd." },
-	{ 0x15a2, "Freescale Semiconductor, Inc." },
-	{ 0x15a4, "Afatech Technologies, Inc." },
-	{ 0x15a8, "Teams Power Limited" },
-	{ 0x15a9, "Gemtek" },
-	{ 0x15aa, "Gearway Electronics (Dong Guan) Co., Ltd." },
-	{ 0x15ad, "VMware Inc." },
-	{ 0x15ba, "Olimex Ltd." },
-	{ 0x15c0, "XL Imaging" },
-	{ 0x15c2, "SoundGraph Inc." },
-	{ 0x15c5, "Advance Multimedia Internet Technology Inc. (AMIT)" },
-	{ 0x15c6, "Laboratoires MXM" },
-	{ 0x15c8, "KTF Technologies" },
-	{ 0x15c9, "D-Box Technologies" },
-	{ 0x15ca, "Textech International Ltd." },
-	{ 0x15d5, "Coulomb Electronics Ltd." },
-	{ 0x15d9, "Trust International B.V." },
-	{ 0x15dc, "Hynix Semiconductor Inc." },
-	{ 0x15e0, "Seong Ji Industrial Co., Ltd." },
-	{ 0x15e1, "RSA" },
-	{ 0x15e4, "Numark" },
-	{ 0x15e8, "SohoWare" },
-	{ 0x15e9, "Pacific Digital Corp." },
-	{ 0x15ec, "Belcarra Technologies Corp." },
-	{ 0x15f4, "HanfTek" },
-	{ 0x1604, "Tascam" },
-	{ 0x1605, "ACCES I/O Products, Inc." },
-	{ 0x1606, "Umax" },
-	{ 0x1608, "Inside Out Networks [hex]" },
-	{ 0x160a, "VIA Technologies, Inc." },
-	{ 0x160e, "INRO" },
-	{ 0x1614, "Amoi Electronics" },
-	{ 0x1617, "Sony Corp." },
-	{ 0x1619, "L & K Precision Technology Co., Ltd." },
-	{ 0x161c, "Digitech Systems" },
-	{ 0x1621, "Wionics Research" },
-	{ 0x1628, "Stonestreet One, Inc." },
-	{ 0x162a, "Airgo Networks Inc." },
-	{ 0x162f, "WiQuest Communications, Inc." },
-	{ 0x1630, "2Wire, Inc." },
-	{ 0x1631, "Good Way Technology" },
-	{ 0x1645, "Entrega [hex]" },
-	{ 0x1649, "SofTec Microsystems" },
-	{ 0x164a, "ChipX" },
-	{ 0x164c, "Matrix Vision GmbH" },
-	{ 0x1657, "Struck Innovative Systeme GmbH" },
-	{ 0x165b, "Frontier Design Group" },
-	{ 0x165c, "Kondo Kagaku" },
-	{ 0x1660, "Creatix Polymedia GmbH" },
-	{ 0x1667, "GIGA-TMS INC." },
-	{ 0x1668, "Actiontec Electronics, Inc. [hex]" },
-	{ 0x1669, "PiKRON Ltd. [hex]" },
-	{ 0x166a, "Clipsal" },
-	{ 0x1677, "China Huada Integrated Circuit Design (Group) Co., Ltd. (CIDC Group)" },
-	{ 0x1679, "Total Phase" },
-	{ 0x1680, "Golden Bridge Electech Inc." },
-	{ 0x1681, "Prevo Technologies, Inc." },
-	{ 0x1682, "Maxwise Production Enterprise Ltd." },
-	{ 0x1684, "Godspeed Computer Corp." },
-	{ 0x1685, "Delock" },
-	{ 0x1686, "ZOOM Corporation" },
-	{ 0x1687, "Kingmax Digital Inc." },
-	{ 0x1688, "Saab AB" },
-	{ 0x1689, "Razer USA, Ltd" },
-	{ 0x168c, "Atheros Communications" },
-	{ 0x1690, "Askey Computer Corp. [hex]" },
-	{ 0x1696, "Hitachi Video and Information System, Inc." },
-	{ 0x1697, "VTec Test, Inc." },
-	{ 0x16a5, "Shenzhen Zhengerya Cable Co., Ltd." },
-	{ 0x16a6, "Unigraf" },
-	{ 0x16ab, "Global Sun Technology" },
-	{ 0x16ac, "Dongguan ChingLung Wire & Cable Co., Ltd." },
-	{ 0x16b4, "iStation" },
-	{ 0x16b5, "Persentec, Inc." },
-	{ 0x16c0, "Van Ooijen Technische Informatica" },
-	{ 0x16ca, "Wireless Cables, Inc." },
-	{ 0x16cc, "silex technology, Inc." },
-	{ 0x16d0, "MCS" },
-	{ 0x16d1, "Suprema Inc." },
-	{ 0x16d3, "Frontline Test Equipment, Inc." },
-	{ 0x16d5, "AnyDATA Corporation" },
-	{ 0x16d6, "JABLOCOM s.r.o." },
-	{ 0x16d8, "CMOTECH Co., Ltd." },
-	{ 0x16dc, "Wiener, Plein & Baus" },
-	{ 0x16de, "Telemecanique" },
-	{ 0x16df, "King Billion Electronics Co., Ltd." },
-	{ 0x16f0, "GN ReSound A/S" },
-	{ 0x16f5, "Futurelogic Inc." },
-	{ 0x1706, "BlueView Technologies, Inc." },
-	{ 0x1707, "ARTIMI" },
-	{ 0x170b, "Swissonic" },
-	{ 0x170d, "Avnera" },
-	{ 0x1711, "Leica Microsystems" },
-	{ 0x1724, "Meyer Instruments (MIS)" },
-	{ 0x1725, "Vitesse Semiconductor" },
-	{ 0x1726, "Axesstel, Inc." },
-	{ 0x172f, "Waltop International Corp." },
-	{ 0x1733, "Cellink Technology Co., Ltd" },
-	{ 0x1736, "CANON IMAGING SYSTEM TECHNOLOGIES INC." },
-	{ 0x1737, "Linksys" },
-	{ 0x173a, "Roche" },
-	{ 0x173d, "QSENN" },
-	{ 0x1740, "Senao" },
-	{ 0x1743, "General Atomics" },
-	{ 0x1748, "MQP Electronics" },
-	{ 0x174c, "ASMedia Technology Inc." },
-	{ 0x174f, "Syntek" },
-	{ 0x1753, "GERTEC Telecomunicacoes Ltda." },
-	{ 0x1756, "ENENSYS Technologies" },
-	{ 0x1759, "LucidPort Technology, Inc." },
-	{ 0x1761, "ASUSTek Computer, Inc. (wrong ID)" },
-	{ 0x1772, "System Level Solutions, Inc." },
-	{ 0x1776, "Arowana" },
-	{ 0x177f, "Sweex" },
-	{ 0x1781, "Multiple Vendors" },
-	{ 0x1782, "Spreadtrum Communications Inc." },
-	{ 0x1784, "TopSeed Technology Corp." },
-	{ 0x1787, "ATI AIB" },
-	{ 0x1788, "ShenZhen Litkconn Technology Co., Ltd." },
-	{ 0x1796, "Printrex, Inc." },
-	{ 0x1797, "JALCO CO., LTD." },
-	{ 0x1799, "Thales Norway A/S" },
-	{ 0x179d, "Ricavision International, Inc." },
-	{ 0x17a0, "Samson Technologies Corp." },
-	{ 0x17a4, "Concept2" },
-	{ 0x17a5, "Advanced Connection Technology Inc." },
-	{ 0x17a7, "MICOMSOFT CO., LTD." },
-	{ 0x17a8, "Kamstrup A/S" },
-	{ 0x17b3, "Grey Innovation" },
-	{ 0x17b5, "Lunatone" },
-	{ 0x17ba, "SAURIS GmbH" },
-	{ 0x17c3, "Singim International Corp." },
-	{ 0x17cc, "Native Instruments" },
-	{ 0x17cf, "Hip Hing Cable & Plug Mfy. Ltd." },
-	{ 0x17d0, "Sanford L.P." },
-	{ 0x17d3, "Korea Techtron Co., Ltd." },
-	{ 0x17e9, "DisplayLink" },
-	{ 0x17eb, "Cornice, Inc." },
-	{ 0x17ef, "Lenovo" },
-	{ 0x17f4, "WaveSense" },
-	{ 0x17f5, "K.K. Rocky" },
-	{ 0x17f6, "Unicomp, Inc" },
-	{ 0x1809, "Advantech" },
-	{ 0x1822, "Twinhan" },
-	{ 0x1831, "Gwo Jinn Industries Co., Ltd." },
-	{ 0x1832, "Huizhou Shenghua Industrial Co., Ltd." },
-	{ 0x183d, "VIVOphone" },
-	{ 0x1843, "Vaisala" },
-	{ 0x1849, "ASRock Incorporation" },
-	{ 0x1852, "GYROCOM C&C Co., LTD" },
-	{ 0x1854, "Memory Devices Ltd." },
-	{ 0x185b, "Compro" },
-	{ 0x1861, "Tech Technology Industrial Company" },
-	{ 0x1862, "Teridian Semiconductor Corp." },
-	{ 0x1870, "Nexio Co., Ltd" },
-	{ 0x1871, "Aveo Technology Corp." },
-	{ 0x1873, "Navilock" },
-	{ 0x187c, "Alienware Corporation" },
-	{ 0x187f, "Siano Mobile Silicon" },
-	{ 0x1892, "Vast Technologies, Inc." },
-	{ 0x1894, "Topseed" },
-	{ 0x1897, "Evertop Wire Cable Co." },
-	{ 0x189f, "3Shape A/S" },
-	{ 0x18a4, "CSSN" },
-	{ 0x18a5, "Verbatim, Ltd" },
-	{ 0x18b1, "Petalynx" },
-	{ 0x18b4, "e3C Technologies" },
-	{ 0x18b6, "Mikkon Technology Limited" },
-	{ 0x18b7, "Zotek Electronic Co., Ltd." },
-	{ 0x18c5, "AMIT Technology, Inc." },
-	{ 0x18cd, "Ecamm" },
-	{ 0x18d1, "Google Inc." },
-	{ 0x18d5, "Starline International Group Limited" },
-	{ 0x18d9, "Kaba" },
-	{ 0x18dc, "LKC Technologies, Inc." },
-	{ 0x18dd, "Planon System Solutions Inc." },
-	{ 0x18e3, "Fitipower Integrated Technology Inc" },
-	{ 0x18e8, "Qcom" },
-	{ 0x18ea, "Matrox Graphics, Inc." },
-	{ 0x18ec, "Arkmicro Technologies Inc." },
-	{ 0x18f8, "[Maxxter]" },
-	{ 0x18fb, "Scriptel Corporation" },
-	{ 0x18fd, "FineArch Inc." },
-	{ 0x1901, "GE Healthcare" },
-	{ 0x1908, "GEMBIRD" },
-	{ 0x190d, "Motorola GSG" },
-	{ 0x1914, "Alco Digital Devices Limited" },
-	{ 0x1915, "Nordic Semiconductor ASA" },
-	{ 0x191c, "Innovative Technology LTD" },
-	{ 0x1923, "FitLinxx" },
-	{ 0x1926, "NextWindow" },
-	{ 0x192f, "Avago Technologies, Pte." },
-	{ 0x1930, "Shenzhen Xianhe Technology Co., Ltd." },
-	{ 0x1931, "Ningbo Broad Telecommunication Co., Ltd." },
-	{ 0x1934, "Feature Integration Technology Inc. (Fintek)" },
-	{ 0x1938, "Meinberg Funkuhren GmbH & Co. KG" },
-	{ 0x1941, "Dream Link" },
-	{ 0x1943, "Sensoray Co., Inc." },
-	{ 0x1949, "Lab126, Inc." },
-	{ 0x194f, "PreSonus Audio Electronics, Inc." },
-	{ 0x1951, "Hyperstone AG" },
-	{ 0x1953, "Ironkey Inc." },
-	{ 0x1954, "Radiient Technologies" },
-	{ 0x195d, "Itron Technology iONE" },
-	{ 0x1965, "Uniden Corporation" },
-	{ 0x1967, "CASIO HITACHI Mobile Communications Co., Ltd." },
-	{ 0x196b, "Wispro Technology Inc." },
-	{ 0x1970, "Dane-Elec Corp. USA" },
-	{ 0x1975, "Dongguan Guneetal Wire & Cable Co., Ltd." },
-	{ 0x1976, "Chipsbrand Microelectronics (HK) Co., Ltd." },
-	{ 0x1977, "T-Logic" },
-	{ 0x197d, "Leuze electronic" },
-	{ 0x1989, "Nuconn Technology Corp." },
-	{ 0x198f, "Beceem Communications Inc." },
-	{ 0x1990, "Acron Precision Industrial Co., Ltd." },
-	{ 0x1995, "Trillium Technology Pty. Ltd." },
-	{ 0x1996, "PixeLINK" },
-	{ 0x199b, "MicroStrain, Inc." },
-	{ 0x199e, "The Imaging Source Europe GmbH" },
-	{ 0x199f, "Benica Corporation" },
-	{ 0x19a8, "Biforst Technology Inc." },
-	{ 0x19ab, "Bodelin" },
-	{ 0x19af, "S Life" },
-	{ 0x19b2, "Batronix" },
-	{ 0x19b4, "Celestron" },
-	{ 0x19b5, "B & W Group" },
-	{ 0x19b6, "Infotech Logistic, LLC" },
-	{ 0x19b9, "Data Robotics" },
-	{ 0x19c2, "Futuba" },
-	{ 0x19ca, "Mindtribe" },
-	{ 0x19cf, "Parrot SA" },
-	{ 0x19d2, "ZTE WCDMA Technologies MSM" },
-	{ 0x19db, "KFI Printers" },
-	{ 0x19e1, "WeiDuan Electronic Accessory (S.Z.) Co., Ltd." },
-	{ 0x19e8, "Industrial Technology Research Institute" },
-	{ 0x19ef, "Pak Heng Technology (Shenzhen) Co., Ltd." },
-	{ 0x19f7, "RODE Microphones" },
-	{ 0x19fa, "Gampaq Co.Ltd" },
-	{ 0x19ff, "Dynex" },
-	{ 0x1a08, "Bellwood International, Inc." },
-	{ 0x1a0a, "USB-IF non-workshop" },
-	{ 0x1a12, "KES Co., Ltd." },
-	{ 0x1a1d, "Veho" },
-	{ 0x1a25, "Amphenol East Asia Ltd." },
-	{ 0x1a2a, "Seagate Branded Solutions" },
-	{ 0x1a2c, "China Resource Semico Co., Ltd" },
-	{ 0x1a32, "Quanta Microsystems, Inc." },
-	{ 0x1a34, "ACRUX" },
-	{ 0x1a36, "Biwin Technology Ltd." },
-	{ 0x1a40, "Terminus Technology Inc." },
-	{ 0x1a41, "Action Electronics Co., Ltd." },
-	{ 0x1a44, "VASCO Data Security International" },
-	{ 0x1a4a, "Silicon Image" },
-	{ 0x1a4b, "SafeBoot International B.V." },
-	{ 0x1a5a, "Tandberg Data" },
-	{ 0x1a61, "Abbott Diabetes Care" },
-	{ 0x1a6a, "Spansion Inc." },
-	{ 0x1a6d, "SamYoung Electronics Co., Ltd" },
-	{ 0x1a6e, "Global Unichip Corp." },
-	{ 0x1a6f, "Sagem Orga GmbH" },
-	{ 0x1a72, "Physik Instrumente" },
-	{ 0x1a79, "Bayer Health Care LLC" },
-	{ 0x1a7b, "Lumberg Connect  GmbH & Co. KG" },
-	{ 0x1a7c, "Evoluent" },
-	{ 0x1a81, "Holtek Semiconductor, Inc." },
-	{ 0x1a86, "QinHeng Electronics" },
-	{ 0x1a89, "Dynalith Systems Co., Ltd." },
-	{ 0x1a8b, "SGS Taiwan Ltd." },
-	{ 0x1a8d, "BandRich, Inc." },
-	{ 0x1a98, "Leica Camera AG" },
-	{ 0x1aa4, "Data Drive Thru, Inc." },
-	{ 0x1aa5, "UBeacon Technologies, Inc." },
-	{ 0x1aa6, "eFortune Technology Corp." },
-	{ 0x1aad, "KeeTouch" },
-	{ 0x1ab1, "Rigol Technologies" },
-	{ 0x1acb, "Salcomp Plc" },
-	{ 0x1acc, "Midiplus Co, Ltd." },
-	{ 0x1ad1, "Desay Wire Co., Ltd." },
-	{ 0x1ad4, "APS" },
-	{ 0x1adb, "SEL C662 Serial Cable" },
-	{ 0x1ae4, "ic-design Reinhard Gottinger GmbH" },
-	{ 0x1ae7, "X-TENSIONS" },
-	{ 0x1aed, "High Top Precision Electronic Co., Ltd." },
-	{ 0x1aef, "Conntech Electronic (Suzhou) Corporation" },
-	{ 0x1af1, "Connect One Ltd." },
-	{ 0x1afe, "A. Eberle GmbH & Co. KG" },
-	{ 0x1b04, "Meilhaus Electronic GmbH" },
-	{ 0x1b0e, "BLUTRONICS S.r.l." },
-	{ 0x1b1c, "Corsair" },
-	{ 0x1b1f, "eQ-3 Entwicklung GmbH" },
-	{ 0x1b20, "MStar Semiconductor, Inc." },
-	{ 0x1b22, "WiLinx Corp." },
-	{ 0x1b26, "Cellex Power Products, Inc." },
-	{ 0x1b27, "Current Electronics Inc." },
-	{ 0x1b28, "NAVIsis Inc." },
-	{ 0x1b32, "Ugobe Life Forms, Inc." },
-	{ 0x1b36, "ViXS Systems, Inc." },
-	{ 0x1b3b, "iPassion Technology Inc." },
-	{ 0x1b3f, "Generalplus Technology Inc." },
-	{ 0x1b47, "Energizer Holdings, Inc." },
-	{ 0x1b48, "Plastron Precision Co., Ltd." },
-	{ 0x1b52, "ARH Inc." },
-	{ 0x1b59, "K.S. Terminals Inc." },
-	{ 0x1b5a, "Chao Zhou Kai Yuan Electric Co., Ltd." },
-	{ 0x1b65, "The Hong Kong Standards and Testing Centre Ltd." },
-	{ 0x1b71, "Fushicai" },
-	{ 0x1b72, "ATERGI TECHNOLOGY CO., LTD." },
-	{ 0x1b73, "Fresco Logic" },
-	{ 0x1b75, "Ovislink Corp." },
-	{ 0x1b76, "Legend Silicon Corp." },
-	{ 0x1b80, "Afatech" },
-	{ 0x1b86, "Dongguan Guanshang Electronics Co., Ltd." },
-	{ 0x1b88, "ShenMing Electron (Dong Guan) Co., Ltd." },
-	{ 0x1b8c, "Altium Limited" },
-	{ 0x1b8d, "e-MOVE Technology Co., Ltd." },
-	{ 0x1b8e, "Amlogic, Inc." },
-	{ 0x1b8f, "MA LABS, Inc." },
-	{ 0x1b96, "N-Trig" },
-	{ 0x1b98, "YMax Communications Corp." },
-	{ 0x1b99, "Shenzhen Yuanchuan Electronic" },
-	{ 0x1ba1, "JINQ CHERN ENTERPRISE CO., LTD." },
-	{ 0x1ba2, "Lite Metals & Plastic (Shenzhen) Co., Ltd." },
-	{ 0x1ba4, "Ember Corporation" },
-	{ 0x1ba6, "Abilis Systems" },
-	{ 0x1ba8, "China Telecommunication Technology Labs" },
-	{ 0x1bad, "Harmonix Music" },
-	{ 0x1bae, "Vuzix Corporation" },
-	{ 0x1bbb, "T & A Mobile Phones" },
-	{ 0x1bc4, "Ford Motor Co." },
-	{ 0x1bc5, "AVIXE Technology (China) Ltd." },
-	{ 0x1bc7, "Telit Wireless Solutions" },
-	{ 0x1bce, "Contac Cable Industrial Limited" },
-	{ 0x1bcf, "Sunplus Innovation Technology Inc." },
-	{ 0x1bd0, "Hangzhou Riyue Electronic Co., Ltd." },
-	{ 0x1bd5, "BG Systems, Inc." },
-	{ 0x1bde, "P-TWO INDUSTRIES, INC." },
-	{ 0x1bef, "Shenzhen Tongyuan Network-Communication Cables Co., Ltd" },
-	{ 0x1bf0, "RealVision Inc." },
-	{ 0x1bf5, "Extranet Systems Inc." },
-	{ 0x1bf6, "Orient Semiconductor Electronics, Ltd." },
-	{ 0x1bfd, "TouchPack" },
-	{ 0x1c02, "Kreton Corporation" },
-	{ 0x1c04, "QNAP System Inc." },
-	{ 0x1c0c, "Ionics EMS, Inc." },
-	{ 0x1c0d, "Relm Wireless" },
-	{ 0x1c10, "Lanterra Industrial Co., Ltd." },
-	{ 0x1c13, "ALECTRONIC LIMITED" },
-	{ 0x1c1a, "Datel Electronics Ltd." },
-	{ 0x1c1b, "Volkswagen of America, Inc." },
-	{ 0x1c1f, "Goldvish S.A." },
-	{ 0x1c20, "Fuji Electric Device Technology Co., Ltd." },
-	{ 0x1c21, "ADDMM LLC" },
-	{ 0x1c22, "ZHONGSHAN CHIANG YU ELECTRIC CO., LTD." },
-	{ 0x1c26, "Shanghai Haiying Electronics Co., Ltd." },
-	{ 0x1c27, "HuiYang D & S Cable Co., Ltd." },
-	{ 0x1c29, "Elster GmbH" },
-	{ 0x1c31, "LS Cable Ltd." },
-	{ 0x1c34, "SpringCard" },
-	{ 0x1c37, "Authorizer Technologies, Inc." },
-	{ 0x1c3d, "NONIN MEDICAL INC." },
-	{ 0x1c3e, "Wep Peripherals" },
-	{ 0x1c40, "EZPrototypes" },
-	{ 0x1c49, "Cherng Weei Technology Corp." },
-	{ 0x1c4f, "SiGma Micro" },
-	{ 0x1c6b, "Philips & Lite-ON Digital Solutions Corporation" },
-	{ 0x1c6c, "Skydigital Inc." },
-	{ 0x1c73, "AMT" },
-	{ 0x1c77, "Kaetat Industrial Co., Ltd." },
-	{ 0x1c78, "Datascope Corp." },
-	{ 0x1c79, "Unigen Corporation" },
-	{ 0x1c7a, "LighTuning Technology Inc." },
-	{ 0x1c7b, "LUXSHARE PRECISION INDUSTRY (SHENZHEN) CO., LTD." },
-	{ 0x1c83, "Schomaecker GmbH" },
-	{ 0x1c87, "2N TELEKOMUNIKACE a.s." },
-	{ 0x1c88, "Somagic, Inc." },
-	{ 0x1c89, "HONGKONG WEIDIDA ELECTRON LIMITED" },
-	{ 0x1c8e, "ASTRON INTERNATIONAL CORP." },
-	{ 0x1c98, "ALPINE ELECTRONICS, INC." },
-	{ 0x1c9e, "OMEGA TECHNOLOGY" },
-	{ 0x1ca0, "ACCARIO Inc." },
-	{ 0x1ca1, "Symwave" },
-	{ 0x1cac, "Kinstone" },
-	{ 0x1cb3, "Aces Electronic Co., Ltd." },
-	{ 0x1cb4, "OPEX CORPORATION" },
-	{ 0x1cb6, "IdeaCom Technology Inc." },
-	{ 0x1cbe, "Luminary Micro Inc." },
-	{ 0x1cbf, "FORTAT SKYMARK INDUSTRIAL COMPANY" },
-	{ 0x1cc0, "PlantSense" },
-	{ 0x1cca, "NextWave Broadband Inc." },
-	{ 0x1ccd, "Bodatong Technology (Shenzhen) Co., Ltd." },
-	{ 0x1cd4, "adp corporation" },
-	{ 0x1cd5, "Firecomms Ltd." },
-	{ 0x1cd6, "Antonio Precise Products Manufactory Ltd." },
-	{ 0x1cde, "Telecommunications Technology Association (TTA)" },
-	{ 0x1cdf, "WonTen Technology Co., Ltd." },
-	{ 0x1ce0, "EDIMAX TECHNOLOGY CO., LTD." },
-	{ 0x1ce1, "Amphenol KAE" },
-	{ 0x1cf1, "Dresden Elektronik" },
-	{ 0x1cfc, "ANDES TECHNOLOGY CORPORATION" },
-	{ 0x1cfd, "Flextronics Digital Design Japan, LTD." },
-	{ 0x1d03, "iCON" },
-	{ 0x1d07, "Solid-Motion" },
-	{ 0x1d08, "NINGBO HENTEK DRAGON ELECTRONICS CO., LTD." },
-	{ 0x1d09, "TechFaith Wireless Technology Limited" },
-	{ 0x1d0a, "Johnson Controls, Inc. The Automotive Business Unit" },
-	{ 0x1d0b, "HAN HUA CABLE & WIRE TECHNOLOGY (J.X.) CO., LTD." },
-	{ 0x1d0f, "Sonix Technology Co., Ltd." },
-	{ 0x1d14, "ALPHA-SAT TECHNOLOGY LIMITED" },
-	{ 0x1d17, "C-Thru Music Ltd." },
-	{ 0x1d19, "Dexatek Technology Ltd." },
-	{ 0x1d1f, "Diostech Co., Ltd." },
-	{ 0x1d20, "SAMTACK INC." },
-	{ 0x1d27, "ASUS" },
-	{ 0x1d34, "Dream Cheeky" },
-	{ 0x1d45, "Touch" },
-	{ 0x1d4d, "PEGATRON CORPORATION" },
-	{ 0x1d50, "OpenMoko, Inc." },
-	{ 0x1d57, "Xenta" },
-	{ 0x1d5b, "Smartronix, Inc." },
-	{ 0x1d5c, "Fresco Logic" },
-	{ 0x1d6b, "Linux Foundation" },
-	{ 0x1d90, "Citizen" },
-	{ 0x1d9d, "Sigma Sport" },
-	{ 0x1de1, "Actions Microelectronics Co." },
-	{ 0x1e0e, "Qualcomm / Option" },
-	{ 0x1e10, "Point Grey Research, Inc." },
-	{ 0x1e17, "Mirion Technologies Dosimetry Services Division" },
-	{ 0x1e1d, "Lumension Security" },
-	{ 0x1e1f, "INVIA" },
-	{ 0x1e29, "Festo AG & Co. KG" },
-	{ 0x1e3d, "Chipsbank Microelectronics Co., Ltd" },
-	{ 0x1e41, "Cleverscope" },
-	{ 0x1e4e, "Cubeternet" },
-	{ 0x1e54, "TypeMatrix" },
-	{ 0x1e68, "TrekStor GmbH & Co. KG" },
-	{ 0x1e71, "NZXT" },
-	{ 0x1e74, "Coby Electronics Corporation" },
-	{ 0x1e7d, "ROCCAT" },
-	{ 0x1ea7, "SHARKOON Technologies GmbH" },
-	{ 0x1ebb, "NuCORE Technology, Inc." },
-	{ 0x1eda, "AirTies Wireless Networks" },
-	{ 0x1edb, "Blackmagic design" },
-	{ 0x1ee8, "ONDA COMMUNICATION S.p.a." },
-	{ 0x1ef6, "EADS Deutschland GmbH" },
-	{ 0x1f28, "Cal-Comp" },
-	{ 0x1f3a, "Onda (unverified)" },
-	{ 0x1f44, "The Neat Company" },
-	{ 0x1f48, "H-TRONIC GmbH" },
-	{ 0x1f4d, "G-Tek Electronics Group" },
-	{ 0x1f6f, "Aliph" },
-	{ 0x1f75, "Innostor Technology Corporation" },
-	{ 0x1f82, "TANDBERG" },
-	{ 0x1f84, "Alere, Inc." },
-	{ 0x1f87, "Stantum" },
-	{ 0x1f9b, "Ubiquiti Networks, Inc." },
-	{ 0x1fab, "Samsung Opto-Electroncs Co., Ltd." },
-	{ 0x1fbd, "Delphin Technology AG" },
-	{ 0x1fc9, "NXP Semiconductors" },
-	{ 0x1fde, "ILX Lightwave Corporation" },
-	{ 0x1fe7, "Vertex Wireless Co., Ltd." },
-	{ 0x1ff7, "CVT Electronics.Co.,Ltd" },
-	{ 0x1fff, "Ideofy Inc." },
-	{ 0x2001, "D-Link Corp." },
-	{ 0x2002, "DAP Technologies" },
-	{ 0x2003, "detectomat" },
-	{ 0x200c, "Reloop" },
-	{ 0x2013, "PCTV Systems" },
-	{ 0x2019, "PLANEX" },
-	{ 0x203d, "Encore Electronics Inc." },
-	{ 0x2040, "Hauppauge" },
-	{ 0x2047, "Texas Instruments" },
-	{ 0x2058, "Nano River Technology" },
-	{ 0x2077, "Taicang T&W Electronics Co. Ltd" },
-	{ 0x2080, "Barnes & Noble" },
-	{ 0x2086, "SIMPASS" },
-	{ 0x2087, "Cando" },
-	{ 0x20a0, "Clay Logic" },
-	{ 0x20b1, "XMOS Ltd" },
-	{ 0x20b3, "Hanvon" },
-	{ 0x20b7, "Qi Hardware" },
-	{ 0x20ce, "Minicircuits" },
-	{ 0x20df, "Simtec Electronics" },
-	{ 0x20f1, "NET New Electronic Technology GmbH" },
-	{ 0x20f4, "TRENDnet" },
-	{ 0x20f7, "XIMEA" },
-	{ 0x2100, "RT Systems" },
-	{ 0x2101, "ActionStar" },
-	{ 0x2109, "VIA Labs, Inc." },
-	{ 0x2113, "Softkinetic" },
-	{ 0x2149, "Advanced Silicon S.A." },
-	{ 0x2162, "Creative (?)" },
-	{ 0x2184, "GW Instek" },
-	{ 0x21a1, "Emotiv Systems Pty. Ltd." },
-	{ 0x21d6, "Agecodagis SARL" },
-	{ 0x2207, "Fuzhou Rockchip Electronics Company" },
-	{ 0x2222, "MacAlly" },
-	{ 0x2227, "SAMWOO Enterprise" },
-	{ 0x2232, "Silicon Motion" },
-	{ 0x2233, "RadioShack Corporation" },
-	{ 0x2237, "Kobo Inc." },
-	{ 0x225d, "Morpho" },
-	{ 0x228d, "8D Technologies inc." },
-	{ 0x22a6, "Pie Digital, Inc." },
-	{ 0x22b8, "Motorola PCS" },
-	{ 0x22b9, "eTurboTouch Technology, Inc." },
-	{ 0x22ba, "Technology Innovation Holdings, Ltd" },
-	{ 0x2304, "Pinnacle Systems, Inc." },
-	{ 0x2318, "Shining Technologies, Inc. [hex]" },
-	{ 0x2341, "Arduino SA" },
-	{ 0x2357, "TP-Link" },
-	{ 0x2373, "Pumatronix Ltda" },
-	{ 0x2375, "Digit@lway, Inc." },
-	{ 0x2406, "SANHO Digital Electronics Co., Ltd." },
-	{ 0x2443, "Aessent Technology Ltd" },
-	{ 0x2478, "Tripp-Lite" },
-	{ 0x248a, "Maxxter" },
-	{ 0x249c, "M2Tech s.r.l." },
-	{ 0x24e1, "Paratronic" },
-	{ 0x2516, "Cooler Master Co., Ltd." },
-	{ 0x2548, "Pulse-Eight" },
-	{ 0x2632, "TwinMOS" },
-	{ 0x2639, "Xsens" },
-	{ 0x2650, "Electronics For Imaging, Inc. [hex]" },
-	{ 0x2659, "Sundtek" },
-	{ 0x2676, "Basler AG" },
-	{ 0x2730, "Citizen" },
-	{ 0x2735, "DigitalWay" },
-	{ 0x273f, "Hughski Limited" },
-	{ 0x2770, "NHJ, Ltd" },
-	{ 0x27b8, "ThingM" },
-	{ 0x2821, "ASUSTek Computer Inc." },
-	{ 0x2899, "Toptronic Industrial Co., Ltd" },
-	{ 0x289b, "Dracal/Raphnet technologies" },
-	{ 0x2931, "Jolla Oy" },
-	{ 0x2939, "Zaber Technologies Inc." },
-	{ 0x2a03, "dog hunter AG" },
-	{ 0x2a37, "RTD Embedded Technologies, Inc." },
-	{ 0x2a45, "Meizu Corp." },
-	{ 0x2b24, "KeepKey LLC" },
-	{ 0x2c02, "Planex Communications" },
-	{ 0x2c1a, "Dolphin Peripherals" },
-	{ 0x2c7c, "Quectel Wireless Solutions Co., Ltd." },
-	{ 0x2dcf, "Dialog Semiconductor" },
-	{ 0x2fb2, "Fujitsu, Ltd" },
-	{ 0x3125, "Eagletron" },
-	{ 0x3136, "Navini Networks" },
-	{ 0x3176, "Whanam Electronics Co., Ltd" },
-	{ 0x3195, "Link Instruments" },
-	{ 0x3275, "VidzMedia Pte Ltd" },
-	{ 0x3333, "InLine" },
-	{ 0x3334, "AEI" },
-	{ 0x3340, "Yakumo" },
-	{ 0x3344, "Leaguer Microelectronics (LME)" },
-	{ 0x3504, "Micro Star" },
-	{ 0x3538, "Power Quotient International Co., Ltd" },
-	{ 0x3579, "DIVA" },
-	{ 0x357d, "Sharkoon" },
-	{ 0x3636, "InVibro" },
-	{ 0x3838, "WEM" },
-	{ 0x3923, "National Instruments Corp." },
-	{ 0x40bb, "I-O Data" },
-	{ 0x4101, "i-rocks" },
-	{ 0x4102, "iRiver, Ltd." },
-	{ 0x413c, "Dell Computer Corp." },
-	{ 0x4146, "USBest Technology" },
-	{ 0x4168, "Targus" },
-	{ 0x4242, "USB Design by Example" },
-	{ 0x4255, "GoPro" },
-	{ 0x4317, "Broadcom Corp." },
-	{ 0x4348, "WinChipHead" },
-	{ 0x4572, "Shuttle, Inc." },
-	{ 0x4586, "Panram" },
-	{ 0x4670, "EMS Production" },
-	{ 0x4752, "Miditech" },
-	{ 0x4757, "GW Instek" },
-	{ 0x4766, "Aceeca" },
-	{ 0x4855, "Memorex" },
-	{ 0x4971, "SimpleTech" },
-	{ 0x4d46, "Musical Fidelity" },
-	{ 0x5032, "Grandtec" },
-	{ 0x5041, "Linksys (?)" },
-	{ 0x50c2, "Averatec (?)" },
-	{ 0x5173, "Sweex" },
-	{ 0x5219, "I-Tetra" },
-	{ 0x5345, "Owon" },
-	{ 0x534c, "SatoshiLabs" },
-	{ 0x5354, "Meyer Instruments (MIS)" },
-	{ 0x544d, "Transmeta Corp." },
-	{ 0x5543, "UC-Logic Technology Corp." },
-	{ 0x5555, "Epiphan Systems Inc." },
-	{ 0x55aa, "OnSpec Electronic, Inc." },
-	{ 0x5654, "Gotview" },
-	{ 0x5656, "Uni-Trend Group Limited" },
-	{ 0x595a, "IRTOUCHSYSTEMS Co. Ltd." },
-	{ 0x5986, "Acer, Inc" },
-	{ 0x59e3, "Nonolith Labs" },
-	{ 0x5a57, "Zinwell" },
-	{ 0x6000, "Beholder International Ltd." },
-	{ 0x601a, "Ingenic Semiconductor Ltd." },
-	{ 0x6189, "Sitecom" },
-	{ 0x6244, "LightingSoft AG" },
-	{ 0x6253, "TwinHan Technology Co., Ltd" },
-	{ 0x636c, "CoreLogic, Inc." },
-	{ 0x6472, "Unknown (Sony?)" },
-	{ 0x6547, "Arkmicro Technologies Inc." },
-	{ 0x6615, "IRTOUCHSYSTEMS Co. Ltd." },
-	{ 0x6666, "Prototype product Vendor ID" },
-	{ 0x6677, "WiseGroup, Ltd." },
-	{ 0x6891, "3Com" },
-	{ 0x695c, "Opera1" },
-	{ 0x6993, "Yealink Network Technology Co., Ltd." },
-	{ 0x6a75, "Shanghai Jujo Electronics Co., Ltd" },
-	{ 0x7104, "CME (Central Music Co.)" },
-	{ 0x726c, "StackFoundry LLC" },
-	{ 0x734c, "TBS Technologies China" },
-	{ 0x7373, "Beijing STONE Technology Co. Ltd." },
-	{ 0x7392, "Edimax Technology Co., Ltd" },
-	{ 0x8086, "Intel Corp." },
-	{ 0x8087, "Intel Corp." },
-	{ 0x80ee, "VirtualBox" },
-	{ 0x8282, "Keio" },
-	{ 0x8341, "EGO Systems, Inc." },
-	{ 0x8564, "Transcend Information, Inc." },
-	{ 0x8644, "Intenso GmbG" },
-	{ 0x8e06, "CH Products, Inc." },
-	{ 0x9016, "Sitecom" },
-	{ 0x9022, "TeVii Technology Ltd." },
-	{ 0x9148, "GeoLab, Ltd" },
-	{ 0x9710, "MosChip Semiconductor" },
-	{ 0x9849, "Bestmedia CD Recordable GmbH & Co. KG" },
-	{ 0x9999, "Odeon" },
-	{ 0x99fa, "Grandtec" },
-	{ 0x9ac4, "J. Westhues" },
-	{ 0x9e88, "Marvell Semiconductor, Inc." },
-	{ 0xa128, "AnMo Electronics Corp. / Dino-Lite (?)" },
-	{ 0xa168, "AnMo Electronics Corporation" },
-	{ 0xa600, "Asix" },
-	{ 0xa727, "3Com" },
-	{ 0xaaaa, "MXT" },
-	{ 0xabcd, "Unknown" },
-	{ 0xb58e, "Blue Microphones" },
-	{ 0xc216, "Card Device Expert Co., LTD" },
-	{ 0xc251, "Keil Software, Inc." },
-	{ 0xcace, "CACE Technologies Inc." },
-	{ 0xcd12, "SMART TECHNOLOGY INDUSTRIAL LTD." },
-	{ 0xd208, "Ultimarc" },
-	{ 0xd209, "Ultimarc" },
-	{ 0xd904, "LogiLink" },
-	{ 0xe4e4, "Xorcom Ltd." },
-	{ 0xeb03, "MakingThings" },
-	{ 0xeb1a, "eMPIA Technology, Inc." },
-	{ 0xeb2a, "KWorld" },
-	{ 0xef18, "SMART TECHNOLOGY INDUSTRIAL LTD." },
-	{ 0xf003, "Hewlett Packard" },
-	{ 0xf182, "Leap Motion" },
-	{ 0xf4ec, "Atten Electronics / Siglent Technologies" },
-	{ 0xf4ed, "Shenzhen Siglent Co., Ltd." },
-	{ 0xf766, "Hama" },
-	{ 0xfc08, "Conrad Electronic SE" },
-	{ 0xffee, "FNK Tech" },
+#define NB_USB_VENDORS 3002
+#define NB_USB_PRODUCTS 0
+#define NB_USB_CLASSES 0
+
+// Names, stored once each, in pages that no name crosses
+#define USB_NAME_PAGE_SIZE 16384
+static const char usb_name[][USB_NAME_PAGE_SIZE] = {
+	"Fry's Electronics\0"
+	"Ingram\0"
+	"Club Mac\0"
+	"Nebraska Furniture Mart\0"
+	"Unknown\0"
+	"Planex\0"
+	"Microntek\0"
+	"DragonRise Inc.\0"
+	"Boeye Technology Co., Ltd.\0"
+	"Trust International B.V.\0"
+	"IBP\0"
+	"MLK\0"
+	"TP-Link\0"
+	"Chipsbank Microelectronics Co., Ltd\0"
+	"Hangzhou Worlde\0"
+	"HUMAX Co., Ltd.\0"
+	"Mini Automation Controller\0"
+	"OCZ Technology Inc\0"
+	"LTS\0"
+	"Shenzhen Sinote Tech-Electron Co., Ltd\0"
+	"Bernd Walter Computer Technology\0"
+	"Intel\0"
+	"EndPoints, Inc.\0"
+	"Thesys Microelectronics\0"
+	"Data Broadcasting Corp.\0"
+	"Atmel Corp.\0"
+	"Iwatsu America, Inc.\0"
+	"Mitel Corp.\0"
+	"Mitsumi\0"
+	"HP, Inc\0"
+	"Genoa Technology\0"
+	"Oak Technology, Inc.\0"
+	"Adaptec, Inc.\0"
+	"Diebold, Inc.\0"
+	"Siemens Electromechanical\0"
+	"Epson Imaging Technology Center\0"
+	"KeyTronic Corp.\0"
+	"OPTi, Inc.\0"
+	"Elitegroup Computer Systems\0"
+	"Xilinx, Inc.\0"
+	"Farallon Comunications\0"
+	"National Semiconductor Corp.\0"
+	"National Registry, Inc.\0"
+	"ALi Corp.\0"
+	"Future Technology Devices International, Ltd\0"
+	"NCR Corp.\0"
+	"Synopsys, Inc.\0"
+	"Fujitsu-ICL Computers\0"
+	"Fujitsu Personal Systems, Inc.\0"
+	"Quanta Computer, Inc.\0"
+	"NEC Corp.\0"
+	"Kodak Co.\0"
+	"Weltrend Semiconductor\0"
+	"VTech Computers, Ltd\0"
+	"VIA Technologies, Inc.\0"
+	"MCCI\0"
+	"Echo Speech Corp.\0"
+	"BUFFALO INC. (formerly MelCo., Inc.)\0"
+	"Award Software International\0"
+	"Leadtek Research, Inc.\0"
+	"Giga-Byte Technology Co., Ltd\0"
+	"Winbond Electronics Corp.\0"
+	"Symbios Logic\0"
+	"AST Research\0"
+	"Samsung Info. Systems America, Inc.\0"
+	"Phoenix Technologies, Ltd\0"
+	"d'TV\0"
+	"S3, Inc.\0"
+	"Creative Technology, Ltd\0"
+	"LCS Telegraphics\0"
+	"Chips and Technologies\0"
+	"Nokia Mobile Phones\0"
+	"ADI Systems, Inc.\0"
+	"Computer Access Technology Corp.\0"
+	"Standard Microsystems Corp.\0"
+	"Motorola Semiconductors HK, Ltd\0"
+	"Integrated Device Technology, Inc.\0"
+	"Motorola Electronics Taiwan, Ltd\0"
+	"Advanced Gravis Computer Tech, Ltd\0"
+	"Cirrus Logic\0"
+	"Ericsson Austrian, AG\0"
+	"Intel Corp.\0"
+	"Innovative Semiconductors, Inc.\0"
+	"Micronics\0"
+	"Acer, Inc.\0"
+	"Molex, Inc.\0"
+	"Sun Microsystems, Inc.\0"
+	"Itac Systems, Inc.\0"
+	"Unisys Corp.\0"
+	"Alps Electric, Inc.\0"
+	"Hyundai Electronics America\0"
+	"Taugagreining HF\0"
+	"Framatome Connectors USA\0"
+	"Advanced Micro Devices, Inc.\0"
+	"Voice Technologies Group\0"
+	"Lexmark International, Inc.\0"
+	"LG Electronics USA, Inc.\0"
+	"RadiSys Corp.\0"
+	"Eizo Nanao Corp.\0"
+	"Winbond Systems Lab.\0"
+	"Ericsson, Inc.\0"
+	"Gateway, Inc.\0"
+	"Lucent Technologies, Inc.\0"
+	"NMB Technologies Corp.\0"
+	"Momentum Microsystems\0"
+	"Duta Multi Robotik\0"
+	"Shamrock Tech. Co., Ltd\0"
+	"WSI\0"
+	"CCL/ITRI\0"
+	"Siemens Nixdorf AG\0"
+	"Alps Electric Co., Ltd\0"
+	"ThrustMaster, Inc.\0"
+	"DFI, Inc.\0"
+	"Texas Instruments, Inc.\0"
+	"Mitsubishi Electronics America, Inc.\0"
+	"CMD Technology\0"
+	"Vobis Microcomputer AG\0"
+	"Telematics International, Inc.\0"
+	"Analog Devices, Inc.\0"
+	"Silicon Integrated Systems Corp.\0"
+	"KYE Systems Corp. (Mouse Systems)\0"
+	"Adobe Systems, Inc.\0"
+	"SONICblue, Inc.\0"
+	"Hitachi, Ltd\0"
+	"Nortel Networks, Ltd\0"
+	"Microsoft Corp.\0"
+	"Ace Cad Enterprise Co., Ltd\0"
+	"Primax Electronics, Ltd\0"
+	"MGE UPS Systems\0"
+	"AMP/Tycoelectronics Corp.\0"
+	"AT&T Paradyne\0"
+	"Wieson Technologies Co., Ltd\0"
+	"Cherry GmbH\0"
+	"American Megatrends, Inc.\0"
+	"Toshiba Corp., Digital Media Equipment\0"
+	"Logitech, Inc.\0"
+	"Behavior Tech. Computer Corp.\0"
+	"Crystal Semiconductor\0"
+	"Philips (or NXP)\0"
+	"Chicony Electronics Co., Ltd\0"
+	"Sanyo Information Business Co., Ltd\0"
+	"Sanyo Electric Co., Ltd\0"
+	"Relisys/Teco Information System\0"
+	"AESP\0"
+	"Seagate Technology, Inc.\0"
+	"Connectix Corp.\0"
+	"Advanced Peripheral Laboratories\0"
+	"Semtech Corp.\0"
+	"Silitek Corp.\0"
+	"Dell Computer Corp.\0"
+	"Kensington\0"
+	"Agere Systems, Inc. (Lucent)\0"
+	"Plantronics, Inc.\0"
+	"Toshiba America Inc\0"
+	"Zenith Data Systems\0"
+	"Kyocera Corp.\0"
+	"STMicroelectronics\0"
+	"Specialix\0"
+	"Nokia Monitors\0"
+	"ASUS Computers, Inc.\0"
+	"Stewart Connector\0"
+	"Cirque Corp.\0"
+	"Foxconn / Hon Hai\0"
+	"S-MOS Systems, Inc.\0"
+	"Alps Electric Ireland, Ltd\0"
+	"Integrated Technology Express, Inc.\0"
+	"Eicon Tech.\0"
+	"United Microelectronics Corp.\0"
+	"Capetronic\0"
+	"Samsung SemiConductor, Inc.\0"
+	"MAG Technology Co., Ltd\0"
+	"ESS Technology, Inc.\0"
+	"Micron Electronics\0"
+	"Smile International\0"
+	"Capetronic (Kaohsiung) Corp.\0"
+	"Yamaha Corp.\0"
+	"Gandalf Technologies, Ltd\0"
+	"Curtis Computer Products\0"
+	"Acer Advanced Labs, Inc.\0"
+	"VLSI Technology\0"
+	"Compaq Computer Corp.\0"
+	"Digital Equipment Corp.\0"
+	"SystemSoft Corp.\0"
+	"FirePower Systems\0"
+	"Trident Microsystems, Inc.\0"
+	"Acer Peripherals Inc. (now BenQ Corp.)\0"
+	"Nokia Display Products\0"
+	"Visioneer\0"
+	"Multivideo Labs, Inc.\0"
+	"Canon, Inc.\0"
+	"DaeWoo Telecom, Ltd\0"
+	"Chromatic Research\0"
+	"Micro Audiometrics Corp.\0"
+	"Dooin Electronics\0"
+	"Winnov L.P.\0"
+	"Nikon Corp.\0"
+	"Pan International\0"
+	"IBM Corp.\0"
+	"Cypress Semiconductor Corp.\0"
+	"ROHM LSI Systems USA, LLC\0"
+	"Hint Corp.\0"
+	"Compal Electronics, Inc.\0"
+	"Seiko Epson Corp.\0"
+	"Rainbow Technologies, Inc.\0"
+	"Toucan Systems, Ltd\0"
+	"I-O Data Device, Inc.\0"
+	"Toshiba Electronics Taiwan Corp.\0"
+	"Telia Research AB\0"
+	"TDK Corp.\0"
+	"U.S. Robotics (3Com)\0"
+	"Methode Electronics Far East PTE, Ltd\0"
+	"Maxi Switch, Inc.\0"
+	"Lockheed Martin Energy Research\0"
+	"Fujitsu, Ltd\0"
+	"Toshiba America Electronic Components\0"
+	"Micro Macro Technologies\0"
+	"Konica Corp.\0"
+	"Lite-On Technology Corp.\0"
+	"Fuji Photo Film Co., Ltd\0"
+	"ST-Ericsson\0"
+	"Tatung Co. Of America\0"
+	"ScanLogic Corp.\0"
+	"Myson Century, Inc.\0"
+	"Digi International\0"
+	"ITT Canon\0"
+	"Altec Lansing Technologies\0"
+	"VidUS, Inc.\0"
+	"LSI Logic, Inc.\0"
+	"Forte Technologies, Inc.\0"
+	"Mentor Graphics\0"
+	"Oki Semiconductor\0"
+	"Microchip Technology, Inc.\0"
+	"Holtek Semiconductor, Inc.\0"
+	"Panasonic (Matsushita)\0"
+	"Hypertec Pty, Ltd\0"
+	"Huan Hsin Holdings, Ltd\0"
+	"Sharp Corp.\0"
+	"MindShare, Inc.\0"
+	"Interlink Electronics\0"
+	"Iiyama North America, Inc.\0"
+	"Exar Corp.\0"
+	"Zilog, Inc.\0"
+	"ACC Microelectronics\0"
+	"Promise Technology\0"
+	"SCM Microsystems, Inc.\0"
+	"Elo TouchSystems\0"
+	"Samsung Electronics Co., Ltd\0"
+	"PC-Tel, Inc.\0"
+	"Brooktree Corp.\0"
+	"Northstar Systems, Inc.\0"
+	"Tokyo Electron Device, Ltd\0"
+	"Annabooks\0"
+	"Pacific Electronic International, Inc.\0"
+	"Daewoo Electronics Co., Ltd\0"
+	"Victor Company of Japan, Ltd\0"
+	"Elan Microelectronics Corp.\0"
+	"Harting Elektronik, Inc.\0"
+	"Fujitsu-ICL Systems, Inc.\0"
+	"Norand Corp.\0"
+	"Newnex Technology Corp.\0"
+	"FuturePlus Systems\0"
+	"Brother Industries, Ltd\0"
+	"Dallas Semiconductor\0"
+	"Biostar Microtech International Corp.\0"
+	"Sunplus Technology Co., Ltd\0"
+	"Soliton Systems, K.K.\0"
+	"PFU, Ltd\0"
+	"E-CMOS Corp.\0"
+	"Siam United Hi-Tech\0"
+	"Fujikura DDK, Ltd\0"
+	"Hitachi America, Ltd\0"
+	"Hayes Microcomputer Products\0"
+	"3Com Corp.\0"
+	"Hosiden Corp.\0"
+	"Clarion Co., Ltd\0"
+	"Aztech Systems, Ltd\0"
+	"Cinch Connectors\0"
+	"Cable System International\0"
+	"InnoMedia, Inc.\0"
+	"Belkin Components\0"
+	"Neon Technology, Inc.\0"
+	"KC Technology, Inc.\0"
+	"Sejin Electron, Inc.\0"
+	"N'Able (DataBook) Technologies, Inc.\0"
+	"Hualon Microelectronics Corp.\0"
+	"digital-X, Inc.\0"
+	"FCI Electronics\0"
+	"ACTC\0"
+	"Longwell Electronics\0"
+	"Butterfly Communications\0"
+	"EzKEY Corp.\0"
+	"Star Micronics Co., Ltd\0"
+	"WYSE Technology\0"
+	"Silicon Graphics\0"
+	"Shuttle, Inc.\0"
+	"American Power Conversion\0"
+	"Scientific Atlanta, Inc.\0"
+	"IO Systems (Elite Electronics), Inc.\0"
+	"Taiwan Semiconductor Manufacturing Co.\0"
+	"Airborn Connectors\0"
+	"Advanced Connectek, Inc.\0"
+	"ATEN GmbH\0"
+	"Sola Electronics\0"
+	"Netchip Technology, Inc.\0"
+	"Temic MHS S.A.\0"
+	"ALTRA\0"
+	"ATI Technologies, Inc.\0"
+	"Aladdin Knowledge Systems\0"
+	"Crescent Heart Software\0"
+	"Tekom Technologies, Inc.\0"
+	"Canon Information Systems, Inc.\0"
+	"Avid Electronics Corp.\0"
+	"Unicore Software, Inc.\0"
+	"American Microsystems, Inc.\0"
+	"Wacom Technology Corp.\0"
+	"Systech Corp.\0"
+	"Alcatel Mobile Phones\0"
+	"Motorola, Inc.\0"
+	"LIH TZU Electric Co., Ltd\0"
+	"Hand Held Products (Welch Allyn, Inc.)\0"
+	"Inventec Corp.\0"
+	"Caldera International, Inc. (SCO)\0"
+	"Shyh Shiun Terminals Co., Ltd\0"
+	"PrehKeyTec GmbH\0"
+	"Global Village Communication\0"
+	"Institut of Microelectronic & Mechatronic Systems\0"
+	"Silicon Architect\0"
+	"Mobility Electronics\0"
+	"UniAccess AB\0"
+	"Sirf Technology, Inc.\0"
+	"ViewSonic Corp.\0"
+	"Cristie Electronics, Ltd\0"
+	"Xirlink, Inc.\0"
+	"Polaroid Corp.\0"
+	"Anchor Chips, Inc.\0"
+	"Tyan Computer Corp.\0"
+	"Pixera Corp.\0"
+	"Fujitsu Microelectronics, Inc.\0"
+	"New Media Corp.\0"
+	"Sony Corp.\0"
+	"Try Corp.\0"
+	"Proside Corp.\0"
+	"WYSE Technology Taiwan\0"
+	"Fuji Xerox Co., Ltd\0"
+	"CompuTrend Systems, Inc.\0"
+	"Philips Monitors\0"
+	"STMicroelectronics Imaging Division (VLSI Vision)\0"
+	"Dictaphone Corp.\0"
+	"ANAM S&T Co., Ltd\0"
+	"Asahi Kasei Microsystems Co., Ltd\0"
+	"ATEN International Co., Ltd\0"
+	"Truevision, Inc.\0"
+	"Cadence Design Systems, Inc.\0"
+	"Kenwood USA\0"
+	"KnowledgeTek, Inc.\0"
+	"Proton Electronic Ind.\0"
+	"Samsung Electro-Mechanics Co.\0"
+	"CTX Opto-Electronics Corp.\0"
+	"Mustek Systems, Inc.\0"
+	"Interface Corp.\0"
+	"Oasis Design, Inc.\0"
+	"Telex Communications, Inc.\0"
+	"Immersion Corp.\0"
+	"Kodak Digital Product Center, Japan Ltd. (formerly Chinon Industries Inc.)\0"
+	"Peracom Networks, Inc.\0"
+	"Monterey International Corp.\0"
+	"Xyratex International, Ltd\0"
+	"Quartz Ingenierie\0"
+	"SegaSoft\0"
+	"Wacom Co., Ltd\0"
+	"Decicon, Inc.\0"
+	"eTEK Labs\0"
+	"EIZO Corp.\0"
+	"Elecom Co., Ltd\0"
+	"Korea Data Systems Co., Ltd\0"
+	"Epson America\0"
+	"Interex, Inc.\0"
+	"Conexant Systems (Rockwell), Inc.\0"
+	"Zoran Co. Personal Media Division (Nogatech)\0"
+	"City University of Hong Kong\0"
+	"Philips Creative Display Solutions\0"
+	"BAFO/Quality Computer Accessories\0"
+	"ELSA\0"
+	"Intrinsix Corp.\0"
+	"GVC Corp.\0"
+	"Samsung Electronics America\0"
+	"Y-E Data, Inc.\0"
+	"AVM GmbH\0"
+	"Shark Multimedia, Inc.\0"
+	"Nintendo Co., Ltd\0"
+	"QuickShot, Ltd\0"
+	"Denron, Inc.\0"
+	"Racal Data Group\0"
+	"Roland Corp.\0"
+	"Padix Co., Ltd (Rockfire)\0"
+	"RATOC System, Inc.\0"
+	"FlashPoint Technology, Inc.\0"
+	"ZyXEL Communications Corp.\0"
+	"America Kotobuki Electronics Industries, Inc.\0"
+	"Sapien Design\0"
+	"Victron\0"
+	"Nohau Corp.\0"
+	"Infineon Technologies\0"
+	"In Focus Systems\0"
+	"Micrel Semiconductor\0"
+	"Tripath Technology, Inc.\0"
+	"Alcor Micro Corp.\0"
+	"Omron Corp.\0"
+	"Questra Consulting\0"
+	"Powerware Corp.\0"
+	"Incite\0"
+	"Princeton Graphic Systems\0"
+	"Zoran Microelectronics, Ltd\0"
+	"MicroTouch Systems, Inc.\0"
+	"Trisignal Communications\0"
+	"Niigata Canotec Co., Inc.\0"
+	"Brilliance Semiconductor, Inc.\0"
+	"Spectrum Signal Processing, Inc.\0"
+	"Iomega Corp.\0"
+	"A-Trend Technology Co., Ltd\0"
+	"Advanced Input Devices\0"
+	"Intelligent Instrumentation\0"
+	"LaCie, Ltd\0"
+	"Vetronix Corp.\0"
+	"USC Corp.\0"
+	"Fuji Film Microdevices Co., Ltd\0"
+	"ARC International\0"
+	"Ortek Technology, Inc.\0"
+	"Sampo Technology Corp.\0"
+	"Cisco Systems, Inc.\0"
+	"Bose Corp.\0"
+	"Spacetec IMC Corp.\0"
+	"OmniVision Technologies, Inc.\0"
+	"Utilux South China, Ltd\0"
+	"In-System Design\0"
+	"Apple, Inc.\0"
+	"Y.C. Cable U.S.A., Inc.\0"
+	"Jing-Mold Enterprise Co., Ltd\0"
+	"Fountain Technologies, Inc.\0"
+	"First International Computer, Inc.\0"
+	"LG Semicon Co., Ltd\0"
+	"Dialogic Corp.\0"
+	"Proxima Corp.\0"
+	"Medianix Semiconductor, Inc.\0"
+	"Agiler, Inc.\0"
+	"Philips Research Laboratories\0"
+	"DigitalPersona, Inc.\0"
+	"Grey Cell Systems\0"
+	"3G Green Green Globe Co., Ltd\0"
+	"RAFI GmbH & Co. KG\0"
+	"Tyco Electronics (Raychem)\0"
+	"S & S Research\0"
+	"Keil Software\0"
+	"Kawasaki Microelectronics, Inc.\0"
+	"Media Phonics (Suisse) S.A.\0"
+	"Digi International, Inc.\0"
+	"Qualcomm, Inc.\0"
+	"Qtronix Corp.\0"
+	"Cheng Uei Precision Industry Co., Ltd (Foxlink)\0"
+	"Ricoh Co., Ltd\0"
+	"PowerVision Technologies, Inc.\0"
+	"ELSA AG\0"
+	"Silicom, Ltd\0"
+	"sci-worx GmbH\0"
+	"Sung Forn Co., Ltd\0"
+	"GE Medical Systems Lunar\0"
+	"Brainboxes, Ltd\0"
+	"Wave Systems Corp.\0"
+	"Tohoku Ricoh Co., Ltd\0"
+	"Super Gate Technology Co., Ltd\0"
+	"Philips Semiconductors, CICT\0"
+	"Thomas & Betts Corp.\0"
+	"Ultima Electronics Corp.\0"
+	"Axiohm Transaction Solutions\0"
+	"Microtek International, Inc.\0"
+	"Sun Corp. (Suntac?)\0"
+	"Lexar Media, Inc.\0"
+	"Delta Electronics, Inc.\0"
+	"Silicon Vision, Inc.\0"
+	"Symbol Technologies\0"
+	"Syntek Semiconductor Co., Ltd\0"
+	"ElecVision, Inc.\0"
+	"Genesys Logic, Inc.\0"
+	"Red Wing Corp.\0"
+	"Fuji Electric Co., Ltd\0"
+	"Keithley Instruments\0"
+	"ICC, Inc.\0"
+	"Kawasaki LSI\0"
+	"FFC, Ltd\0"
+	"COM21, Inc.\0"
+	"Cytechinfo Inc.\0"
+	"AVB, Inc. [anko?]\0"
+	"Canopus Co., Ltd\0"
+	"Compass Communications\0"
+	"Dexin Corp., Ltd\0"
+	"PI Engineering, Inc.\0"
+	"Unixtar Technology, Inc.\0"
+	"AOC International\0"
+	"RFC Distribution(s) PTE, Ltd\0"
+	"PSC Scanning, Inc.\0"
+	"Siemens Telecommunications Systems, Ltd\0"
+	"Harman\0"
+	"InterAct, Inc.\0"
+	"Chic Technology Corp.\0"
+	"LeCroy Corp.\0"
+	"Barco Display Systems\0"
+	"Jazz Hipster Corp.\0"
+	"Vista Imaging, Inc.\0"
+	"Novatek Microelectronics Corp.\0"
+	"Jean Co., Ltd\0"
+	"Anchor C&C Co., Ltd\0"
+	"Royal Information Electronics Co., Ltd\0"
+	"Bridge Information Co., Ltd\0"
+	"Genrad Ads\0"
+	"SMK Manufacturing, Inc.\0"
+	"Worthington Data Solutions, Inc.\0"
+	"Solid Year\0"
+	"EEH Datalink GmbH\0"
+	"Auctor Corp.\0"
+	"Transmonde Technologies, Inc.\0"
+	"Joinsoon Electronics Mfg. Co., Ltd\0"
+	"Costar Electronics, Inc.\0"
+	"Totoku Electric Co., Ltd\0"
+	"TransAct Technologies, Inc.\0"
+	"Bio-Rad Laboratories\0"
+	"Quabbin Wire & Cable Co., Inc.\0"
+	"Future Techno Designs PVT, Ltd\0"
+	"Swiss Federal Insitute of Technology\0"
+	"MacAlly\0"
+	"Seiko Instruments, Inc.\0"
+	"Veridicom International, Inc.\0"
+	"Promptus Communications, Inc.\0"
+	"Act Labs, Ltd\0"
+	"Quatech, Inc.\0"
+	"Nissei Electric Co.\0"
+	"Alaris, Inc.\0"
+	"ODU-Steckverbindungssysteme GmbH & Co. KG\0"
+	"Iotech, Inc.\0"
+	"Littelfuse, Inc.\0"
+	"Avocent Corp.\0"
+	"TiMedia Technology Co., Ltd\0"
+	"Nippon Systems Development Co., Ltd\0"
+	"Adomax Technology Co., Ltd\0"
+	"Tasking Software, Inc.\0"
+	"Zida Technologies, Ltd\0"
+	"MosArt Semiconductor Corp.\0"
+	"Greatlink Electronics Taiwan, Ltd\0"
+	"Institute for Information Industry\0"
+	"Taiwan Tai-Hao Enterprises Co., Ltd\0"
+	"Mainsuper Enterprises Co., Ltd\0"
+	"Sin Sheng Terminal & Machine, Inc.\0"
+	"JUJO Electronics Corp.\0"
+	"Cyrix Corp.\0"
+	"Micron Technology, Inc.\0"
+	"Methode Electronics, Inc.\0"
+	"Sierra Imaging, Inc.\0"
+	"Avision, Inc.\0"
+	"Chrontel, Inc.\0"
+	"Techwin Corp.\0"
+	"Yamaichi Electronics Co., Ltd (Sakura)\0"
+	"Fong Kai Industrial Co., Ltd\0"
+	"RealMedia Technology, Inc.\0"
+	"New Technology Cable, Ltd\0"
+	"Hitex Development Tools\0"
+	"Woods Industries, Inc.\0"
+	"VIA Medical Corp.\0"
+	"TEAC Corp.\0"
+	"Who? Vision Systems, Inc.\0"
+	"UMAX\0"
+	"Acton Research Corp.\0"
+	"Inside Out Networks\0"
+	"Weli Science Co., Ltd\0"
+	"Analog Devices, Inc. (White Mountain DSP)\0"
+	"Ji-Haw Industrial Co., Ltd\0"
+	"TriTech Microelectronics, Ltd\0"
+	"Suyin Corp.\0"
+	"WIBU-Systems AG\0"
+	"Dynapro Systems\0"
+	"Likom Technology Sdn. Bhd.\0"
+	"Stargate Solutions, Inc.\0"
+	"CNF, Inc.\0"
+	"Granite Microsystems, Inc.\0"
+	"Space Shuttle Hi-Tech Co., Ltd\0"
+	"Glory Mark Electronic, Ltd\0"
+	"Tekcon Electronics Corp.\0"
+	"Sigma Designs, Inc.\0"
+	"Aethra\0"
+	"Optoelectronics Co., Ltd\0"
+	"Tracewell Systems\0"
+	"Good Way Technology Co., Ltd & GWC technology Inc.\0"
+	"TSAY-E (BVI) International, Inc.\0"
+	"Hamamatsu Photonics K.K.\0"
+	"Kansai Electric Co., Ltd\0"
+	"Topmax Electronic Co., Ltd\0"
+	"ET&T Technology Co., Ltd.\0"
+	"Cypress Semiconductor\0"
+	"Aiwa Co., Ltd\0"
+	"WordWand\0"
+	"Oce' Printing Systems GmbH\0"
+	"Total Technologies, Ltd\0"
+	"Linksys, Inc.\0"
+	"Entrega, Inc.\0"
+	"Acer Semiconductor America, Inc.\0"
+	"SigmaTel, Inc.\0"
+	"Sequel Imaging\0"
+	"Labtec, Inc.\0"
+	"HCL\0"
+	"Key Mouse Electronic Enterprise Co., Ltd\0"
+	"DrayTek Corp.\0"
+	"Teles AG\0"
+	"ACard Technology Corp.\0"
+	"Prolific Technology, Inc.\0"
+	"Efficient Networks, Inc.\0"
+	"Hohner Corp.\0"
+	"Intermec Technologies Corp.\0"
+	"Virata, Ltd\0"
+	"Realtek Semiconductor Corp., CPP Div. (Avance Logic)\0"
+	"Siemens Information and Communication Products\0"
+	"Actiontec Electronics, Inc.\0"
+	"ZD Incorporated\0"
+	"Minolta Co., Ltd\0"
+	"Pertech, Inc.\0"
+	"Potrans International, Inc.\0"
+	"CH Products, Inc.\0"
+	"Golden Bridge Electech, Inc.\0"
+	"Hagiwara Sys-Com Co., Ltd\0"
+	"Lego Group\0"
+	"Chuntex (CTX)\0"
+	"Tektronix, Inc.\0"
+	"Askey Computer Corp.\0"
+	"Thomson, Inc.\0"
+	"Hughes Network Systems (HNS)\0"
+	"Welcat Inc.\0"
+	"Allied Data Technologies BV\0"
+	"Topro Technology, Inc.\0"
+	"Saitek PLC\0"
+	"Xiamen Doowell Electron Co., Ltd\0"
+	"Divio\0"
+	"MicroStore, Inc.\0"
+	"Topaz Systems, Inc.\0"
+	"Westell\0"
+	"Sysgration, Ltd\0"
+	"Fujitsu Laboratories of America, Inc.\0"
+	"Greatland Electronics Taiwan, Ltd\0"
+	"Professional Multimedia Testing Centre\0"
+	"Harting, Inc. of North America\0"
+	"Pixela Corp.\0"
+	"Alcatel Telecom\0"
+	"Smooth Cord & Connector Co., Ltd\0"
+	"EDA, Inc.\0"
+	"Oki Data Corp.\0"
+	"AGFA-Gevaert NV\0"
+	"AME Optimedia Technology Co., Ltd\0"
+	"Leoco Corp.\0"
+	"Phidgets Inc. (formerly GLAB)\0"
+	"Bizlink International Corp.\0"
+	"Hagenuk, GmbH\0"
+	"Infowave Software, Inc.\0"
+	"SIIG, Inc.\0"
+	"Taxan (Europe), Ltd\0"
+	"Newer Technology, Inc.\0"
+	"Synaptics, Inc.\0"
+	"Terayon Communication Systems\0"
+	"Keyspan\0"
+	"Contec\0"
+	"SpheronVR AG\0"
+	"LapLink, Inc.\0"
+	"Mitsubishi Electric Corp.\0"
+	"Cisco Systems\0"
+	"Toshiba\0"
+	"Aashima Technology B.V.\0"
+	"Network Computing Devices (NCD)\0"
+	"Technical Marketing Research, Inc.\0"
+	"Phoenixtec Power Co., Ltd\0"
+	"Paradyne\0"
+	"Foxlink Image Technology Co., Ltd\0"
+	"Heisei Electronics Co., Ltd\0"
+	"Multi-Tech Systems, Inc.\0"
+	"ADS Technologies, Inc.\0"
+	"Alcatel Microelectronics\0"
+	"Tiger Jet Network, Inc.\0"
+	"Sirius Technologies\0"
+	"PC Expert Tech. Co., Ltd\0"
+	"I.A.C. Geometrische Ingenieurs B.V.\0"
+	"T.N.C Industrial Co., Ltd\0"
+	"Opcode Systems, Inc.\0"
+	"Emine Technology Co.\0"
+	"Wintrend Technology Co., Ltd\0"
+	"Wailly Technology Ltd\0"
+	"Guillemot Corp.\0"
+	"ASYST electronic d.o.o.\0"
+	"HSD S.r.L\0"
+	"Motorola Semiconductor Products Sector\0"
+	"Boston Acoustics\0"
+	"Gallant Computer, Inc.\0"
+	"Supercomal Wire & Cable SDN. BHD.\0"
+	"Bvtech Industry, Inc.\0"
+	"NKK Corp.\0"
+	"Ariel Corp.\0"
+	"Putercom Co., Ltd\0"
+	"Silicon Systems, Ltd (SSL)\0"
+	"Oki Electric Industry Co., Ltd\0"
+	"Comoss Electronic Co., Ltd\0"
+	"Excel Cell Electronic Co., Ltd\0"
+	"Connect Tech, Inc.\0"
+	"Magic Control Technology Corp.\0"
+	"Interval Research Corp.\0"
+	"NewMotion, Inc.\0"
+	"ZNK Corp.\0"
+	"Imation Corp.\0"
+	"Tremon Enterprises Co., Ltd\0"
+	"Domain Technologies, Inc.\0"
+	"Xionics Document Technologies, Inc.\0"
+	"Eicon Networks Corp.\0"
+	"Ariston Technologies\0"
+	"Keyence Corp.\0"
+	"Centillium Communications Corp.\0"
+	"Vanguard International Semiconductor-America\0"
+	"Amitm\0"
+	"Sunix Co., Ltd\0"
+	"Advanced Card Systems, Ltd\0"
+	"Susteen, Inc.\0"
+	"Goldfull Electronics & Telecommunications Corp.\0"
+	"ViewQuest Technologies, Inc.\0"
+	"Lasat Communications A/S\0"
+	"Asuscom Network\0"
+	"Lorom Industrial Co., Ltd\0"
+	"Mad Catz, Inc.\0"
+	"Chaplet Systems, Inc.\0"
+	"Suncom Technologies\0"
+	"Industrial Electronic Engineers, Inc.\0"
+	"Eutron S.p.a.\0"
+	"NEC, Inc.\0"
+	"Stollmann\0"
+	"Syntech Information Co., Ltd\0"
+	"Onkyo Corp.\0"
+	"Labway Corp.\0"
+	"Strong Man Enterprise Co., Ltd\0"
+	"EVer Electronics Corp.\0"
+	"Ming Fortune Industry Co., Ltd\0"
+	"Polestar Tech. Corp.\0"
+	"C-C-C Group PLC\0"
+	"Micronas GmbH\0"
+	"Digital Stream Corp.\0"
+	"Aureal Semiconductor\0"
+	"Network Technologies, Inc.\0"
+	"Carl Zeiss Microscopy GmbH\0"
+	"Sophisticated Circuits, Inc.\0"
+	"M-Audio\0"
+	"Cyber Power System, Inc.\0"
+	"X-Rite, Inc.\0"
+	"Jess-Link Products Co., Ltd\0"
+	"Tokheim Corp.\0"
+	"Camtel Technology Corp.\0"
+	"Surecom Technology Corp.\0"
+	"Smart Technology Enablers, Inc.\0"
+	"OmniKey AG\0"
+	"Partner Tech\0"
+	"Denso Corp.\0"
+	"Kuan Tech Enterprise Co., Ltd\0"
+	"Jhen Vei Electronic Co., Ltd\0"
+	"Welch Allyn, Inc - Medical Division\0",
+	"Observator Instruments BV\0"
+	"Your data Our Care\0"
+	"AmTRAN Technology Co., Ltd\0"
+	"Longshine Electronics Corp.\0"
+	"Inalways Corp.\0"
+	"Comda Enterprise Corp.\0"
+	"Volex, Inc.\0"
+	"Fairchild Semiconductor\0"
+	"Sankyo Seiki Mfg. Co., Ltd\0"
+	"Linksys\0"
+	"Forward Electronics Co., Ltd\0"
+	"Griffin Technology\0"
+	"Well Excellent & Most Corp.\0"
+	"Sagem Monetel GmbH\0"
+	"SanDisk Corp.\0"
+	"Trackerball\0"
+	"C3PO\0"
+	"Vivitar, Inc.\0"
+	"NTT-ME\0"
+	"Logitec Corp.\0"
+	"Happ Controls, Inc.\0"
+	"GTCO/CalComp\0"
+	"Brincom, Inc.\0"
+	"Pro-Image Manufacturing Co., Ltd\0"
+	"Copartner Wire and Cable Mfg. Corp.\0"
+	"Axis Communications AB\0"
+	"Wha Yu Industrial Co., Ltd\0"
+	"ABL Electronics Corp.\0"
+	"RealChip, Inc.\0"
+	"Certicom Corp.\0"
+	"Grandtech Semiconductor Corp.\0"
+	"Optelec\0"
+	"Altera\0"
+	"Sagem\0"
+	"Alfadata Computer Corp.\0"
+	"Digicom S.p.A.\0"
+	"National Technical Systems\0"
+	"Onnto Corp.\0"
+	"Be, Inc.\0"
+	"ADMtek, Inc.\0"
+	"Corega K.K.\0"
+	"Freecom Technologies\0"
+	"Microtech\0"
+	"Trust Technologies\0"
+	"IMP, Inc.\0"
+	"Motorola BCS, Inc.\0"
+	"Plustek, Inc.\0"
+	"Olympus Optical Co., Ltd\0"
+	"Mega World International, Ltd\0"
+	"Marubun Corp.\0"
+	"TIME Interconnect, Ltd\0"
+	"AboCom Systems Inc\0"
+	"Canon Computer Systems, Inc.\0"
+	"Webgear, Inc.\0"
+	"Veridicom\0"
+	"Code Mercenaries Hard- und Software GmbH\0"
+	"Keisokugiken\0"
+	"Datafab Systems, Inc.\0"
+	"APG Cash Drawer\0"
+	"ShareWave, Inc.\0"
+	"Powertech Industrial Co., Ltd\0"
+	"B.U.G., Inc.\0"
+	"Allied Telesyn International\0"
+	"AVerMedia Technologies, Inc.\0"
+	"Kingmax Technology, Inc.\0"
+	"Carry Computer Eng., Co., Ltd\0"
+	"Elektor\0"
+	"Casio Computer Co., Ltd\0"
+	"Dazzle\0"
+	"D-Link System\0"
+	"Aptio Products, Inc.\0"
+	"Cyberdata Corp.\0"
+	"Radiant Systems\0"
+	"GCC Technologies, Inc.\0"
+	"Arasan Chip Systems\0"
+	"Diamond Multimedia\0"
+	"David Electronics Co., Ltd\0"
+	"NCP engineering GmbH\0"
+	"Ambient Technologies, Inc.\0"
+	"Elmeg GmbH & Co., Ltd\0"
+	"Planex Communications, Inc.\0"
+	"Movado Enterprise Co., Ltd\0"
+	"QPS, Inc.\0"
+	"Allied Cable Corp.\0"
+	"Mirvo Toys, Inc.\0"
+	"Labsystems\0"
+	"Iwatsu Electric Co., Ltd\0"
+	"Double-H Technology Co., Ltd\0"
+	"Taiyo Electric Wire & Cable Co., Ltd\0"
+	"Torex Retail (formerly Logware)\0"
+	"STSN\0"
+	"Microcomputer Applications, Inc.\0"
+	"Circuit Assembly Corp.\0"
+	"Century Corp.\0"
+	"Dotop Technology, Inc.\0"
+	"Thomann\0"
+	"Mark of the Unicorn\0"
+	"MagTek\0"
+	"Mako Technologies, LLC\0"
+	"Zoom Telephonics, Inc.\0"
+	"Genicom Technology, Inc.\0"
+	"Evermuch Technology Co., Ltd\0"
+	"Cross Match Technologies\0"
+	"Datalogic S.p.A.\0"
+	"Teco Image Systems Co., Ltd\0"
+	"Personal Communication Systems, Inc.\0"
+	"Mattel, Inc.\0"
+	"eLicenser\0"
+	"MG Logic\0"
+	"Indigita Corp.\0"
+	"Mipsys\0"
+	"AlphaSmart, Inc.\0"
+	"Reudo Corp.\0"
+	"GC Protronics\0"
+	"Data Transit\0"
+	"BroadLogic, Inc.\0"
+	"Sato Corp.\0"
+	"DirecTV Broadband, Inc. (Telocity)\0"
+	"Handspring\0"
+	"Palm, Inc.\0"
+	"Kouwell Electronics Corp.\0"
+	"Sourcenext Corp.\0"
+	"Action Star Enterprise Co., Ltd\0"
+	"TrekStor\0"
+	"Samsung Techwin Co., Ltd\0"
+	"Accton Technology Corp.\0"
+	"Global Village\0"
+	"Argosy Research, Inc.\0"
+	"Rioport.com, Inc.\0"
+	"Welland Industrial Co., Ltd\0"
+	"NetGear, Inc.\0"
+	"Minton Optic Industry Co., Inc.\0"
+	"KB Gear\0"
+	"Empeg\0"
+	"Fast Point Technologies, Inc.\0"
+	"Macronix International Co., Ltd\0"
+	"CSEM\0"
+	"Topre Corporation\0"
+	"ActiveWire, Inc.\0"
+	"B&B Electronics\0"
+	"Hitachi Maxell, Ltd\0"
+	"Minolta Systems Laboratory, Inc.\0"
+	"Xircom\0"
+	"ColorVision, Inc.\0"
+	"Teletrol Systems, Inc.\0"
+	"Filanet Corp.\0"
+	"Data Translation, Inc.\0"
+	"Emagic Soft- und Hardware GmbH\0"
+	"DeTeWe - Deutsche Telephonwerke AG & Co.\0"
+	"System TALKS, Inc.\0"
+	"MEC IMEX, Inc.\0"
+	"Metricom\0"
+	"SanDisk, Inc.\0"
+	"Xpeed, Inc.\0"
+	"A-Tec Subsystem, Inc.\0"
+	"Comtrol Corp.\0"
+	"Adesso/Kbtek America, Inc.\0"
+	"Jaton Corp.\0"
+	"Fujitsu Computer Products of America\0"
+	"QualCore Logic Inc.\0"
+	"APT Technologies, Inc.\0"
+	"Recording Industry Association of America (RIAA)\0"
+	"Boca Research, Inc.\0"
+	"XAC Automation Corp.\0"
+	"Hannstar Electronics Corp.\0"
+	"TechTools\0"
+	"MassWorks, Inc.\0"
+	"Swecoin AB\0"
+	"iLok\0"
+	"DioGraphy, Inc.\0"
+	"TSI Incorporated\0"
+	"Lauterbach\0"
+	"United Technologies Research Cntr.\0"
+	"Icron Technologies Corp.\0"
+	"NST Co., Ltd\0"
+	"Primex Aerospace Co.\0"
+	"e9, Inc.\0"
+	"Toshiba TEC\0"
+	"Andrea Electronics\0"
+	"CWAV Inc.\0"
+	"Macraigor Systems LLC\0"
+	"Macally (Mace Group, Inc.)\0"
+	"Metrohm\0"
+	"Sorenson Vision, Inc.\0"
+	"NATSU\0"
+	"J. Gordon Electronic Design, Inc.\0"
+	"RadioShack Corp. (Tandy)\0"
+	"Texas Instruments\0"
+	"Citizen Watch Co., Ltd\0"
+	"Precise Biometrics\0"
+	"Proxim, Inc.\0"
+	"Key Nice Enterprise Co., Ltd\0"
+	"2Wire, Inc.\0"
+	"Nippon Telegraph and Telephone Corp.\0"
+	"Aiptek International, Inc.\0"
+	"Jue Hsun Ind. Corp.\0"
+	"Long Well Electronics Corp.\0"
+	"Productivity Enhancement Products\0"
+	"smartBridges, Inc.\0"
+	"Virtual Ink\0"
+	"Fujitsu Siemens Computers\0"
+	"IXXAT Automation GmbH\0"
+	"Increment P Corp.\0"
+	"Billionton Systems, Inc.\0"
+	"?\0"
+	"Spyrus, Inc.\0"
+	"Olitec, Inc.\0"
+	"Pioneer Corp.\0"
+	"Litronic\0"
+	"Gemalto (was Gemplus)\0"
+	"Pan-International Wire & Cable\0"
+	"Integrated Memory Logic\0"
+	"Extended Systems, Inc.\0"
+	"Ericsson, Inc., Blue Ridge Labs\0"
+	"M-Systems Flash Disk Pioneers\0"
+	"MediaTek Inc.\0"
+	"CCSI/Hesso\0"
+	"Corex Technologies\0"
+	"CTI Electronics Corp.\0"
+	"Gotop Information Inc.\0"
+	"SysTec Co., Ltd\0"
+	"Logic 3 International, Ltd\0"
+	"Vernier\0"
+	"Keen Top International Enterprise Co., Ltd\0"
+	"Wipro Technologies\0"
+	"Caere\0"
+	"Socket Communications\0"
+	"Sicon Cable Technology Co., Ltd\0"
+	"Digianswer A/S\0"
+	"AuthenTec, Inc.\0"
+	"Pinnacle Systems, Inc.\0"
+	"VST Technologies\0"
+	"Faraday Technology Corp.\0"
+	"Siemens AG\0"
+	"Audio-Technica Corp.\0"
+	"Trumpion Microelectronics, Inc.\0"
+	"Neurosmith\0"
+	"Silicon Motion, Inc. - Taiwan (formerly Feiya Technology Corp.)\0"
+	"Multiport Computer Vertriebs GmbH\0"
+	"Shining Technology, Inc.\0"
+	"Fujitsu Devices, Inc.\0"
+	"Alation Systems, Inc.\0"
+	"Philips Speech Processing\0"
+	"Voquette, Inc.\0"
+	"GlobeSpan, Inc.\0"
+	"SmartDisk Corp.\0"
+	"Tiger Electronics\0"
+	"Garmin International\0"
+	"Echelon Co.\0"
+	"GoHubs, Inc.\0"
+	"Dymo-CoStar Corp.\0"
+	"IC Media Corp.\0"
+	"Xerox\0"
+	"Lakeview Research\0"
+	"Summus, Ltd\0"
+	"PLX Technology, Inc. (formerly Oxford Semiconductor, Ltd)\0"
+	"American Biometric Co.\0"
+	"Toshiba Information & Industrial Sys. And Services\0"
+	"Sena Technologies, Inc.\0"
+	"Northern Embedded Science/CAVNEX\0"
+	"Toshiba Corp.\0"
+	"Harmonic Data Systems, Ltd\0"
+	"Crescentec Corp.\0"
+	"Quantum Corp.\0"
+	"Spirent Communications\0"
+	"NuTesla\0"
+	"Lumberg, Inc.\0"
+	"Pixart Imaging, Inc.\0"
+	"Plextor Corp.\0"
+	"Intrepid Control Systems, Inc.\0"
+	"InnoSync, Inc.\0"
+	"J.S.T. Mfg. Co., Ltd\0"
+	"Olympia Telecom Vertriebs GmbH\0"
+	"Japan Storage Battery Co., Ltd\0"
+	"Photobit Corp.\0"
+	"i2Go.com, LLC\0"
+	"HCL Technologies India Private, Ltd\0"
+	"KORG, Inc.\0"
+	"Pasco Scientific\0"
+	"Kronauer music in digital\0"
+	"Linkup Systems Corp.\0"
+	"Cable Television Laboratories\0"
+	"Yano\0"
+	"Kingston Technology\0"
+	"RPM Systems Corp.\0"
+	"NVIDIA Corp.\0"
+	"BSquare Corp.\0"
+	"Agilent Technologies, Inc.\0"
+	"CompuLink Research, Inc.\0"
+	"Cologne Chip AG\0"
+	"Portsmith\0"
+	"Medialogic Corp.\0"
+	"K-Tec Electronics\0"
+	"Polycom, Inc.\0"
+	"BITRAN\0"
+	"Acer NeWeb Corp.\0"
+	"Catalyst Enterprises, Inc.\0"
+	"Feitian Technologies, Inc.\0"
+	"Gretag-Macbeth AG\0"
+	"Schlumberger\0"
+	"Datagraphix, a business unit of Anacomp\0"
+	"OL'E Communications, Inc.\0"
+	"Adirondack Wire & Cable\0"
+	"Lightsurf Technologies\0"
+	"Beckhoff GmbH\0"
+	"Jeilin Technology Corp., Ltd\0"
+	"Minds At Work LLC\0"
+	"Knudsen Engineering, Ltd\0"
+	"Marunix Co., Ltd\0"
+	"Rosun Technologies, Inc.\0"
+	"Biopac Systems Inc.\0"
+	"Barun Electronics Co., Ltd\0"
+	"Oak Technology, Ltd\0"
+	"Apricorn\0"
+	"cab Produkttechnik GmbH & Co KG\0"
+	"Matsushita Electric Works, Ltd.\0"
+	"Vitana Corp.\0"
+	"INDesign\0"
+	"Integrated Intellectual Property, Inc.\0"
+	"Kenwood TMI Corp.\0"
+	"Gemstar eBook Group, Ltd\0"
+	"Integrated Telecom Express, Inc.\0"
+	"Zippy Technology Corp.\0"
+	"Trimble Navigation, Ltd\0"
+	"PairGain Technologies\0"
+	"Contech Research, Inc.\0"
+	"VCON Telecommunications\0"
+	"Poinchips\0"
+	"Data Transmission Network Corp.\0"
+	"Lin Shiung Enterprise Co., Ltd\0"
+	"Smart Card Technologies Co., Ltd\0"
+	"Intersil Corp.\0"
+	"Japan Cash Machine Co., Ltd.\0"
+	"Tripp Lite\0"
+	"Franklin Electronic Publishers, Inc.\0"
+	"Altius Solutions, Inc.\0"
+	"MDS Telephone Systems\0"
+	"Celltrix Technology Co., Ltd\0"
+	"Grundig\0"
+	"MySmart.Com\0"
+	"Auerswald GmbH & Co. KG\0"
+	"Genpix Electronics, LLC\0"
+	"Arris Interactive LLC\0"
+	"Nisca Corp.\0"
+	"ActivCard, Inc.\0"
+	"ACTiSYS Corp.\0"
+	"Memory Corp.\0"
+	"BMC Messsysteme GmbH\0"
+	"FLIR Systems\0"
+	"Workbit Corp.\0"
+	"Psion Dacom Home Networks, Ltd\0"
+	"City Electronics, Ltd\0"
+	"Electronics Testing Center, Taiwan\0"
+	"NeoMagic, Inc.\0"
+	"Vreelin Engineering, Inc.\0"
+	"Com One\0"
+	"NovAtel Inc.\0"
+	"ELATEC\0"
+	"KRF Tech, Ltd\0"
+	"A4Tech Co., Ltd.\0"
+	"Measurement Computing Corp.\0"
+	"Aimex Corp.\0"
+	"Fellowes, Inc.\0"
+	"Addonics Technologies Corp.\0"
+	"Intellon Corp.\0"
+	"Jo-Dan International, Inc.\0"
+	"Silutia, Inc.\0"
+	"Real 3D, Inc.\0"
+	"AKAI  Professional M.I. Corp.\0"
+	"Chen-Source, Inc.\0"
+	"IM Networks, Inc.\0"
+	"Xitel\0"
+	"GoFlight, Inc.\0"
+	"AresCom\0"
+	"RocketChips, Inc.\0"
+	"Edu-Science (H.K.), Ltd\0"
+	"SoftConnex Technologies, Inc.\0"
+	"Bay Associates\0"
+	"Mtek Vision\0"
+	"Gain Technology Corp.\0"
+	"Liquid Audio\0"
+	"ViA, Inc.\0"
+	"Unknown Manufacturer\0"
+	"Ontrak Control Systems Inc.\0"
+	"Cybex Computer Products Co.\0"
+	"Servergy, Inc\0"
+	"Xentec, Inc.\0"
+	"Cambridge Silicon Radio, Ltd\0"
+	"Telebyte, Inc.\0"
+	"Spacelabs Medical, Inc.\0"
+	"Scalar Corp.\0"
+	"Trek Technology (S) PTE, Ltd\0"
+	"Pentax Corp.\0"
+	"Heidelberger Druckmaschinen AG\0"
+	"Hua Geng Technologies, Inc.\0"
+	"Medtronic Physio Control Corp.\0"
+	"Century Semiconductor USA, Inc.\0"
+	"Datacard Group\0"
+	"AK-Modul-Bus Computer GmbH\0"
+	"TG3 Electronics, Inc.\0"
+	"Radikal Technologies\0"
+	"Gilat Satellite Networks, Ltd\0"
+	"PentaMedia Co., Ltd\0"
+	"NTT DoCoMo, Inc.\0"
+	"Varo Vision\0"
+	"Swissonic AG\0"
+	"Boca Systems, Inc.\0"
+	"Davicom Semiconductor, Inc.\0"
+	"Hirose Electric\0"
+	"I/O Interconnect\0"
+	"Ploytec GmbH\0"
+	"Fujitsu Media Devices, Ltd\0"
+	"Computex Co., Ltd\0"
+	"Evolution Electronics, Ltd\0"
+	"Steinberg Soft-und Hardware GmbH\0"
+	"Litton Systems, Inc.\0"
+	"Mimaki Engineering Co., Ltd\0"
+	"Sony Electronics, Inc.\0"
+	"Jebsee Electronics Co., Ltd\0"
+	"Portable Peripheral Co., Ltd\0"
+	"Electronics For Imaging, Inc.\0"
+	"EAsics NV\0"
+	"Broadcom Corp.\0"
+	"Diatrend Corp.\0"
+	"Zebra\0"
+	"MPMan\0"
+	"ClearCube Technology\0"
+	"Medeli Electronics Co., Ltd\0"
+	"Comaide Corp.\0"
+	"Chroma ate, Inc.\0"
+	"Green House Co., Ltd\0"
+	"Integrated Circuit Systems, Inc.\0"
+	"UPS Manufacturing\0"
+	"Benwin\0"
+	"Core Technology, Inc.\0"
+	"International Game Technology\0"
+	"VIPColor Technologies USA, Inc.\0"
+	"Sanwa Denshi\0"
+	"Mackie Designs\0"
+	"NSTL, Inc.\0"
+	"Octagon Systems Corp.\0"
+	"Rexon Technology Corp., Ltd\0"
+	"Chesen Electronics Corp.\0"
+	"Syscan\0"
+	"NextComm, Inc.\0"
+	"Maui Innovative Peripherals\0"
+	"Idexx Labs\0"
+	"NITGen Co., Ltd\0"
+	"Aktiv\0"
+	"Picturetel\0"
+	"Japan Aviation Electronics Industry, Ltd\0"
+	"Candy Technology Co., Ltd\0"
+	"Globlink Technology, Inc.\0"
+	"EGO SYStems, Inc.\0"
+	"C Technologies AB\0"
+	"Intersense\0"
+	"Lava Computer Mfg., Inc.\0"
+	"Develco Elektronik\0"
+	"First International Digital\0"
+	"Perception Digital, Ltd\0"
+	"Wincor Nixdorf International GmbH\0"
+	"TriGem Computer, Inc.\0"
+	"Baromtec Co.\0"
+	"Japan CBM Corp.\0"
+	"Vision Shape Europe SA\0"
+	"iCompression, Inc.\0"
+	"Rohde & Schwarz GmbH & Co. KG\0"
+	"NEC infrontia Corp. (Nitsuko)\0"
+	"Digitalway Co., Ltd\0"
+	"Arrow Strong Electronics Co., Ltd\0"
+	"FEIG ELECTRONIC GmbH\0"
+	"Ellisys\0"
+	"Stereo-Link\0"
+	"Diolan\0"
+	"Sanyo Semiconductor Company Micro\0"
+	"Leco Corp.\0"
+	"I & C Corp.\0"
+	"Singing Electrons, Inc.\0"
+	"Panwest Corp.\0"
+	"Z-Star Microelectronics Corp.\0"
+	"Micro Solutions, Inc.\0"
+	"OPEN Networks Ltd\0"
+	"Koga Electronics Co.\0"
+	"ID Tech\0"
+	"ZyDAS\0"
+	"Intoto, Inc.\0"
+	"Intellix Corp.\0"
+	"Remotec Technology, Ltd\0"
+	"Service & Quality Technology Co., Ltd\0"
+	"Data Encryption Systems Ltd.\0"
+	"Allion Computer, Inc.\0"
+	"Taito Corp.\0"
+	"Neodym Systems, Inc.\0"
+	"System Support Co., Ltd\0"
+	"North Shore Circuit Design L.L.P.\0"
+	"SciEssence, LLC\0"
+	"TTP Communications, Ltd\0"
+	"Neodio Technologies Corp.\0"
+	"Option\0"
+	"Silver I Co., Ltd\0"
+	"B2C2, Inc.\0"
+	"Hama, Inc.\0"
+	"DMC Co., Ltd.\0"
+	"Zaptronix Ltd\0"
+	"Tateno Dennou, Inc.\0"
+	"Cummins Engine Co.\0"
+	"Jump Zone Network Products, Inc.\0"
+	"INGENICO\0"
+	"ASUSTek Computer, Inc.\0"
+	"Datamax-O'Neil\0"
+	"Todos AB\0"
+	"ProjectLab\0"
+	"GN Netcom\0"
+	"AVID Technology\0"
+	"Pcally\0"
+	"I Tech Solutions Co., Ltd\0"
+	"Electronic Warfare Assoc., Inc. (EWA)\0"
+	"Insyde Software Corp.\0"
+	"TransDimension, Inc.\0"
+	"Yokogawa Electric Corp.\0"
+	"Japan System Development Co., Ltd\0"
+	"Pan-Asia Electronics Co., Ltd\0"
+	"Link Evolution Corp.\0"
+	"Ritek Corp.\0"
+	"Kenwood Corp.\0"
+	"Village Center, Inc.\0"
+	"PNY Technologies, Inc.\0"
+	"Contour Design, Inc.\0"
+	"Hitachi ULSI Systems Co., Ltd\0"
+	"Gear Head\0"
+	"Omnidirectional Control Technology, Inc.\0"
+	"IPaxess\0"
+	"Tekram Technology Co., Ltd\0"
+	"Olivetti Techcenter\0"
+	"Kikusui Electronics Corp.\0"
+	"Hal Corp.\0"
+	"Play.com, Inc.\0"
+	"Sportbug.com, Inc.\0"
+	"TechnoTrend AG\0"
+	"ASCII Corp.\0"
+	"Pine Corp. Ltd.\0"
+	"Graphtec America, Inc.\0"
+	"Musical Electronics, Ltd\0"
+	"Dumpries Co., Ltd\0"
+	"Comfort Keyboard Co.\0"
+	"Colorado MicroDisplay, Inc.\0"
+	"Sinbon Electronics Co., Ltd\0"
+	"TYI Systems, Ltd\0"
+	"Beijing HanwangTechnology Co., Ltd\0"
+	"Lake Communications, Ltd\0"
+	"Corel Corp.\0"
+	"Green Electronics Co., Ltd\0"
+	"Nsine, Ltd\0"
+	"NEC Viewtechnology, Ltd\0"
+	"Orange Micro, Inc.\0"
+	"ADLink Technology, Inc.\0"
+	"Wonderful Wire Cable Co., Ltd\0"
+	"Expert Magnetics Corp.\0"
+	"Cybiko Inc.\0"
+	"Fairbanks Scales\0"
+	"CacheVision\0"
+	"Maxim Integrated Products\0"
+	"Nagano Japan Radio Co., Ltd\0"
+	"PortalPlayer, Inc.\0"
+	"SHIN-EI Sangyo Co., Ltd\0"
+	"Embedded Wireless Technology Co., Ltd\0"
+	"Computone Corp.\0"
+	"Roland DG Corp.\0"
+	"Sunrise Telecom, Inc.\0"
+	"Zeevo, Inc.\0"
+	"Taiko Denki Co., Ltd\0"
+	"ITRAN Communications, Ltd\0"
+	"Astrodesign, Inc.\0"
+	"id3 Technologies\0"
+	"Rextron Technology, Inc.\0"
+	"Elkat Electronics, Sdn., Bhd.\0"
+	"Exputer Systems, Inc.\0"
+	"Plus-One I & T, Inc.\0"
+	"Sigma Koki Co., Ltd, Technology Center\0"
+	"Advanced Digital Broadcast, Ltd\0"
+	"SMART Technologies Inc.\0"
+	"ASIX Electronics Corp.\0"
+	"Sewon Telecom\0"
+	"O2 Micro, Inc.\0"
+	"Playmates Toys, Inc.\0"
+	"Audio International, Inc.\0"
+	"Dipl.-Ing. Stefan Kunde\0"
+	"Softprotec Co.\0"
+	"Chippo Technologies\0"
+	"U.S. Robotics\0"
+	"Concord Camera Corp.\0"
+	"Infinilink Corp.\0"
+	"Ambit Microsystems Corp.\0"
+	"Ofuji Technology\0"
+	"HTC (High Tech Computer Corp.)\0"
+	"Murata Manufacturing Co., Ltd\0"
+	"Network Alchemy\0"
+	"Joytech Computer Co., Ltd\0"
+	"Hitachi Semiconductor and Devices Sales Co., Ltd\0"
+	"Eiger M&C Co., Ltd\0"
+	"ZAccess Systems\0"
+	"General Meters Corp.\0"
+	"Assistive Technology, Inc.\0"
+	"System Connection, Inc.\0"
+	"Knilink Technology, Inc.\0"
+	"Fuw Yng Electronics Co., Ltd\0"
+	"Seagate RSS LLC\0"
+	"IPWireless, Inc.\0"
+	"Microcube Corp.\0"
+	"JCN Co., Ltd\0"
+	"ExWAY, Inc.\0"
+	"X10 Wireless Technology, Inc.\0"
+	"Telmax Communications\0"
+	"ECI Telecom, Ltd\0"
+	"Startek Engineering, Inc.\0"
+	"Perfect Technic Enterprise Co., Ltd\0"
+	"Andrew Pargeter & Associates\0"
+	"Realtek Semiconductor Corp.\0"
+	"Ericsson Business Mobile Networks BV\0"
+	"Y Media Corp.\0"
+	"Orange PCS\0"
+	"Kanda Tsushin Kogyo Co., Ltd\0"
+	"TOYO Corp.\0"
+	"Elka International, Ltd\0"
+	"DOME imaging systems, Inc.\0"
+	"Dong Guan Humen Wonderful Wire Cable Factory\0"
+	"MEI\0"
+	"LTK Industries, Ltd\0"
+	"Way2Call Communications\0"
+	"Pace Micro Technology PLC\0"
+	"Intracom S.A.\0"
+	"Konexx\0"
+	"Addonics Technologies, Inc.\0"
+	"Sunny Giken, Inc.\0"
+	"Kvaser AB\0"
+	"FireFly Mouse Mat\0"
+	"MOTO Development Group, Inc.\0"
+	"Appian Graphics\0"
+	"Hasbro Games, Inc.\0"
+	"Infinite Data Storage, Ltd\0"
+	"Agate\0"
+	"Comjet Information System\0"
+	"Highpoint Technologies, Inc.\0"
+	"Dura Micro, Inc. (Acomdata)\0"
+	"Zeroplus\0"
+	"Iris Graphics\0"
+	"Gyration, Inc.\0"
+	"Cyberboard A/S\0"
+	"SynerTek Korea, Inc.\0"
+	"cyberPIXIE, Inc.\0"
+	"Silicon Motion, Inc.\0"
+	"MIPS Technologies\0"
+	"Hang Zhou Silan Electronics Co., Ltd\0"
+	"Tally Printer Corp.\0"
+	"Lernout + Hauspie\0"
+	"Taiyo Yuden\0"
+	"Sampo Corp.\0"
+	"Prolific Technology Inc.\0"
+	"RFIDeas, Inc\0"
+	"Metrologic Instruments\0"
+	"Mutoh Industries Ltd\0"
+	"Eagletron, Inc.\0"
+	"E Ink Corp.\0"
+	"e.Digital\0"
+	"Der An Electric Wire & Cable Co., Ltd\0"
+	"IFR\0"
+	"Furui Precise Component (Kunshan) Co., Ltd\0"
+	"Komatsu, Ltd\0"
+	"Radius Co., Ltd\0"
+	"Innocom, Inc.\0"
+	"Nextcell, Inc.\0"
+	"Motorola iDEN\0"
+	"Microdia\0"
+	"WaveRider Communications, Inc.\0"
+	"ALGE-TIMING GmbH\0"
+	"Reiner SCT Kartensysteme GmbH\0"
+	"Needham's Electronics\0"
+	"Sealevel Systems, Inc.\0"
+	"ViewPLUS, Inc.\0"
+	"Glory, Ltd\0"
+	"Spectrum Digital, Inc.\0"
+	"Billion Bright, Ltd\0"
+	"Imaginative Design Operation Co., Ltd\0"
+	"Vidar Systems Corp.\0"
+	"Dong Guan Shinko Wire Co., Ltd\0"
+	"TRS International Mfg., Inc.\0"
+	"Xytronix Research & Design\0"
+	"Apogee Electronics Corp.\0"
+	"Chant Sincere Co., Ltd\0"
+	"Toko, Inc.\0"
+	"Signality System Engineering Co., Ltd\0"
+	"Eminence Enterprise Co., Ltd\0"
+	"Rexon Electronics Corp.\0"
+	"Concept Telecom, Ltd\0"
+	"ACS\0"
+	"JETI Technische Instrumente GmbH\0"
+	"MCT Elektronikladen\0"
+	"PEAK System\0"
+	"Optronic Laboratories Inc.\0"
+	"JMTek, LLC.\0"
+	"Sipix Group, Ltd\0"
+	"Detto Corp.\0"
+	"NuConnex Technologies Pte., Ltd\0"
+	"Wing-Span Enterprise Co., Ltd\0"
+	"NDA Technologies, Inc.\0"
+	"Kyocera Wireless Corp.\0"
+	"Honda Tsushin Kogyo Co., Ltd\0"
+	"Pathway Connectivity, Inc.\0"
+	"Wavefly Corp.\0"
+	"Coactive Networks\0"
+	"Tempo\0"
+	"Cesscom Co., Ltd\0"
+	"Applied Microsystems\0"
+	"Cryptera\0"
+	"Berkshire Products, Inc.\0"
+	"Innochips Co., Ltd\0"
+	"Hanwool Robotics Corp.\0"
+	"Jobin Yvon, Inc.\0"
+	"SemTek\0"
+	"Zyfer\0"
+	"Sega Corp.\0"
+	"ST&T Instrument Corp.\0"
+	"BAE Systems Canada, Inc.\0"
+	"Castles Technology Co., Ltd\0"
+	"Information Systems Laboratories\0"
+	"Motorola CGISS\0"
+	"Ascom Business Systems, Ltd\0"
+	"Buslink\0"
+	"Flying Pig Systems\0"
+	"Innovonics, Inc.\0"
+	"Celestix Networks, Pte., Ltd\0"
+	"Singatron Enterprise Co., Ltd\0"
+	"Opticis Co., Ltd\0"
+	"Trust Electronic (Shanghai) Co., Ltd\0"
+	"Shanghai Darong Electronics Co., Ltd\0"
+	"Palmax Technology Co., Ltd\0"
+	"Pentel Co., Ltd (Electronics Equipment Div.)\0"
+	"Keryx Technologies, Inc.\0"
+	"Union Genius Computer Co., Ltd\0"
+	"Kuon Yi Industrial Corp.\0"
+	"Given Imaging, Ltd\0"
+	"Timex Corp.\0"
+	"Rimage Corp.\0"
+	"emsys GmbH\0"
+	"Sendo\0"
+	"Intermagic Corp.\0"
+	"Technotools Corp.\0"
+	"BroadMAX Technologies, Inc.\0"
+	"Amphenol\0"
+	"SKNet Co., Ltd\0"
+	"Domex Technology Corp.\0"
+	"TerraTec Electronic GmbH\0"
+	"Bang Olufsen\0"
+	"LabJack Corporation\0"
+	"Scheidt & Bachmann\0"
+	"NewChip S.r.l.\0"
+	"JS Digitech, Inc.\0"
+	"Hitachi Shin Din Cable, Ltd\0"
+	"Z-Com\0"
+	"Validation Technologies International\0"
+	"Pico Technology\0"
+	"e-Conn Electronic Co., Ltd\0"
+	"ENE Technology, Inc.\0"
+	"Qualcomm Atheros Communications\0"
+	"Fomtex Corp.\0"
+	"Cellink Co., Ltd\0"
+	"Compucable Corp.\0"
+	"ishoni Networks\0"
+	"Clarisys, Inc.\0"
+	"Central System Research Co., Ltd\0"
+	"Inviso, Inc.\0"
+	"Minolta-QMS, Inc.\0"
+	"SAFA MEDIA Co., Ltd.\0"
+	"telos EDV Systementwicklung GmbH\0"
+	"UTStarcom\0"
+	"Contemporary Controls\0"
+	"Astron Electronics Co., Ltd\0"
+	"MKNet Corp.\0"
+	"Hybrid Networks, Inc.\0"
+	"Feng Shin Cable Co., Ltd\0"
+	"Elastic Networks\0"
+	"Maspro Denkoh Corp.\0"
+	"Hansol Electronics, Inc.\0"
+	"BMF Corp.\0"
+	"Array Comm, Inc.\0"
+	"OnStream b.v.\0"
+	"Hi-Touch Imaging Technologies Co., Ltd\0"
+	"NALTEC, Inc.\0"
+	"coaXmedia\0"
+	"Hank Connection Industrial Co., Ltd\0"
+	"NXP\0"
+	"Leo Hui Electric Wire & Cable Co., Ltd\0"
+	"AirSpeak, Inc.\0"
+	"Rearden Steel Technologies\0"
+	"Dah Kun Co., Ltd\0"
+	"Posiflex Technologies, Inc.\0"
+	"Sri Cable Technology, Ltd\0"
+	"Tangtop Technology Co., Ltd\0"
+	"Fitcom, inc.\0"
+	"MTS Systems Corp.\0"
+	"Ascor, Inc.\0",
+	"Ta Yun Terminals Industrial Co., Ltd\0"
+	"Full Der Co., Ltd\0"
+	"Kobil Systems GmbH\0"
+	"Promethean Limited\0"
+	"Maxtor\0"
+	"NF Corp.\0"
+	"Grape Systems, Inc.\0"
+	"Tedas AG\0"
+	"Coherent, Inc.\0"
+	"Agere Systems Netherland BV\0"
+	"EADS Airbus France\0"
+	"Cleware GmbH\0"
+	"Volex (Asia) Pte., Ltd\0"
+	"HMI Co., Ltd\0"
+	"Holon Corp.\0"
+	"ASKA Technologies, Inc.\0"
+	"AVLAB Technology, Inc.\0"
+	"Solomon Microtech, Ltd\0"
+	"SMC Networks, Inc.\0"
+	"Myacom, Ltd\0"
+	"CSI, Inc.\0"
+	"IVL Technologies, Ltd\0"
+	"Meilu Electronics (Shenzhen) Co., Ltd\0"
+	"Darfon Electronics Corp.\0"
+	"Fritz Gegauf AG\0"
+	"DXG Technology Corp.\0"
+	"KMJP Co., Ltd\0"
+	"TMT\0"
+	"Advanet, Inc.\0"
+	"Super Link Electronics Co., Ltd\0"
+	"NSI\0"
+	"Megapower International Corp.\0"
+	"And-Or Logic\0"
+	"Try Computer Co., Ltd\0"
+	"Hirakawa Hewtech Corp.\0"
+	"Winmate Communication, Inc.\0"
+	"Hit's Communications, Inc.\0"
+	"MFP Korea, Inc.\0"
+	"Power Sentry/Newpoint\0"
+	"Japan Distributor Corp.\0"
+	"MARX Datentechnik GmbH\0"
+	"Wellco Technology Co., Ltd\0"
+	"Taiwan Line Tek Electronic Co., Ltd\0"
+	"Phison Electronics Corp.\0"
+	"American Computer & Digital Components\0"
+	"Essential Reality LLC\0"
+	"H.R. Silvine Electronics, Inc.\0"
+	"TechnoVision\0"
+	"Think Outside, Inc.\0"
+	"Dolby Laboratories Inc.\0"
+	"Oz Software\0"
+	"King Jim Co., Ltd\0"
+	"Ascom Telecommunications, Ltd\0"
+	"C-Media Electronics, Inc.\0"
+	"Promotion & Display Technology, Ltd\0"
+	"Global Sun Technology, Inc.\0"
+	"Pitney Bowes\0"
+	"Sure-Fire Electrical Corp.\0"
+	"Skanhex Technology, Inc.\0"
+	"Santa Barbara Instrument Group\0"
+	"Mars Semiconductor Corp.\0"
+	"Trazer Technologies, Inc.\0"
+	"RTX AS\0"
+	"Tat Shing Electrical Co.\0"
+	"Chee Chen Hi-Technology Co., Ltd\0"
+	"Sanwa Supply, Inc.\0"
+	"Avaya\0"
+	"Powercom Co., Ltd\0"
+	"Danger Research\0"
+	"Suzhou Peter's Precise Industrial Co., Ltd\0"
+	"Land Instruments International, Ltd\0"
+	"Nippon Electro-Sensory Devices Corp.\0"
+	"Polar Electro Oy\0"
+	"IOGear, Inc.\0"
+	"softDSP Co., Ltd\0"
+	"Cubig Group\0"
+	"Westover Scientific\0"
+	"Micro Star International\0"
+	"Wen Te Electronics Co., Ltd\0"
+	"Shian Hwi Plug Parts, Plastic Factory\0"
+	"Chung Fu Chen Yeh Enterprise Corp.\0"
+	"Access IS\0"
+	"ELCON Systemtechnik\0"
+	"Digidesign\0"
+	"A&D Medical\0"
+	"Jiuh Shiuh Precision Industry Co., Ltd\0"
+	"Jess-Link International\0"
+	"G7 Solutions (formerly Great Notions)\0"
+	"Tamagawa Seiki Co., Ltd\0"
+	"Athena Smartcard Solutions, Inc.\0"
+	"inXtron, Inc.\0"
+	"SDK Co., Ltd\0"
+	"Precision Squared Technology Corp.\0"
+	"First Cable Line, Inc.\0"
+	"NetworkFab Corp.\0"
+	"Access Solutions\0"
+	"Contek Electronics Co., Ltd\0"
+	"Power Quotient International Co., Ltd\0"
+	"MediaQ\0"
+	"Custom Engineering SPA\0"
+	"California Micro Devices\0"
+	"Kocom Co., Ltd\0"
+	"Netac Technology Co., Ltd\0"
+	"HighSpeed Surfing\0"
+	"Integrated Circuit Solution, Inc.\0"
+	"Tamarack, Inc.\0"
+	"Datelink Technology Co., Ltd\0"
+	"Ubicom, Inc.\0"
+	"BD Consumer Healthcare\0"
+	"USBmicro\0"
+	"UTECH Electronic (D.G.) Co., Ltd.\0"
+	"Novasonics\0"
+	"Lifetime Memory Products\0"
+	"Full Rise Electronic Co., Ltd\0"
+	"NET&SYS\0"
+	"Sitecom Europe B.V.\0"
+	"Mobile Action Technology, Inc.\0"
+	"Toyo Communication Equipment Co., Ltd\0"
+	"GeneralTouch Technology Co., Ltd\0"
+	"Nippon Systemware Co., Ltd\0"
+	"Winbest Technology Co., Ltd\0"
+	"Amigo Technology Inc.\0"
+	"Gesytec\0"
+	"PicoQuant GmbH\0"
+	"VMware, Inc.\0"
+	"JMTek, LLC\0"
+	"Walex Electronic, Ltd\0"
+	"Unisys\0"
+	"Crewave\0"
+	"Pegasus Technologies Ltd.\0"
+	"Cowon Systems, Inc.\0"
+	"Symbian Ltd.\0"
+	"Liou Yuane Enterprise Co., Ltd\0"
+	"VinChip Systems, Inc.\0"
+	"J-Phone East Co., Ltd\0"
+	"HeartMath LLC\0"
+	"Micro Computer Control Corp.\0"
+	"3Pea Technologies, Inc.\0"
+	"TiePie engineering\0"
+	"Stratitec, Inc.\0"
+	"Smart Modular Technologies, Inc.\0"
+	"Neostar Technology Co., Ltd\0"
+	"Mansella, Ltd\0"
+	"Line6, Inc.\0"
+	"Sun-Riseful Technology Co., Ltd.\0"
+	"Julia Corp., Ltd\0"
+	"Shenzhen Bao Hing Electric Wire & Cable Mfr. Co.\0"
+	"Radica Games, Ltd\0"
+	"TechnoData Interware\0"
+	"Speed Dragon Multimedia, Ltd\0"
+	"Kingston Technology Company, Inc.\0"
+	"Active Co., Ltd\0"
+	"Union Power Information Industrial Co., Ltd\0"
+	"Bitland Information Technology Co., Ltd\0"
+	"Neltron Industrial Co., Ltd\0"
+	"Conwise Technology Co., Ltd.\0"
+	"Hawking Technologies\0"
+	"Fossil, Inc.\0"
+	"Megawin Technology Co., Ltd\0"
+	"Logic3\0"
+	"Tokyo Electronic Industry Co., Ltd\0"
+	"Hsi-Chin Electronics Co., Ltd\0"
+	"TVS Electronics, Ltd\0"
+	"Archos, Inc.\0"
+	"On-Tech Industry Co., Ltd\0"
+	"Gmate, Inc.\0"
+	"Ching Tai Electric Wire & Cable Co., Ltd\0"
+	"Shin An Wire & Cable Co.\0"
+	"Well Force Electronic Co., Ltd\0"
+	"GreenAsia Inc.\0"
+	"WiebeTech, LLC\0"
+	"VTech Engineering Canada, Ltd\0"
+	"C's Glory Enterprise Co., Ltd\0"
+	"eM Technics Co., Ltd\0"
+	"Future Technology Co., Ltd\0"
+	"Aplux Communications, Ltd\0"
+	"Fingerworks, Inc.\0"
+	"Advanced Analogic Technologies, Inc.\0"
+	"Parallel Dice Co., Ltd\0"
+	"TA HSING Industries, Ltd\0"
+	"ADTEC Corp.\0"
+	"Streamzap, Inc.\0"
+	"Tamura Corp.\0"
+	"Ours Technology, Inc.\0"
+	"Nihon Computer Co., Ltd\0"
+	"MSL Enterprises Corp.\0"
+	"CenDyne, Inc.\0"
+	"Humax Co., Ltd\0"
+	"NovaTech\0"
+	"WIS Technologies, Inc.\0"
+	"Y-S Electronic Co., Ltd\0"
+	"Saint Technology Corp.\0"
+	"Endor AG\0"
+	"Mettler Toledo\0"
+	"Thermo Fisher Scientific\0"
+	"VWeb Corp.\0"
+	"Omega Technology of Taiwan, Inc.\0"
+	"LHI Technology (China) Co., Ltd\0"
+	"Abit Computer Corp.\0"
+	"Sweetray Industrial, Ltd\0"
+	"Axell Co., Ltd\0"
+	"Ballracing Developments, Ltd\0"
+	"GT Information System Co., Ltd\0"
+	"InnoVISION Multimedia, Ltd\0"
+	"Theta Link Corp.\0"
+	"Lite-On IT Corp.\0"
+	"TaiSol Electronics Co., Ltd\0"
+	"Phogenix Imaging, LLC\0"
+	"WinMaxGroup\0"
+	"Kyoto Micro Computer Co., Ltd\0"
+	"Wing-Tech Enterprise Co., Ltd\0"
+	"Fiberbyte\0"
+	"Noriake Itron Corp.\0"
+	"e-MDT Co., Ltd\0"
+	"Shima Seiki Mfg., Ltd\0"
+	"Sarotech Co., Ltd\0"
+	"AMI Semiconductor, Inc.\0"
+	"ComTrue Technology Corp.\0"
+	"Sunrich Technology, Ltd\0"
+	"Digital Stream Technology, Inc.\0"
+	"D-WAV Scientific Co., Ltd\0"
+	"Hitachi Cable, Ltd\0"
+	"Aichi Micro Intelligent Corp.\0"
+	"I/O Magic Corp.\0"
+	"Lynn Products, Inc.\0"
+	"DSI Datotech\0"
+	"PointChips\0"
+	"Yield Microelectronics Corp.\0"
+	"SM Tech Co., Ltd (Tulip)\0"
+	"Oasis Semiconductor\0"
+	"Wem Technology, Inc.\0"
+	"Unitek UPS Systems\0"
+	"Visual Frontier Enterprise Co., Ltd\0"
+	"CSL Wire & Plug (Shen Zhen) Co.\0"
+	"CAS Corp.\0"
+	"Hori Co., Ltd\0"
+	"Energy Full Corp.\0"
+	"Silego Technology Inc\0"
+	"LD Didactic GmbH\0"
+	"Mars Engineering Corp.\0"
+	"Acetek Technology Co., Ltd\0"
+	"Ingenico\0"
+	"Finger Lakes Instrumentation\0"
+	"Oracom Co., Ltd\0"
+	"Onset Computer Corp.\0"
+	"Funai Electric Co., Ltd\0"
+	"Iwill Corp.\0"
+	"IOI Technology Corp.\0"
+	"Senior Industries, Inc.\0"
+	"Leader Tech Manufacturer Co., Ltd\0"
+	"Flex-P Industries, Snd., Bhd.\0"
+	"ViPower, Inc.\0"
+	"Geniality Maple Technology Co., Ltd\0"
+	"Priva Design Services\0"
+	"Jess Technology Co., Ltd\0"
+	"Chrysalis Development\0"
+	"YFC-BonEagle Electric Co., Ltd\0"
+	"Kokuyo Co., Ltd\0"
+	"Nien-Yi Industrial Corp.\0"
+	"TG3 Electronics\0"
+	"Airprime, Incorporated\0"
+	"RDC Semiconductor Co., Ltd\0"
+	"Nital Consulting Services, Inc.\0"
+	"Polhemus\0"
+	"St. John Technology Co., Ltd\0"
+	"WorldWide Cable Opto Corp.\0"
+	"Microtune, Inc.\0"
+	"Freedom Scientific\0"
+	"Wing Key Electrical Co., Ltd\0"
+	"Dongguan White Horse Cable Factory, Ltd\0"
+	"Kawai Musical Instruments Mfg. Co., Ltd\0"
+	"AmbiCom, Inc.\0"
+	"Prairiecomm, Inc.\0"
+	"NewAge International, LLC\0"
+	"Key Technology Corp.\0"
+	"NTK, Ltd\0"
+	"Varian, Inc.\0"
+	"Acrox Technologies Co., Ltd\0"
+	"LeapFrog Enterprises\0"
+	"Kobe Steel, Ltd\0"
+	"Dionex Corp.\0"
+	"Vibren Technologies, Inc.\0"
+	"INTELLIGENT SYSTEMS\0"
+	"DFI\0"
+	"Guntermann & Drunck GmbH\0"
+	"DQ Technology, Inc.\0"
+	"NetBotz, Inc.\0"
+	"Fluke Corp.\0"
+	"VTech Holdings, Ltd\0"
+	"Yazaki Corp.\0"
+	"Young Generation International Corp.\0"
+	"Uniwill Computer Corp.\0"
+	"Kingnet Technology Co., Ltd\0"
+	"Soma Networks\0"
+	"CviLux Corp.\0"
+	"CyberBank Corp.\0"
+	"Hyun Won, Inc.\0"
+	"Lucent Technologies\0"
+	"Starconn Electronic Co., Ltd\0"
+	"ATL Technology\0"
+	"Sotec Co., Ltd\0"
+	"Epox Computer Co., Ltd\0"
+	"Logic Controls, Inc.\0"
+	"Winpoint Electronic Corp.\0"
+	"Haurtian Wire & Cable Co., Ltd\0"
+	"Inclose Design, Inc.\0"
+	"Juan-Chern Industrial Co., Ltd\0"
+	"Heber Ltd\0"
+	"Wistron Corp.\0"
+	"AACom Corp.\0"
+	"San Shing Electronics Co., Ltd\0"
+	"Bitwise Systems, Inc.\0"
+	"Mitac Internatinal Corp.\0"
+	"Plug and Jack Industrial, Inc.\0"
+	"Delcom Engineering\0"
+	"Dataplus Supplies, Inc.\0"
+	"Research In Motion, Ltd.\0"
+	"Sony Ericsson Mobile Communications AB\0"
+	"Dynastream Innovations, Inc.\0"
+	"Tulip Computers B.V.\0"
+	"Giant Electronics Ltd.\0"
+	"Seac Banche\0"
+	"Tenovis GmbH & Co., KG\0"
+	"Direct Access Technology, Inc.\0"
+	"Elgato Systems GmbH\0"
+	"Quantec Networks GmbH\0"
+	"Micro Plus\0"
+	"Oregon Scientific\0"
+	"Osterhout Design Group\0"
+	"Air Techniques\0"
+	"IN-Tech Electronics, Ltd\0"
+	"Greenconn (U.S.A.), Inc.\0"
+	"ICS Advent\0"
+	"DVICO\0"
+	"United Computer Accessories\0"
+	"CRS Electronic Co., Ltd\0"
+	"UMC Electronics Co., Ltd\0"
+	"Access Co., Ltd\0"
+	"Xsido Corp.\0"
+	"MJ Research, Inc.\0"
+	"Core Valley Co., Ltd\0"
+	"CHI SHING Computer Accessories Co., Ltd\0"
+	"Clavia DMI AB\0"
+	"EarlySense\0"
+	"Aopen, Inc.\0"
+	"Speed Tech Corp.\0"
+	"Ritronics Components (S) Pte., Ltd\0"
+	"Sigma Corp.\0"
+	"LG Electronics, Inc.\0"
+	"Apacer Technology, Inc.\0"
+	"iRiver, Ltd.\0"
+	"Emuzed, Inc.\0"
+	"AV Chaseway, Ltd\0"
+	"Chou Chin Industrial Co., Ltd\0"
+	"Netopia, Inc.\0"
+	"Fukuda Denshi Co., Ltd\0"
+	"Mobile Media Tech.\0"
+	"SDKM Fibres, Wires & Cables Berhad\0"
+	"TST-Touchless Sensor Technology AG\0"
+	"Densitron Technologies PLC\0"
+	"Softronics Pty., Ltd\0"
+	"Xiamen Hung's Enterprise Co., Ltd\0"
+	"Speedy Industrial Supplies, Pte., Ltd\0"
+	"Elitegroup Computer Systems (ECS)\0"
+	"Labtec\0"
+	"Shinko Shoji Co., Ltd\0"
+	"Hyper-Paltek\0"
+	"Newly Corp.\0"
+	"Time Domain\0"
+	"Inovys Corp.\0"
+	"Atlantic Coast Telesys\0"
+	"Ramos Technology Co., Ltd\0"
+	"Infotronic America, Inc.\0"
+	"Etoms Electronics Corp.\0"
+	"Winic Corp.\0"
+	"Comax Technology, Inc.\0"
+	"C-One Technology Corp.\0"
+	"Nucam Corp.\0"
+	"SteelSeries ApS\0"
+	"devolo AG\0"
+	"PSA\0"
+	"Stanton\0"
+	"iCreate Technologies Corp.\0"
+	"Chu Yuen Enterprise Co., Ltd\0"
+	"Winbond Electronics Corp. [hex]\0"
+	"Targus Group International\0"
+	"Mylex / Buslogic\0"
+	"AMCO TEC International, Inc.\0"
+	"Newport Corporation\0"
+	"WB Electronics\0"
+	"Yubico.com\0"
+	"Immanuel Electronics Co., Ltd\0"
+	"BMS International Beheer N.V.\0"
+	"Complex Micro Interconnection Co., Ltd\0"
+	"Hsin Chen Ent Co., Ltd\0"
+	"ON Semiconductor\0"
+	"Western Digital Technologies, Inc.\0"
+	"Giesecke & Devrient GmbH\0"
+	"Foxconn International, Inc.\0"
+	"Hong Ji Electric Wire & Cable (Dongguan) Co., Ltd\0"
+	"Delkin Devices, Inc.\0"
+	"Valence Semiconductor Design, Ltd\0"
+	"Chin Shong Enterprise Co., Ltd\0"
+	"Easthome Industrial Co., Ltd\0"
+	"Motorola Electronics Taiwan, Ltd [hex]\0"
+	"CCYU Technology\0"
+	"Micropi Elettronica\0"
+	"Loyal Legend, Ltd\0"
+	"Curitel Communications, Inc.\0"
+	"San Chieh Manufacturing, Ltd\0"
+	"ConectL\0"
+	"Money Controls\0"
+	"GCT Semiconductor, Inc.\0"
+	"Arlec Australia, Ltd\0"
+	"Midoriya Electric Co., Ltd\0"
+	"KidzMouse, Inc.\0"
+	"Shin-Etsukaken Co., Ltd\0"
+	"Canon Electronics, Inc.\0"
+	"Pantech Co., Ltd\0"
+	"Chloride Power Protection\0"
+	"Grand-tek Technology Co., Ltd\0"
+	"Robert Bosch GmbH\0"
+	"Lotes Co., Ltd.\0"
+	"Numerik Jena\0"
+	"Surface Optics Corp.\0"
+	"DATASOFT Systems GmbH\0"
+	"Hisense\0"
+	"eSOL Co., Ltd\0"
+	"Hirotech, Inc.\0"
+	"Mitsubishi Materials Corp.\0"
+	"SK Teletech Co., Ltd\0"
+	"Cables To Go\0"
+	"USI Co., Ltd\0"
+	"Honeywell, Inc.\0"
+	"Princeton Technology Corp.\0"
+	"Liebert Corp.\0"
+	"Comodo (PLX?)\0"
+	"DiBcom\0"
+	"TM Technology, Inc.\0"
+	"Dinging Technology Co., Ltd\0"
+	"TMT Technology, Inc.\0"
+	"SmartHome\0"
+	"Universal Laser Systems, Inc.\0"
+	"Cygnal Integrated Products, Inc.\0"
+	"Sanei Electric, Inc.\0"
+	"Intec, Inc.\0"
+	"Eratech\0"
+	"GBM Connector Co., Ltd\0"
+	"Kycon, Inc.\0"
+	"Silicon Labs\0"
+	"Velleman Components, Inc.\0"
+	"Hottinger Baldwin Measurement\0"
+	"RayComposer - R. Adams\0"
+	"Man Boon Manufactory, Ltd\0"
+	"Uni Class Technology Co., Ltd\0"
+	"Actions Semiconductor Co., Ltd\0"
+	"Authenex, Inc.\0"
+	"In-Win Development, Inc.\0"
+	"Post-Op Video, Inc.\0"
+	"CablePlus, Ltd\0"
+	"Nada Electronics, Ltd\0"
+	"Vast Technologies, Inc.\0"
+	"Nexio Co., Ltd\0"
+	"Importek\0"
+	"Turtle Beach\0"
+	"Pictos Technologies, Inc.\0"
+	"Anubis Electronics, Ltd\0"
+	"Thrane & Thrane\0"
+	"VirTouch, Ltd\0"
+	"EasyPass Industrial Co., Ltd\0"
+	"Brightcom Technologies, Ltd\0"
+	"Moxa Technologies Co., Ltd.\0"
+	"Analog Devices Canada, Ltd (Allied Telesyn)\0"
+	"Pandora International Ltd.\0"
+	"YM ELECTRIC CO., Ltd\0"
+	"Medion AG\0"
+	"VSO Electric Co., Ltd\0"
+	"RedRat\0"
+	"Master Hill Electric Wire and Cable Co., Ltd\0"
+	"Cellon International, Inc.\0"
+	"Tenx Technology, Inc.\0"
+	"Integrated System Solution Corp.\0"
+	"Toshiba Corp., Digital Media Equipment [hex]\0"
+	"CTS Electronincs\0"
+	"Arin Tech Co., Ltd\0"
+	"Mapower Electronics Co., Ltd\0"
+	"Integrated Biometrics, LLC\0"
+	"V One Multimedia, Pte., Ltd\0"
+	"CyberScan Technologies, Inc.\0"
+	"Japan Radio Company\0"
+	"Shimane SANYO Electric Co., Ltd.\0"
+	"Ever Great Electric Wire and Cable Co., Ltd\0"
+	"Sphairon Access Systems GmbH\0"
+	"Tinius Olsen Testing Machine Co., Inc.\0"
+	"Alpha Imaging Technology Corp.\0"
+	"Wavecom\0"
+	"Salix Technology Co., Ltd.\0"
+	"Secugen Corp.\0"
+	"DeLorme Publishing, Inc.\0"
+	"YUAN High-Tech Development Co., Ltd\0"
+	"Telson Electronics Co., Ltd\0"
+	"Bantam Interactive Technologies\0"
+	"Salient Systems Corp.\0"
+	"BizConn International Corp.\0"
+	"Gigastorage Corp.\0"
+	"Silicon 10 Technology Corp.\0"
+	"Shengyih Steel Mold Co., Ltd\0"
+	"Santa Electronic, Inc.\0"
+	"JNC, Inc.\0"
+	"Venture Corp., Ltd\0"
+	"Compaq Computer Corp. [hex] (Digital Dream ?)\0"
+	"Kyocera Elco Corp.\0"
+	"Bloomberg L.P.\0"
+	"Acer Communications & Multimedia\0"
+	"You Yang Technology Co., Ltd\0"
+	"Tripace\0"
+	"Loyalty Founder Enterprise Co., Ltd\0"
+	"Yankee Robotics, LLC\0"
+	"Technoimagia Co., Ltd\0"
+	"StarShine Technology Corp.\0"
+	"Sierra Wireless, Inc.\0"
+	"ZHAN QI Technology Co., Ltd\0"
+	"ruwido austria GmbH\0"
+	"Chipcon AS\0"
+	"Technovas Co., Ltd\0"
+	"GlobalMedia Group, LLC\0"
+	"Exito Electronics Co., Ltd\0"
+	"Nike\0"
+	"ATECH FLASH TECHNOLOGY\0"
+	"R&D International NV\0"
+	"Betop\0"
+	"Inmax\0"
+	"VeriFone Inc\0"
+	"Topfield Co., Ltd.\0"
+	"K.I. Technology Co. Ltd.\0"
+	"Prolific\0"
+	"Alcatel (?)\0"
+	"TSC Auto ID Technology Co., Ltd\0"
+	"InterBiometrics\0"
+	"Hudson Soft Co., Ltd\0"
+	"Magellan\0"
+	"DigiTech\0"
+	"Jungsoft Co., Ltd\0"
+	"TC Electronic\0"
+	"Unknown manufacturer\0"
+	"SKYCABLE ENTERPRISE. CO., LTD.\0"
+	"Datapaq Limited\0"
+	"Chipidea-Microelectronica, S.A.\0"
+	"Denver Electronics\0"
+	"Brain Actuated Technologies\0"
+	"Focusrite-Novation\0"
+	"Belkin\0"
+	"AirVast\0"
+	"Nyko (Honey Bee)\0"
+	"MXI - Memory Experts International, Inc.\0"
+	"Apogee Inc.\0"
+	"A-DATA Technology Co., Ltd.\0"
+	"Covidien Energy-based Devices\0"
+	"Pirelli Broadband Solutions\0"
+	"Logic3 / SpectraVideo plc\0"
+	"Aristocrat Technologies\0"
+	"Bel Stewart\0"
+	"Strobe Data, Inc.\0"
+	"TwinMOS\0"
+	"Ensoniq\0"
+	"Xaxero Marine Software Engineering, Ltd.\0"
+	"Starlight Xpress\0"
+	"zebris Medical GmbH\0"
+	"Marvell Semiconductor, Inc.\0"
+	"Qualcomm Flarion Technologies, Inc. / Leadtek Research, Inc.\0"
+	"Innomedia\0"
+	"Belkin Components [hex]\0"
+	"RISO KAGAKU CORP.\0"
+	"DekTec\0"
+	"CyberTAN Technology\0"
+	"Trendchip Technologies Corp.\0"
+	"Honey Bee Electronic International Ltd.\0"
+	"Zhejiang Xinya Electronic Technology Co., Ltd.\0"
+	"E28\0"
+	"Licensed by Sony Computer Entertainment America\0"
+	"Gembird\0"
+	"Autocue Group Ltd\0"
+	"DEXIN\0"
+	"Huawei Technologies Co., Ltd.\0"
+	"LINE TECH INDUSTRIAL CO., LTD.\0"
+	"EMS Dr. Thomas Wuensche\0"
+	"BETTER WIRE FACTORY CO., LTD.\0"
+	"Araneus Information Systems Oy\0"
+	"Waldorf Music GmbH\0"
+	"Tapwave, Inc.\0"
+	"ViewPlus Technologies, Inc.\0"
+	"Dynamic System Electronics Corp.\0"
+	"Memorex Products, Inc.\0"
+	"AIN Comm. Technology Co., Ltd\0"
+	"Fascinating Electronics, Inc.\0"
+	"Transcend Information, Inc.\0"
+	"Roper\0"
+	"ICS Electronics\0"
+	"ThorLabs\0"
+	"Natural Point\0"
+	"ams AG\0"
+	"Envara Inc.\0"
+	"Konica Minolta\0"
+	"Kemper Digital GmbH\0"
+	"Mobility\0"
+	"Citizen Systems\0"
+	"Sino Lite Technology Corp.\0"
+	"Moravian Instruments\0"
+	"Katsuragawa Electric Co., Ltd.\0"
+	"PanJit International Inc.\0"
+	"Digby's Bitpile, Inc. DBA D Bit\0"
+	"P&E Microcomputer Systems\0"
+	"Control Development Inc.\0"
+	"SEGGER\0"
+	"STEC\0"
+	"Andor Technology Ltd.\0"
+	"Swissbit\0"
+	"CNet Technology Inc.\0"
+	"Vimtron Electronics Co., Ltd.\0"
+	"Sennheiser electronic GmbH & Co. KG\0"
+	"SCAPS GmbH\0"
+	"Netgear, Inc\0"
+	"Validity Sensors, Inc.\0"
+	"Jungo LTD\0"
+	"TOMTOM B.V.\0"
+	"IdealTEK, Inc.\0"
+	"Sennheiser Communications\0"
+	"BEHRINGER International GmbH\0"
+	"Q-tec\0"
+	"Baltech\0"
+	"PerkinElmer Optoelectronics\0"
+	"Alesis\0"
+	"Nippon Dics Co., Ltd.\0"
+	"PCPlay\0"
+	"Ricoh Printing Systems, Ltd.\0"
+	"JyeTai Precision Industrial Co., Ltd.\0"
+	"Wisair Ltd.\0"
+	"Techsan Electronics Co., Ltd.\0"
+	"A-Max Technology Macao Commercial Offshore Co. Ltd.\0"
+	"Shark Multimedia\0"
+	"IMC Networks\0"
+	"Guidance Software, Inc.\0"
+	"ALEREON, INC.\0"
+	"i.Tech Dynamic Limited\0"
+	"Kaibo Wire & Cable (Shenzhen) Co., Ltd.\0"
+	"Rane\0"
+	"TechnoScope Co., Ltd.\0"
+	"Hengstler\0"
+	"Zydacron\0"
+	"MosArt\0"
+	"Initio Corporation\0"
+	"Kingston Technology Company Inc.\0"
+	"Axxion Group Corp.\0"
+	"Bowe Bell & Howell\0"
+	"Sitronix\0"
+	"IDS Imaging Development Systems GmbH\0"
+	"Telechips, Inc.\0"
+	"Novatel Wireless\0"
+	"Nam Tai E&E Products Ltd. or OmniVision Technologies, Inc.\0"
+	"ABILITY ENTERPRISE CO., LTD.\0"
+	"Sensor Technology\0"
+	"Posnet Polska S.A.\0"
+	"Vega Technologies Industrial (Austria) Co.\0"
+	"Thales E-Transactions\0"
+	"Arbiter Systems, Inc.\0"
+	"RedOctane\0"
+	"Pertech Resources, Inc.\0"
+	"Wistron NeWeb\0"
+	"Denali Software, Inc.\0"
+	"Altek Corporation\0"
+	"Digilent\0"
+	"X.J.GROUP\0"
+	"Force Dimension\0"
+	"Dai Nippon Printing, Inc\0"
+	"Radio Shack\0"
+	"Extending Wire & Cable Co., Ltd.\0"
+	"Trust\0"
+	"Tatung Co.\0"
+	"Staccato Communications\0"
+	"Huawei-3Com\0"
+	"Formosa Industrial Computing, Inc.\0"
+	"Upek\0"
+	"Hama GmbH & Co., KG\0"
+	"Vaillant\0"
+	"Elsa AG [hex]\0"
+	"Silicom\0"
+	"DSP Group, Ltd.\0"
+	"EVATRONIX SA\0"
+	"Ralink Technology, Corp.\0"
+	"Futronic Technology Co. Ltd.\0"
+	"Suunto\0"
+	"Panstrong Company Ltd.\0"
+	"Microtek International Inc.\0"
+	"Imagination Technologies\0"
+	"WideView Technology Inc.\0"
+	"CTK Corporation\0"
+	"Printronix Inc.\0"
+	"ATP Electronics Inc.\0"
+	"StarTech.com Ltd.\0"
+	"Rockwell Automation, Inc.\0"
+	"Gemlight Computer, Ltd\0"
+	"Zytronic\0"
+	"Super Top\0"
+	"JAMER INDUSTRIES CO., LTD.\0"
+	"Raritan Computer, Inc.\0"
+	"WiNRADiO Communications\0"
+	"Dialogue Technology Corp.\0"
+	"SAIN Information & Communications Co., Ltd.\0"
+	"Planex Communications\0"
+	"Shure Inc.\0"
+	"TechniSat Digital GmbH\0"
+	"Pine-Tum Enterprise Co., Ltd.\0"
+	"medMobile\0"
+	"Actel\0"
+	"CompUSA\0"
+	"Cheshire Engineering Corp.\0"
+	"Comneon\0"
+	"Opal Kelly Incorporated\0"
+	"Bitwire Corp.\0"
+	"ENE Technology Inc\0"
+	"Silicon Portals\0"
+	"UBIQUAM Co., Ltd.\0"
+	"Thesycon Systemsoftware & Consulting GmbH\0"
+	"MIR Srl\0"
+	"JMicron Technology Corp. / JMicron USA Technology Corp.\0"
+	"LG (HLDS)\0"
+	"Razer USA, Ltd\0"
+	"U-Blox AG\0"
+	"SG Intec Ltd & Co KG\0"
+	"Celectronic GmbH\0"
+	"PNY\0"
+	"ConnectCounty Holdings Berhad\0"
+	"D&M Holdings, Inc. (Denon/Marantz)\0"
+	"SNBC CO., Ltd\0"
+	"Prolink Microsystems Corp.\0"
+	"OQO\0"
+	"Sunf Pu Technology Co., Ltd\0"
+	"Quantum Corporation\0"
+	"ALLTOP TECHNOLOGY CO., LTD.\0"
+	"Ketron SRL\0"
+	"TRENDnet\0"
+	"Fiberline\0"
+	"SMA Technologie AG\0"
+	"Oakley Inc.\0"
+	"JDS Uniphase Corporation (JDSU)\0"
+	"Kunshan Guoji Electronics Co., Ltd.\0"
+	"Freescale Semiconductor, Inc.\0"
+	"Afatech Technologies, Inc.\0"
+	"Teams Power Limited\0"
+	"Gemtek\0"
+	"Gearway Electronics (Dong Guan) Co., Ltd.\0"
+	"VMware Inc.\0"
+	"Olimex Ltd.\0"
+	"XL Imaging\0"
+	"SoundGraph Inc.\0"
+	"Advance Multimedia Internet Technology Inc. (AMIT)\0"
+	"Laboratoires MXM\0"
+	"KTF Technologies\0"
+	"D-Box Technologies\0",
+	"Textech International Ltd.\0"
+	"Coulomb Electronics Ltd.\0"
+	"Hynix Semiconductor Inc.\0"
+	"Seong Ji Industrial Co., Ltd.\0"
+	"RSA\0"
+	"Numark\0"
+	"SohoWare\0"
+	"Pacific Digital Corp.\0"
+	"Belcarra Technologies Corp.\0"
+	"HanfTek\0"
+	"Tascam\0"
+	"ACCES I/O Products, Inc.\0"
+	"Umax\0"
+	"Inside Out Networks [hex]\0"
+	"INRO\0"
+	"Amoi Electronics\0"
+	"L & K Precision Technology Co., Ltd.\0"
+	"Digitech Systems\0"
+	"Wionics Research\0"
+	"Stonestreet One, Inc.\0"
+	"Airgo Networks Inc.\0"
+	"WiQuest Communications, Inc.\0"
+	"Good Way Technology\0"
+	"Entrega [hex]\0"
+	"SofTec Microsystems\0"
+	"ChipX\0"
+	"Matrix Vision GmbH\0"
+	"Struck Innovative Systeme GmbH\0"
+	"Frontier Design Group\0"
+	"Kondo Kagaku\0"
+	"Creatix Polymedia GmbH\0"
+	"GIGA-TMS INC.\0"
+	"Actiontec Electronics, Inc. [hex]\0"
+	"PiKRON Ltd. [hex]\0"
+	"Clipsal\0"
+	"China Huada Integrated Circuit Design (Group) Co., Ltd. (CIDC Group)\0"
+	"Total Phase\0"
+	"Golden Bridge Electech Inc.\0"
+	"Prevo Technologies, Inc.\0"
+	"Maxwise Production Enterprise Ltd.\0"
+	"Godspeed Computer Corp.\0"
+	"Delock\0"
+	"ZOOM Corporation\0"
+	"Kingmax Digital Inc.\0"
+	"Saab AB\0"
+	"Atheros Communications\0"
+	"Askey Computer Corp. [hex]\0"
+	"Hitachi Video and Information System, Inc.\0"
+	"VTec Test, Inc.\0"
+	"Shenzhen Zhengerya Cable Co., Ltd.\0"
+	"Unigraf\0"
+	"Global Sun Technology\0"
+	"Dongguan ChingLung Wire & Cable Co., Ltd.\0"
+	"iStation\0"
+	"Persentec, Inc.\0"
+	"Van Ooijen Technische Informatica\0"
+	"Wireless Cables, Inc.\0"
+	"silex technology, Inc.\0"
+	"MCS\0"
+	"Suprema Inc.\0"
+	"Frontline Test Equipment, Inc.\0"
+	"AnyDATA Corporation\0"
+	"JABLOCOM s.r.o.\0"
+	"CMOTECH Co., Ltd.\0"
+	"Wiener, Plein & Baus\0"
+	"Telemecanique\0"
+	"King Billion Electronics Co., Ltd.\0"
+	"GN ReSound A/S\0"
+	"Futurelogic Inc.\0"
+	"BlueView Technologies, Inc.\0"
+	"ARTIMI\0"
+	"Swissonic\0"
+	"Avnera\0"
+	"Leica Microsystems\0"
+	"Meyer Instruments (MIS)\0"
+	"Vitesse Semiconductor\0"
+	"Axesstel, Inc.\0"
+	"Waltop International Corp.\0"
+	"Cellink Technology Co., Ltd\0"
+	"CANON IMAGING SYSTEM TECHNOLOGIES INC.\0"
+	"Roche\0"
+	"QSENN\0"
+	"Senao\0"
+	"General Atomics\0"
+	"MQP Electronics\0"
+	"ASMedia Technology Inc.\0"
+	"Syntek\0"
+	"GERTEC Telecomunicacoes Ltda.\0"
+	"ENENSYS Technologies\0"
+	"LucidPort Technology, Inc.\0"
+	"ASUSTek Computer, Inc. (wrong ID)\0"
+	"System Level Solutions, Inc.\0"
+	"Arowana\0"
+	"Sweex\0"
+	"Multiple Vendors\0"
+	"Spreadtrum Communications Inc.\0"
+	"TopSeed Technology Corp.\0"
+	"ATI AIB\0"
+	"ShenZhen Litkconn Technology Co., Ltd.\0"
+	"Printrex, Inc.\0"
+	"JALCO CO., LTD.\0"
+	"Thales Norway A/S\0"
+	"Ricavision International, Inc.\0"
+	"Samson Technologies Corp.\0"
+	"Concept2\0"
+	"Advanced Connection Technology Inc.\0"
+	"MICOMSOFT CO., LTD.\0"
+	"Kamstrup A/S\0"
+	"Grey Innovation\0"
+	"Lunatone\0"
+	"SAURIS GmbH\0"
+	"Singim International Corp.\0"
+	"Native Instruments\0"
+	"Hip Hing Cable & Plug Mfy. Ltd.\0"
+	"Sanford L.P.\0"
+	"Korea Techtron Co., Ltd.\0"
+	"DisplayLink\0"
+	"Cornice, Inc.\0"
+	"Lenovo\0"
+	"WaveSense\0"
+	"K.K. Rocky\0"
+	"Unicomp, Inc\0"
+	"Advantech\0"
+	"Twinhan\0"
+	"Gwo Jinn Industries Co., Ltd.\0"
+	"Huizhou Shenghua Industrial Co., Ltd.\0"
+	"VIVOphone\0"
+	"Vaisala\0"
+	"ASRock Incorporation\0"
+	"GYROCOM C&C Co., LTD\0"
+	"Memory Devices Ltd.\0"
+	"Compro\0"
+	"Tech Technology Industrial Company\0"
+	"Teridian Semiconductor Corp.\0"
+	"Aveo Technology Corp.\0"
+	"Navilock\0"
+	"Alienware Corporation\0"
+	"Siano Mobile Silicon\0"
+	"Topseed\0"
+	"Evertop Wire Cable Co.\0"
+	"3Shape A/S\0"
+	"CSSN\0"
+	"Verbatim, Ltd\0"
+	"Petalynx\0"
+	"e3C Technologies\0"
+	"Mikkon Technology Limited\0"
+	"Zotek Electronic Co., Ltd.\0"
+	"AMIT Technology, Inc.\0"
+	"Ecamm\0"
+	"Google Inc.\0"
+	"Starline International Group Limited\0"
+	"Kaba\0"
+	"LKC Technologies, Inc.\0"
+	"Planon System Solutions Inc.\0"
+	"Fitipower Integrated Technology Inc\0"
+	"Qcom\0"
+	"Matrox Graphics, Inc.\0"
+	"Arkmicro Technologies Inc.\0"
+	"[Maxxter]\0"
+	"Scriptel Corporation\0"
+	"FineArch Inc.\0"
+	"GE Healthcare\0"
+	"GEMBIRD\0"
+	"Motorola GSG\0"
+	"Alco Digital Devices Limited\0"
+	"Nordic Semiconductor ASA\0"
+	"Innovative Technology LTD\0"
+	"FitLinxx\0"
+	"NextWindow\0"
+	"Avago Technologies, Pte.\0"
+	"Shenzhen Xianhe Technology Co., Ltd.\0"
+	"Ningbo Broad Telecommunication Co., Ltd.\0"
+	"Feature Integration Technology Inc. (Fintek)\0"
+	"Meinberg Funkuhren GmbH & Co. KG\0"
+	"Dream Link\0"
+	"Sensoray Co., Inc.\0"
+	"Lab126, Inc.\0"
+	"PreSonus Audio Electronics, Inc.\0"
+	"Hyperstone AG\0"
+	"Ironkey Inc.\0"
+	"Radiient Technologies\0"
+	"Itron Technology iONE\0"
+	"Uniden Corporation\0"
+	"CASIO HITACHI Mobile Communications Co., Ltd.\0"
+	"Wispro Technology Inc.\0"
+	"Dane-Elec Corp. USA\0"
+	"Dongguan Guneetal Wire & Cable Co., Ltd.\0"
+	"Chipsbrand Microelectronics (HK) Co., Ltd.\0"
+	"T-Logic\0"
+	"Leuze electronic\0"
+	"Nuconn Technology Corp.\0"
+	"Beceem Communications Inc.\0"
+	"Acron Precision Industrial Co., Ltd.\0"
+	"Trillium Technology Pty. Ltd.\0"
+	"PixeLINK\0"
+	"MicroStrain, Inc.\0"
+	"The Imaging Source Europe GmbH\0"
+	"Benica Corporation\0"
+	"Biforst Technology Inc.\0"
+	"Bodelin\0"
+	"S Life\0"
+	"Batronix\0"
+	"Celestron\0"
+	"B & W Group\0"
+	"Infotech Logistic, LLC\0"
+	"Data Robotics\0"
+	"Futuba\0"
+	"Mindtribe\0"
+	"Parrot SA\0"
+	"ZTE WCDMA Technologies MSM\0"
+	"KFI Printers\0"
+	"WeiDuan Electronic Accessory (S.Z.) Co., Ltd.\0"
+	"Industrial Technology Research Institute\0"
+	"Pak Heng Technology (Shenzhen) Co., Ltd.\0"
+	"RODE Microphones\0"
+	"Gampaq Co.Ltd\0"
+	"Dynex\0"
+	"Bellwood International, Inc.\0"
+	"USB-IF non-workshop\0"
+	"KES Co., Ltd.\0"
+	"Veho\0"
+	"Amphenol East Asia Ltd.\0"
+	"Seagate Branded Solutions\0"
+	"China Resource Semico Co., Ltd\0"
+	"Quanta Microsystems, Inc.\0"
+	"ACRUX\0"
+	"Biwin Technology Ltd.\0"
+	"Terminus Technology Inc.\0"
+	"Action Electronics Co., Ltd.\0"
+	"VASCO Data Security International\0"
+	"Silicon Image\0"
+	"SafeBoot International B.V.\0"
+	"Tandberg Data\0"
+	"Abbott Diabetes Care\0"
+	"Spansion Inc.\0"
+	"SamYoung Electronics Co., Ltd\0"
+	"Global Unichip Corp.\0"
+	"Sagem Orga GmbH\0"
+	"Physik Instrumente\0"
+	"Bayer Health Care LLC\0"
+	"Lumberg Connect  GmbH & Co. KG\0"
+	"Evoluent\0"
+	"QinHeng Electronics\0"
+	"Dynalith Systems Co., Ltd.\0"
+	"SGS Taiwan Ltd.\0"
+	"BandRich, Inc.\0"
+	"Leica Camera AG\0"
+	"Data Drive Thru, Inc.\0"
+	"UBeacon Technologies, Inc.\0"
+	"eFortune Technology Corp.\0"
+	"KeeTouch\0"
+	"Rigol Technologies\0"
+	"Salcomp Plc\0"
+	"Midiplus Co, Ltd.\0"
+	"Desay Wire Co., Ltd.\0"
+	"APS\0"
+	"SEL C662 Serial Cable\0"
+	"ic-design Reinhard Gottinger GmbH\0"
+	"X-TENSIONS\0"
+	"High Top Precision Electronic Co., Ltd.\0"
+	"Conntech Electronic (Suzhou) Corporation\0"
+	"Connect One Ltd.\0"
+	"A. Eberle GmbH & Co. KG\0"
+	"Meilhaus Electronic GmbH\0"
+	"BLUTRONICS S.r.l.\0"
+	"Corsair\0"
+	"eQ-3 Entwicklung GmbH\0"
+	"MStar Semiconductor, Inc.\0"
+	"WiLinx Corp.\0"
+	"Cellex Power Products, Inc.\0"
+	"Current Electronics Inc.\0"
+	"NAVIsis Inc.\0"
+	"Ugobe Life Forms, Inc.\0"
+	"ViXS Systems, Inc.\0"
+	"iPassion Technology Inc.\0"
+	"Generalplus Technology Inc.\0"
+	"Energizer Holdings, Inc.\0"
+	"Plastron Precision Co., Ltd.\0"
+	"ARH Inc.\0"
+	"K.S. Terminals Inc.\0"
+	"Chao Zhou Kai Yuan Electric Co., Ltd.\0"
+	"The Hong Kong Standards and Testing Centre Ltd.\0"
+	"Fushicai\0"
+	"ATERGI TECHNOLOGY CO., LTD.\0"
+	"Fresco Logic\0"
+	"Ovislink Corp.\0"
+	"Legend Silicon Corp.\0"
+	"Afatech\0"
+	"Dongguan Guanshang Electronics Co., Ltd.\0"
+	"ShenMing Electron (Dong Guan) Co., Ltd.\0"
+	"Altium Limited\0"
+	"e-MOVE Technology Co., Ltd.\0"
+	"Amlogic, Inc.\0"
+	"MA LABS, Inc.\0"
+	"N-Trig\0"
+	"YMax Communications Corp.\0"
+	"Shenzhen Yuanchuan Electronic\0"
+	"JINQ CHERN ENTERPRISE CO., LTD.\0"
+	"Lite Metals & Plastic (Shenzhen) Co., Ltd.\0"
+	"Ember Corporation\0"
+	"Abilis Systems\0"
+	"China Telecommunication Technology Labs\0"
+	"Harmonix Music\0"
+	"Vuzix Corporation\0"
+	"T & A Mobile Phones\0"
+	"Ford Motor Co.\0"
+	"AVIXE Technology (China) Ltd.\0"
+	"Telit Wireless Solutions\0"
+	"Contac Cable Industrial Limited\0"
+	"Sunplus Innovation Technology Inc.\0"
+	"Hangzhou Riyue Electronic Co., Ltd.\0"
+	"BG Systems, Inc.\0"
+	"P-TWO INDUSTRIES, INC.\0"
+	"Shenzhen Tongyuan Network-Communication Cables Co., Ltd\0"
+	"RealVision Inc.\0"
+	"Extranet Systems Inc.\0"
+	"Orient Semiconductor Electronics, Ltd.\0"
+	"TouchPack\0"
+	"Kreton Corporation\0"
+	"QNAP System Inc.\0"
+	"Ionics EMS, Inc.\0"
+	"Relm Wireless\0"
+	"Lanterra Industrial Co., Ltd.\0"
+	"ALECTRONIC LIMITED\0"
+	"Datel Electronics Ltd.\0"
+	"Volkswagen of America, Inc.\0"
+	"Goldvish S.A.\0"
+	"Fuji Electric Device Technology Co., Ltd.\0"
+	"ADDMM LLC\0"
+	"ZHONGSHAN CHIANG YU ELECTRIC CO., LTD.\0"
+	"Shanghai Haiying Electronics Co., Ltd.\0"
+	"HuiYang D & S Cable Co., Ltd.\0"
+	"Elster GmbH\0"
+	"LS Cable Ltd.\0"
+	"SpringCard\0"
+	"Authorizer Technologies, Inc.\0"
+	"NONIN MEDICAL INC.\0"
+	"Wep Peripherals\0"
+	"EZPrototypes\0"
+	"Cherng Weei Technology Corp.\0"
+	"SiGma Micro\0"
+	"Philips & Lite-ON Digital Solutions Corporation\0"
+	"Skydigital Inc.\0"
+	"AMT\0"
+	"Kaetat Industrial Co., Ltd.\0"
+	"Datascope Corp.\0"
+	"Unigen Corporation\0"
+	"LighTuning Technology Inc.\0"
+	"LUXSHARE PRECISION INDUSTRY (SHENZHEN) CO., LTD.\0"
+	"Schomaecker GmbH\0"
+	"2N TELEKOMUNIKACE a.s.\0"
+	"Somagic, Inc.\0"
+	"HONGKONG WEIDIDA ELECTRON LIMITED\0"
+	"ASTRON INTERNATIONAL CORP.\0"
+	"ALPINE ELECTRONICS, INC.\0"
+	"OMEGA TECHNOLOGY\0"
+	"ACCARIO Inc.\0"
+	"Symwave\0"
+	"Kinstone\0"
+	"Aces Electronic Co., Ltd.\0"
+	"OPEX CORPORATION\0"
+	"IdeaCom Technology Inc.\0"
+	"Luminary Micro Inc.\0"
+	"FORTAT SKYMARK INDUSTRIAL COMPANY\0"
+	"PlantSense\0"
+	"NextWave Broadband Inc.\0"
+	"Bodatong Technology (Shenzhen) Co., Ltd.\0"
+	"adp corporation\0"
+	"Firecomms Ltd.\0"
+	"Antonio Precise Products Manufactory Ltd.\0"
+	"Telecommunications Technology Association (TTA)\0"
+	"WonTen Technology Co., Ltd.\0"
+	"EDIMAX TECHNOLOGY CO., LTD.\0"
+	"Amphenol KAE\0"
+	"Dresden Elektronik\0"
+	"ANDES TECHNOLOGY CORPORATION\0"
+	"Flextronics Digital Design Japan, LTD.\0"
+	"iCON\0"
+	"Solid-Motion\0"
+	"NINGBO HENTEK DRAGON ELECTRONICS CO., LTD.\0"
+	"TechFaith Wireless Technology Limited\0"
+	"Johnson Controls, Inc. The Automotive Business Unit\0"
+	"HAN HUA CABLE & WIRE TECHNOLOGY (J.X.) CO., LTD.\0"
+	"Sonix Technology Co., Ltd.\0"
+	"ALPHA-SAT TECHNOLOGY LIMITED\0"
+	"C-Thru Music Ltd.\0"
+	"Dexatek Technology Ltd.\0"
+	"Diostech Co., Ltd.\0"
+	"SAMTACK INC.\0"
+	"ASUS\0"
+	"Dream Cheeky\0"
+	"Touch\0"
+	"PEGATRON CORPORATION\0"
+	"OpenMoko, Inc.\0"
+	"Xenta\0"
+	"Smartronix, Inc.\0"
+	"Linux Foundation\0"
+	"Citizen\0"
+	"Sigma Sport\0"
+	"Actions Microelectronics Co.\0"
+	"Qualcomm / Option\0"
+	"Point Grey Research, Inc.\0"
+	"Mirion Technologies Dosimetry Services Division\0"
+	"Lumension Security\0"
+	"INVIA\0"
+	"Festo AG & Co. KG\0"
+	"Cleverscope\0"
+	"Cubeternet\0"
+	"TypeMatrix\0"
+	"TrekStor GmbH & Co. KG\0"
+	"NZXT\0"
+	"Coby Electronics Corporation\0"
+	"ROCCAT\0"
+	"SHARKOON Technologies GmbH\0"
+	"NuCORE Technology, Inc.\0"
+	"AirTies Wireless Networks\0"
+	"Blackmagic design\0"
+	"ONDA COMMUNICATION S.p.a.\0"
+	"EADS Deutschland GmbH\0"
+	"Cal-Comp\0"
+	"Onda (unverified)\0"
+	"The Neat Company\0"
+	"H-TRONIC GmbH\0"
+	"G-Tek Electronics Group\0"
+	"Aliph\0"
+	"Innostor Technology Corporation\0"
+	"TANDBERG\0"
+	"Alere, Inc.\0"
+	"Stantum\0"
+	"Ubiquiti Networks, Inc.\0"
+	"Samsung Opto-Electroncs Co., Ltd.\0"
+	"Delphin Technology AG\0"
+	"NXP Semiconductors\0"
+	"ILX Lightwave Corporation\0"
+	"Vertex Wireless Co., Ltd.\0"
+	"CVT Electronics.Co.,Ltd\0"
+	"Ideofy Inc.\0"
+	"D-Link Corp.\0"
+	"DAP Technologies\0"
+	"detectomat\0"
+	"Reloop\0"
+	"PCTV Systems\0"
+	"PLANEX\0"
+	"Encore Electronics Inc.\0"
+	"Hauppauge\0"
+	"Nano River Technology\0"
+	"Taicang T&W Electronics Co. Ltd\0"
+	"Barnes & Noble\0"
+	"SIMPASS\0"
+	"Cando\0"
+	"Clay Logic\0"
+	"XMOS Ltd\0"
+	"Hanvon\0"
+	"Qi Hardware\0"
+	"Minicircuits\0"
+	"Simtec Electronics\0"
+	"NET New Electronic Technology GmbH\0"
+	"XIMEA\0"
+	"RT Systems\0"
+	"ActionStar\0"
+	"VIA Labs, Inc.\0"
+	"Softkinetic\0"
+	"Advanced Silicon S.A.\0"
+	"Creative (?)\0"
+	"GW Instek\0"
+	"Emotiv Systems Pty. Ltd.\0"
+	"Agecodagis SARL\0"
+	"Fuzhou Rockchip Electronics Company\0"
+	"SAMWOO Enterprise\0"
+	"Silicon Motion\0"
+	"RadioShack Corporation\0"
+	"Kobo Inc.\0"
+	"Morpho\0"
+	"8D Technologies inc.\0"
+	"Pie Digital, Inc.\0"
+	"Motorola PCS\0"
+	"eTurboTouch Technology, Inc.\0"
+	"Technology Innovation Holdings, Ltd\0"
+	"Shining Technologies, Inc. [hex]\0"
+	"Arduino SA\0"
+	"Pumatronix Ltda\0"
+	"Digit@lway, Inc.\0"
+	"SANHO Digital Electronics Co., Ltd.\0"
+	"Aessent Technology Ltd\0"
+	"Tripp-Lite\0"
+	"Maxxter\0"
+	"M2Tech s.r.l.\0"
+	"Paratronic\0"
+	"Cooler Master Co., Ltd.\0"
+	"Pulse-Eight\0"
+	"Xsens\0"
+	"Electronics For Imaging, Inc. [hex]\0"
+	"Sundtek\0"
+	"Basler AG\0"
+	"DigitalWay\0"
+	"Hughski Limited\0"
+	"NHJ, Ltd\0"
+	"ThingM\0"
+	"ASUSTek Computer Inc.\0"
+	"Toptronic Industrial Co., Ltd\0"
+	"Dracal/Raphnet technologies\0"
+	"Jolla Oy\0"
+	"Zaber Technologies Inc.\0"
+	"dog hunter AG\0"
+	"RTD Embedded Technologies, Inc.\0"
+	"Meizu Corp.\0"
+	"KeepKey LLC\0"
+	"Dolphin Peripherals\0"
+	"Quectel Wireless Solutions Co., Ltd.\0"
+	"Dialog Semiconductor\0"
+	"Eagletron\0"
+	"Navini Networks\0"
+	"Whanam Electronics Co., Ltd\0"
+	"Link Instruments\0"
+	"VidzMedia Pte Ltd\0"
+	"InLine\0"
+	"AEI\0"
+	"Yakumo\0"
+	"Leaguer Microelectronics (LME)\0"
+	"Micro Star\0"
+	"DIVA\0"
+	"Sharkoon\0"
+	"InVibro\0"
+	"WEM\0"
+	"National Instruments Corp.\0"
+	"I-O Data\0"
+	"i-rocks\0"
+	"USBest Technology\0"
+	"Targus\0"
+	"USB Design by Example\0"
+	"GoPro\0"
+	"WinChipHead\0"
+	"Panram\0"
+	"EMS Production\0"
+	"Miditech\0"
+	"Aceeca\0"
+	"Memorex\0"
+	"SimpleTech\0"
+	"Musical Fidelity\0"
+	"Grandtec\0"
+	"Linksys (?)\0"
+	"Averatec (?)\0"
+	"I-Tetra\0"
+	"Owon\0"
+	"SatoshiLabs\0"
+	"Transmeta Corp.\0"
+	"UC-Logic Technology Corp.\0"
+	"Epiphan Systems Inc.\0"
+	"OnSpec Electronic, Inc.\0"
+	"Gotview\0"
+	"Uni-Trend Group Limited\0"
+	"IRTOUCHSYSTEMS Co. Ltd.\0"
+	"Acer, Inc\0"
+	"Nonolith Labs\0"
+	"Zinwell\0"
+	"Beholder International Ltd.\0"
+	"Ingenic Semiconductor Ltd.\0"
+	"Sitecom\0"
+	"LightingSoft AG\0"
+	"TwinHan Technology Co., Ltd\0"
+	"CoreLogic, Inc.\0"
+	"Unknown (Sony?)\0"
+	"Prototype product Vendor ID\0"
+	"WiseGroup, Ltd.\0"
+	"3Com\0"
+	"Opera1\0"
+	"Yealink Network Technology Co., Ltd.\0"
+	"Shanghai Jujo Electronics Co., Ltd\0"
+	"CME (Central Music Co.)\0"
+	"StackFoundry LLC\0"
+	"TBS Technologies China\0"
+	"Beijing STONE Technology Co. Ltd.\0"
+	"Edimax Technology Co., Ltd\0"
+	"VirtualBox\0"
+	"Keio\0"
+	"EGO Systems, Inc.\0"
+	"Intenso GmbG\0"
+	"TeVii Technology Ltd.\0"
+	"GeoLab, Ltd\0"
+	"MosChip Semiconductor\0"
+	"Bestmedia CD Recordable GmbH & Co. KG\0"
+	"Odeon\0"
+	"J. Westhues\0"
+	"AnMo Electronics Corp. / Dino-Lite (?)\0"
+	"AnMo Electronics Corporation\0"
+	"Asix\0"
+	"MXT\0"
+	"Blue Microphones\0"
+	"Card Device Expert Co., LTD\0"
+	"Keil Software, Inc.\0"
+	"CACE Technologies Inc.\0"
+	"SMART TECHNOLOGY INDUSTRIAL LTD.\0"
+	"Ultimarc\0"
+	"LogiLink\0"
+	"Xorcom Ltd.\0"
+	"MakingThings\0"
+	"eMPIA Technology, Inc.\0"
+	"KWorld\0"
+	"Hewlett Packard\0"
+	"Leap Motion\0"
+	"Atten Electronics / Siglent Technologies\0"
+	"Shenzhen Siglent Co., Ltd.\0"
+	"Hama\0"
+	"Conrad Electronic SE\0"
+	"FNK Tech\0",
 };
 
-const char* LIBWDI_API wdi_get_vendor_name(unsigned short vid)
-{
-	int i;
+// Sorted VIDs, the offset of their name in usb_name[], and the index of their first product
+static const uint16_t usb_vendor_id[3002] = {
+	0x0001, 0x0002, 0x0003, 0x0004, 0x0011, 0x0053, 0x0078, 0x0079,
+	0x0085, 0x0105, 0x0127, 0x0145, 0x017c, 0x0200, 0x0204, 0x0218,
+	0x02ad, 0x0303, 0x0324, 0x0325, 0x0386, 0x03d9, 0x03da, 0x03e7,
+	0x03e8, 0x03e9, 0x03ea, 0x03eb, 0x03ec, 0x03ed, 0x03ee, 0x03f0,
+	0x03f1, 0x03f2, 0x03f3, 0x03f4, 0x03f5, 0x03f8, 0x03f9, 0x03fb,
+	0x03fc, 0x03fd, 0x03fe, 0x0400, 0x0401, 0x0402, 0x0403, 0x0404,
+	0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040a, 0x040b, 0x040c,
+	0x040d, 0x040e, 0x040f, 0x0411, 0x0412, 0x0413, 0x0414, 0x0416,
+	0x0417, 0x0418, 0x0419, 0x041a, 0x041b, 0x041d, 0x041e, 0x041f,
+	0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+	0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d, 0x042e, 0x042f,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+	0x0438, 0x0439, 0x043d, 0x043e, 0x043f, 0x0440, 0x0441, 0x0442,
+	0x0443, 0x0445, 0x0446, 0x0447, 0x0449, 0x044a, 0x044b, 0x044c,
+	0x044d, 0x044e, 0x044f, 0x0450, 0x0451, 0x0452, 0x0453, 0x0454,
+	0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045a, 0x045b, 0x045d,
+	0x045e, 0x0460, 0x0461, 0x0463, 0x0464, 0x0467, 0x0468, 0x046a,
+	0x046b, 0x046c, 0x046d, 0x046e, 0x046f, 0x0471, 0x0472, 0x0473,
+	0x0474, 0x0475, 0x0476, 0x0477, 0x0478, 0x0479, 0x047a, 0x047b,
+	0x047c, 0x047d, 0x047e, 0x047f, 0x0480, 0x0481, 0x0482, 0x0483,
+	0x0484, 0x0485, 0x0486, 0x0487, 0x0488, 0x0489, 0x048a, 0x048c,
+	0x048d, 0x048f, 0x0490, 0x0491, 0x0492, 0x0493, 0x0495, 0x0496,
+	0x0497, 0x0498, 0x0499, 0x049a, 0x049b, 0x049c, 0x049d, 0x049f,
+	0x04a0, 0x04a1, 0x04a2, 0x04a3, 0x04a4, 0x04a5, 0x04a6, 0x04a7,
+	0x04a8, 0x04a9, 0x04aa, 0x04ab, 0x04ac, 0x04ad, 0x04af, 0x04b0,
+	0x04b1, 0x04b3, 0x04b4, 0x04b5, 0x04b6, 0x04b7, 0x04b8, 0x04b9,
+	0x04ba, 0x04bb, 0x04bd, 0x04be, 0x04bf, 0x04c1, 0x04c2, 0x04c3,
+	0x04c4, 0x04c5, 0x04c6, 0x04c7, 0x04c8, 0x04ca, 0x04cb, 0x04cc,
+	0x04cd, 0x04ce, 0x04cf, 0x04d0, 0x04d1, 0x04d2, 0x04d3, 0x04d4,
+	0x04d5, 0x04d6, 0x04d7, 0x04d8, 0x04d9, 0x04da, 0x04db, 0x04dc,
+	0x04dd, 0x04de, 0x04df, 0x04e1, 0x04e2, 0x04e3, 0x04e4, 0x04e5,
+	0x04e6, 0x04e7, 0x04e8, 0x04e9, 0x04ea, 0x04eb, 0x04ec, 0x04ed,
+	0x04ef, 0x04f0, 0x04f1, 0x04f2, 0x04f3, 0x04f4, 0x04f5, 0x04f6,
+	0x04f7, 0x04f8, 0x04f9, 0x04fa, 0x04fb, 0x04fc, 0x04fd, 0x04fe,
+	0x04ff, 0x0500, 0x0501, 0x0502, 0x0503, 0x0504, 0x0506, 0x0507,
+	0x0508, 0x0509, 0x050a, 0x050b, 0x050c, 0x050d, 0x050e, 0x050f,
+	0x0510, 0x0511, 0x0512, 0x0513, 0x0514, 0x0515, 0x0516, 0x0517,
+	0x0518, 0x0519, 0x051a, 0x051b, 0x051c, 0x051d, 0x051e, 0x051f,
+	0x0520, 0x0521, 0x0522, 0x0523, 0x0524, 0x0525, 0x0526, 0x0527,
+	0x0528, 0x0529, 0x052a, 0x052b, 0x052c, 0x052d, 0x052e, 0x052f,
+	0x0530, 0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0536, 0x0537,
+	0x0538, 0x0539, 0x053a, 0x053b, 0x053c, 0x053d, 0x053e, 0x053f,
+	0x0540, 0x0541, 0x0543, 0x0544, 0x0545, 0x0546, 0x0547, 0x0548,
+	0x0549, 0x054a, 0x054b, 0x054c, 0x054d, 0x054e, 0x054f, 0x0550,
+	0x0551, 0x0552, 0x0553, 0x0554, 0x0555, 0x0556, 0x0557, 0x0558,
+	0x0559, 0x055a, 0x055b, 0x055c, 0x055d, 0x055e, 0x055f, 0x0560,
+	0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568,
+	0x0569, 0x056a, 0x056b, 0x056c, 0x056d, 0x056e, 0x056f, 0x0570,
+	0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578,
+	0x0579, 0x057a, 0x057b, 0x057c, 0x057d, 0x057e, 0x057f, 0x0580,
+	0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0587, 0x0588,
+	0x0589, 0x058a, 0x058b, 0x058c, 0x058d, 0x058e, 0x058f, 0x0590,
+	0x0591, 0x0592, 0x0593, 0x0594, 0x0595, 0x0596, 0x0597, 0x0598,
+	0x0599, 0x059a, 0x059b, 0x059c, 0x059d, 0x059e, 0x059f, 0x05a0,
+	0x05a1, 0x05a2, 0x05a3, 0x05a4, 0x05a5, 0x05a6, 0x05a7, 0x05a8,
+	0x05a9, 0x05aa, 0x05ab, 0x05ac, 0x05ad, 0x05ae, 0x05af, 0x05b0,
+	0x05b1, 0x05b4, 0x05b5, 0x05b6, 0x05b7, 0x05b8, 0x05b9, 0x05ba,
+	0x05bb, 0x05bc, 0x05bd, 0x05be, 0x05bf, 0x05c0, 0x05c1, 0x05c2,
+	0x05c5, 0x05c6, 0x05c7, 0x05c8, 0x05c9, 0x05ca, 0x05cb, 0x05cc,
+	0x05cd, 0x05ce, 0x05cf, 0x05d0, 0x05d1, 0x05d2, 0x05d3, 0x05d5,
+	0x05d6, 0x05d7, 0x05d8, 0x05d9, 0x05da, 0x05db, 0x05dc, 0x05dd,
+	0x05df, 0x05e0, 0x05e1, 0x05e2, 0x05e3, 0x05e4, 0x05e5, 0x05e6,
+	0x05e8, 0x05e9, 0x05eb, 0x05ec, 0x05ee, 0x05ef, 0x05f0, 0x05f1,
+	0x05f2, 0x05f3, 0x05f5, 0x05f6, 0x05f7, 0x05f9, 0x05fa, 0x05fc,
+	0x05fd, 0x05fe, 0x05ff, 0x0600, 0x0601, 0x0602, 0x0603, 0x0604,
+	0x0605, 0x0606, 0x0607, 0x0608, 0x0609, 0x060a, 0x060b, 0x060c,
+	0x060d, 0x060e, 0x060f, 0x0610, 0x0611, 0x0613, 0x0614, 0x0615,
+	0x0616, 0x0617, 0x0618, 0x0619, 0x061a, 0x061b, 0x061c, 0x061d,
+	0x061e, 0x0620, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626,
+	0x0627, 0x0628, 0x0629, 0x062a, 0x062b, 0x062c, 0x062d, 0x062e,
+	0x062f, 0x0631, 0x0633, 0x0634, 0x0635, 0x0636, 0x0638, 0x0639,
+	0x063a, 0x063b, 0x063c, 0x063d, 0x063e, 0x063f, 0x0640, 0x0641,
+	0x0642, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x0649, 0x064b,
+	0x064c, 0x064d, 0x064e, 0x064f, 0x0650, 0x0651, 0x0652, 0x0653,
+	0x0654, 0x0655, 0x0656, 0x0657, 0x0658, 0x0659, 0x065a, 0x065b,
+	0x065e, 0x065f, 0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665,
+	0x0667, 0x0668, 0x0669, 0x066a, 0x066b, 0x066d, 0x066e, 0x066f,
+	0x0670, 0x0672, 0x0673, 0x0674, 0x0675, 0x0676, 0x0677, 0x0678,
+	0x067b, 0x067c, 0x067d, 0x067e, 0x067f, 0x0680, 0x0681, 0x0682,
+	0x0684, 0x0685, 0x0686, 0x068a, 0x068b, 0x068e, 0x0690, 0x0693,
+	0x0694, 0x0698, 0x0699, 0x069a, 0x069b, 0x069d, 0x069e, 0x069f,
+	0x06a2, 0x06a3, 0x06a4, 0x06a5, 0x06a7, 0x06a8, 0x06a9, 0x06aa,
+	0x06ac, 0x06ad, 0x06ae, 0x06af, 0x06b8, 0x06b9, 0x06ba, 0x06bb,
+	0x06bc, 0x06bd, 0x06be, 0x06bf, 0x06c2, 0x06c4, 0x06c5, 0x06c6,
+	0x06c8, 0x06c9, 0x06ca, 0x06cb, 0x06cc, 0x06cd, 0x06ce, 0x06cf,
+	0x06d0, 0x06d1, 0x06d3, 0x06d4, 0x06d5, 0x06d6, 0x06d7, 0x06d8,
+	0x06da, 0x06db, 0x06dc, 0x06de, 0x06e0, 0x06e1, 0x06e4, 0x06e6,
+	0x06ea, 0x06eb, 0x06ef, 0x06f0, 0x06f1, 0x06f2, 0x06f6, 0x06f7,
+	0x06f8, 0x06f9, 0x06fa, 0x06fc, 0x06fd, 0x06fe, 0x0701, 0x0703,
+	0x0705, 0x0706, 0x0707, 0x0708, 0x0709, 0x070a, 0x070d, 0x070e,
+	0x0710, 0x0711, 0x0713, 0x0714, 0x0717, 0x0718, 0x0719, 0x071b,
+	0x071c, 0x071d, 0x071e, 0x0720, 0x0723, 0x0726, 0x0729, 0x072e,
+	0x072f, 0x0731, 0x0732, 0x0733, 0x0734, 0x0735, 0x0736, 0x0738,
+	0x073a, 0x073b, 0x073c, 0x073d, 0x073e, 0x0742, 0x0745, 0x0746,
+	0x0747, 0x0748, 0x0749, 0x074a, 0x074b, 0x074c, 0x074d, 0x074e,
+	0x0755, 0x0757, 0x0758, 0x075b, 0x0763, 0x0764, 0x0765, 0x0766,
+	0x0767, 0x0768, 0x0769, 0x076a, 0x076b, 0x076c, 0x076d, 0x076e,
+	0x076f, 0x0770, 0x0771, 0x0772, 0x0774, 0x0775, 0x0776, 0x0777,
+	0x0778, 0x0779, 0x077a, 0x077b, 0x077c, 0x077d, 0x077f, 0x0780,
+	0x0781, 0x0782, 0x0783, 0x0784, 0x0785, 0x0789, 0x078b, 0x078c,
+	0x078e, 0x0790, 0x0791, 0x0792, 0x0793, 0x0794, 0x0795, 0x0796,
+	0x0797, 0x0798, 0x0799, 0x079b, 0x079d, 0x07a1, 0x07a2, 0x07a3,
+	0x07a4, 0x07a6, 0x07aa, 0x07ab, 0x07af, 0x07b0, 0x07b1, 0x07b2,
+	0x07b3, 0x07b4, 0x07b5, 0x07b6, 0x07b7, 0x07b8, 0x07bc, 0x07bd,
+	0x07be, 0x07c0, 0x07c1, 0x07c4, 0x07c5, 0x07c6, 0x07c7, 0x07c8,
+	0x07c9, 0x07ca, 0x07cb, 0x07cc, 0x07cd, 0x07cf, 0x07d0, 0x07d1,
+	0x07d2, 0x07d3, 0x07d5, 0x07d7, 0x07da, 0x07de, 0x07df, 0x07e0,
+	0x07e1, 0x07e2, 0x07e3, 0x07e4, 0x07e5, 0x07e6, 0x07e7, 0x07e8,
+	0x07ea, 0x07eb, 0x07ec, 0x07ee, 0x07ef, 0x07f2, 0x07f6, 0x07f7,
+	0x07f9, 0x07fa, 0x07fc, 0x07fd, 0x07ff, 0x0801, 0x0802, 0x0803,
+	0x0809, 0x080a, 0x080b, 0x080c, 0x080d, 0x0810, 0x0813, 0x0819,
+	0x081a, 0x081b, 0x081c, 0x081e, 0x0822, 0x0825, 0x0826, 0x0827,
+	0x0828, 0x0829, 0x082d, 0x0830, 0x0832, 0x0833, 0x0835, 0x0836,
+	0x0839, 0x083a, 0x083f, 0x0840, 0x0841, 0x0844, 0x0846, 0x084d,
+	0x084e, 0x084f, 0x0850, 0x0851, 0x0852, 0x0853, 0x0854, 0x0856,
+	0x0858, 0x0859, 0x085a, 0x085c, 0x0862, 0x0863, 0x0864, 0x0867,
+	0x086a, 0x086c, 0x086e, 0x086f, 0x0870, 0x0871, 0x0873, 0x0874,
+	0x0879, 0x087c, 0x087d, 0x087e, 0x087f, 0x0880, 0x0883, 0x0885,
+	0x0886, 0x0887, 0x088a, 0x088b, 0x088c, 0x088e, 0x0892, 0x0894,
+	0x0897, 0x089c, 0x089d, 0x089e, 0x089f, 0x08a5, 0x08a6, 0x08a8,
+	0x08a9, 0x08ac, 0x08ae, 0x08b0, 0x08b4, 0x08b7, 0x08b8, 0x08b9,
+	0x08bb, 0x08bd, 0x08c3, 0x08c4, 0x08c7, 0x08c8, 0x08c9, 0x08ca,
+	0x08cd, 0x08ce, 0x08cf, 0x08d1, 0x08d3, 0x08d4, 0x08d8, 0x08d9,
+	0x08dd, 0x08de, 0x08df, 0x08e3, 0x08e4, 0x08e5, 0x08e6, 0x08e7,
+	0x08e8, 0x08e9, 0x08ea, 0x08ec, 0x08ed, 0x08ee, 0x08f0, 0x08f1,
+	0x08f2, 0x08f5, 0x08f6, 0x08f7, 0x08f8, 0x08f9, 0x08fa, 0x08fb,
+	0x08fc, 0x08fd, 0x08ff, 0x0900, 0x0901, 0x0906, 0x0908, 0x0909,
+	0x090a, 0x090b, 0x090c, 0x090d, 0x090e, 0x090f, 0x0910, 0x0911,
+	0x0912, 0x0915, 0x0917, 0x0919, 0x091e, 0x0920, 0x0921, 0x0922,
+	0x0923, 0x0924, 0x0925, 0x0927, 0x0928, 0x0929, 0x092a, 0x092b,
+	0x092f, 0x0930, 0x0931, 0x0932, 0x0933, 0x0934, 0x0936, 0x0939,
+	0x093a, 0x093b, 0x093c, 0x093d, 0x093e, 0x093f, 0x0940, 0x0941,
+	0x0942, 0x0943, 0x0944, 0x0945, 0x0948, 0x094b, 0x094d, 0x094f,
+	0x0951, 0x0954, 0x0955, 0x0956, 0x0957, 0x0958, 0x0959, 0x095a,
+	0x095b, 0x095c, 0x095d, 0x0964, 0x0967, 0x0968, 0x096e, 0x0971,
+	0x0973, 0x0974, 0x0975, 0x0976, 0x0977, 0x0978, 0x0979, 0x097a,
+	0x097b, 0x097c, 0x097d, 0x097e, 0x097f, 0x0981, 0x0984, 0x0985,
+	0x0986, 0x098c, 0x098d, 0x098e, 0x098f, 0x0993, 0x0996, 0x099a,
+	0x099e, 0x09a3, 0x09a4, 0x09a5, 0x09a6, 0x09a7, 0x09a8, 0x09a9,
+	0x09aa, 0x09ab, 0x09ae, 0x09b2, 0x09b3, 0x09b4, 0x09b5, 0x09bc,
+	0x09be, 0x09bf, 0x09c0, 0x09c1, 0x09c2, 0x09c3, 0x09c4, 0x09c5,
+	0x09ca, 0x09cb, 0x09cc, 0x09cd, 0x09ce, 0x09cf, 0x09d1, 0x09d2,
+	0x09d3, 0x09d7, 0x09d8, 0x09d9, 0x09da, 0x09db, 0x09dc, 0x09dd,
+	0x09df, 0x09e1, 0x09e5, 0x09e6, 0x09e7, 0x09e8, 0x09e9, 0x09eb,
+	0x09ef, 0x09f3, 0x09f5, 0x09f6, 0x09f7, 0x09f8, 0x09f9, 0x09fa,
+	0x09fb, 0x09ff, 0x0a00, 0x0a01, 0x0a05, 0x0a07, 0x0a0b, 0x0a0d,
+	0x0a11, 0x0a12, 0x0a13, 0x0a14, 0x0a15, 0x0a16, 0x0a17, 0x0a18,
+	0x0a19, 0x0a21, 0x0a22, 0x0a27, 0x0a2c, 0x0a34, 0x0a35, 0x0a39,
+	0x0a3a, 0x0a3c, 0x0a3d, 0x0a3f, 0x0a43, 0x0a46, 0x0a47, 0x0a48,
+	0x0a4a, 0x0a4b, 0x0a4c, 0x0a4d, 0x0a4e, 0x0a4f, 0x0a50, 0x0a51,
+	0x0a52, 0x0a53, 0x0a5a, 0x0a5b, 0x0a5c, 0x0a5d, 0x0a5f, 0x0a62,
+	0x0a66, 0x0a67, 0x0a68, 0x0a69, 0x0a6b, 0x0a6c, 0x0a6d, 0x0a6e,
+	0x0a6f, 0x0a70, 0x0a71, 0x0a72, 0x0a73, 0x0a7d, 0x0a7e, 0x0a80,
+	0x0a81, 0x0a82, 0x0a83, 0x0a84, 0x0a85, 0x0a86, 0x0a89, 0x0a8d,
+	0x0a8e, 0x0a90, 0x0a91, 0x0a92, 0x0a93, 0x0a94, 0x0aa3, 0x0aa4,
+	0x0aa5, 0x0aa6, 0x0aa7, 0x0aa8, 0x0aa9, 0x0aaa, 0x0aab, 0x0aac,
+	0x0aad, 0x0aae, 0x0aaf, 0x0ab0, 0x0ab1, 0x0aba, 0x0abe, 0x0abf,
+	0x0ac3, 0x0ac4, 0x0ac5, 0x0ac6, 0x0ac7, 0x0ac8, 0x0ac9, 0x0aca,
+	0x0acc, 0x0acd, 0x0ace, 0x0acf, 0x0ad0, 0x0ad1, 0x0ad2, 0x0ada,
+	0x0ae3, 0x0ae4, 0x0ae7, 0x0ae8, 0x0ae9, 0x0aea, 0x0aeb, 0x0aec,
+	0x0af0, 0x0af6, 0x0af7, 0x0af9, 0x0afa, 0x0afc, 0x0afd, 0x0afe,
+	0x0aff, 0x0b00, 0x0b05, 0x0b0b, 0x0b0c, 0x0b0d, 0x0b0e, 0x0b0f,
+	0x0b10, 0x0b11, 0x0b1e, 0x0b1f, 0x0b20, 0x0b21, 0x0b22, 0x0b23,
+	0x0b24, 0x0b27, 0x0b28, 0x0b2c, 0x0b30, 0x0b33, 0x0b37, 0x0b38,
+	0x0b39, 0x0b3a, 0x0b3b, 0x0b3c, 0x0b3e, 0x0b41, 0x0b43, 0x0b47,
+	0x0b48, 0x0b49, 0x0b4b, 0x0b4d, 0x0b4e, 0x0b50, 0x0b51, 0x0b52,
+	0x0b54, 0x0b56, 0x0b57, 0x0b59, 0x0b5a, 0x0b5f, 0x0b60, 0x0b61,
+	0x0b62, 0x0b63, 0x0b64, 0x0b65, 0x0b66, 0x0b67, 0x0b69, 0x0b6a,
+	0x0b6f, 0x0b70, 0x0b71, 0x0b72, 0x0b73, 0x0b75, 0x0b79, 0x0b7a,
+	0x0b7b, 0x0b7c, 0x0b7d, 0x0b81, 0x0b84, 0x0b85, 0x0b86, 0x0b87,
+	0x0b88, 0x0b89, 0x0b8c, 0x0b95, 0x0b96, 0x0b97, 0x0b98, 0x0b99,
+	0x0b9b, 0x0b9d, 0x0b9f, 0x0baf, 0x0bb0, 0x0bb1, 0x0bb2, 0x0bb3,
+	0x0bb4, 0x0bb5, 0x0bb6, 0x0bb7, 0x0bb8, 0x0bb9, 0x0bba, 0x0bbb,
+	0x0bbc, 0x0bbd, 0x0bc0, 0x0bc1, 0x0bc2, 0x0bc3, 0x0bc4, 0x0bc5,
+	0x0bc6, 0x0bc7, 0x0bc8, 0x0bc9, 0x0bca, 0x0bcb, 0x0bd7, 0x0bda,
+	0x0bdb, 0x0bdc, 0x0bdd, 0x0be2, 0x0be3, 0x0be4, 0x0be5, 0x0be6,
+	0x0bed, 0x0bee, 0x0bef, 0x0bf0, 0x0bf1, 0x0bf2, 0x0bf6, 0x0bf7,
+	0x0bf8, 0x0bfd, 0x0c00, 0x0c04, 0x0c05, 0x0c06, 0x0c07, 0x0c08,
+	0x0c09, 0x0c0a, 0x0c0b, 0x0c12, 0x0c15, 0x0c16, 0x0c17, 0x0c18,
+	0x0c19, 0x0c1a, 0x0c1b, 0x0c1c, 0x0c22, 0x0c23, 0x0c24, 0x0c25,
+	0x0c26, 0x0c27, 0x0c2e, 0x0c30, 0x0c35, 0x0c36, 0x0c37, 0x0c38,
+	0x0c39, 0x0c3a, 0x0c3b, 0x0c3c, 0x0c3d, 0x0c3e, 0x0c44, 0x0c45,
+	0x0c46, 0x0c4a, 0x0c4b, 0x0c4c, 0x0c52, 0x0c53, 0x0c54, 0x0c55,
+	0x0c56, 0x0c57, 0x0c58, 0x0c59, 0x0c5a, 0x0c5e, 0x0c60, 0x0c62,
+	0x0c63, 0x0c64, 0x0c65, 0x0c66, 0x0c67, 0x0c6a, 0x0c6c, 0x0c70,
+	0x0c72, 0x0c74, 0x0c76, 0x0c77, 0x0c78, 0x0c79, 0x0c7a, 0x0c86,
+	0x0c88, 0x0c89, 0x0c8a, 0x0c8b, 0x0c8c, 0x0c8d, 0x0c8e, 0x0c8f,
+	0x0c94, 0x0c98, 0x0c99, 0x0c9a, 0x0c9b, 0x0c9d, 0x0ca2, 0x0ca3,
+	0x0ca4, 0x0ca5, 0x0ca6, 0x0ca7, 0x0cad, 0x0cae, 0x0caf, 0x0cb0,
+	0x0cb1, 0x0cb6, 0x0cb7, 0x0cb8, 0x0cba, 0x0cbb, 0x0cbc, 0x0cbd,
+	0x0cbe, 0x0cbf, 0x0cc0, 0x0cc1, 0x0cc2, 0x0cc3, 0x0cc4, 0x0cc5,
+	0x0cc6, 0x0cc8, 0x0cc9, 0x0cca, 0x0ccb, 0x0ccc, 0x0ccd, 0x0cd4,
+	0x0cd5, 0x0cd6, 0x0cd7, 0x0cd8, 0x0cd9, 0x0cde, 0x0ce5, 0x0ce9,
+	0x0cf1, 0x0cf2, 0x0cf3, 0x0cf4, 0x0cf5, 0x0cf6, 0x0cf7, 0x0cf8,
+	0x0cf9, 0x0cfa, 0x0cfc, 0x0cff, 0x0d06, 0x0d08, 0x0d0b, 0x0d0c,
+	0x0d0d, 0x0d0e, 0x0d0f, 0x0d10, 0x0d11, 0x0d12, 0x0d13, 0x0d14,
+	0x0d15, 0x0d16, 0x0d17, 0x0d18, 0x0d19, 0x0d28, 0x0d32, 0x0d33,
+	0x0d34, 0x0d35, 0x0d3a, 0x0d3c, 0x0d3d, 0x0d3e, 0x0d3f, 0x0d40,
+	0x0d41, 0x0d42, 0x0d46, 0x0d48, 0x0d49, 0x0d4a, 0x0d4b, 0x0d4c,
+	0x0d4d, 0x0d4e, 0x0d4f, 0x0d50, 0x0d51, 0x0d53, 0x0d54, 0x0d55,
+	0x0d56, 0x0d57, 0x0d5c, 0x0d5e, 0x0d5f, 0x0d60, 0x0d61, 0x0d62,
+	0x0d63, 0x0d64, 0x0d65, 0x0d66, 0x0d67, 0x0d68, 0x0d69, 0x0d6a,
+	0x0d6b, 0x0d70, 0x0d71, 0x0d72, 0x0d73, 0x0d76, 0x0d77, 0x0d78,
+	0x0d7a, 0x0d7b, 0x0d7c, 0x0d7d, 0x0d7e, 0x0d7f, 0x0d80, 0x0d81,
+	0x0d83, 0x0d87, 0x0d89, 0x0d8a, 0x0d8b, 0x0d8c, 0x0d8d, 0x0d8e,
+	0x0d8f, 0x0d90, 0x0d96, 0x0d97, 0x0d98, 0x0d99, 0x0d9a, 0x0d9b,
+	0x0d9c, 0x0d9d, 0x0d9e, 0x0d9f, 0x0da0, 0x0da1, 0x0da2, 0x0da3,
+	0x0da4, 0x0da7, 0x0da8, 0x0dab, 0x0dad, 0x0db0, 0x0db1, 0x0db2,
+	0x0db3, 0x0db4, 0x0db5, 0x0db7, 0x0dba, 0x0dbc, 0x0dbe, 0x0dbf,
+	0x0dc0, 0x0dc1, 0x0dc3, 0x0dc4, 0x0dc5, 0x0dc6, 0x0dc7, 0x0dcd,
+	0x0dd0, 0x0dd1, 0x0dd2, 0x0dd3, 0x0dd4, 0x0dd5, 0x0dd7, 0x0dd8,
+	0x0dd9, 0x0dda, 0x0ddb, 0x0ddd, 0x0dde, 0x0de0, 0x0de7, 0x0dea,
+	0x0ded, 0x0dee, 0x0def, 0x0df4, 0x0df6, 0x0df7, 0x0dfa, 0x0dfc,
+	0x0e03, 0x0e08, 0x0e0b, 0x0e0c, 0x0e0d, 0x0e0f, 0x0e16, 0x0e17,
+	0x0e1a, 0x0e1b, 0x0e20, 0x0e21, 0x0e22, 0x0e23, 0x0e25, 0x0e26,
+	0x0e30, 0x0e34, 0x0e35, 0x0e36, 0x0e38, 0x0e39, 0x0e3a, 0x0e3b,
+	0x0e41, 0x0e44, 0x0e48, 0x0e4a, 0x0e4c, 0x0e50, 0x0e55, 0x0e56,
+	0x0e5a, 0x0e5b, 0x0e5c, 0x0e5d, 0x0e5e, 0x0e66, 0x0e67, 0x0e6a,
+	0x0e6f, 0x0e70, 0x0e72, 0x0e75, 0x0e79, 0x0e7b, 0x0e7e, 0x0e82,
+	0x0e83, 0x0e8c, 0x0e8d, 0x0e8f, 0x0e90, 0x0e91, 0x0e92, 0x0e93,
+	0x0e95, 0x0e96, 0x0e97, 0x0e98, 0x0e99, 0x0e9a, 0x0e9b, 0x0e9c,
+	0x0e9f, 0x0ea0, 0x0ea6, 0x0ea7, 0x0ea8, 0x0ead, 0x0eb0, 0x0eb1,
+	0x0eb2, 0x0eb3, 0x0eb7, 0x0eb8, 0x0ebb, 0x0ebe, 0x0ebf, 0x0ec0,
+	0x0ec1, 0x0ec2, 0x0ec3, 0x0ec4, 0x0ec5, 0x0ec6, 0x0ec7, 0x0ecd,
+	0x0ece, 0x0ecf, 0x0ed1, 0x0ed2, 0x0ed3, 0x0ed5, 0x0eda, 0x0edf,
+	0x0ee0, 0x0ee1, 0x0ee2, 0x0ee3, 0x0ee4, 0x0eee, 0x0eef, 0x0ef0,
+	0x0ef1, 0x0ef2, 0x0ef3, 0x0ef4, 0x0ef5, 0x0ef6, 0x0ef7, 0x0efd,
+	0x0efe, 0x0f03, 0x0f06, 0x0f08, 0x0f0c, 0x0f0d, 0x0f0e, 0x0f0f,
+	0x0f11, 0x0f12, 0x0f13, 0x0f14, 0x0f18, 0x0f19, 0x0f1b, 0x0f1c,
+	0x0f1d, 0x0f21, 0x0f22, 0x0f23, 0x0f24, 0x0f2d, 0x0f2e, 0x0f2f,
+	0x0f30, 0x0f31, 0x0f32, 0x0f37, 0x0f38, 0x0f39, 0x0f3d, 0x0f41,
+	0x0f42, 0x0f44, 0x0f4b, 0x0f4c, 0x0f4d, 0x0f4e, 0x0f52, 0x0f53,
+	0x0f54, 0x0f55, 0x0f5c, 0x0f5d, 0x0f5f, 0x0f60, 0x0f61, 0x0f62,
+	0x0f63, 0x0f68, 0x0f69, 0x0f6a, 0x0f6e, 0x0f73, 0x0f78, 0x0f7c,
+	0x0f7d, 0x0f7e, 0x0f88, 0x0f8b, 0x0f8c, 0x0f8d, 0x0f8e, 0x0f8f,
+	0x0f97, 0x0f98, 0x0f9c, 0x0f9e, 0x0fa3, 0x0fa4, 0x0fa5, 0x0fa7,
+	0x0fa8, 0x0faf, 0x0fb0, 0x0fb1, 0x0fb2, 0x0fb6, 0x0fb8, 0x0fb9,
+	0x0fba, 0x0fbb, 0x0fc1, 0x0fc2, 0x0fc5, 0x0fc6, 0x0fca, 0x0fce,
+	0x0fcf, 0x0fd0, 0x0fd1, 0x0fd2, 0x0fd4, 0x0fd5, 0x0fd9, 0x0fda,
+	0x0fdc, 0x0fde, 0x0fe0, 0x0fe2, 0x0fe4, 0x0fe5, 0x0fe6, 0x0fe9,
+	0x0fea, 0x0feb, 0x0fec, 0x0fed, 0x0fee, 0x0fef, 0x0ff6, 0x0ff7,
+	0x0ffc, 0x0ffd, 0x0fff, 0x1000, 0x1001, 0x1003, 0x1004, 0x1005,
+	0x1006, 0x1009, 0x100a, 0x100b, 0x100d, 0x1010, 0x1011, 0x1012,
+	0x1013, 0x1014, 0x1015, 0x1016, 0x1017, 0x1019, 0x1020, 0x1022,
+	0x1025, 0x1026, 0x1027, 0x1028, 0x1029, 0x102a, 0x102b, 0x102c,
+	0x102d, 0x1031, 0x1032, 0x1033, 0x1038, 0x1039, 0x103a, 0x103d,
+	0x1043, 0x1044, 0x1046, 0x1048, 0x104b, 0x104c, 0x104d, 0x104f,
+	0x1050, 0x1053, 0x1054, 0x1055, 0x1056, 0x1057, 0x1058, 0x1059,
+	0x105b, 0x105c, 0x105d, 0x105e, 0x105f, 0x1060, 0x1063, 0x1065,
+	0x1068, 0x106a, 0x106c, 0x106d, 0x106e, 0x106f, 0x1076, 0x107b,
+	0x107d, 0x107e, 0x107f, 0x1082, 0x1083, 0x1084, 0x108a, 0x108b,
+	0x108c, 0x108e, 0x1091, 0x1099, 0x109a, 0x109b, 0x109f, 0x10a0,
+	0x10a3, 0x10a9, 0x10aa, 0x10ab, 0x10ac, 0x10ae, 0x10af, 0x10b5,
+	0x10b8, 0x10bb, 0x10bc, 0x10bd, 0x10bf, 0x10c3, 0x10c4, 0x10c5,
+	0x10c6, 0x10cb, 0x10cc, 0x10cd, 0x10ce, 0x10cf, 0x10d1, 0x10d2,
+	0x10d4, 0x10d5, 0x10d6, 0x10de, 0x10df, 0x10e0, 0x10e1, 0x10e2,
+	0x10ec, 0x10f0, 0x10f1, 0x10f5, 0x10fb, 0x10fd, 0x10fe, 0x1100,
+	0x1101, 0x1108, 0x110a, 0x1110, 0x1111, 0x1112, 0x1113, 0x111e,
+	0x112a, 0x112e, 0x112f, 0x1130, 0x1131, 0x1132, 0x1136, 0x113c,
+	0x113d, 0x113f, 0x1141, 0x1142, 0x1145, 0x1146, 0x1147, 0x114b,
+	0x114c, 0x114d, 0x114f, 0x115b, 0x1162, 0x1163, 0x1164, 0x1165,
+	0x1166, 0x1167, 0x1168, 0x116e, 0x116f, 0x1175, 0x117d, 0x117e,
+	0x1182, 0x1183, 0x1184, 0x1188, 0x1189, 0x118f, 0x1190, 0x1191,
+	0x1196, 0x1197, 0x1198, 0x1199, 0x119a, 0x119b, 0x11a0, 0x11a3,
+	0x11aa, 0x11ab, 0x11ac, 0x11b0, 0x11be, 0x11c0, 0x11c5, 0x11ca,
+	0x11db, 0x11e6, 0x11f5, 0x11f6, 0x11f7, 0x1203, 0x1209, 0x120e,
+	0x120f, 0x1210, 0x121e, 0x1220, 0x1221, 0x1223, 0x1228, 0x1230,
+	0x1233, 0x1234, 0x1235, 0x1241, 0x124a, 0x124b, 0x124c, 0x125c,
+	0x125f, 0x1260, 0x1264, 0x1266, 0x1267, 0x126c, 0x126d, 0x126e,
+	0x126f, 0x1274, 0x1275, 0x1278, 0x1283, 0x1286, 0x1291, 0x1292,
+	0x1293, 0x1294, 0x1297, 0x129b, 0x12a7, 0x12ab, 0x12b8, 0x12b9,
+	0x12ba, 0x12bd, 0x12c4, 0x12cf, 0x12d1, 0x12d2, 0x12d6, 0x12d7,
+	0x12d8, 0x12e6, 0x12ef, 0x12f2, 0x12f5, 0x12f7, 0x12fd, 0x12ff,
+	0x1307, 0x1308, 0x1310, 0x1312, 0x1313, 0x131d, 0x1325, 0x132a,
+	0x132b, 0x133e, 0x1342, 0x1343, 0x1345, 0x1347, 0x1348, 0x134c,
+	0x134e, 0x1357, 0x135f, 0x1366, 0x136b, 0x136e, 0x1370, 0x1371,
+	0x1376, 0x1377, 0x137b, 0x1385, 0x138a, 0x138e, 0x1390, 0x1391,
+	0x1395, 0x1397, 0x1398, 0x13ad, 0x13b0, 0x13b1, 0x13b2, 0x13b3,
+	0x13ba, 0x13be, 0x13ca, 0x13cf, 0x13d0, 0x13d1, 0x13d2, 0x13d3,
+	0x13d7, 0x13dc, 0x13dd, 0x13e1, 0x13e5, 0x13e6, 0x13ea, 0x13ec,
+	0x13ee, 0x13fd, 0x13fe, 0x1400, 0x1402, 0x1403, 0x1409, 0x140e,
+	0x1410, 0x1415, 0x1419, 0x1421, 0x1424, 0x1429, 0x142a, 0x142b,
+	0x1430, 0x1431, 0x1435, 0x1436, 0x143c, 0x1443, 0x1446, 0x1451,
+	0x1452, 0x1453, 0x1456, 0x1457, 0x145f, 0x1460, 0x1461, 0x1462,
+	0x1472, 0x147a, 0x147e, 0x147f, 0x1482, 0x1484, 0x1485, 0x1487,
+	0x148e, 0x148f, 0x1491, 0x1493, 0x1497, 0x1498, 0x149a, 0x14aa,
+	0x14ad, 0x14ae, 0x14af, 0x14b0, 0x14b2, 0x14c0, 0x14c2, 0x14c8,
+	0x14cd, 0x14d8, 0x14dd, 0x14e0, 0x14e1, 0x14e5, 0x14ea, 0x14ed,
+	0x14f7, 0x1500, 0x1501, 0x1509, 0x1513, 0x1514, 0x1516, 0x1518,
+	0x1519, 0x151f, 0x1520, 0x1524, 0x1527, 0x1529, 0x152a, 0x152b,
+	0x152d, 0x152e, 0x1532, 0x153b, 0x1546, 0x1547, 0x154a, 0x154b,
+	0x154d, 0x154e, 0x154f, 0x1554, 0x1557, 0x1568, 0x156f, 0x1570,
+	0x157b, 0x157e, 0x1582, 0x1587, 0x158d, 0x158e, 0x1598, 0x15a2,
+	0x15a4, 0x15a8, 0x15a9, 0x15aa, 0x15ad, 0x15ba, 0x15c0, 0x15c2,
+	0x15c5, 0x15c6, 0x15c8, 0x15c9, 0x15ca, 0x15d5, 0x15d9, 0x15dc,
+	0x15e0, 0x15e1, 0x15e4, 0x15e8, 0x15e9, 0x15ec, 0x15f4, 0x1604,
+	0x1605, 0x1606, 0x1608, 0x160a, 0x160e, 0x1614, 0x1617, 0x1619,
+	0x161c, 0x1621, 0x1628, 0x162a, 0x162f, 0x1630, 0x1631, 0x1645,
+	0x1649, 0x164a, 0x164c, 0x1657, 0x165b, 0x165c, 0x1660, 0x1667,
+	0x1668, 0x1669, 0x166a, 0x1677, 0x1679, 0x1680, 0x1681, 0x1682,
+	0x1684, 0x1685, 0x1686, 0x1687, 0x1688, 0x1689, 0x168c, 0x1690,
+	0x1696, 0x1697, 0x16a5, 0x16a6, 0x16ab, 0x16ac, 0x16b4, 0x16b5,
+	0x16c0, 0x16ca, 0x16cc, 0x16d0, 0x16d1, 0x16d3, 0x16d5, 0x16d6,
+	0x16d8, 0x16dc, 0x16de, 0x16df, 0x16f0, 0x16f5, 0x1706, 0x1707,
+	0x170b, 0x170d, 0x1711, 0x1724, 0x1725, 0x1726, 0x172f, 0x1733,
+	0x1736, 0x1737, 0x173a, 0x173d, 0x1740, 0x1743, 0x1748, 0x174c,
+	0x174f, 0x1753, 0x1756, 0x1759, 0x1761, 0x1772, 0x1776, 0x177f,
+	0x1781, 0x1782, 0x1784, 0x1787, 0x1788, 0x1796, 0x1797, 0x1799,
+	0x179d, 0x17a0, 0x17a4, 0x17a5, 0x17a7, 0x17a8, 0x17b3, 0x17b5,
+	0x17ba, 0x17c3, 0x17cc, 0x17cf, 0x17d0, 0x17d3, 0x17e9, 0x17eb,
+	0x17ef, 0x17f4, 0x17f5, 0x17f6, 0x1809, 0x1822, 0x1831, 0x1832,
+	0x183d, 0x1843, 0x1849, 0x1852, 0x1854, 0x185b, 0x1861, 0x1862,
+	0x1870, 0x1871, 0x1873, 0x187c, 0x187f, 0x1892, 0x1894, 0x1897,
+	0x189f, 0x18a4, 0x18a5, 0x18b1, 0x18b4, 0x18b6, 0x18b7, 0x18c5,
+	0x18cd, 0x18d1, 0x18d5, 0x18d9, 0x18dc, 0x18dd, 0x18e3, 0x18e8,
+	0x18ea, 0x18ec, 0x18f8, 0x18fb, 0x18fd, 0x1901, 0x1908, 0x190d,
+	0x1914, 0x1915, 0x191c, 0x1923, 0x1926, 0x192f, 0x1930, 0x1931,
+	0x1934, 0x1938, 0x1941, 0x1943, 0x1949, 0x194f, 0x1951, 0x1953,
+	0x1954, 0x195d, 0x1965, 0x1967, 0x196b, 0x1970, 0x1975, 0x1976,
+	0x1977, 0x197d, 0x1989, 0x198f, 0x1990, 0x1995, 0x1996, 0x199b,
+	0x199e, 0x199f, 0x19a8, 0x19ab, 0x19af, 0x19b2, 0x19b4, 0x19b5,
+	0x19b6, 0x19b9, 0x19c2, 0x19ca, 0x19cf, 0x19d2, 0x19db, 0x19e1,
+	0x19e8, 0x19ef, 0x19f7, 0x19fa, 0x19ff, 0x1a08, 0x1a0a, 0x1a12,
+	0x1a1d, 0x1a25, 0x1a2a, 0x1a2c, 0x1a32, 0x1a34, 0x1a36, 0x1a40,
+	0x1a41, 0x1a44, 0x1a4a, 0x1a4b, 0x1a5a, 0x1a61, 0x1a6a, 0x1a6d,
+	0x1a6e, 0x1a6f, 0x1a72, 0x1a79, 0x1a7b, 0x1a7c, 0x1a81, 0x1a86,
+	0x1a89, 0x1a8b, 0x1a8d, 0x1a98, 0x1aa4, 0x1aa5, 0x1aa6, 0x1aad,
+	0x1ab1, 0x1acb, 0x1acc, 0x1ad1, 0x1ad4, 0x1adb, 0x1ae4, 0x1ae7,
+	0x1aed, 0x1aef, 0x1af1, 0x1afe, 0x1b04, 0x1b0e, 0x1b1c, 0x1b1f,
+	0x1b20, 0x1b22, 0x1b26, 0x1b27, 0x1b28, 0x1b32, 0x1b36, 0x1b3b,
+	0x1b3f, 0x1b47, 0x1b48, 0x1b52, 0x1b59, 0x1b5a, 0x1b65, 0x1b71,
+	0x1b72, 0x1b73, 0x1b75, 0x1b76, 0x1b80, 0x1b86, 0x1b88, 0x1b8c,
+	0x1b8d, 0x1b8e, 0x1b8f, 0x1b96, 0x1b98, 0x1b99, 0x1ba1, 0x1ba2,
+	0x1ba4, 0x1ba6, 0x1ba8, 0x1bad, 0x1bae, 0x1bbb, 0x1bc4, 0x1bc5,
+	0x1bc7, 0x1bce, 0x1bcf, 0x1bd0, 0x1bd5, 0x1bde, 0x1bef, 0x1bf0,
+	0x1bf5, 0x1bf6, 0x1bfd, 0x1c02, 0x1c04, 0x1c0c, 0x1c0d, 0x1c10,
+	0x1c13, 0x1c1a, 0x1c1b, 0x1c1f, 0x1c20, 0x1c21, 0x1c22, 0x1c26,
+	0x1c27, 0x1c29, 0x1c31, 0x1c34, 0x1c37, 0x1c3d, 0x1c3e, 0x1c40,
+	0x1c49, 0x1c4f, 0x1c6b, 0x1c6c, 0x1c73, 0x1c77, 0x1c78, 0x1c79,
+	0x1c7a, 0x1c7b, 0x1c83, 0x1c87, 0x1c88, 0x1c89, 0x1c8e, 0x1c98,
+	0x1c9e, 0x1ca0, 0x1ca1, 0x1cac, 0x1cb3, 0x1cb4, 0x1cb6, 0x1cbe,
+	0x1cbf, 0x1cc0, 0x1cca, 0x1ccd, 0x1cd4, 0x1cd5, 0x1cd6, 0x1cde,
+	0x1cdf, 0x1ce0, 0x1ce1, 0x1cf1, 0x1cfc, 0x1cfd, 0x1d03, 0x1d07,
+	0x1d08, 0x1d09, 0x1d0a, 0x1d0b, 0x1d0f, 0x1d14, 0x1d17, 0x1d19,
+	0x1d1f, 0x1d20, 0x1d27, 0x1d34, 0x1d45, 0x1d4d, 0x1d50, 0x1d57,
+	0x1d5b, 0x1d5c, 0x1d6b, 0x1d90, 0x1d9d, 0x1de1, 0x1e0e, 0x1e10,
+	0x1e17, 0x1e1d, 0x1e1f, 0x1e29, 0x1e3d, 0x1e41, 0x1e4e, 0x1e54,
+	0x1e68, 0x1e71, 0x1e74, 0x1e7d, 0x1ea7, 0x1ebb, 0x1eda, 0x1edb,
+	0x1ee8, 0x1ef6, 0x1f28, 0x1f3a, 0x1f44, 0x1f48, 0x1f4d, 0x1f6f,
+	0x1f75, 0x1f82, 0x1f84, 0x1f87, 0x1f9b, 0x1fab, 0x1fbd, 0x1fc9,
+	0x1fde, 0x1fe7, 0x1ff7, 0x1fff, 0x2001, 0x2002, 0x2003, 0x200c,
+	0x2013, 0x2019, 0x203d, 0x2040, 0x2047, 0x2058, 0x2077, 0x2080,
+	0x2086, 0x2087, 0x20a0, 0x20b1, 0x20b3, 0x20b7, 0x20ce, 0x20df,
+	0x20f1, 0x20f4, 0x20f7, 0x2100, 0x2101, 0x2109, 0x2113, 0x2149,
+	0x2162, 0x2184, 0x21a1, 0x21d6, 0x2207, 0x2222, 0x2227, 0x2232,
+	0x2233, 0x2237, 0x225d, 0x228d, 0x22a6, 0x22b8, 0x22b9, 0x22ba,
+	0x2304, 0x2318, 0x2341, 0x2357, 0x2373, 0x2375, 0x2406, 0x2443,
+	0x2478, 0x248a, 0x249c, 0x24e1, 0x2516, 0x2548, 0x2632, 0x2639,
+	0x2650, 0x2659, 0x2676, 0x2730, 0x2735, 0x273f, 0x2770, 0x27b8,
+	0x2821, 0x2899, 0x289b, 0x2931, 0x2939, 0x2a03, 0x2a37, 0x2a45,
+	0x2b24, 0x2c02, 0x2c1a, 0x2c7c, 0x2dcf, 0x2fb2, 0x3125, 0x3136,
+	0x3176, 0x3195, 0x3275, 0x3333, 0x3334, 0x3340, 0x3344, 0x3504,
+	0x3538, 0x3579, 0x357d, 0x3636, 0x3838, 0x3923, 0x40bb, 0x4101,
+	0x4102, 0x413c, 0x4146, 0x4168, 0x4242, 0x4255, 0x4317, 0x4348,
+	0x4572, 0x4586, 0x4670, 0x4752, 0x4757, 0x4766, 0x4855, 0x4971,
+	0x4d46, 0x5032, 0x5041, 0x50c2, 0x5173, 0x5219, 0x5345, 0x534c,
+	0x5354, 0x544d, 0x5543, 0x5555, 0x55aa, 0x5654, 0x5656, 0x595a,
+	0x5986, 0x59e3, 0x5a57, 0x6000, 0x601a, 0x6189, 0x6244, 0x6253,
+	0x636c, 0x6472, 0x6547, 0x6615, 0x6666, 0x6677, 0x6891, 0x695c,
+	0x6993, 0x6a75, 0x7104, 0x726c, 0x734c, 0x7373, 0x7392, 0x8086,
+	0x8087, 0x80ee, 0x8282, 0x8341, 0x8564, 0x8644, 0x8e06, 0x9016,
+	0x9022, 0x9148, 0x9710, 0x9849, 0x9999, 0x99fa, 0x9ac4, 0x9e88,
+	0xa128, 0xa168, 0xa600, 0xa727, 0xaaaa, 0xabcd, 0xb58e, 0xc216,
+	0xc251, 0xcace, 0xcd12, 0xd208, 0xd209, 0xd904, 0xe4e4, 0xeb03,
+	0xeb1a, 0xeb2a, 0xef18, 0xf003, 0xf182, 0xf4ec, 0xf4ed, 0xf766,
+	0xfc08, 0xffee,
+};
 
-	for(i=0; i<sizeof(usb_vendor)/sizeof(usb_vendor[0]); i++) {
-		if (usb_vendor[i].vid == vid) {
-			return usb_vendor[i].name;
-		}
-	}
-	return NULL;
-}
+static const uint32_t usb_vendor_name[3002] = {
+	0, 18, 25, 34, 58, 66, 73, 83,
+	99, 126, 151, 58, 155, 159, 167, 203,
+	219, 235, 262, 262, 281, 285, 324, 357,
+	363, 379, 403, 427, 439, 460, 472, 480,
+	488, 505, 526, 540, 554, 580, 612, 628,
+	639, 667, 680, 703, 732, 756, 766, 811,
+	821, 836, 858, 889, 911, 921, 931, 954,
+	975, 998, 1003, 1021, 1058, 1087, 1110, 1140,
+	1166, 1180, 1193, 1229, 1255, 1260, 1269, 1294,
+	1311, 1334, 1354, 1372, 1405, 1433, 1465, 1500,
+	1533, 1568, 1581, 1603, 1615, 1647, 1657, 1668,
+	1680, 1703, 1722, 1735, 1193, 1755, 1783, 1800,
+	1825, 1854, 1879, 1907, 1932, 1946, 1963, 1984,
+	1999, 2013, 2039, 2062, 2084, 2103, 2127, 2131,
+	2140, 2159, 2182, 2201, 2211, 2235, 2272, 2287,
+	2310, 2341, 2362, 2395, 2429, 2449, 2465, 2478,
+	2499, 2515, 2543, 2567, 2583, 2609, 2623, 2652,
+	2664, 2690, 2729, 2744, 2774, 2796, 2813, 2842,
+	2878, 2902, 2934, 2939, 2964, 2980, 3013, 3027,
+	3041, 3061, 3072, 3101, 3119, 3139, 3159, 3173,
+	3192, 3202, 3217, 3238, 3256, 3269, 3287, 3307,
+	3334, 3370, 3382, 3412, 3423, 3451, 3475, 3496,
+	3515, 3535, 3564, 3577, 3603, 3628, 3653, 3669,
+	3691, 3715, 3732, 3750, 2465, 3777, 3816, 3839,
+	3849, 3871, 3883, 3903, 3922, 3947, 3965, 3977,
+	3989, 4007, 4017, 4045, 4071, 4082, 4107, 4125,
+	4152, 4172, 4194, 4227, 4245, 4255, 4276, 4314,
+	4332, 4364, 4377, 4415, 4440, 4453, 4478, 4503,
+	4515, 4537, 4553, 4573, 4592, 4602, 4629, 4641,
+	4657, 4682, 4698, 4716, 4743, 4770, 4793, 4811,
+	4835, 4847, 4863, 4885, 4912, 4923, 4935, 4956,
+	4975, 4998, 5015, 5044, 5057, 5073, 5097, 5124,
+	5134, 5173, 5201, 2813, 5230, 5258, 5283, 5309,
+	5322, 5346, 5365, 5389, 5410, 5448, 5476, 5498,
+	5507, 5520, 5540, 1657, 5558, 5579, 5608, 5619,
+	5633, 5650, 5670, 5687, 5714, 5730, 5748, 5770,
+	5790, 5811, 5848, 5878, 5894, 5910, 5915, 5936,
+	5961, 5973, 5997, 6013, 6030, 6044, 6070, 6095,
+	6132, 6171, 6190, 6215, 6225, 6242, 6267, 6282,
+	6288, 6311, 6337, 6361, 6386, 6418, 1405, 6441,
+	6464, 6492, 6515, 6529, 6551, 6566, 6592, 6631,
+	6646, 6680, 6710, 6726, 6755, 6805, 6823, 821,
+	6844, 6857, 6879, 6895, 6920, 6934, 6949, 6968,
+	6988, 7001, 7032, 7048, 7059, 7069, 7083, 7106,
+	7126, 7151, 7168, 7218, 7235, 7253, 7287, 7315,
+	7332, 7361, 7373, 7392, 7415, 7445, 7472, 7493,
+	7509, 7528, 7555, 7571, 7646, 7669, 7698, 7725,
+	7743, 7752, 7767, 7781, 7791, 7802, 7818, 7846,
+	7860, 7874, 7908, 7953, 7982, 8017, 8051, 8056,
+	8072, 8082, 8110, 8125, 8134, 8157, 8175, 8190,
+	8203, 8220, 8233, 8259, 8278, 8306, 8333, 8379,
+	8393, 8401, 8413, 8435, 8452, 8473, 8498, 8516,
+	8528, 8547, 8563, 8570, 8596, 8624, 8649, 8674,
+	8700, 8731, 8764, 8777, 8805, 8828, 8856, 8867,
+	8882, 8892, 8924, 8942, 8965, 8988, 9008, 9019,
+	9038, 9068, 9092, 9109, 9121, 821, 9145, 9175,
+	9203, 9238, 9258, 9273, 9287, 9316, 9329, 9359,
+	9380, 9398, 9428, 9447, 9474, 9489, 9503, 9535,
+	9563, 9588, 9603, 9617, 3013, 9665, 9680, 9711,
+	9719, 9732, 9746, 9765, 9790, 9806, 9825, 9847,
+	9878, 9907, 9928, 9953, 9982, 10011, 10031, 10049,
+	10073, 10094, 10114, 10144, 10161, 10181, 10196, 10219,
+	10240, 10250, 10263, 10272, 10284, 10300, 10318, 10335,
+	10358, 10375, 10396, 10421, 10439, 10468, 10487, 10527,
+	10534, 10549, 10571, 10584, 10606, 10625, 10645, 10676,
+	10690, 10710, 10749, 10777, 10788, 10812, 10845, 10856,
+	10874, 10887, 10917, 10952, 10977, 11002, 11030, 11051,
+	11082, 11113, 11150, 11158, 11182, 11212, 11242, 11256,
+	11270, 11290, 11303, 11345, 11358, 11375, 11389, 11417,
+	11453, 11480, 11503, 11526, 11553, 11587, 11622, 11658,
+	11689, 11724, 11747, 11759, 11783, 11809, 11830, 11844,
+	11859, 1783, 11873, 11912, 11941, 11968, 11994, 12018,
+	12041, 12059, 12070, 12096, 12101, 12122, 12142, 12164,
+	12206, 12233, 12263, 12275, 12291, 12307, 12334, 12359,
+	12369, 12396, 12427, 12454, 12479, 12499, 12506, 12531,
+	6013, 12549, 12600, 12633, 12658, 12683, 12710, 12736,
+	12758, 12772, 12781, 12808, 12832, 12846, 12860, 12893,
+	12908, 12923, 12936, 12940, 12981, 12995, 12758, 13004,
+	13027, 13053, 13078, 13091, 13119, 13131, 13184, 5201,
+	13231, 13259, 13275, 13292, 13306, 13334, 13352, 13381,
+	13407, 13418, 13432, 13448, 13469, 13483, 13512, 13524,
+	13552, 13575, 13586, 13619, 13625, 13642, 13662, 13670,
+	13686, 13724, 13758, 13797, 13828, 13841, 13857, 13890,
+	13900, 13915, 13931, 13965, 13977, 14007, 14035, 14049,
+	14073, 14084, 14104, 14127, 14143, 14173, 14181, 14188,
+	14201, 5173, 14215, 14241, 14255, 14263, 14287, 14319,
+	14354, 14380, 14389, 14423, 14451, 14476, 14499, 14524,
+	14548, 14568, 14593, 14629, 14655, 14676, 14697, 14726,
+	14748, 14764, 14788, 14798, 14837, 14854, 14877, 14911,
+	14933, 14943, 1405, 14955, 14973, 15000, 15031, 15058,
+	15089, 15108, 15139, 15163, 15179, 15189, 15203, 15231,
+	15257, 15293, 15314, 15335, 15349, 15381, 15426, 15432,
+	15447, 15474, 15488, 15536, 15565, 15590, 15606, 15632,
+	15647, 15669, 15689, 15727, 15741, 15751, 15761, 15790,
+	15802, 15815, 15846, 15869, 15900, 15921, 15937, 15951,
+	15972, 15993, 16020, 16047, 16076, 16084, 16109, 16122,
+	16150, 16164, 16188, 16213, 16245, 16256, 16269, 16281,
+	16311, 16340, 16384, 16410, 16429, 16456, 16484, 16499,
+	16522, 16534, 16558, 16585, 16593, 16622, 16641, 16669,
+	16688, 16702, 16714, 16719, 16733, 16740, 16754, 16774,
+	16787, 16801, 16834, 16870, 16893, 16920, 16942, 16957,
+	16972, 17002, 17010, 17017, 17023, 17047, 17062, 17089,
+	17101, 17110, 17123, 17135, 17156, 17166, 17185, 17195,
+	17214, 17228, 17253, 17283, 17297, 17320, 17339, 17368,
+	17382, 17392, 17433, 17446, 17468, 17484, 17500, 17530,
+	17543, 17572, 17601, 17626, 17656, 17664, 17688, 17695,
+	17709, 17730, 17746, 17762, 17785, 17805, 17824, 17851,
+	17872, 17899, 17921, 17949, 17976, 17986, 18005, 18022,
+	18033, 18058, 18087, 18124, 18156, 18161, 18194, 18217,
+	18231, 12981, 18254, 18262, 58, 18282, 18289, 18312,
+	18335, 18360, 18389, 18414, 18431, 18459, 18496, 18509,
+	18519, 18528, 18543, 18550, 18567, 18579, 18593, 18606,
+	18623, 18634, 18669, 18680, 18691, 18717, 18734, 18766,
+	18775, 18800, 18824, 18839, 18861, 18879, 18907, 18921,
+	18953, 18961, 18967, 18997, 19029, 19034, 19052, 19069,
+	19085, 19105, 19138, 19145, 19163, 19186, 18907, 19200,
+	19223, 19254, 19295, 19314, 19329, 19338, 19352, 19364,
+	19386, 19400, 19427, 19439, 19476, 19496, 19519, 19568,
+	19588, 19609, 19636, 19646, 19662, 19673, 19678, 19694,
+	19711, 19722, 19757, 19782, 19795, 19816, 19825, 19837,
+	19856, 19866, 19888, 19915, 19923, 19945, 19951, 19985,
+	20010, 20028, 20051, 20070, 20083, 20112, 20124, 20161,
+	20188, 20208, 20236, 20270, 20289, 20301, 20327, 20349,
+	20367, 20392, 20394, 20407, 20420, 20434, 20443, 20465,
+	20496, 20520, 20543, 20575, 20605, 20619, 20630, 20649,
+	20671, 20694, 20710, 20737, 20745, 20788, 20807, 20813,
+	20835, 20867, 20882, 20898, 20921, 20938, 20963, 20974,
+	20995, 21027, 21038, 21102, 21136, 21161, 21183, 21205,
+	21231, 21246, 21262, 21278, 21296, 21317, 21329, 21342,
+	21360, 21375, 21381, 21399, 21411, 21469, 21492, 21543,
+	21567, 21600, 21614, 21641, 21658, 21672, 21695, 21703,
+	21717, 21738, 21752, 21783, 21798, 21819, 21850, 21881,
+	21896, 21910, 21946, 21957, 21974, 22000, 22021, 22051,
+	22056, 22076, 22094, 22107, 22121, 22148, 22173, 22189,
+	22199, 22216, 22234, 22248, 22255, 22272, 22299, 22326,
+	22344, 22357, 22397, 22423, 22447, 22470, 22484, 22513,
+	22531, 22556, 22573, 22598, 22618, 22645, 22665, 22674,
+	22706, 22738, 22751, 22760, 22799, 22817, 22842, 22875,
+	22898, 22922, 22944, 22967, 22991, 23001, 23033, 23064,
+	23097, 23112, 23141, 23152, 23189, 23212, 23234, 23263,
+	23271, 23283, 23307, 23331, 23353, 23365, 23381, 23395,
+	23408, 23429, 23442, 23456, 23487, 23509, 23544, 23559,
+	23585, 23593, 23606, 23613, 23627, 23644, 23672, 23684,
+	23699, 23727, 23742, 23769, 23783, 23797, 23827, 23845,
+	23863, 23869, 23884, 23892, 23910, 23934, 23964, 23979,
+	17010, 23991, 24013, 24026, 24036, 24057, 24085, 24113,
+	24127, 24140, 24169, 24184, 24208, 24221, 24250, 24263,
+	24294, 24322, 24353, 24385, 24400, 24427, 24449, 24470,
+	24500, 24520, 24537, 24549, 24562, 24581, 24609, 24625,
+	24642, 24655, 24682, 24700, 24727, 24760, 24781, 24809,
+	24832, 24860, 24889, 24919, 24929, 24944, 24959, 24965,
+	24971, 24992, 25020, 25034, 25051, 25072, 25105, 25123,
+	25130, 25152, 25182, 25214, 25227, 25242, 25253, 25275,
+	25303, 25328, 25335, 25350, 25378, 25389, 25405, 25411,
+	25422, 25463, 25489, 25515, 25533, 25551, 25562, 25587,
+	25606, 25634, 25658, 25692, 25714, 25727, 25743, 25766,
+	25785, 25815, 25845, 25865, 25899, 25920, 25928, 25940,
+	25947, 25981, 25992, 26004, 26028, 26042, 26072, 26094,
+	26112, 26133, 26141, 26147, 26160, 26175, 26199, 26237,
+	26266, 26288, 26300, 26321, 26345, 26379, 26395, 26419,
+	26445, 26452, 26470, 26481, 26492, 26506, 26520, 26540,
+	26559, 26592, 26601, 26624, 26639, 26648, 26659, 26669,
+	26685, 26692, 26718, 26756, 26778, 26799, 26823, 26857,
+	26887, 26908, 26920, 26934, 26955, 26978, 26999, 27029,
+	27039, 27080, 27088, 27115, 27135, 27161, 27171, 27186,
+	27205, 27220, 27232, 27248, 27271, 27296, 27314, 27335,
+	27363, 27391, 27408, 27443, 27468, 27480, 27507, 27518,
+	27542, 27561, 27585, 27615, 27638, 27650, 27667, 27679,
+	27705, 27733, 27752, 27776, 27814, 27830, 27846, 27868,
+	27880, 27901, 27927, 27945, 27962, 27987, 28017, 28039,
+	28060, 28099, 28131, 28155, 28178, 28192, 28207, 28228,
+	28254, 28278, 28293, 28313, 28327, 28348, 28365, 28390,
+	28407, 28438, 28468, 28484, 28510, 28559, 28578, 28594,
+	28615, 28642, 28666, 28691, 28720, 28736, 28753, 28769,
+	28782, 28794, 28824, 28846, 28863, 28889, 28925, 28954,
+	28982, 29019, 29033, 29044, 29073, 29084, 29108, 29135,
+	29180, 29184, 29204, 29228, 29254, 29268, 29275, 29303,
+	20301, 29321, 29331, 29349, 29378, 29394, 29413, 29440,
+	29446, 29472, 29501, 29529, 29538, 29552, 29567, 29582,
+	29603, 29620, 29641, 29659, 29696, 29716, 29734, 29746,
+	29758, 29783, 29796, 29819, 29840, 29856, 29868, 29878,
+	29916, 29920, 29963, 29976, 29992, 30006, 30021, 30035,
+	30044, 30075, 30092, 30122, 30144, 30167, 30182, 30193,
+	30216, 30236, 30274, 30294, 30325, 30354, 30381, 30406,
+	30429, 30440, 30478, 30507, 30531, 30552, 30556, 30589,
+	30609, 30621, 30648, 30660, 30677, 30689, 30721, 30751,
+	30774, 30797, 30826, 30853, 30867, 30885, 30891, 30908,
+	30929, 30938, 30963, 30982, 31005, 31022, 31029, 31035,
+	31046, 31068, 31093, 31121, 31154, 31169, 31197, 31205,
+	31224, 31241, 31270, 31300, 31317, 31354, 31391, 31418,
+	31463, 31488, 31519, 31544, 31563, 31575, 31588, 31599,
+	31605, 31622, 31640, 31668, 31677, 31692, 31715, 31740,
+	31753, 31773, 31792, 31807, 31825, 31853, 31859, 31897,
+	31913, 31940, 31961, 31993, 32006, 32023, 32040, 32056,
+	32071, 32104, 32117, 32135, 32156, 32189, 32199, 32221,
+	32249, 32261, 32283, 32308, 32325, 32345, 32370, 32380,
+	32397, 32411, 32450, 32463, 32473, 32509, 32513, 32552,
+	32567, 32594, 32611, 32639, 32665, 32693, 32706, 32724,
+	32768, 32805, 32823, 32842, 32861, 32868, 32877, 32897,
+	32906, 32921, 32949, 32968, 32981, 33004, 33017, 33029,
+	33053, 33076, 33099, 33118, 33130, 33140, 33162, 33200,
+	33225, 33241, 33262, 33276, 33280, 33294, 33326, 33330,
+	33360, 33373, 33395, 33418, 33446, 33473, 33489, 33511,
+	33535, 33558, 33585, 33621, 33646, 33685, 33707, 33738,
+	33751, 33771, 33795, 33807, 33825, 33855, 33881, 33917,
+	33945, 33958, 33985, 34010, 34041, 34066, 34092, 34099,
+	34124, 34157, 34176, 34182, 34200, 34216, 34259, 34295,
+	34332, 34349, 34362, 34379, 34391, 34411, 34436, 34464,
+	27088, 34502, 34537, 34547, 34567, 34578, 34590, 34629,
+	34653, 34691, 34715, 34748, 34762, 34775, 34810, 34833,
+	34850, 34867, 34895, 34933, 34940, 34963, 34988, 35003,
+	35029, 35047, 35081, 35096, 35125, 35138, 35161, 35170,
+	35204, 35215, 35240, 35270, 35278, 35298, 35329, 35367,
+	35400, 35427, 35455, 35477, 35485, 35500, 35513, 35524,
+	35546, 35553, 35561, 35587, 35607, 35620, 35651, 35673,
+	35695, 35709, 35738, 35762, 35781, 35797, 35830, 35858,
+	35872, 35884, 35917, 35934, 35983, 36001, 36022, 36051,
+	36085, 36101, 36145, 36185, 36213, 36242, 36263, 36276,
+	36304, 36311, 36346, 36376, 36397, 36410, 36436, 36448,
+	36489, 36514, 20605, 36545, 36560, 36575, 36605, 36635,
+	36656, 36683, 36709, 36727, 36764, 36787, 36812, 36824,
+	36840, 36853, 36875, 36899, 36921, 36935, 36950, 36959,
+	36982, 37006, 37029, 37038, 37053, 37078, 37089, 37122,
+	37154, 37174, 37199, 37214, 37243, 37274, 37301, 37318,
+	37335, 37363, 37385, 37397, 37427, 37457, 37467, 37487,
+	37502, 37524, 37542, 37566, 37591, 37615, 37647, 37673,
+	37692, 37722, 37738, 37758, 37771, 37782, 37811, 37836,
+	37856, 37877, 37896, 37932, 37964, 37974, 37988, 38006,
+	38028, 38045, 38068, 38095, 38104, 38133, 38149, 38170,
+	38194, 38206, 38227, 38251, 38285, 38315, 38329, 38365,
+	38387, 38412, 38434, 38465, 38481, 38506, 38522, 38545,
+	38572, 38604, 38613, 38642, 38669, 38685, 38704, 38733,
+	38773, 38813, 38827, 38845, 38871, 38892, 38901, 38914,
+	38942, 38963, 38979, 38992, 39018, 39038, 39042, 39067,
+	39087, 39101, 39113, 39133, 39146, 39183, 39206, 39234,
+	39248, 39261, 39277, 39292, 39312, 39341, 39356, 39371,
+	39394, 39415, 39441, 39472, 39493, 39524, 39534, 39548,
+	39560, 39591, 39613, 39638, 39669, 39688, 39712, 39737,
+	39776, 39805, 39826, 39849, 39861, 39884, 39915, 39935,
+	39957, 39968, 39986, 40009, 40024, 40049, 40074, 40085,
+	40091, 40119, 40143, 40168, 40184, 40196, 40214, 40235,
+	40275, 40289, 40300, 40312, 40329, 40364, 40376, 40397,
+	40421, 40434, 40447, 40464, 40494, 40508, 40531, 40550,
+	40585, 40620, 40647, 40668, 40702, 40740, 40774, 40781,
+	40803, 40816, 40828, 40840, 40853, 40876, 40902, 40927,
+	40951, 40963, 40986, 41009, 41021, 41037, 41047, 41051,
+	41059, 41086, 41115, 41147, 41174, 41191, 41220, 41240,
+	41255, 41266, 41296, 41326, 41365, 41388, 41405, 41440,
+	41465, 41493, 41543, 41564, 41598, 41629, 41658, 41697,
+	41713, 41733, 41751, 41780, 41809, 41817, 41832, 1999,
+	41856, 41877, 41904, 41920, 41944, 41968, 41985, 42011,
+	42041, 42059, 42075, 42088, 42109, 42131, 42139, 42153,
+	42168, 42195, 42216, 42229, 42242, 42258, 42285, 42299,
+	42313, 42320, 42340, 42368, 42389, 42399, 42429, 42462,
+	42483, 42495, 42503, 42526, 42538, 42551, 42577, 42607,
+	42630, 42656, 42686, 42717, 42732, 42757, 42777, 42792,
+	42814, 42838, 42853, 42862, 42875, 42901, 42925, 42941,
+	42955, 42984, 43012, 43040, 43084, 43111, 43132, 43142,
+	43164, 43171, 43216, 43243, 43265, 43298, 43343, 43360,
+	43379, 43408, 43435, 43463, 43492, 43512, 43545, 43589,
+	43618, 43657, 43688, 43696, 43723, 43737, 43762, 43798,
+	43826, 43858, 43880, 43908, 43926, 43954, 43983, 44006,
+	44016, 44035, 44081, 44100, 44115, 44148, 44177, 44185,
+	44221, 44242, 44264, 44291, 44313, 44341, 44361, 44372,
+	44391, 44414, 44441, 44446, 44469, 44490, 44496, 44502,
+	44515, 44534, 20963, 44559, 44568, 44580, 44612, 44628,
+	44649, 44658, 44667, 44685, 44699, 44720, 44751, 44767,
+	44799, 44818, 44846, 44865, 44872, 44880, 44897, 44938,
+	44950, 1405, 44978, 45008, 45036, 45062, 45086, 45098,
+	45116, 45124, 45132, 45173, 45190, 45210, 45238, 45299,
+	45309, 45333, 45351, 45358, 45378, 45407, 45447, 45494,
+	45498, 45546, 45554, 45572, 45578, 45608, 45639, 45663,
+	45693, 45724, 45743, 45757, 45785, 45818, 45841, 45871,
+	45901, 6030, 45929, 45935, 45951, 45960, 45974, 45981,
+	45993, 46008, 46028, 46037, 46053, 46080, 46101, 46132,
+	46158, 46190, 46216, 46241, 46248, 46253, 46275, 46284,
+	46305, 46335, 46371, 46382, 46395, 46418, 46428, 46440,
+	46455, 46481, 46510, 46516, 46524, 16585, 46552, 46559,
+	46581, 46588, 46617, 46655, 46667, 46697, 46749, 46766,
+	46779, 46803, 46817, 46840, 46880, 46885, 46907, 46917,
+	46926, 46933, 46952, 46985, 47004, 47023, 47032, 47069,
+	47085, 47102, 47161, 47190, 47208, 47227, 47270, 47292,
+	47314, 47324, 47348, 47362, 47384, 47402, 47411, 47421,
+	47437, 47462, 47474, 9203, 47507, 47513, 47524, 34411,
+	47548, 47560, 47595, 47600, 47620, 47629, 47643, 47651,
+	47667, 47680, 47705, 47734, 47741, 47764, 47792, 47817,
+	47842, 47858, 47874, 47895, 47680, 47913, 47939, 47962,
+	47971, 47981, 48008, 48031, 48055, 48081, 48125, 48147,
+	48158, 25920, 48181, 9203, 48211, 48221, 48227, 48235,
+	48262, 48270, 48294, 48308, 48327, 48343, 48361, 48403,
+	48411, 48467, 48477, 31715, 48492, 48502, 48523, 48540,
+	48544, 48574, 48609, 48623, 48650, 48654, 48682, 48702,
+	48730, 48741, 48750, 48760, 48779, 48791, 48823, 48859,
+	48889, 48916, 48936, 48943, 48985, 48997, 49009, 49020,
+	49036, 49087, 49104, 49121, 49152, 49179, 126, 49204,
+	49229, 49259, 49263, 49270, 49279, 49301, 49329, 49337,
+	49344, 49369, 49374, 975, 49400, 49405, 7048, 49422,
+	49459, 49476, 49493, 49515, 49535, 20112, 49564, 49584,
+	49598, 49618, 49624, 49643, 49674, 49696, 49709, 49732,
+	49746, 49780, 49798, 49806, 49875, 49887, 49915, 49940,
+	49975, 49999, 50006, 50023, 50044, 48477, 50052, 50075,
+	50102, 50145, 50161, 50196, 50204, 50226, 50268, 50277,
+	50293, 50327, 50349, 50372, 50376, 50389, 50420, 50440,
+	50456, 50474, 50495, 50509, 50544, 50559, 50576, 50604,
+	50611, 50621, 50628, 50647, 50671, 50693, 50708, 50735,
+	50763, 16585, 50802, 50808, 50814, 50820, 50836, 50852,
+	50876, 50883, 50913, 50934, 50961, 50995, 51024, 51032,
+	51038, 51055, 51086, 51111, 51119, 51158, 51173, 51189,
+	51207, 51238, 51264, 51273, 51309, 51329, 51342, 51358,
+	51367, 51379, 51406, 51425, 51457, 51470, 51495, 51507,
+	51521, 51528, 51538, 51549, 51562, 51572, 51580, 51610,
+	51648, 51658, 51666, 51687, 51708, 51728, 51735, 51770,
+	42838, 51799, 51821, 51830, 51852, 42814, 51873, 51881,
+	51904, 51915, 51920, 51934, 51943, 51960, 51986, 52013,
+	52035, 52041, 52053, 52090, 52095, 52118, 52147, 52183,
+	52188, 52210, 52237, 52247, 52268, 52282, 52296, 52304,
+	52317, 52346, 52371, 52397, 52406, 52417, 52442, 52479,
+	52520, 52565, 52598, 52609, 52628, 52641, 52674, 52688,
+	52701, 52723, 52745, 52764, 52810, 52833, 52853, 52894,
+	52937, 52945, 52962, 52986, 53013, 53050, 53080, 53089,
+	53107, 53138, 53157, 53181, 53189, 53196, 53205, 53215,
+	53227, 53250, 53264, 53271, 53281, 53291, 53318, 53331,
+	53377, 53418, 53459, 53476, 53490, 53496, 53525, 53545,
+	53559, 53564, 53588, 53614, 53645, 53671, 53677, 53699,
+	53724, 53753, 53787, 53801, 53829, 53843, 53864, 53878,
+	53908, 53929, 53945, 53964, 53986, 54017, 4743, 54026,
+	54046, 54073, 54089, 54104, 54120, 54142, 54169, 54195,
+	54204, 54223, 54235, 54253, 54274, 54278, 54300, 54334,
+	54345, 54385, 54426, 54443, 54467, 54492, 54510, 54518,
+	54540, 54566, 54579, 54607, 54632, 54645, 54668, 54687,
+	54712, 54740, 54765, 54794, 54803, 54823, 54861, 54909,
+	54918, 54946, 54959, 54974, 54995, 55003, 55044, 55084,
+	55099, 55127, 55141, 55155, 55162, 55188, 55218, 55250,
+	55293, 55311, 55326, 55366, 55381, 55399, 55419, 55434,
+	55464, 55489, 55521, 55556, 55592, 55609, 55632, 55688,
+	55704, 55726, 55765, 55775, 55794, 55811, 55828, 55842,
+	55872, 55891, 55914, 55942, 55956, 55998, 56008, 56047,
+	56086, 56116, 56128, 56142, 56153, 56183, 56202, 56218,
+	56231, 56260, 56272, 56320, 56336, 56340, 56368, 56384,
+	56403, 56430, 56479, 56496, 56519, 56533, 56567, 56594,
+	56619, 56636, 56649, 56657, 56666, 56692, 56709, 56733,
+	56753, 56787, 56798, 56822, 56863, 56879, 56894, 56936,
+	56984, 57012, 57040, 57053, 57072, 57101, 57140, 57145,
+	57158, 57201, 57239, 57291, 57340, 57367, 57396, 57414,
+	57438, 57457, 57470, 57475, 57488, 57494, 57515, 57530,
+	57536, 54946, 57553, 57570, 57578, 57590, 57619, 57637,
+	57663, 57711, 57730, 57736, 167, 57754, 57766, 57777,
+	57788, 57811, 57816, 57845, 57852, 57879, 57903, 57929,
+	57947, 57973, 57995, 58004, 58022, 58039, 58053, 58077,
+	58083, 58115, 58124, 58136, 58144, 58168, 58202, 58224,
+	58243, 58269, 58295, 58319, 58331, 58344, 58361, 58372,
+	58379, 58392, 58399, 58423, 20010, 58433, 58455, 58487,
+	58502, 58510, 58516, 58527, 58536, 58543, 58555, 58568,
+	58587, 48741, 58622, 58628, 58639, 58650, 58665, 58677,
+	58699, 58712, 58722, 58747, 58763, 11150, 58799, 58817,
+	58832, 58855, 58865, 58872, 58893, 58911, 58924, 58953,
+	20898, 58989, 59022, 159, 59033, 59049, 59066, 59102,
+	59125, 59136, 59144, 59158, 59169, 59193, 45116, 59205,
+	59211, 59247, 59255, 57570, 59265, 59276, 59292, 59301,
+	59308, 59330, 59360, 59388, 59397, 59421, 59435, 59467,
+	59479, 48125, 59491, 59511, 59548, 4364, 59569, 59579,
+	59595, 59623, 59640, 59658, 59665, 59669, 59676, 59707,
+	34895, 59718, 59723, 59732, 59740, 59744, 59771, 59780,
+	40421, 3041, 59788, 59806, 59813, 59835, 24929, 59841,
+	6030, 59853, 59860, 59875, 58712, 59884, 59891, 59899,
+	59910, 59927, 59936, 59948, 51032, 59961, 59969, 59974,
+	50647, 59986, 60002, 60028, 60049, 60073, 60081, 60105,
+	60129, 60139, 60153, 60161, 60189, 60216, 60224, 60240,
+	60268, 60284, 52210, 60105, 60300, 60328, 60344, 60349,
+	60356, 60393, 60428, 60452, 60469, 60492, 60526, 1603,
+	1603, 60553, 60564, 60569, 45901, 60587, 13334, 60216,
+	60600, 60622, 60634, 60656, 60694, 59927, 60700, 45210,
+	60712, 60751, 60780, 60344, 60785, 58, 60789, 60806,
+	60834, 60854, 60877, 60910, 60910, 60919, 60928, 60940,
+	60953, 60976, 60877, 60983, 60999, 61011, 61052, 61079,
+	61084, 61105,
+};
+
+static const uint32_t usb_vendor_product[3003] = {
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0,
+};
+
+// PIDs, sorted for each vendor, and the offset of their name in usb_name[]
+static const uint16_t usb_product_id[1] = {
+	0,
+};
+
+static const uint32_t usb_product_name[1] = {
+	0,
+};
+
+// Sorted class keys, and the offset of their name in usb_name[]
+static const uint32_t usb_class_id[1] = {
+	0,
+};
+
+static const uint32_t usb_class_name[1] = {
+	0,
+};
+
+const struct usb_ids_table usb_ids_builtin = {
+	(const char*)usb_name,
+	NB_USB_VENDORS, NB_USB_PRODUCTS, NB_USB_CLASSES,
+	usb_vendor_id, usb_vendor_name, usb_vendor_product,
+	usb_product_id, usb_product_name,
+	usb_class_id, usb_class_name,
+};
@@ -1,82 +1,230 @@
 #!/bin/sh
 
-echo This file recreates vid_data.c according http://www.linux-usb.org/usb.ids
+# Usage: vid_data.sh [usb.ids [output]]
+# Without arguments, the latest http://www.linux-usb.org/usb.ids is downloaded, and
+# vid_data.c is recreated from it. The output is only replaced if usb.ids is valid.
+usb_ids=${1:-usb.ids}
+output=${2:-vid_data.c}
+
+echo This file recreates $output according http://www.linux-usb.org/usb.ids
 echo
 
-# check that wget and sed are available
-type -P wget &>/dev/null || { echo "wget command not found. Aborting." >&2; exit 1; }
-type -P sed &>/dev/null || { echo "sed command not found. Aborting." >&2; exit 1; }
-
-# Download the latest version (overwrite previous if newer)
-wget -m -nd http://www.linux-usb.org/usb.ids
-
-# Create the sed command file
-cat > cmd.sed <<\_EOF
-# Header, part 1
-s^#.*List of USB.*/*\
- * USB vendors, by VID\
- * This file is autogenerated from http://www.linux-usb.org/usb.ids\
- * See http://www.linux-usb.org/usb-ids.html to submit new VIDs or PIDs\
- *\
- *\
- * This library is free software; you can redistribute it and/or\
- * modify it under the terms of the GNU Lesser General Public\
- * License as published by the Free Software Foundation; either\
- * version 3 of the License, or (at your option) any later version.\
- *\
- * This library is distributed in the hope that it will be useful,\
- * but WITHOUT ANY WARRANTY; without even the implied warranty of\
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU\
- * Lesser General Public License for more details.\
- *\
- * You should have received a copy of the GNU Lesser General Public\
- * License along with this library; if not, write to the Free Software\
- * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA\
- */\
-\
-#include <stdlib.h>\
-#include "libwdi.h"\
-\
-struct vendor_name \{\
-	unsigned short vid;\
-	const char* name;\
-\};\
-\
-/*\
- * http://www.linux-usb.org/usb.idsp
-
-# Header part 2, version
-s|# Version:| * Version:|
-/ \* Version:/p
-
-# Header Part 3
-s|^#.*Date:.*| \*/\
-static struct vendor_name usb_vendor[] = \{|p
-
-# Footer
-$a\
-\};\
-\
-const char* LIBWDI_API wdi_get_vendor_name(unsigned short vid)\
-\{\
-	int i;\
-\
-	for(i=0; i<sizeof(usb_vendor)/sizeof(usb_vendor[0]); i++) \{\
-		if (usb_vendor[i].vid == vid) \{\
-			return usb_vendor[i].name;\
-		\}\
-	\}\
-	return NULL;\
-\}
-
-# Main Data
-/^[0-9a-fA-F][0-9a-fA-F][0-9a-fA-F][0-9a-fA-F]  /!d
-s/^\([0-9a-fA-F][0-9a-fA-F][0-9a-fA-F][0-9a-fA-F]\)  \(.*\)/\	{ 0x\1, "\2" \},/
-s/???/?/
-s/??/?/
-_EOF
+# check that wget and awk are available
+type -P awk &>/dev/null || { echo "awk command not found. Aborting." >&2; exit 1; }
+if [ -z "$1" ]; then
+  type -P wget &>/dev/null || { echo "wget command not found. Aborting." >&2; exit 1; }
+  # Download the latest version (overwrite previous if newer)
+  wget -m -nd http://www.linux-usb.org/usb.ids
+fi
+
+# Create the awk command file
+# The IDs are stored sorted, in packed arrays, with parallel arrays of offsets into
+# a pool where each name is only stored once, so that the tables don't need any
+# pointer or relocation, and can be binary searched. See usb_ids.h for the layout.
+cat > cmd.awk <<\_EOF
+BEGIN {
+	# MSVC doesn't support string literals larger than 64 KB, so the pool is split
+	# in pages, that are contiguous in memory, and that no name crosses
+	page_size = 16384
+	nb_pages = 1
+	pos = 0
+	nb_vendors = 0
+	nb_products = 0
+	nb_classes = 0
+	section = "vendor"
+}
+
+# exit runs the END rule, which must then not output anything
+function fail(msg) {
+	print "usb.ids line " NR ": " msg > "/dev/stderr"
+	failed = 1
+	exit 1
+}
+
+# Return the offset of a name in the pool, adding it if needed
+function add_name(name,    literal) {
+	# Avoid trigraphs
+	gsub(/\?\?\?/, "?", name)
+	gsub(/\?\?/, "?", name)
+	if (!(name in offset)) {
+		# The name, with its NUL terminator, plus the NUL terminator of the page
+		if (pos + length(name) + 2 > page_size) {
+			nb_pages++
+			pos = 0
+		}
+		offset[name] = (nb_pages - 1) * page_size + pos
+		pos += length(name) + 1
+		literal = name
+		gsub(/\\/, "&&", literal)
+		gsub(/"/, "\\\"", literal)
+		pool[nb_pages] = pool[nb_pages] "\n\t\"" literal "\\0\""
+	}
+	return offset[name]
+}
+
+function add_class(key) {
+	if ((nb_classes > 0) && (key <= classes[nb_classes - 1]))
+		fail("classes are not sorted")
+	classes[nb_classes] = key
+	class_offsets[nb_classes] = add_name(substr($0, index($0, "  ") + 2))
+	nb_classes++
+}
+
+/^# Version:/ {
+	version = $3
+}
+
+/^#/ || /^$/ {
+	next
+}
 
-# Run sed to generate the source.
-sed -f cmd.sed usb.ids > vid_data.c
-rm cmd.sed
-echo Done.
\ No newline at end of file
+# Vendors: "vvvv  name"
+section == "vendor" && /^[0-9a-f][0-9a-f][0-9a-f][0-9a-f]  / {
+	vid = substr($0, 1, 4)
+	skip_vendor = 0
+	if (nb_vendors > 0) {
+		if (vid == vids[nb_vendors - 1]) {
+			skip_vendor = 1
+			next
+		}
+		if (vid < vids[nb_vendors - 1])
+			fail("vendors are not sorted")
+	}
+	vids[nb_vendors] = vid
+	vendor_offsets[nb_vendors] = add_name(substr($0, 7))
+	vendor_products[nb_vendors] = nb_products
+	nb_vendors++
+	next
+}
+
+# Products: "<tab>pppp  name"
+section == "vendor" && /^\t[0-9a-f][0-9a-f][0-9a-f][0-9a-f]  / {
+	if ((nb_vendors == 0) || (skip_vendor))
+		next
+	pid = substr($0, 2, 4)
+	if (nb_products > vendor_products[nb_vendors - 1]) {
+		if (pid == pids[nb_products - 1])
+			next
+		if (pid < pids[nb_products - 1])
+			fail("products are not sorted")
+	}
+	pids[nb_products] = pid
+	product_offsets[nb_products] = add_name(substr($0, 8))
+	nb_products++
+	next
+}
+
+# Classes: "C cc  name", with "<tab>ss  name" subclasses and "<tab><tab>pp  name" protocols
+/^C [0-9a-f][0-9a-f]  / {
+	section = "class"
+	class_code = substr($0, 3, 2)
+	add_class(sprintf("%s000001", class_code))
+	next
+}
+
+section == "class" && /^\t[0-9a-f][0-9a-f]  / {
+	subclass = substr($0, 2, 2)
+	add_class(sprintf("%s%s0002", class_code, subclass))
+	next
+}
+
+section == "class" && /^\t\t[0-9a-f][0-9a-f]  / {
+	add_class(sprintf("%s%s%s03", class_code, subclass, substr($0, 3, 2)))
+	next
+}
+
+# Everything else, i.e. product interfaces and the other lists, is ignored
+/^[^\t]/ {
+	section = "other"
+}
+
+function print_array(type, name, count, values, format,    i, line) {
+	# Empty arrays are not valid C
+	printf("static const %s %s[%d] = {\n", type, name, (count > 0) ? count : 1)
+	if (count == 0)
+		print "\t0,"
+	for (i = 0; i < count; i++) {
+		line = line sprintf(format, values[i]) ","
+		if ((i % 8 == 7) || (i == count - 1)) {
+			print "\t" line
+			line = ""
+		} else {
+			line = line " "
+		}
+	}
+	print "};\n"
+}
+
+END {
+	if (failed)
+		exit 1
+	# A truncated or partial usb.ids would silently drop the names from libwdi
+	if ((nb_vendors == 0) || (nb_products == 0) || (nb_classes == 0)) {
+		printf("usb.ids has %d vendors, %d products and %d classes - is it complete?\n",
+			nb_vendors, nb_products, nb_classes) > "/dev/stderr"
+		exit 1
+	}
+	vendor_products[nb_vendors] = nb_products
+	print "/*"
+	print " * USB vendors, products and classes, by ID"
+	print " * This file is autogenerated from http://www.linux-usb.org/usb.ids"
+	print " * See http://www.linux-usb.org/usb-ids.html to submit new VIDs or PIDs"
+	print " *"
+	print " *"
+	print " * This library is free software; you can redistribute it and/or"
+	print " * modify it under the terms of the GNU Lesser General Public"
+	print " * License as published by the Free Software Foundation; either"
+	print " * version 3 of the License, or (at your option) any later version."
+	print " *"
+	print " * This library is distributed in the hope that it will be useful,"
+	print " * but WITHOUT ANY WARRANTY; without even the implied warranty of"
+	print " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU"
+	print " * Lesser General Public License for more details."
+	print " *"
+	print " * You should have received a copy of the GNU Lesser General Public"
+	print " * License along with this library; if not, write to the Free Software"
+	print " * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA"
+	print " */"
+	print ""
+	print "#include <stdint.h>"
+	print "#include \"usb_ids.h\""
+	print ""
+	print "/*"
+	print " * http://www.linux-usb.org/usb.ids"
+	print " * Version: " version
+	print " */"
+	printf("#define NB_USB_VENDORS %d\n", nb_vendors)
+	printf("#define NB_USB_PRODUCTS %d\n", nb_products)
+	printf("#define NB_USB_CLASSES %d\n", nb_classes)
+	print ""
+	print "// Names, stored once each, in pages that no name crosses"
+	printf("#define USB_NAME_PAGE_SIZE %d\n", page_size)
+	print "static const char usb_name[][USB_NAME_PAGE_SIZE] = {"
+	for (i = 1; i <= nb_pages; i++) {
+		print substr(pool[i], 2) ","
+	}
+	print "};\n"
+	print "// Sorted VIDs, the offset of their name in usb_name[], and the index of their first product"
+	print_array("uint16_t", "usb_vendor_id", nb_vendors, vids, "0x%s")
+	print_array("uint32_t", "usb_vendor_name", nb_vendors, vendor_offsets, "%d")
+	print_array("uint32_t", "usb_vendor_product", nb_vendors + 1, vendor_products, "%d")
+	print "// PIDs, sorted for each vendor, and the offset of their name in usb_name[]"
+	print_array("uint16_t", "usb_product_id", nb_products, pids, "0x%s")
+	print_array("uint32_t", "usb_product_name", nb_products, product_offsets, "%d")
+	print "// Sorted class keys, and the offset of their name in usb_name[]"
+	print_array("uint32_t", "usb_class_id", nb_classes, classes, "0x%s")
+	print_array("uint32_t", "usb_class_name", nb_classes, class_offsets, "%d")
+	print "const struct usb_ids_table usb_ids_builtin = {"
+	print "\t(const char*)usb_name,"
+	print "\tNB_USB_VENDORS, NB_USB_PRODUCTS, NB_USB_CLASSES,"
+	print "\tusb_vendor_id, usb_vendor_name, usb_vendor_product,"
+	print "\tusb_product_id, usb_product_name,"
+	print "\tusb_class_id, usb_class_name,"
+	print "};"
+}
+_EOF
+# Run awk to generate the source.
+LC_ALL=C awk -f cmd.awk "$usb_ids" > "$output.tmp" || { rm -f cmd.awk "$output.tmp"; exit 1; }
+rm cmd.awk
+mv "$output.tmp" "$output"
+echo Done.
@@ -0,0 +1,108 @@
+/*
+ * xxhash.h: XXH64 hash of the embedded resources
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * XXH64 (https://github.com/Cyan4973/xxHash), used by the embedder to detect content
+ * changes in the embedded files, independently of their timestamps, and by the library
+ * to detect extracted files that are identical to the embedded ones.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define XXH_PRIME64_1			UINT64_C(0x9E3779B185EBCA87)
+#define XXH_PRIME64_2			UINT64_C(0xC2B2AE3D27D4EB4F)
+#define XXH_PRIME64_3			UINT64_C(0x165667B19E3779F9)
+#define XXH_PRIME64_4			UINT64_C(0x85EBCA77C2B2AE63)
+#define XXH_PRIME64_5			UINT64_C(0x27D4EB2F165667C5)
+#define XXH_ROTL64(x, r)		(((x) << (r)) | ((x) >> (64 - (r))))
+
+static __inline uint64_t xxh_read32(const unsigned char* p)
+{
+	return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24);
+}
+
+static __inline uint64_t xxh_read64(const unsigned char* p)
+{
+	return xxh_read32(p) | (xxh_read32(p + 4) << 32);
+}
+
+static __inline uint64_t xxh_round(uint64_t acc, uint64_t input)
+{
+	acc += input * XXH_PRIME64_2;
+	acc = XXH_ROTL64(acc, 31);
+	return acc * XXH_PRIME64_1;
+}
+
+static __inline uint64_t xxh_merge_round(uint64_t acc, uint64_t val)
+{
+	acc ^= xxh_round(0, val);
+	return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+static __inline uint64_t xxh64(const unsigned char* buffer, size_t size)
+{
+	const unsigned char* p = buffer;
+	const unsigned char* end = buffer + size;
+	uint64_t h, v1, v2, v3, v4;
+
+	if (size >= 32) {
+		v1 = XXH_PRIME64_1 + XXH_PRIME64_2;
+		v2 = XXH_PRIME64_2;
+		v3 = 0;
+		v4 = 0 - XXH_PRIME64_1;
+		do {
+			v1 = xxh_round(v1, xxh_read64(p));
+			v2 = xxh_round(v2, xxh_read64(p + 8));
+			v3 = xxh_round(v3, xxh_read64(p + 16));
+			v4 = xxh_round(v4, xxh_read64(p + 24));
+			p += 32;
+		} while (p + 32 <= end);
+		h = XXH_ROTL64(v1, 1) + XXH_ROTL64(v2, 7) + XXH_ROTL64(v3, 12) + XXH_ROTL64(v4, 18);
+		h = xxh_merge_round(h, v1);
+		h = xxh_merge_round(h, v2);
+		h = xxh_merge_round(h, v3);
+		h = xxh_merge_round(h, v4);
+	} else {
+		h = XXH_PRIME64_5;
+	}
+	h += (uint64_t)size;
+
+	for (; p + 8 <= end; p += 8) {
+		h ^= xxh_round(0, xxh_read64(p));
+		h = XXH_ROTL64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+	}
+	if (p + 4 <= end) {
+		h ^= xxh_read32(p) * XXH_PRIME64_1;
+		h = XXH_ROTL64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+		p += 4;
+	}
+	for (; p < end; p++) {
+		h ^= (*p) * XXH_PRIME64_5;
+		h = XXH_ROTL64(h, 11) * XXH_PRIME64_1;
+	}
+
+	h ^= h >> 33;
+	h *= XXH_PRIME64_2;
+	h ^= h >> 29;
+	h *= XXH_PRIME64_3;
+	h ^= h >> 32;
+	return h;
+}
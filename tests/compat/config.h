@@ -0,0 +1 @@
+/* The portable sources of libwdi include config.h, which has nothing they need on Linux */
@@ -0,0 +1,75 @@
+/*
+ * windows.h: the few Windows definitions that the portable sources of libwdi use,
+ * so that they can be built and tested on Linux
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+typedef int BOOL;
+typedef uint32_t DWORD;
+typedef uint32_t UINT32;
+typedef uint64_t UINT64;
+typedef unsigned int UINT;
+typedef long LONG;
+typedef const char* LPCSTR;
+typedef void* HGLOBAL;
+typedef void* HRSRC;
+typedef void* HMODULE;
+typedef void* HWND;
+
+#define TRUE 1
+#define FALSE 0
+#define WINAPI
+
+#ifndef min
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#define ERROR_NOT_ENOUGH_MEMORY          8
+#define ERROR_WRITE_FAULT                29
+#define ERROR_BAD_ARGUMENTS              160
+#define ERROR_RESOURCE_DATA_NOT_FOUND    1812
+
+typedef struct {
+	DWORD dwLowDateTime;
+	DWORD dwHighDateTime;
+} FILETIME;
+
+// Only used through pointers, by libwdi.h
+typedef struct tagVS_FIXEDFILEINFO VS_FIXEDFILEINFO;
+
+static __inline LONG InterlockedIncrement(volatile LONG* p) { return __sync_add_and_fetch(p, 1); }
+static __inline LONG InterlockedDecrement(volatile LONG* p) { return __sync_sub_and_fetch(p, 1); }
+static __inline LONG InterlockedExchange(volatile LONG* p, LONG v) { return __sync_lock_test_and_set(p, v); }
+static __inline LONG InterlockedCompareExchange(volatile LONG* p, LONG v, LONG cmp)
+{
+	return __sync_val_compare_and_swap(p, cmp, v);
+}
+static __inline BOOL SwitchToThread(void) { return TRUE; }
+
+// There are no resources in a Linux executable
+static __inline HRSRC FindResourceA(HMODULE module, LPCSTR name, LPCSTR type)
+{
+	(void)module; (void)name; (void)type;
+	return NULL;
+}
+static __inline DWORD SizeofResource(HMODULE module, HRSRC res) { (void)module; (void)res; return 0; }
+static __inline HGLOBAL LoadResource(HMODULE module, HRSRC res) { (void)module; (void)res; return NULL; }
+static __inline void* LockResource(HGLOBAL data) { return data; }
@@ -0,0 +1,72 @@
+/*
+ * device_id_bench.c: device ID parser against strtok() and sscanf()
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Parses made up device IDs, hardware IDs and interface paths with the strtok() and
+ * sscanf() code that wdi_create_list() used to have, and with parse_device_id().
+ */
+#include <string.h>
+#include "test.h"
+#include "windows.h"
+#include "device_id.h"
+#include "device_id_ref.h"
+
+#define NB_IDS 100000
+#define NB_RUNS 10
+
+int main(void)
+{
+	static char id[NB_IDS][128];
+	struct wdi_device_id parsed;
+	struct ref_device_id ref;
+	struct gen_id g;
+	double t_ref, t_parse;
+	size_t i;
+	int k, nb_same = 0;
+
+	for (i = 0; i < NB_IDS; i++) {
+		gen_device_id(&g, (enum gen_id_form)(i % GEN_NB_FORMS), test_rand() & 1, id[i], sizeof(id[i]));
+		ref_parse_device_id(id[i], &ref);
+		parse_device_id(id[i], &parsed);
+		nb_same += (ref.vid == parsed.vid) && (ref.pid == parsed.pid) && (ref.mi == parsed.mi);
+	}
+	CHECK(nb_same == NB_IDS);
+
+	t_ref = test_now();
+	for (k = 0; k < NB_RUNS; k++) {
+		for (i = 0; i < NB_IDS; i++) {
+			ref_parse_device_id(id[i], &ref);
+			test_sink += ref.vid + ref.pid;
+		}
+	}
+	t_ref = test_now() - t_ref;
+	t_parse = test_now();
+	for (k = 0; k < NB_RUNS; k++) {
+		for (i = 0; i < NB_IDS; i++) {
+			parse_device_id(id[i], &parsed);
+			test_sink += parsed.vid + parsed.pid;
+		}
+	}
+	t_parse = test_now() - t_parse;
+
+	printf("%d IDs, device IDs, hardware IDs and interface paths\n", NB_IDS);
+	printf("strtok and sscanf: %.0f ns per ID\n", t_ref * 1e9 / (NB_RUNS * (double)NB_IDS));
+	printf("parse_device_id: %.0f ns per ID (%.1fx)\n", t_parse * 1e9 / (NB_RUNS * (double)NB_IDS), t_ref / t_parse);
+	return TEST_RESULT();
+}
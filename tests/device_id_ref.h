@@ -0,0 +1,138 @@
+/*
+ * device_id_ref.h: the device ID parsing that device_id.h replaced, and ID generation
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * ref_parse_device_id() is the strtok() and sscanf() parsing of the device ID that
+ * wdi_create_list() did before device_id.h, to check the new parser against, and
+ * gen_device_id() makes up IDs like the ones that Windows reports.
+ */
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+
+struct ref_device_id {
+	int has_vid;
+	unsigned short vid;
+	unsigned short pid;
+	int is_composite;
+	unsigned char mi;
+};
+
+static __inline void ref_parse_device_id(const char* device_id, struct ref_device_id* id)
+{
+	const char* prefix[3] = { "VID_", "PID_", "MI_" };
+	char strbuf[256], *token;
+	unsigned int j, tmp;
+	size_t len = strlen(device_id);
+
+	memset(id, 0, sizeof(*id));
+	// static_strcpy()
+	len = (len < sizeof(strbuf)) ? len : sizeof(strbuf) - 1;
+	memcpy(strbuf, device_id, len);
+	strbuf[len] = 0;
+	token = strtok(strbuf, "\\#&");
+	while (token != NULL) {
+		for (j = 0; j < 3; j++) {
+			if (strncmp(token, prefix[j], strlen(prefix[j])) == 0) {
+				switch (j) {
+				case 0:
+					if (sscanf(token, "VID_%04X", &tmp) == 1) {
+						id->vid = (unsigned short)tmp;
+					}
+					id->has_vid = 1;
+					break;
+				case 1:
+					if (sscanf(token, "PID_%04X", &tmp) == 1) {
+						id->pid = (unsigned short)tmp;
+					}
+					break;
+				case 2:
+					if (sscanf(token, "MI_%02X", &tmp) == 1) {
+						id->is_composite = 1;
+						id->mi = (unsigned char)tmp;
+					}
+					break;
+				}
+			}
+		}
+		token = strtok(NULL, "\\#&");
+	}
+}
+
+enum gen_id_form {
+	GEN_DEVICE_ID,			// USB\VID_xxxx&PID_xxxx[&MI_xx]\<instance>
+	GEN_HARDWARE_ID,		// USB\VID_xxxx&PID_xxxx[&REV_xxxx][&MI_xx]
+	GEN_INTERFACE_PATH,		// \\?\USB#VID_xxxx&PID_xxxx[&MI_xx]#<instance>#{GUID}
+	GEN_NB_FORMS
+};
+
+struct gen_id {
+	enum gen_id_form form;
+	unsigned short vid, pid, rev;
+	int has_rev, has_mi;
+	unsigned char mi;
+	// A serial number, or an instance ID that Windows made up
+	char instance[40];
+	int is_serial;
+};
+
+// Make up an ID, in the given form, with lowercase hex digits if lowercase is set
+static __inline void gen_device_id(struct gen_id* g, enum gen_id_form form, int lowercase, char* buf, size_t size)
+{
+	const char* x4 = lowercase ? "%04x" : "%04X";
+	const char* x2 = lowercase ? "%02x" : "%02X";
+	char vid[8], pid[8], rev[8], mi[8];
+	uint64_t r = test_rand();
+
+	memset(g, 0, sizeof(*g));
+	g->form = form;
+	g->vid = (unsigned short)r;
+	g->pid = (unsigned short)(r >> 16);
+	g->rev = (unsigned short)(r >> 32);
+	g->has_rev = (form == GEN_HARDWARE_ID) && ((r >> 48) & 1);
+	g->has_mi = (r >> 49) & 1;
+	g->mi = (unsigned char)((r >> 50) & 0x1f);
+	g->is_serial = (r >> 55) & 1;
+	if (g->is_serial) {
+		snprintf(g->instance, sizeof(g->instance), "%08X%04X", (unsigned int)test_rand(), (unsigned int)(r >> 56));
+	} else {
+		snprintf(g->instance, sizeof(g->instance), "%d&%X&0&%04d", (int)(r >> 56) % 10,
+			(unsigned int)test_rand(), g->mi);
+	}
+	snprintf(vid, sizeof(vid), x4, g->vid);
+	snprintf(pid, sizeof(pid), x4, g->pid);
+	snprintf(rev, sizeof(rev), x4, g->rev);
+	snprintf(mi, sizeof(mi), x2, g->mi);
+	switch (form) {
+	case GEN_DEVICE_ID:
+		snprintf(buf, size, "USB\\VID_%s&PID_%s%s%s\\%s", vid, pid, g->has_mi ? "&MI_" : "",
+			g->has_mi ? mi : "", g->instance);
+		break;
+	case GEN_HARDWARE_ID:
+		snprintf(buf, size, "USB\\VID_%s&PID_%s%s%s%s%s", vid, pid, g->has_rev ? "&REV_" : "",
+			g->has_rev ? rev : "", g->has_mi ? "&MI_" : "", g->has_mi ? mi : "");
+		break;
+	default:
+		snprintf(buf, size, "\\\\?\\USB#VID_%s&PID_%s%s%s#%s#{a5dcbf10-6530-11d2-901f-00c04fb951ed}",
+			vid, pid, g->has_mi ? "&MI_" : "", g->has_mi ? mi : "", g->instance);
+		break;
+	}
+}
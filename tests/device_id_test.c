@@ -0,0 +1,212 @@
+/*
+ * device_id_test.c: fuzzing of the device ID parser
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Parses a few known IDs, then made up device IDs, hardware IDs and interface paths,
+ * which must give the fields they were made from, and the same ones as the strtok()
+ * parsing that device_id.h replaced. Then parses mutations of these, each in a buffer
+ * of its exact size, so that ASan reports any read past the end, and checks that the
+ * results are consistent.
+ */
+#include <string.h>
+#include "test.h"
+#include "windows.h"
+#include "device_id.h"
+#include "device_id_ref.h"
+
+#define NB_GENERATED 100000
+#define NB_MUTATED 500000
+
+static int same_part(const char* part, size_t len, const char* str)
+{
+	return (part == NULL) ? (str == NULL) : ((str != NULL) && (len == strlen(str)) && (memcmp(part, str, len) == 0));
+}
+
+static void test_known(void)
+{
+	struct wdi_device_id id, other;
+
+	CHECK(parse_device_id("USB\\VID_1234&PID_ABCD&MI_01\\6&12345678&0&0001", &id) == WDI_SUCCESS);
+	CHECK(id.has_vid && id.has_pid && !id.has_rev && id.has_mi);
+	CHECK((id.vid == 0x1234) && (id.pid == 0xabcd) && (id.mi == 1));
+	CHECK(same_part(id.enumerator, id.enumerator_length, "USB"));
+	CHECK(same_part(id.instance, id.instance_length, "6&12345678&0&0001"));
+	CHECK(!id.is_serial);
+
+	CHECK(parse_device_id("usb\\vid_1234&pid_abcd&rev_0100", &id) == WDI_SUCCESS);
+	CHECK(id.has_rev && (id.rev == 0x0100) && !id.has_mi && (id.instance == NULL));
+	CHECK(same_part(id.enumerator, id.enumerator_length, "usb"));
+
+	CHECK(parse_device_id("\\\\?\\USB#VID_1234&PID_ABCD#0123456789#{a5dcbf10-6530-11d2-901f-00c04fb951ed}", &id) == WDI_SUCCESS);
+	CHECK(same_part(id.enumerator, id.enumerator_length, "USB"));
+	CHECK(same_part(id.instance, id.instance_length, "0123456789"));
+	CHECK(id.is_serial);
+	CHECK(parse_device_id("USB\\VID_1234&PID_abcd\\0123456789", &other) == WDI_SUCCESS);
+	CHECK(is_same_device_id(&id, &other));
+
+	// A different enumerator, instance or interface is a different device
+	CHECK(parse_device_id("USBSTOR\\VID_1234&PID_ABCD\\0123456789", &other) == WDI_SUCCESS);
+	CHECK(!is_same_device_id(&id, &other));
+	CHECK(parse_device_id("USB\\VID_1234&PID_ABCD\\0123456780", &other) == WDI_SUCCESS);
+	CHECK(!is_same_device_id(&id, &other));
+	CHECK(parse_device_id("USB\\VID_1234&PID_ABCD&MI_00\\0123456789", &other) == WDI_SUCCESS);
+	CHECK(!is_same_device_id(&id, &other));
+
+	// Without enumerator, or with fields that are not ours
+	CHECK(parse_device_id("VID_1234&PID_5678", &id) == WDI_SUCCESS);
+	CHECK(id.has_vid && id.has_pid && (id.enumerator == NULL));
+	CHECK(parse_device_id("USB\\ROOT_HUB30\\4&1A2B3C4D&0&0", &id) == WDI_SUCCESS);
+	CHECK(!id.has_vid && !id.has_pid);
+	CHECK(parse_device_id("HID\\VID_046D&PID_C52B&MI_02&COL01\\7&1B2C3D4E&0&0000", &id) == WDI_SUCCESS);
+	CHECK(id.has_mi && (id.mi == 2));
+	CHECK(same_part(id.enumerator, id.enumerator_length, "HID"));
+
+	// Fields with the wrong number of digits are invalid, but the others are still parsed
+	CHECK(parse_device_id("USB\\VID_123&PID_5678", &id) == WDI_ERROR_INVALID_PARAM);
+	CHECK(!id.has_vid && id.has_pid && (id.pid == 0x5678));
+	CHECK(parse_device_id("USB\\VID_12345&PID_5678&MI_1", &id) == WDI_ERROR_INVALID_PARAM);
+	CHECK(!id.has_vid && !id.has_mi);
+	CHECK(parse_device_id("USB\\VID_12G4", &id) == WDI_ERROR_INVALID_PARAM);
+	CHECK(parse_device_id(NULL, &id) == WDI_ERROR_INVALID_PARAM);
+	CHECK(parse_device_id("", &id) == WDI_SUCCESS);
+	CHECK(!id.has_vid && (id.enumerator == NULL) && (id.instance == NULL));
+	CHECK(parse_device_id("\\\\?\\", &id) == WDI_SUCCESS);
+	CHECK(parse_device_id("\\", &id) == WDI_SUCCESS);
+	CHECK((id.enumerator == NULL) && (id.instance == NULL));
+}
+
+static void test_generated(void)
+{
+	struct wdi_device_id id, lower_id, path_id;
+	struct ref_device_id ref;
+	struct gen_id g, lower_g;
+	char buf[128], lower[128], path[128];
+	uint64_t seed;
+	int i;
+
+	for (i = 0; i < NB_GENERATED; i++) {
+		seed = test_seed;
+		gen_device_id(&g, (enum gen_id_form)(i % GEN_NB_FORMS), 0, buf, sizeof(buf));
+		test_seed = seed;
+		gen_device_id(&lower_g, g.form, 1, lower, sizeof(lower));
+		CHECK(parse_device_id(buf, &id) == WDI_SUCCESS);
+		CHECK(id.has_vid && id.has_pid && (id.vid == g.vid) && (id.pid == g.pid));
+		CHECK((id.has_rev == g.has_rev) && (!g.has_rev || (id.rev == g.rev)));
+		CHECK((id.has_mi == g.has_mi) && (!g.has_mi || (id.mi == g.mi)));
+		CHECK(same_part(id.enumerator, id.enumerator_length, "USB"));
+		if (g.form == GEN_HARDWARE_ID) {
+			CHECK(id.instance == NULL);
+		} else {
+			CHECK(same_part(id.instance, id.instance_length, g.instance));
+			CHECK(id.is_serial == g.is_serial);
+		}
+
+		// Same fields as with strtok() and sscanf()
+		ref_parse_device_id(buf, &ref);
+		CHECK(ref.has_vid && (ref.vid == id.vid) && (ref.pid == id.pid));
+		CHECK((ref.is_composite == id.has_mi) && (ref.mi == id.mi));
+
+		// Hex digits are not case sensitive, and an interface path is the same device
+		CHECK(parse_device_id(lower, &lower_id) == WDI_SUCCESS);
+		CHECK(is_same_device_id(&id, &lower_id));
+		if (g.form == GEN_DEVICE_ID) {
+			test_seed = seed;
+			gen_device_id(&g, GEN_INTERFACE_PATH, 0, path, sizeof(path));
+			CHECK(parse_device_id(path, &path_id) == WDI_SUCCESS);
+			CHECK(is_same_device_id(&id, &path_id));
+		}
+	}
+}
+
+static void mutate(char* buf, size_t size)
+{
+	static const char chars[] = "\\#&_?{}VIDPMREv0123456789abcdefABCDEFG\x80\xff";
+	size_t len = strlen(buf), pos;
+	int i, nb = 1 + (int)(test_rand() % 4);
+
+	for (i = 0; i < nb; i++) {
+		pos = (len == 0) ? 0 : test_rand() % len;
+		switch (test_rand() % 3) {
+		case 0:		// Replace
+			if (len > 0) {
+				buf[pos] = chars[test_rand() % (sizeof(chars) - 1)];
+			}
+			break;
+		case 1:		// Insert
+			if (len + 1 < size) {
+				memmove(&buf[pos + 1], &buf[pos], len - pos + 1);
+				buf[pos] = chars[test_rand() % (sizeof(chars) - 1)];
+				len++;
+			}
+			break;
+		default:	// Delete or truncate
+			if (test_rand() & 1) {
+				memmove(&buf[pos], &buf[pos + 1], len - pos);
+			} else {
+				buf[pos] = 0;
+			}
+			len = strlen(buf);
+			break;
+		}
+	}
+}
+
+static void test_mutated(void)
+{
+	struct wdi_device_id id, again;
+	struct gen_id g;
+	char buf[128], *copy;
+	const char* end;
+	size_t len;
+	int i, r;
+
+	for (i = 0; i < NB_MUTATED; i++) {
+		gen_device_id(&g, (enum gen_id_form)(test_rand() % GEN_NB_FORMS), test_rand() & 1, buf, sizeof(buf));
+		mutate(buf, sizeof(buf));
+		len = strlen(buf);
+		copy = malloc(len + 1);
+		memcpy(copy, buf, len + 1);
+		end = copy + len;
+		r = parse_device_id(copy, &id);
+		CHECK((r == WDI_SUCCESS) || (r == WDI_ERROR_INVALID_PARAM));
+		// The parts point into the string, and have no separator
+		if (id.enumerator != NULL) {
+			CHECK((id.enumerator >= copy) && (id.enumerator + id.enumerator_length <= end));
+			CHECK((id.enumerator_length > 0) && (memchr(id.enumerator, '\\', id.enumerator_length) == NULL)
+				&& (memchr(id.enumerator, '#', id.enumerator_length) == NULL));
+		}
+		if (id.instance != NULL) {
+			CHECK((id.instance > copy) && (id.instance + id.instance_length <= end));
+			CHECK((id.instance_length > 0) && (memchr(id.instance, '\\', id.instance_length) == NULL)
+				&& (memchr(id.instance, '#', id.instance_length) == NULL));
+			CHECK(id.is_serial == (memchr(id.instance, '&', id.instance_length) == NULL));
+		}
+		CHECK(strcmp(copy, buf) == 0);
+		CHECK((parse_device_id(copy, &again) == r) && is_same_device_id(&id, &again));
+		free(copy);
+	}
+}
+
+int main(void)
+{
+	test_known();
+	test_generated();
+	test_mutated();
+	return TEST_RESULT();
+}
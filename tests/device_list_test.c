@@ -0,0 +1,179 @@
+/*
+ * device_list_test.c: allocation and release of the device lists
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Builds device lists with the allocator of wdi_create_list(), and releases them the
+ * way wdi_destroy_list() does, both from device_list.h. Checks that the devices and
+ * their strings survive the growth of the blocks, that only live lists from
+ * wdi_create_list() are released, without reading anything from other pointers, which
+ * ASan reports, and that lists can be created and destroyed from several threads at once.
+ */
+#include <string.h>
+#include <pthread.h>
+#include "test.h"
+#include "windows.h"
+#include "device_list.h"
+
+#define NB_THREADS 4
+
+static struct device_lists lists = { NULL, 0 };
+
+// As wdi_destroy_list() in libwdi.c, without the error message
+static int destroy_list(struct wdi_device_info* list)
+{
+	struct device_list_block* blocks;
+
+	if (list == NULL)
+		return WDI_SUCCESS;
+	blocks = remove_device_list(&lists, list);
+	if (blocks == NULL)
+		return WDI_ERROR_INVALID_PARAM;
+	free_device_list(blocks);
+	return WDI_SUCCESS;
+}
+
+// Build a list the way wdi_create_list() does, and register it
+static struct wdi_device_info* create_list(int nb_devices, unsigned short vid)
+{
+	struct device_list_block* blocks = NULL;
+	struct wdi_device_info *dev, *cur = NULL;
+	char buf[128];
+	BOOL error = FALSE;
+	int i;
+
+	for (i = 0; i < nb_devices; i++) {
+		dev = (struct wdi_device_info*)device_list_alloc(&blocks, sizeof(struct wdi_device_info), TRUE);
+		if (dev == NULL) {
+			free_device_list(blocks);
+			return NULL;
+		}
+		memset(dev, 0, sizeof(*dev));
+		dev->vid = vid;
+		dev->pid = (unsigned short)i;
+		snprintf(buf, sizeof(buf), "USB\\VID_%04X&PID_%04X\\%d", vid, i, i);
+		dev->device_id = device_list_strdup(&blocks, buf, &error);
+		snprintf(buf, sizeof(buf), "Device %d of a list that has %d of them", i, nb_devices);
+		dev->desc = device_list_strdup(&blocks, buf, &error);
+		dev->driver = device_list_strdup(&blocks, (i % 2) ? "WinUSB" : NULL, &error);
+		CHECK(!error);
+		CHECK(((uintptr_t)dev % sizeof(UINT64)) == 0);
+		if (cur != NULL) {
+			cur->next = dev;
+		}
+		cur = dev;
+	}
+	if (blocks == NULL) {
+		return NULL;
+	}
+	add_device_list(&lists, blocks);
+	return (struct wdi_device_info*)DEVICE_LIST_DATA(blocks);
+}
+
+static void check_list(struct wdi_device_info* list, int nb_devices, unsigned short vid)
+{
+	struct wdi_device_info* dev;
+	char buf[128];
+	int i = 0;
+
+	for (dev = list; dev != NULL; dev = dev->next, i++) {
+		snprintf(buf, sizeof(buf), "USB\\VID_%04X&PID_%04X\\%d", vid, i, i);
+		CHECK((dev->vid == vid) && (dev->pid == i));
+		CHECK(strcmp(dev->device_id, buf) == 0);
+		CHECK((i % 2) ? (strcmp(dev->driver, "WinUSB") == 0) : (dev->driver == NULL));
+	}
+	CHECK(i == nb_devices);
+}
+
+static int nb_blocks(struct wdi_device_info* list)
+{
+	struct device_list_block* block = (struct device_list_block*)((char*)list - DEVICE_LIST_HEADER_SIZE);
+	int n;
+
+	for (n = 0; block != NULL; block = block->next) {
+		n++;
+	}
+	return n;
+}
+
+static void* create_destroy_thread(void* param)
+{
+	struct wdi_device_info* list[8];
+	unsigned short vid = (unsigned short)(uintptr_t)param;
+	int i, k;
+
+	for (k = 0; k < 200; k++) {
+		for (i = 0; i < 8; i++) {
+			list[i] = create_list(1 + i * 37, vid);
+		}
+		for (i = 7; i >= 0; i--) {
+			check_list(list[i], 1 + i * 37, vid);
+			CHECK(destroy_list(list[i]) == WDI_SUCCESS);
+		}
+	}
+	return NULL;
+}
+
+int main(void)
+{
+	struct wdi_device_info *list, *other, *single, *caller_built;
+	char* app_desc;
+	pthread_t thread[NB_THREADS];
+	int i;
+
+	// A list that takes several blocks, which double in size
+	list = create_list(5000, 0x1234);
+	CHECK(list != NULL);
+	check_list(list, 5000, 0x1234);
+	CHECK(nb_blocks(list) <= 8);
+	other = create_list(3, 0x5678);
+	single = create_list(1, 0x9abc);
+	CHECK(create_list(0, 0) == NULL);
+
+	// A string that the application put in the list stays its own
+	app_desc = strdup("Edited description");
+	list->next->desc = app_desc;
+	CHECK(destroy_list(list) == WDI_SUCCESS);
+	CHECK(strcmp(app_desc, "Edited description") == 0);
+	free(app_desc);
+
+	// The other lists are still live, and lists can be released in any order
+	check_list(other, 3, 0x5678);
+	CHECK(destroy_list(single) == WDI_SUCCESS);
+	check_list(other, 3, 0x5678);
+
+	// Lists that are not live, or not from wdi_create_list(), are rejected, without
+	// reading what comes before them, which is out of bounds for a device of our own
+	CHECK(destroy_list(single) == WDI_ERROR_INVALID_PARAM);
+	caller_built = calloc(1, sizeof(struct wdi_device_info));
+	CHECK(destroy_list(caller_built) == WDI_ERROR_INVALID_PARAM);
+	free(caller_built);
+	CHECK(destroy_list(other->next) == WDI_ERROR_INVALID_PARAM);
+	CHECK(destroy_list(NULL) == WDI_SUCCESS);
+	CHECK(destroy_list(other) == WDI_SUCCESS);
+	CHECK(lists.first == NULL);
+
+	for (i = 0; i < NB_THREADS; i++) {
+		CHECK(pthread_create(&thread[i], NULL, create_destroy_thread, (void*)(uintptr_t)(0x1000 + i)) == 0);
+	}
+	for (i = 0; i < NB_THREADS; i++) {
+		pthread_join(thread[i], NULL);
+	}
+	CHECK(lists.first == NULL);
+	return TEST_RESULT();
+}
@@ -0,0 +1,269 @@
+/*
+ * device_source_test.c: snapshots and replay of the devices of the device list
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Parses sample_devices.snapshot, as is and with CRLF line endings, and replays it
+ * through the device source calls, the way wdi_create_list() reads the devnodes.
+ * Then records the replay to a new snapshot, which must parse to the same devices,
+ * and checks the invalid snapshots and the latency of the replay.
+ */
+#include <string.h>
+#include "test.h"
+#include "device_source.h"
+
+#define NB_SAMPLE_DEVICES 11
+#define REPLAY_LATENCY 200
+
+static int same_value(const char* a, const char* b)
+{
+	return ((a == NULL) || (b == NULL)) ? (a == b) : (strcmp(a, b) == 0);
+}
+
+static char* with_crlf(const char* data, size_t size, size_t* crlf_size)
+{
+	char* crlf = malloc(2 * size + 1);
+	size_t i, j;
+
+	for (i = 0, j = 0; i < size; i++) {
+		if (data[i] == '\n') {
+			crlf[j++] = '\r';
+		}
+		crlf[j++] = data[i];
+	}
+	*crlf_size = j;
+	return crlf;
+}
+
+// Parse a string, which is copied, as the snapshot points into the data that it parses
+static int parse_string(const char* str, struct device_snapshot* snapshot, char** data)
+{
+	size_t size = strlen(str);
+	int r;
+
+	*data = malloc(size + 1);
+	memcpy(*data, str, size);
+	r = device_snapshot_parse(*data, size, snapshot);
+	if (r != 0) {
+		free(*data);
+		*data = NULL;
+	}
+	return r;
+}
+
+static void check_snapshot(const struct device_snapshot* snapshot)
+{
+	const struct device_snapshot_entry* d = snapshot->device;
+
+	CHECK(snapshot->nb_devices == NB_SAMPLE_DEVICES);
+	if (snapshot->nb_devices != NB_SAMPLE_DEVICES) {
+		return;
+	}
+	CHECK(same_value(d[0].device_id, "USB\\ROOT_HUB30\\4&1A2B3C4D&0&0"));
+	CHECK(same_value(d[0].property[DEVICE_PROPERTY_SERVICE], "USBHUB3"));
+	CHECK(same_value(d[0].property[DEVICE_PROPERTY_HARDWARE_ID], "USB\\ROOT_HUB30&VID8086&PID A36D&REV0010"));
+	CHECK(d[0].property[DEVICE_PROPERTY_BUS_DESC] == NULL);
+	CHECK(same_value(d[2].property[DEVICE_PROPERTY_SERVICE], "usbccgp"));
+	CHECK(same_value(d[3].property[DEVICE_PROPERTY_DRIVER], "{88bae032-5a81-49f0-bc3d-a4ff138216d6}\\0004"));
+	CHECK(same_value(d[3].property[DEVICE_PROPERTY_DRIVER_VERSION], "6.1.7600.16385"));
+	CHECK(d[4].property[DEVICE_PROPERTY_DRIVER] == NULL);
+	CHECK(same_value(d[4].property[DEVICE_PROPERTY_HARDWARE_ID], "USB\\VID_15BA&PID_002A&REV_0700&MI_01"));
+	// Values are kept as they are, including their trailing spaces and the '=' they contain
+	CHECK(same_value(d[5].property[DEVICE_PROPERTY_UPPER_FILTER], "usbdlfilter"));
+	CHECK(same_value(d[5].property[DEVICE_PROPERTY_BUS_DESC], "Digilent USB Device    "));
+	CHECK(same_value(d[6].property[DEVICE_PROPERTY_DESC], "STM Device in DFU Mode"));
+	CHECK(same_value(d[8].property[DEVICE_PROPERTY_BUS_DESC], "Capteur de temp\xC3\xA9rature \xCE\xA9"));
+	CHECK(same_value(d[9].device_id, "USB\\VID_1D50&PID_6089\\0000000000000000457863dc2b5a1d93"));
+	CHECK(d[9].property[DEVICE_PROPERTY_COMPATIBLE_ID] == NULL);
+	CHECK(same_value(d[10].device_id, "USB\\VID_16C0&PID_05DC\\5&3A4B5C6D&0&4"));
+	CHECK(d[10].property[DEVICE_PROPERTY_HARDWARE_ID] == NULL);
+	CHECK(d[10].property[DEVICE_PROPERTY_DESC] == NULL);
+}
+
+static int same_snapshot(const struct device_snapshot* a, const struct device_snapshot* b)
+{
+	size_t i;
+	int j;
+
+	if (a->nb_devices != b->nb_devices) {
+		return 0;
+	}
+	for (i = 0; i < a->nb_devices; i++) {
+		if (!same_value(a->device[i].device_id, b->device[i].device_id)) {
+			return 0;
+		}
+		for (j = 0; j < DEVICE_NB_PROPERTIES; j++) {
+			if (!same_value(a->device[i].property[j], b->device[i].property[j])) {
+				return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+// Read all the devnodes through the source calls, as wdi_create_list() does
+static void test_replay(struct device_snapshot* snapshot)
+{
+	const struct device_source* source = &device_replay;
+	char buf[256], small[8];
+	void* context;
+	unsigned int i, nb_driverless = 0, nb_descriptions = 0;
+
+	context = source->open(snapshot);
+	CHECK(context != NULL);
+	if (context == NULL) {
+		return;
+	}
+	for (i = 0; source->get_devnode(context, i); i++) {
+		CHECK(source->get_device_id(context, buf, sizeof(buf)));
+		CHECK(same_value(buf, snapshot->device[i].device_id));
+		if (!source->get_property(context, DEVICE_PROPERTY_DRIVER, buf, sizeof(buf))) {
+			nb_driverless++;
+		}
+		if ( source->get_property(context, DEVICE_PROPERTY_BUS_DESC, buf, sizeof(buf))
+		  || source->get_property(context, DEVICE_PROPERTY_DESC, buf, sizeof(buf)) ) {
+			nb_descriptions++;
+		}
+	}
+	CHECK(i == NB_SAMPLE_DEVICES);
+	CHECK(nb_driverless == 6);
+	CHECK(nb_descriptions == 10);
+	// A devnode past the last one doesn't change the current one
+	CHECK(source->get_devnode(context, 3));
+	CHECK(!source->get_devnode(context, NB_SAMPLE_DEVICES));
+	CHECK(source->get_property(context, DEVICE_PROPERTY_SERVICE, buf, sizeof(buf)));
+	CHECK(same_value(buf, "WinUSB"));
+	// Values that don't fit are not returned, rather than truncated
+	CHECK(!source->get_property(context, DEVICE_PROPERTY_SERVICE, small, 6));
+	CHECK(source->get_property(context, DEVICE_PROPERTY_SERVICE, small, 7));
+	CHECK(!source->get_device_id(context, small, sizeof(small)));
+	CHECK(!source->get_property(context, DEVICE_PROPERTY_UPPER_FILTER, buf, sizeof(buf)));
+	source->close(context);
+}
+
+// A snapshot recorded from the replay must parse to the same devices
+static void test_record(struct device_snapshot* snapshot)
+{
+	struct device_snapshot recorded;
+	FILE* fd = tmpfile();
+	char* data;
+	long size;
+	void* context;
+
+	CHECK(fd != NULL);
+	if (fd == NULL) {
+		return;
+	}
+	context = device_replay.open(snapshot);
+	CHECK(device_snapshot_write(fd, &device_replay, context) == 0);
+	device_replay.close(context);
+	size = ftell(fd);
+	data = malloc(size + 1);
+	rewind(fd);
+	CHECK(fread(data, 1, size, fd) == (size_t)size);
+	fclose(fd);
+	CHECK(device_snapshot_parse(data, size, &recorded) == 0);
+	CHECK(same_snapshot(snapshot, &recorded));
+	device_snapshot_free(&recorded);
+	free(data);
+}
+
+// Each call of the replay takes at least the latency
+static void test_latency(struct device_snapshot* snapshot)
+{
+	char buf[256];
+	void* context;
+	unsigned int i, nb_calls = 0;
+	double t;
+
+	snapshot->latency = REPLAY_LATENCY;
+	t = test_now();
+	context = device_replay.open(snapshot);
+	nb_calls++;
+	for (i = 0; device_replay.get_devnode(context, i); i++) {
+		nb_calls += 2;
+		test_sink += device_replay.get_property(context, DEVICE_PROPERTY_HARDWARE_ID, buf, sizeof(buf));
+	}
+	device_replay.close(context);
+	nb_calls += 2;
+	t = test_now() - t;
+	CHECK(nb_calls == 2 * NB_SAMPLE_DEVICES + 3);
+	CHECK(t * 1e6 >= (double)nb_calls * REPLAY_LATENCY);
+	snapshot->latency = 0;
+}
+
+static void test_invalid(void)
+{
+	struct device_snapshot snapshot;
+	char* data;
+
+	// A property before the first devnode, a devnode without ID, or not closed, and a line without '='
+	CHECK(parse_string("; comment\nService=WinUSB\n", &snapshot, &data) == 2);
+	CHECK(parse_string("[USB\\VID_1234&PID_5678\\1]\n[]\n", &snapshot, &data) == 2);
+	CHECK(parse_string("\n[USB\\VID_1234&PID_5678\\1\n", &snapshot, &data) == 2);
+	CHECK(parse_string("[USB\\VID_1234&PID_5678\\1] \n", &snapshot, &data) == 1);
+	CHECK(parse_string("[USB\\VID_1234&PID_5678\\1]\r\nService=WinUSB\r\nWinUSB\r\n", &snapshot, &data) == 3);
+	// An empty snapshot has no devices
+	CHECK(parse_string("; libwdi device snapshot\n", &snapshot, &data) == 0);
+	CHECK(snapshot.nb_devices == 0);
+	device_snapshot_free(&snapshot);
+	free(data);
+	// A devnode can have no properties, and the last line doesn't need a newline
+	CHECK(parse_string("[A]\n[B]\nService=C", &snapshot, &data) == 0);
+	CHECK(snapshot.nb_devices == 2);
+	if (snapshot.nb_devices == 2) {
+		CHECK(snapshot.device[0].property[DEVICE_PROPERTY_SERVICE] == NULL);
+		CHECK(same_value(snapshot.device[1].property[DEVICE_PROPERTY_SERVICE], "C"));
+	}
+	device_snapshot_free(&snapshot);
+	free(data);
+}
+
+int main(int argc, char** argv)
+{
+	struct device_snapshot snapshot;
+	char *data, *copy;
+	size_t size, crlf_size;
+
+	data = test_read_file((argc > 1) ? argv[1] : "sample_devices.snapshot", &size, 0);
+	if (data == NULL) {
+		fprintf(stderr, "could not read the sample snapshot\n");
+		return 1;
+	}
+	copy = malloc(size + 1);
+	memcpy(copy, data, size);
+	CHECK(device_snapshot_parse(copy, size, &snapshot) == 0);
+	check_snapshot(&snapshot);
+	if (snapshot.nb_devices == NB_SAMPLE_DEVICES) {
+		test_replay(&snapshot);
+		test_record(&snapshot);
+		test_latency(&snapshot);
+	}
+	device_snapshot_free(&snapshot);
+	free(copy);
+
+	copy = with_crlf(data, size, &crlf_size);
+	CHECK(device_snapshot_parse(copy, crlf_size, &snapshot) == 0);
+	check_snapshot(&snapshot);
+	device_snapshot_free(&snapshot);
+	free(copy);
+
+	test_invalid();
+	free(data);
+	return TEST_RESULT();
+}
@@ -0,0 +1,217 @@
+/*
+ * extract_bench.c: extraction of multi-megabyte resources, through extract.h and stdio
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Usage: extract_bench [-s] [nb_files] [max_size_mb] [dir]
+ * Extracts a set of generated resources, of up to max_size_mb each, into a temporary
+ * directory in dir, the way libwdi used to (one file at a time, through stdio), and
+ * with the pool and writer of extract.h, stored and LZ4 compressed. With -s, each file
+ * is synced to disk before it is closed, to measure the device rather than the cache.
+ * Every extracted file is checked against its resource.
+ */
+#include <sys/stat.h>
+#include "test.h"
+#include "extract.h"
+
+#define NB_PASSES 5
+
+struct res {
+	unsigned char* data;
+	size_t size;
+	unsigned char* compressed;
+	size_t compressed_size;
+};
+
+struct bench {
+	struct res* r;
+	int nb_res;
+	const char* dir;
+	int compressed;
+	int sync;
+};
+
+static void file_path(char* path, size_t size, const char* dir, int i)
+{
+	snprintf(path, size, "%s/file_%03d.bin", dir, i);
+}
+
+// The pool callback, as extract_item() in libwdi.c, without the store
+static int extract_file(void* context, int i, unsigned char* write_buffer)
+{
+	struct bench* b = (struct bench*)context;
+	struct res* r = &b->r[i];
+	char path[1024];
+	int fd, ret;
+
+	file_path(path, sizeof(path), b->dir, i);
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return EXTRACT_ERROR_WRITE;
+	ret = b->compressed ? extract_to_handle(fd, r->compressed, r->compressed_size, r->size, write_buffer)
+		: extract_to_handle(fd, r->data, 0, r->size, write_buffer);
+	if ((ret == EXTRACT_SUCCESS) && b->sync && (fsync(fd) != 0))
+		ret = EXTRACT_ERROR_WRITE;
+	close(fd);
+	return ret;
+}
+
+// What extract_binaries() did before: fopen(), then a single fwrite() through stdio
+static int extract_stdio(struct bench* b)
+{
+	char path[1024];
+	FILE* fd;
+	int i;
+
+	for (i = 0; i < b->nb_res; i++) {
+		file_path(path, sizeof(path), b->dir, i);
+		fd = fopen(path, "wb");
+		if (fd == NULL)
+			return -1;
+		if ((fwrite(b->r[i].data, 1, b->r[i].size, fd) != b->r[i].size) || (fflush(fd) != 0)
+		  || (b->sync && (fsync(fileno(fd)) != 0))) {
+			fclose(fd);
+			return -1;
+		}
+		fclose(fd);
+	}
+	return 0;
+}
+
+static void check_files(struct bench* b)
+{
+	char path[1024];
+	size_t size;
+	char* data;
+	int i;
+
+	for (i = 0; i < b->nb_res; i++) {
+		file_path(path, sizeof(path), b->dir, i);
+		data = test_read_file(path, &size, 0);
+		CHECK((data != NULL) && (size == b->r[i].size) && (memcmp(data, b->r[i].data, size) == 0));
+		free(data);
+		unlink(path);
+	}
+}
+
+// Best time of NB_PASSES, with nb_threads pool threads, or stdio if nb_threads is 0
+static double run(struct bench* b, int nb_threads, int compressed)
+{
+	unsigned char* write_buffer[EXTRACT_MAX_THREADS];
+	double t, best = 1e9;
+	int i, pass, r;
+
+	for (i = 0; i < EXTRACT_MAX_THREADS; i++)
+		write_buffer[i] = malloc(EXTRACT_BUFFER_SIZE);
+	b->compressed = compressed;
+	for (pass = 0; pass < NB_PASSES; pass++) {
+		t = test_now();
+		r = (nb_threads == 0) ? extract_stdio(b) : extract_run(extract_file, b, b->nb_res, write_buffer, nb_threads);
+		t = test_now() - t;
+		CHECK(r == 0);
+		if (t < best)
+			best = t;
+	}
+	check_files(b);
+	for (i = 0; i < EXTRACT_MAX_THREADS; i++)
+		free(write_buffer[i]);
+	return best;
+}
+
+// Driver like data, that compresses about 2:1: new bytes, mostly small values, and
+// copies of earlier runs
+static void fill(unsigned char* buf, size_t size)
+{
+	size_t i = 0, len, from;
+
+	while (i < size) {
+		if ((i > 1024) && ((test_rand() & 1) == 0)) {
+			len = 8 + test_rand() % 56;
+			from = i - 1 - test_rand() % 1024;
+			for (; (len > 0) && (i < size); len--)
+				buf[i++] = buf[from++];
+		} else {
+			for (len = 8 + test_rand() % 24; (len > 0) && (i < size); len--)
+				buf[i++] = ((test_rand() & 7) == 0) ? (unsigned char)test_rand() : (unsigned char)(test_rand() & 0x0F);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	struct bench b = { 0 };
+	char dir[1024];
+	size_t total = 0, total_compressed = 0;
+	double t;
+	int i, nb_threads, nb_files = 16, max_size = 8, sync = 0;
+
+	if ((argc > 1) && (strcmp(argv[1], "-s") == 0)) {
+		sync = 1;
+		argc--;
+		argv++;
+	}
+	if (argc > 1)
+		nb_files = atoi(argv[1]);
+	if (argc > 2)
+		max_size = atoi(argv[2]);
+	snprintf(dir, sizeof(dir), "%s/extract_bench_XXXXXX", (argc > 3) ? argv[3] : "/tmp");
+	if ((nb_files < 1) || (max_size < 1) || (mkdtemp(dir) == NULL)) {
+		fprintf(stderr, "usage: extract_bench [-s] [nb_files] [max_size_mb] [dir]\n");
+		return 1;
+	}
+
+	b.r = calloc(nb_files, sizeof(struct res));
+	b.nb_res = nb_files;
+	b.dir = dir;
+	b.sync = sync;
+	for (i = 0; i < nb_files; i++) {
+		// From 1 MB to max_size MB, and not a multiple of the chunk size
+		b.r[i].size = (1 + i % max_size) * 1024 * 1024 - 12345 * i;
+		if (b.r[i].size < 1024)
+			b.r[i].size = 1024 + i;
+		b.r[i].data = malloc(b.r[i].size);
+		fill(b.r[i].data, b.r[i].size);
+		b.r[i].compressed = malloc(lz4_chunks_bound(b.r[i].size));
+		b.r[i].compressed_size = lz4_compress_chunks(b.r[i].data, b.r[i].size, b.r[i].compressed);
+		total += b.r[i].size;
+		total_compressed += b.r[i].compressed_size;
+	}
+	// libwdi uses extract_nb_threads(), but more threads than CPUs still help with the I/O
+	nb_threads = EXTRACT_MAX_THREADS;
+
+	printf("%d files, %.1f MB (%.1f MB compressed), in %s%s, %d CPUs\n", nb_files, total / 1e6,
+		total_compressed / 1e6, dir, sync ? ", synced" : "", (int)sysconf(_SC_NPROCESSORS_ONLN));
+	t = run(&b, 0, 0);
+	printf("stdio, 1 thread:           %7.1f ms (%5.0f MB/s)\n", t * 1e3, total / t / 1e6);
+	t = run(&b, 1, 0);
+	printf("extract.h, 1 thread:       %7.1f ms (%5.0f MB/s)\n", t * 1e3, total / t / 1e6);
+	t = run(&b, nb_threads, 0);
+	printf("extract.h, %d threads:      %7.1f ms (%5.0f MB/s)\n", nb_threads, t * 1e3, total / t / 1e6);
+	t = run(&b, 1, 1);
+	printf("extract.h, LZ4, 1 thread:  %7.1f ms (%5.0f MB/s)\n", t * 1e3, total / t / 1e6);
+	t = run(&b, nb_threads, 1);
+	printf("extract.h, LZ4, %d threads: %7.1f ms (%5.0f MB/s)\n", nb_threads, t * 1e3, total / t / 1e6);
+	rmdir(dir);
+
+	for (i = 0; i < nb_files; i++) {
+		free(b.r[i].data);
+		free(b.r[i].compressed);
+	}
+	free(b.r);
+	return TEST_RESULT();
+}
@@ -0,0 +1,127 @@
+/*
+ * extract_test.c: tests of the extraction pool and writer
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include "test.h"
+#include "extract.h"
+
+#define NB_ITEMS 1000
+
+struct count {
+	volatile long seen[NB_ITEMS];
+	int fail_at;
+};
+
+static int count_item(void* context, int item, unsigned char* write_buffer)
+{
+	struct count* c = (struct count*)context;
+
+	// Each thread has its own buffer
+	write_buffer[0] = (unsigned char)item;
+	__sync_fetch_and_add(&c->seen[item], 1);
+	return (item == c->fail_at) ? -42 : 0;
+}
+
+static void test_pool(unsigned char** buffers)
+{
+	static struct count c;
+	int i, nb_threads, nb_seen;
+
+	for (nb_threads = 1; nb_threads <= EXTRACT_MAX_THREADS; nb_threads++) {
+		// Every item is processed exactly once
+		memset(&c, 0, sizeof(c));
+		c.fail_at = -1;
+		CHECK(extract_run(count_item, &c, NB_ITEMS, buffers, nb_threads) == 0);
+		for (i = 0; i < NB_ITEMS; i++)
+			CHECK(c.seen[i] == 1);
+		// A failure is returned, and stops the threads from picking up more than a few items
+		memset(&c, 0, sizeof(c));
+		c.fail_at = 10;
+		CHECK(extract_run(count_item, &c, NB_ITEMS, buffers, nb_threads) == -42);
+		for (i = 0, nb_seen = 0; i < NB_ITEMS; i++) {
+			CHECK(c.seen[i] <= 1);
+			nb_seen += (int)c.seen[i];
+		}
+		CHECK(c.seen[10] == 1);
+		CHECK(nb_seen < NB_ITEMS);
+	}
+	CHECK(extract_run(count_item, &c, 0, buffers, 2) == 0);
+}
+
+static int extract_to_file(const unsigned char* data, size_t compressed_size, size_t size,
+	unsigned char* write_buffer, unsigned char* out)
+{
+	FILE* fd = tmpfile();
+	int r;
+
+	r = extract_to_handle(fileno(fd), data, compressed_size, size, write_buffer);
+	if (r == EXTRACT_SUCCESS) {
+		rewind(fd);
+		if (fread(out, 1, size, fd) != size)
+			r = EXTRACT_ERROR_WRITE;
+		// Preallocating must not leave the file any larger
+		if (fgetc(fd) != EOF)
+			r = EXTRACT_ERROR_WRITE;
+	}
+	fclose(fd);
+	return r;
+}
+
+static void test_writer(size_t size, unsigned char* write_buffer)
+{
+	unsigned char *src = malloc(size + 1), *compressed = malloc(lz4_chunks_bound(size)), *out = malloc(size + 1);
+	size_t i, compressed_size;
+
+	for (i = 0; i < size; i++)
+		src[i] = ((test_rand() & 3) == 0) ? (unsigned char)test_rand() : (unsigned char)(i / 64);
+	compressed_size = lz4_compress_chunks(src, size, compressed);
+
+	CHECK(extract_to_file(src, 0, size, write_buffer, out) == EXTRACT_SUCCESS);
+	CHECK(memcmp(src, out, size) == 0);
+	if (size == 0) {
+		goto out;
+	}
+	memset(out, 0, size);
+	CHECK(extract_to_file(compressed, compressed_size, size, write_buffer, out) == EXTRACT_SUCCESS);
+	CHECK(memcmp(src, out, size) == 0);
+	// The size of the resource must match what the data decompresses to
+	CHECK(extract_to_file(compressed, compressed_size, size - 1, write_buffer, out) == EXTRACT_ERROR_CORRUPTED);
+	CHECK(extract_to_file(compressed, compressed_size, size + 1, write_buffer, out) == EXTRACT_ERROR_CORRUPTED);
+	// Truncated data
+	CHECK(extract_to_file(compressed, compressed_size - 1, size, write_buffer, out) == EXTRACT_ERROR_CORRUPTED);
+out:
+	free(src);
+	free(compressed);
+	free(out);
+}
+
+int main(void)
+{
+	static const size_t sizes[] = { 0, 1, 100, LZ4_CHUNK_SIZE - 1, LZ4_CHUNK_SIZE, LZ4_CHUNK_SIZE + 1,
+		EXTRACT_BUFFER_SIZE - 1, EXTRACT_BUFFER_SIZE, EXTRACT_BUFFER_SIZE + 1, 3 * EXTRACT_BUFFER_SIZE + 12345 };
+	unsigned char* buffers[EXTRACT_MAX_THREADS];
+	int i;
+
+	for (i = 0; i < EXTRACT_MAX_THREADS; i++)
+		buffers[i] = malloc(EXTRACT_BUFFER_SIZE);
+	test_pool(buffers);
+	for (i = 0; i < (int)(sizeof(sizes) / sizeof(sizes[0])); i++)
+		test_writer(sizes[i], buffers[0]);
+	for (i = 0; i < EXTRACT_MAX_THREADS; i++)
+		free(buffers[i]);
+	return TEST_RESULT();
+}
@@ -0,0 +1,153 @@
+/*
+ * lz4_bench.c: size and extraction time of compressed against uncompressed resources
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Usage: lz4_bench [file...]
+ * The files stand for the embedded resources, e.g. the driver binaries of a WDK or
+ * libusb0 distribution. They are extracted to a temporary directory one at a time,
+ * with the same writer as libwdi: the file is preallocated, then written from the
+ * embedded data, or decompressed chunk by chunk through a 16 chunk buffer.
+ */
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "test.h"
+#include "extract.h"
+
+#define NB_PASSES 10
+
+struct res {
+	const char* name;
+	unsigned char* data;
+	size_t size;
+	unsigned char* compressed;
+	size_t compressed_size;
+};
+
+static int write_resource(const struct res* r, const char* path, unsigned char* write_buffer, int compressed)
+{
+	int fd, ret;
+
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return -1;
+	ret = compressed ? extract_to_handle(fd, r->compressed, r->compressed_size, r->size, write_buffer)
+		: extract_to_handle(fd, r->data, 0, r->size, write_buffer);
+	close(fd);
+	return ret;
+}
+
+static double extract(struct res* r, int nb_res, const char* dir, int compressed)
+{
+	unsigned char* write_buffer = malloc(EXTRACT_BUFFER_SIZE);
+	char path[1024];
+	double t, best = 1e9;
+	int i, pass;
+
+	for (pass = 0; pass < NB_PASSES; pass++) {
+		t = test_now();
+		for (i = 0; i < nb_res; i++) {
+			snprintf(path, sizeof(path), "%s/file_%03d", dir, i);
+			if (write_resource(&r[i], path, write_buffer, compressed) != 0) {
+				fprintf(stderr, "could not extract %s\n", r[i].name);
+				exit(1);
+			}
+		}
+		t = test_now() - t;
+		if (t < best)
+			best = t;
+	}
+	free(write_buffer);
+	return best;
+}
+
+int main(int argc, char** argv)
+{
+	struct res* r = calloc(argc, sizeof(struct res));
+	unsigned char* out;
+	char dir[] = "/tmp/lz4_bench_XXXXXX", path[1024];
+	size_t total = 0, total_compressed = 0, max_size = 0;
+	double t, compress_time, decompress_time = 1e9, t_raw, t_lz4;
+	int i, nb_res = 0, pass;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s file...\n", argv[0]);
+		return 1;
+	}
+	for (i = 1; i < argc; i++) {
+		r[nb_res].data = (unsigned char*)test_read_file(argv[i], &r[nb_res].size, 0);
+		if ((r[nb_res].data == NULL) || (r[nb_res].size == 0))
+			continue;
+		r[nb_res].name = argv[i];
+		total += r[nb_res].size;
+		if (r[nb_res].size > max_size)
+			max_size = r[nb_res].size;
+		nb_res++;
+	}
+
+	compress_time = test_now();
+	for (i = 0; i < nb_res; i++) {
+		r[i].compressed = malloc(lz4_chunks_bound(r[i].size));
+		r[i].compressed_size = lz4_compress_chunks(r[i].data, r[i].size, r[i].compressed);
+		total_compressed += r[i].compressed_size;
+	}
+	compress_time = test_now() - compress_time;
+
+	// Decompression alone, to tell it apart from the file system
+	out = malloc(max_size);
+	for (pass = 0; pass < NB_PASSES; pass++) {
+		t = test_now();
+		for (i = 0; i < nb_res; i++) {
+			if (lz4_decompress_chunks(r[i].compressed, r[i].compressed_size, out, r[i].size) != (int)r[i].size) {
+				fprintf(stderr, "could not decompress %s\n", r[i].name);
+				return 1;
+			}
+		}
+		t = test_now() - t;
+		if (t < decompress_time)
+			decompress_time = t;
+	}
+
+	if (mkdtemp(dir) == NULL) {
+		perror("mkdtemp");
+		return 1;
+	}
+	t_raw = extract(r, nb_res, dir, 0);
+	t_lz4 = extract(r, nb_res, dir, 1);
+	for (i = 0; i < nb_res; i++) {
+		snprintf(path, sizeof(path), "%s/file_%03d", dir, i);
+		unlink(path);
+	}
+	rmdir(dir);
+
+	printf("%d files\n", nb_res);
+	printf("embedded size: %zu bytes uncompressed, %zu bytes compressed (%.1f%%)\n",
+		total, total_compressed, total ? 100.0 * total_compressed / total : 0.0);
+	printf("compression (embedder): %.1f ms\n", compress_time * 1e3);
+	printf("decompression: %.2f ms (%.0f MB/s)\n", decompress_time * 1e3, total / decompress_time / 1e6);
+	printf("extraction: %.2f ms uncompressed, %.2f ms compressed\n", t_raw * 1e3, t_lz4 * 1e3);
+	for (i = 0; i < nb_res; i++) {
+		free(r[i].data);
+		free(r[i].compressed);
+	}
+	free(r);
+	free(out);
+	return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * lz4_test.c: round trip and corruption tests of the resource compression
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <string.h>
+#include "test.h"
+#include "lz4.h"
+
+enum { DATA_ZEROS, DATA_RANDOM, DATA_TEXT, DATA_PE, DATA_MAX };
+
+static void fill(unsigned char* buf, size_t size, int type)
+{
+	static const char* words[] = { "Device", "Driver", "%DeviceName%", "USB\\VID_", "&PID_",
+		"HKR,,", "WinUSB", "\r\n", " = ", "[Strings]", "0x", "DeviceInterfaceGUIDs" };
+	size_t i, len;
+
+	switch (type) {
+	case DATA_ZEROS:
+		memset(buf, 0, size);
+		break;
+	case DATA_RANDOM:
+		for (i = 0; i < size; i++)
+			buf[i] = (unsigned char)test_rand();
+		break;
+	case DATA_TEXT:
+		for (i = 0; i < size; i += len) {
+			const char* w = words[test_rand() % (sizeof(words) / sizeof(words[0]))];
+			len = strlen(w);
+			if (len > size - i)
+				len = size - i;
+			memcpy(&buf[i], w, len);
+		}
+		break;
+	default:
+		// Code like data: mostly small values, with some repeated runs
+		for (i = 0; i < size; i++)
+			buf[i] = ((test_rand() & 7) == 0) ? (unsigned char)test_rand() : (unsigned char)(test_rand() & 0x0F);
+		break;
+	}
+}
+
+static void round_trip(size_t size, int type)
+{
+	unsigned char *src = malloc(size + 1), *dst = malloc(lz4_chunks_bound(size)), *out = malloc(size + 1);
+	size_t compressed_size;
+
+	fill(src, size, type);
+	compressed_size = lz4_compress_chunks(src, size, dst);
+	CHECK(compressed_size <= lz4_chunks_bound(size));
+	// Exactly sized output, so that the last partial chunk is decompressed in place
+	CHECK(lz4_decompress_chunks(dst, compressed_size, out, size) == (int)size);
+	CHECK(memcmp(src, out, size) == 0);
+	// An output that is one byte short must be rejected
+	if (size > 0)
+		CHECK(lz4_decompress_chunks(dst, compressed_size, out, size - 1) == -1);
+	free(src);
+	free(dst);
+	free(out);
+}
+
+// Decompressing corrupted data must fail cleanly, without reading or writing out of bounds
+static void corrupt(size_t size, int nb_rounds)
+{
+	unsigned char *src = malloc(size), *dst = malloc(lz4_chunks_bound(size)), *bad, *out = malloc(size);
+	size_t compressed_size, bad_size;
+	int i, k;
+
+	fill(src, size, DATA_TEXT);
+	compressed_size = lz4_compress_chunks(src, size, dst);
+	for (i = 0; i < nb_rounds; i++) {
+		bad_size = compressed_size - (test_rand() % 2) * (test_rand() % (compressed_size + 1));
+		bad = malloc(bad_size + 1);
+		memcpy(bad, dst, bad_size);
+		for (k = 0; k < 4; k++)
+			if (bad_size > 0)
+				bad[test_rand() % bad_size] = (unsigned char)test_rand();
+		test_sink += lz4_decompress_chunks(bad, bad_size, out, size);
+		free(bad);
+	}
+	free(src);
+	free(dst);
+	free(out);
+}
+
+int main(void)
+{
+	static const size_t large[] = { LZ4_CHUNK_SIZE - 1, LZ4_CHUNK_SIZE, LZ4_CHUNK_SIZE + 1,
+		3 * LZ4_CHUNK_SIZE + 12345, 1024 * 1024 + 17 };
+	size_t size;
+	int type, i;
+
+	// Small sizes cover the blocks that are too short to hold a match
+	for (type = 0; type < DATA_MAX; type++) {
+		for (size = 0; size <= 300; size++)
+			round_trip(size, type);
+		for (i = 0; i < (int)(sizeof(large) / sizeof(large[0])); i++)
+			round_trip(large[i], type);
+	}
+	corrupt(200, 20000);
+	corrupt(LZ4_CHUNK_SIZE + 999, 2000);
+	return TEST_RESULT();
+}
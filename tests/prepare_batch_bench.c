@@ -0,0 +1,110 @@
+/*
+ * prepare_batch_bench.c: wdi_prepare_driver_batch() against a loop of wdi_prepare_driver()
+ * (Windows only)
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Usage: prepare_batch_bench [nb_devices]
+ * Prepares the packages of the same VID/PID/MI combinations into one directory with
+ * single calls, and into another one with a batch, checks every package, and checks
+ * that a batch rejects the devices that reuse an inf name.
+ */
+#include "prepare_check.h"
+
+int main(int argc, char** argv)
+{
+	struct wdi_options_prepare_driver options = { 0 };
+	struct wdi_prepare_driver_device* batch;
+	struct wdi_device_info* devices;
+	char base[MAX_PATH], path[MAX_PATH], name[64], **inf_names;
+	int i, r, nb_devices = (argc > 1) ? atoi(argv[1]) : 200;
+	double t_loop, t_batch;
+
+	if (nb_devices < 2)
+		nb_devices = 2;
+	options.driver_type = test_driver_type();
+	if (options.driver_type < 0) {
+		fprintf(stderr, "this build of libwdi has no driver to test with\n");
+		return 1;
+	}
+	options.disable_signing = TRUE;
+	options.vendor_name = "libwdi tests";
+	GetTempPathA(sizeof(base), base);
+	snprintf(&base[strlen(base)], sizeof(base) - strlen(base), "libwdi_batch_%lu", GetCurrentProcessId());
+
+	devices = calloc(nb_devices, sizeof(struct wdi_device_info));
+	batch = calloc(nb_devices, sizeof(struct wdi_prepare_driver_device));
+	inf_names = calloc(nb_devices, sizeof(char*));
+	for (i = 0; i < nb_devices; i++) {
+		devices[i].vid = (unsigned short)(0x2000 + i / 16);
+		devices[i].pid = (unsigned short)(i / 4);
+		devices[i].is_composite = TRUE;
+		devices[i].mi = (unsigned char)(i % 4);
+		snprintf(name, sizeof(name), "Batch Device %d", i);
+		devices[i].desc = _strdup(name);
+		snprintf(name, sizeof(name), "device_%04d.inf", i);
+		inf_names[i] = _strdup(name);
+		batch[i].device_info = &devices[i];
+		batch[i].inf_name = inf_names[i];
+	}
+
+	snprintf(path, sizeof(path), "%s\\loop", base);
+	t_loop = test_now();
+	for (i = 0; i < nb_devices; i++) {
+		r = wdi_prepare_driver(&devices[i], path, inf_names[i], &options);
+		if (r != WDI_SUCCESS) {
+			fprintf(stderr, "%s\\%s: %s\n", path, inf_names[i], wdi_strerror(r));
+			test_failures++;
+		}
+	}
+	t_loop = test_now() - t_loop;
+	for (i = 0; i < nb_devices; i++)
+		test_check_package(path, inf_names[i], &devices[i], TRUE);
+
+	snprintf(path, sizeof(path), "%s\\batch", base);
+	t_batch = test_now();
+	r = wdi_prepare_driver_batch(batch, nb_devices, path, &options);
+	t_batch = test_now() - t_batch;
+	CHECK(r == WDI_SUCCESS);
+	for (i = 0; i < nb_devices; i++) {
+		CHECK(batch[i].status == WDI_SUCCESS);
+		test_check_package(path, inf_names[i], &devices[i], TRUE);
+	}
+
+	// Only the first of the devices that share an inf name is prepared
+	snprintf(path, sizeof(path), "%s\\duplicates", base);
+	batch[1].inf_name = "DEVICE_0000.INF";
+	r = wdi_prepare_driver_batch(batch, 2, path, &options);
+	CHECK(r == WDI_ERROR_INVALID_PARAM);
+	CHECK(batch[0].status == WDI_SUCCESS);
+	CHECK(batch[1].status == WDI_ERROR_INVALID_PARAM);
+	test_check_package(path, inf_names[0], &devices[0], TRUE);
+
+	printf("%d devices, in %s\n", nb_devices, base);
+	printf("wdi_prepare_driver() loop: %.3f s (%.2f ms per device)\n", t_loop, t_loop * 1e3 / nb_devices);
+	printf("wdi_prepare_driver_batch(): %.3f s (%.2f ms per device), %.1fx\n", t_batch,
+		t_batch * 1e3 / nb_devices, t_loop / t_batch);
+	for (i = 0; i < nb_devices; i++) {
+		free(devices[i].desc);
+		free(inf_names[i]);
+	}
+	free(devices);
+	free(batch);
+	free(inf_names);
+	return TEST_RESULT();
+}
@@ -0,0 +1,98 @@
+/*
+ * prepare_check.h: checks of the driver packages created by wdi_prepare_driver()
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#pragma once
+
+#include <windows.h>
+#include <string.h>
+#include "test.h"
+#include "libwdi.h"
+
+// The first driver that this build of libwdi embeds, other than WDI_USER
+static __inline int test_driver_type(void)
+{
+	static const int types[] = { WDI_WINUSB, WDI_LIBUSB0, WDI_LIBUSBK, WDI_CDC };
+	int i;
+
+	for (i = 0; i < (int)(sizeof(types) / sizeof(types[0])); i++) {
+		if (wdi_is_driver_supported(types[i], NULL))
+			return types[i];
+	}
+	return -1;
+}
+
+// Reads a UTF-16LE inf, as created by libwdi, into a UTF-8 string
+static __inline char* test_read_inf(const char* path)
+{
+	size_t size;
+	char *data = test_read_file(path, &size, 2), *utf8 = NULL;
+	int len;
+
+	if (data == NULL)
+		return NULL;
+	data[size] = data[size + 1] = 0;
+	if ((size >= 2) && ((unsigned char)data[0] == 0xFF) && ((unsigned char)data[1] == 0xFE)) {
+		len = WideCharToMultiByte(CP_UTF8, 0, (const wchar_t*)&data[2], -1, NULL, 0, NULL, NULL);
+		utf8 = (len > 0) ? malloc(len) : NULL;
+		if ((utf8 != NULL) && (WideCharToMultiByte(CP_UTF8, 0, (const wchar_t*)&data[2], -1, utf8, len, NULL, NULL) != len)) {
+			free(utf8);
+			utf8 = NULL;
+		}
+	}
+	free(data);
+	return utf8;
+}
+
+// Checks that the inf and cat in path were created for this device, and for no other
+static __inline int test_check_package(const char* path, const char* inf_name,
+	const struct wdi_device_info* dev, BOOL has_cat)
+{
+	char file[MAX_PATH], line[512], *inf;
+	size_t cat_size;
+	int failures = test_failures;
+	char* cat;
+
+	snprintf(file, sizeof(file), "%s\\%s", path, inf_name);
+	inf = test_read_inf(file);
+	CHECK(inf != NULL);
+	if (inf == NULL)
+		return -1;
+	snprintf(line, sizeof(line), "DeviceName = \"%s\"", dev->desc);
+	CHECK(strstr(inf, line) != NULL);
+	if (dev->is_composite)
+		snprintf(line, sizeof(line), "DeviceID   = \"VID_%04X&PID_%04X&MI_%02X\"", dev->vid, dev->pid, dev->mi);
+	else
+		snprintf(line, sizeof(line), "DeviceID   = \"VID_%04X&PID_%04X\"", dev->vid, dev->pid);
+	CHECK(strstr(inf, line) != NULL);
+	// The cat name is the inf name, with a .cat extension
+	snprintf(line, sizeof(line), "CatalogFile = %.*s.cat", (int)(strrchr(inf_name, '.') - inf_name), inf_name);
+	CHECK(strstr(inf, line) != NULL);
+	// Every tag must have been replaced
+	CHECK(strstr(inf, "#DEVICE_") == NULL);
+	CHECK(strstr(inf, "#INF_FILENAME#") == NULL);
+	CHECK(strstr(inf, "#CAT_FILENAME#") == NULL);
+	free(inf);
+
+	if (has_cat) {
+		snprintf(file, sizeof(file), "%s\\%.*s.cat", path, (int)(strrchr(inf_name, '.') - inf_name), inf_name);
+		cat = test_read_file(file, &cat_size, 0);
+		CHECK((cat != NULL) && (cat_size > 0));
+		free(cat);
+	}
+	return (test_failures == failures) ? 0 : -1;
+}
@@ -0,0 +1,198 @@
+/*
+ * prepare_stress.c: concurrent calls to wdi_prepare_driver() (Windows only)
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Usage: prepare_stress [nb_threads] [nb_rounds]
+ * Each thread prepares the packages of its own devices, into their own directories,
+ * while the other threads do the same. Every inf and cat is then checked against the
+ * device it was created for, so that values leaking from one call to another show up.
+ * This is done once with the messages going to the console, and once with a logger
+ * window, that reads them from the main thread while the others keep logging.
+ */
+#include "prepare_check.h"
+
+#define UM_LOGGER (WM_APP + 1)
+
+struct job {
+	int thread;
+	int nb_rounds;
+	char base[MAX_PATH];
+	struct wdi_options_prepare_driver* options;
+	struct wdi_device_info* devices;
+	int* status;
+};
+
+static int nb_log_messages = 0, nb_log_errors = 0;
+
+static void set_device(struct wdi_device_info* dev, int thread, int round)
+{
+	char desc[128];
+
+	memset(dev, 0, sizeof(*dev));
+	dev->vid = (unsigned short)(0x1000 + thread);
+	dev->pid = (unsigned short)round;
+	// Composite devices and non ASCII descriptions go through other paths
+	dev->is_composite = (round & 1);
+	dev->mi = (unsigned char)(round % 7);
+	snprintf(desc, sizeof(desc), "Stress Device %d.%d \xC3\xA9\xE2\x82\xAC", thread, round);
+	dev->desc = _strdup(desc);
+}
+
+static DWORD WINAPI prepare_thread(LPVOID param)
+{
+	struct job* job = (struct job*)param;
+	char path[MAX_PATH];
+	int r;
+
+	for (r = 0; r < job->nb_rounds; r++) {
+		snprintf(path, sizeof(path), "%s\\dev_%03d_%03d", job->base, job->thread, r);
+		job->status[r] = wdi_prepare_driver(&job->devices[r], path, "device.inf", job->options);
+	}
+	return 0;
+}
+
+// Every message must be a whole libwdi message, in spite of the threads logging at once
+static LRESULT CALLBACK logger_proc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
+{
+	char line[512];
+	DWORD size;
+
+	if (msg != UM_LOGGER)
+		return DefWindowProcA(hwnd, msg, wparam, lparam);
+	if ( (wdi_read_logger(line, sizeof(line), &size) == WDI_SUCCESS) && (size > 0)
+	  && (strncmp(line, "libwdi:", 7) == 0) )
+		nb_log_messages++;
+	else
+		nb_log_errors++;
+	return 0;
+}
+
+// Wait for the threads, while processing the messages of the logger window, if any
+static void wait_threads(HANDLE* threads, int nb_threads)
+{
+	MSG msg;
+	int i;
+
+	for (i = 0; i < nb_threads; i++) {
+		while (MsgWaitForMultipleObjects(1, &threads[i], FALSE, INFINITE, QS_ALLINPUT) != WAIT_OBJECT_0) {
+			while (PeekMessageA(&msg, NULL, 0, 0, PM_REMOVE))
+				DispatchMessageA(&msg);
+		}
+	}
+	while (PeekMessageA(&msg, NULL, 0, 0, PM_REMOVE))
+		DispatchMessageA(&msg);
+}
+
+static void stress(const char* base, struct wdi_options_prepare_driver* options,
+	int nb_threads, int nb_rounds)
+{
+	struct job* jobs;
+	HANDLE* threads;
+	char path[MAX_PATH];
+	int i, r;
+	double t;
+
+	jobs = calloc(nb_threads, sizeof(struct job));
+	threads = calloc(nb_threads, sizeof(HANDLE));
+	for (i = 0; i < nb_threads; i++) {
+		jobs[i].thread = i;
+		jobs[i].nb_rounds = nb_rounds;
+		strcpy(jobs[i].base, base);
+		jobs[i].options = options;
+		jobs[i].devices = calloc(nb_rounds, sizeof(struct wdi_device_info));
+		jobs[i].status = calloc(nb_rounds, sizeof(int));
+		for (r = 0; r < nb_rounds; r++)
+			set_device(&jobs[i].devices[r], i, r);
+	}
+
+	t = test_now();
+	for (i = 0; i < nb_threads; i++)
+		threads[i] = CreateThread(NULL, 0, prepare_thread, &jobs[i], 0, NULL);
+	wait_threads(threads, nb_threads);
+	t = test_now() - t;
+
+	for (i = 0; i < nb_threads; i++) {
+		CloseHandle(threads[i]);
+		for (r = 0; r < nb_rounds; r++) {
+			snprintf(path, sizeof(path), "%s\\dev_%03d_%03d", base, i, r);
+			if (jobs[i].status[r] != WDI_SUCCESS) {
+				fprintf(stderr, "%s: %s\n", path, wdi_strerror(jobs[i].status[r]));
+				test_failures++;
+				continue;
+			}
+			if (test_check_package(path, "device.inf", &jobs[i].devices[r], TRUE) != 0)
+				fprintf(stderr, "%s: wrong package\n", path);
+		}
+	}
+	printf("%d threads, %d packages in %.2f s, in %s\n", nb_threads, nb_threads * nb_rounds, t, base);
+
+	for (i = 0; i < nb_threads; i++) {
+		for (r = 0; r < nb_rounds; r++)
+			free(jobs[i].devices[r].desc);
+		free(jobs[i].devices);
+		free(jobs[i].status);
+	}
+	free(jobs);
+	free(threads);
+}
+
+int main(int argc, char** argv)
+{
+	struct wdi_options_prepare_driver options = { 0 };
+	WNDCLASSA wc = { 0 };
+	HWND hwnd;
+	char base[MAX_PATH], path[MAX_PATH];
+	int nb_threads = (argc > 1) ? atoi(argv[1]) : 16, nb_rounds = (argc > 2) ? atoi(argv[2]) : 8;
+
+	// One thread handle per wait, but a single array of them
+	if ((nb_threads < 1) || (nb_threads > MAXIMUM_WAIT_OBJECTS))
+		nb_threads = MAXIMUM_WAIT_OBJECTS;
+	options.driver_type = test_driver_type();
+	if (options.driver_type < 0) {
+		fprintf(stderr, "this build of libwdi has no driver to test with\n");
+		return 1;
+	}
+	// The signing of the cat would install a certificate for each device
+	options.disable_signing = TRUE;
+	options.vendor_name = "libwdi tests";
+	GetTempPathA(sizeof(base), base);
+	snprintf(&base[strlen(base)], sizeof(base) - strlen(base), "libwdi_stress_%lu", GetCurrentProcessId());
+
+	snprintf(path, sizeof(path), "%s\\console", base);
+	stress(path, &options, nb_threads, nb_rounds);
+
+	wc.lpfnWndProc = logger_proc;
+	wc.hInstance = GetModuleHandleA(NULL);
+	wc.lpszClassName = "prepare_stress";
+	RegisterClassA(&wc);
+	hwnd = CreateWindowA("prepare_stress", NULL, 0, 0, 0, 0, 0, HWND_MESSAGE, NULL, wc.hInstance, NULL);
+	CHECK(hwnd != NULL);
+	CHECK(wdi_register_logger(hwnd, UM_LOGGER, 0) == WDI_SUCCESS);
+	// As many messages as possible, so that the pipe fills up
+	wdi_set_log_level(WDI_LOG_LEVEL_DEBUG);
+	snprintf(path, sizeof(path), "%s\\logger", base);
+	stress(path, &options, nb_threads, nb_rounds);
+	wdi_unregister_logger(hwnd);
+	DestroyWindow(hwnd);
+	printf("%d messages read from the logger\n", nb_log_messages);
+	CHECK(nb_log_messages > 0);
+	CHECK(nb_log_errors == 0);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,152 @@
+/*
+ * resource_index_bench.c: indexed against linear lookup of the embedded resources
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Usage: resource_index_bench [nb_subdirs] [nb_files_per_subdir]
+ * Builds a resource table that looks like a large USER_DIR payload, with the index
+ * sorted the same way as the embedder does, and checks that the lookup of libwdi.c,
+ * from resource_index.h, returns the same resources as the linear scans it replaced.
+ */
+#include <string.h>
+#include "test.h"
+
+struct res {
+	char* subdir;
+	char* name;
+};
+
+static struct res* resource;
+static int* resource_index;
+static int nb_resources;
+
+#include "resource_index.h"
+
+// As in libwdi.c
+static int find_resource(const char* subdir, const char* name)
+{
+	return resource_index_find(resource, resource_index, nb_resources, subdir, name);
+}
+
+// The lookup that wdi_is_file_embedded() used to do
+static int find_resource_linear(const char* subdir, const char* name)
+{
+	int i;
+
+	for (i = 0; i < nb_resources; i++) {
+		if ( ((subdir == NULL) || (strcmp(resource[i].subdir, subdir) == 0))
+		  && (strcmp(resource[i].name, name) == 0) ) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+// Same order as compare_res_keys() in embedder.c
+static int compare_index(const void* a, const void* b)
+{
+	int ia = *(const int*)a, ib = *(const int*)b, r;
+
+	r = strcmp(resource[ia].name, resource[ib].name);
+	if (r == 0)
+		r = strcmp(resource[ia].subdir, resource[ib].subdir);
+	return (r != 0) ? r : ia - ib;
+}
+
+int main(int argc, char** argv)
+{
+	static const char* drivers[] = { "winusbcoinstaller2.dll", "WdfCoInstaller01011.dll",
+		"libusb0.sys", "libusb0.dll", "libusbK.sys", "libusbK.dll", "libusbK_x86.dll" };
+	static const char* arch[] = { "x86", "amd64", "arm64" };
+	int nb_subdirs = (argc > 1) ? atoi(argv[1]) : 64;
+	int nb_files = (argc > 2) ? atoi(argv[2]) : 32;
+	int i, j, k, n = 0, nb_queries, nb_found = 0;
+	char buf[64], **query_subdir, **query_name;
+	double t_linear, t_index;
+
+	resource = calloc(nb_subdirs * nb_files + 32, sizeof(struct res));
+	resource_index = calloc(nb_subdirs * nb_files + 32, sizeof(int));
+	// The standard driver files, then the user payload
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < (int)(sizeof(drivers) / sizeof(drivers[0])); j++) {
+			resource[n].subdir = strdup(arch[i]);
+			resource[n++].name = strdup(drivers[j]);
+		}
+	}
+	resource[n].subdir = strdup(".");
+	resource[n++].name = strdup("installer_x64.exe");
+	for (i = 0; i < nb_subdirs; i++) {
+		for (j = 0; j < nb_files; j++) {
+			snprintf(buf, sizeof(buf), "user\\device_%03d\\%s", i, arch[j % 3]);
+			resource[n].subdir = strdup(buf);
+			// Some names are shared by several subdirs
+			snprintf(buf, sizeof(buf), (j % 4 == 0) ? "common_%03d.dll" : "file_%03d_%03d.sys", j, i);
+			resource[n++].name = strdup(buf);
+		}
+	}
+	nb_resources = n;
+	for (i = 0; i < n; i++)
+		resource_index[i] = i;
+	qsort(resource_index, n, sizeof(int), compare_index);
+
+	// Every resource, by subdir and name, and by name only, plus the same number of misses
+	nb_queries = 4 * n;
+	query_subdir = calloc(nb_queries, sizeof(char*));
+	query_name = calloc(nb_queries, sizeof(char*));
+	for (i = 0; i < n; i++) {
+		query_subdir[4 * i] = resource[i].subdir;
+		query_name[4 * i] = resource[i].name;
+		query_subdir[4 * i + 1] = NULL;
+		query_name[4 * i + 1] = resource[i].name;
+		query_subdir[4 * i + 2] = resource[(i + 1) % n].subdir;
+		query_name[4 * i + 2] = resource[i].name;
+		query_subdir[4 * i + 3] = NULL;
+		snprintf(buf, sizeof(buf), "missing_%d.dll", i);
+		query_name[4 * i + 3] = strdup(buf);
+	}
+	for (i = 0; i < nb_queries; i++) {
+		k = find_resource(query_subdir[i], query_name[i]);
+		CHECK(k == find_resource_linear(query_subdir[i], query_name[i]));
+		nb_found += (k >= 0);
+	}
+
+	t_linear = test_now();
+	for (k = 0; k < 4; k++)
+		for (i = 0; i < nb_queries; i++)
+			test_sink += find_resource_linear(query_subdir[i], query_name[i]);
+	t_linear = test_now() - t_linear;
+	t_index = test_now();
+	for (k = 0; k < 4; k++)
+		for (i = 0; i < nb_queries; i++)
+			test_sink += find_resource(query_subdir[i], query_name[i]);
+	t_index = test_now() - t_index;
+
+	printf("%d resources, %d lookups (%d hits)\n", n, nb_queries, nb_found);
+	printf("linear scan: %.0f ns per lookup\n", t_linear * 1e9 / (4.0 * nb_queries));
+	printf("find_resource: %.0f ns per lookup\n", t_index * 1e9 / (4.0 * nb_queries));
+	for (i = 0; i < n; i++) {
+		free(resource[i].subdir);
+		free(resource[i].name);
+		free(query_name[4 * i + 3]);
+	}
+	free(resource);
+	free(resource_index);
+	free(query_subdir);
+	free(query_name);
+	return TEST_RESULT();
+}
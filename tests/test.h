@@ -0,0 +1,94 @@
+/*
+ * test.h: helpers for the tests and benchmarks of the portable parts of libwdi
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define TEST_UNUSED __attribute__((unused))
+
+static int test_failures TEST_UNUSED = 0;
+
+// Report a failed check, and carry on with the next ones
+#define CHECK(cond) do { if (!(cond)) { \
+	fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+	test_failures++; } } while (0)
+
+// Exit status of a test, once all the checks have run
+#define TEST_RESULT() ((test_failures == 0) ? (printf("PASS\n"), 0) : (printf("FAIL (%d)\n", test_failures), 1))
+
+// Keep the compiler from optimizing away the results of a benchmark loop
+static volatile uint64_t test_sink TEST_UNUSED;
+
+static __inline double test_now(void)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER count, frequency;
+
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&frequency);
+	return (double)count.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+#endif
+}
+
+// xorshift64*, so that the random inputs are the same on every run
+static uint64_t test_seed TEST_UNUSED = 0x9E3779B97F4A7C15ULL;
+
+static __inline uint64_t test_rand(void)
+{
+	test_seed ^= test_seed >> 12;
+	test_seed ^= test_seed << 25;
+	test_seed ^= test_seed >> 27;
+	return test_seed * 0x2545F4914F6CDD1DULL;
+}
+
+// Read a whole file into a NUL terminated buffer, with room for extra bytes
+static __inline char* test_read_file(const char* path, size_t* size, size_t extra)
+{
+	FILE* fd = fopen(path, "rb");
+	char* data = NULL;
+	long len;
+
+	if (fd == NULL)
+		return NULL;
+	if ((fseek(fd, 0, SEEK_END) == 0) && ((len = ftell(fd)) >= 0) && (fseek(fd, 0, SEEK_SET) == 0)) {
+		data = (char*)malloc(len + extra + 1);
+		if ((data != NULL) && (fread(data, 1, len, fd) != (size_t)len)) {
+			free(data);
+			data = NULL;
+		}
+	}
+	fclose(fd);
+	if (data != NULL) {
+		data[len] = 0;
+		*size = (size_t)len;
+	}
+	return data;
+}
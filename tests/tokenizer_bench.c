@@ -0,0 +1,172 @@
+/*
+ * tokenizer_bench.c: rendering of the INF templates for many devices
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Usage: tokenizer_bench [-n nb_devices] template.inf.in...
+ * Renders each template once per device, with the tags of libwdi, through the original
+ * tokenizer, tokenize_string(), which compiles a matcher for each call, a matcher that
+ * is compiled once, and a compiled template, and checks that all the outputs are equal.
+ */
+#include <string.h>
+#include "test.h"
+#include "tokenizer_ref.h"
+#include "inf_tags.h"
+
+enum { RENDER_REFERENCE, RENDER_STRING, RENDER_COMPILED, RENDER_TEMPLATE, RENDER_MAX };
+static const char* render_name[RENDER_MAX] = { "original tokenizer", "tokenize_string()",
+	"compiled matcher", "compiled template" };
+
+#define set_value(tag, str) snprintf(entities[tag].replace, sizeof(entities[tag].replace), "%s", str)
+
+static void set_device(token_entity_t* entities, const char** values, int n)
+{
+	int i;
+
+	snprintf(entities[INF_FILENAME].replace, sizeof(entities[0].replace), "device_%05d.inf", n);
+	snprintf(entities[CAT_FILENAME].replace, sizeof(entities[0].replace), "device_%05d.cat", n);
+	snprintf(entities[DEVICE_DESCRIPTION].replace, sizeof(entities[0].replace), "Provisioned Device #%d", n);
+	snprintf(entities[DEVICE_HARDWARE_ID].replace, sizeof(entities[0].replace),
+		"VID_%04X&PID_%04X&MI_%02X", 0x1000 + n % 0xE000, n & 0xFFFF, n % 4);
+	snprintf(entities[DEVICE_INTERFACE_GUID].replace, sizeof(entities[0].replace),
+		"{%08X-1234-5678-9ABC-DEF012345678}", n);
+	for (i = 0; i < NB_INF_TAGS; i++)
+		values[i] = entities[i].replace;
+}
+
+static char* render(int method, const char* src, long size, token_entity_t* entities,
+	const char** values, const token_matcher_t* matcher, const token_template_t* tmpl, long* out_size)
+{
+	char* out = NULL;
+
+	switch (method) {
+	case RENDER_REFERENCE:
+		*out_size = tokenize_string_reference(src, size, &out, entities, "#", "#", 0);
+		break;
+	case RENDER_STRING:
+		*out_size = tokenize_string(src, size, &out, entities, "#", "#", 0);
+		break;
+	case RENDER_COMPILED:
+		*out_size = tokenize_string_compiled(src, size, &out, matcher, 0);
+		break;
+	default:
+		*out_size = tokenize_render(tmpl, values, &out);
+		break;
+	}
+	return out;
+}
+
+int main(int argc, char** argv)
+{
+	token_entity_t entities[NB_INF_TAGS + 1];
+	const char* values[NB_INF_TAGS];
+	token_matcher_t* matcher;
+	token_template_t** tmpl;
+	char **src, *out, *ref;
+	size_t* src_size, total_in = 0, total_out = 0;
+	int i, j, n, method, nb_templates, nb_devices = 4000;
+	double t[RENDER_MAX];
+	long out_size, ref_size;
+
+	if ((argc > 2) && (strcmp(argv[1], "-n") == 0)) {
+		nb_devices = atoi(argv[2]);
+		argc -= 2;
+		argv += 2;
+	}
+	if (argc < 2) {
+		fprintf(stderr, "usage: tokenizer_bench [-n nb_devices] template.inf.in...\n");
+		return 1;
+	}
+	nb_templates = argc - 1;
+	src = calloc(nb_templates, sizeof(char*));
+	src_size = calloc(nb_templates, sizeof(size_t));
+	tmpl = calloc(nb_templates, sizeof(token_template_t*));
+
+	// The values that don't depend on the device, as set by wdi_prepare_driver()
+	memset(entities, 0, sizeof(entities));
+	for (i = 0; i < NB_INF_TAGS; i++)
+		entities[i].match = inf_tags[i];
+	set_value(DEVICE_MANUFACTURER, "Provisioning Pipeline");
+	set_value(DRIVER_DATE, "10/16/2026");
+	set_value(DRIVER_VERSION, "6.1.7600.16385");
+	set_value(USE_DEVICE_INTERFACE_GUID, "HKR,,DeviceInterfaceGUIDs,0x10000,\"{00000000-0000-0000-0000-000000000000}\"");
+	set_value(WDF_VERSION, "01011");
+	set_value(KMDF_VERSION, "1.11");
+	set_value(LK_COMMA, ",");
+	set_value(LK_DLL, "libusbK.dll");
+	set_value(LK_X86_DLL, "libusbK_x86.dll");
+	set_value(LK_EQ_X86, "= libusbk_dev_x86");
+	set_value(LK_EQ_X64, "= libusbk_dev_x64");
+	// tokenize_string_compiled() reads the replace fields, so the matcher is compiled from the entities
+	matcher = tokenize_compile(entities, "#", "#");
+	for (i = 0; i < nb_templates; i++) {
+		src[i] = test_read_file(argv[i + 1], &src_size[i], 0);
+		if (src[i] == NULL) {
+			fprintf(stderr, "could not read %s\n", argv[i + 1]);
+			return 1;
+		}
+		tmpl[i] = tokenize_compile_template(src[i], (long)src_size[i], matcher);
+		total_in += src_size[i];
+	}
+
+	// Every method must render the same text
+	for (n = 0; n < 100; n++) {
+		set_device(entities, values, n);
+		for (i = 0; i < nb_templates; i++) {
+			ref = render(RENDER_REFERENCE, src[i], (long)src_size[i], entities, values, matcher, tmpl[i], &ref_size);
+			for (method = RENDER_STRING; method < RENDER_MAX; method++) {
+				out = render(method, src[i], (long)src_size[i], entities, values, matcher, tmpl[i], &out_size);
+				CHECK((out_size == ref_size) && (memcmp(out, ref, ref_size) == 0));
+				free(out);
+			}
+			free(ref);
+		}
+	}
+
+	for (method = 0; method < RENDER_MAX; method++) {
+		t[method] = test_now();
+		for (n = 0; n < nb_devices; n++) {
+			set_device(entities, values, n);
+			for (i = 0; i < nb_templates; i++) {
+				out = render(method, src[i], (long)src_size[i], entities, values, matcher, tmpl[i], &out_size);
+				test_sink += out[out_size / 2];
+				if (method == 0)
+					total_out += out_size;
+				free(out);
+			}
+		}
+		t[method] = test_now() - t[method];
+	}
+
+	printf("%d templates (%zu bytes), %d devices, %.1f MB rendered\n", nb_templates, total_in,
+		nb_devices, total_out / 1e6);
+	for (method = 0; method < RENDER_MAX; method++) {
+		printf("%s: %.2f us per template (%.0f MB/s), %.1fx\n", render_name[method],
+			t[method] * 1e6 / ((double)nb_devices * nb_templates), total_out / t[method] / 1e6,
+			t[RENDER_REFERENCE] / t[method]);
+	}
+	for (j = 0; j < nb_templates; j++) {
+		tokenize_free_template(tmpl[j]);
+		free(src[j]);
+	}
+	tokenize_free(matcher);
+	free(tmpl);
+	free(src);
+	free(src_size);
+	return TEST_RESULT();
+}
@@ -0,0 +1,181 @@
+/*
+ * tokenizer_test.c: the compiled tokenizer against the original one, on random inputs
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <string.h>
+#include "test.h"
+#include "tokenizer_ref.h"
+
+#define NB_ROUNDS 200000
+#define MAX_ENTITIES 8
+
+static const char* prefixes[] = { "#", "$(", "%" };
+static const char* suffixes[] = { "#", ")", "%%" };
+
+static char random_char(const char* alphabet)
+{
+	return alphabet[test_rand() % strlen(alphabet)];
+}
+
+// Token names are made of letters, so that they never hold a prefix or a suffix
+static void random_name(char* name, int max_len)
+{
+	int i, len = 1 + (int)(test_rand() % max_len);
+
+	for (i = 0; i < len; i++)
+		name[i] = random_char("ABC");
+	name[len] = 0;
+}
+
+static void append(char* buf, size_t size, const char* s)
+{
+	size_t len = strlen(buf);
+
+	snprintf(&buf[len], size - len, "%s", s);
+}
+
+static void check_same(const char* src, token_entity_t* entities, const char* prefix,
+	const char* suffix, int recursive)
+{
+	token_matcher_t* matcher;
+	token_template_t* tmpl;
+	const char* values[MAX_ENTITIES];
+	char *ref = NULL, *out = NULL;
+	long ref_size, size;
+	int i;
+
+	ref_size = tokenize_string_reference(src, -1, &ref, entities, prefix, suffix, recursive);
+	size = tokenize_string(src, -1, &out, entities, prefix, suffix, recursive);
+	CHECK(size == ref_size);
+	if ((size > 0) && (size == ref_size) && (memcmp(out, ref, size + 1) != 0)) {
+		fprintf(stderr, "'%s' [%s %s]: got '%s', expected '%s'\n", src, prefix, suffix, out, ref);
+		test_failures++;
+	}
+	// An empty output may still have been allocated
+	free(out);
+	out = NULL;
+
+	// A template renders the same text, when tokens are not recursive
+	if (!recursive && (ref_size > 0)) {
+		for (i = 0; entities[i].match != NULL; i++)
+			values[i] = entities[i].replace;
+		matcher = tokenize_compile(entities, prefix, suffix);
+		tmpl = tokenize_compile_template(src, -1, matcher);
+		CHECK((matcher != NULL) && (tmpl != NULL));
+		size = tokenize_render(tmpl, values, &out);
+		CHECK((size == ref_size) && (memcmp(out, ref, size + 1) == 0));
+		free(out);
+		tokenize_free_template(tmpl);
+		tokenize_free(matcher);
+	}
+	free(ref);
+}
+
+// Any text, with delimiters that may or may not be part of a token
+static void random_round(void)
+{
+	token_entity_t entities[MAX_ENTITIES + 1];
+	char src[256], name[8], alphabet[16];
+	int i, nb_entities = 1 + (int)(test_rand() % MAX_ENTITIES), k = (int)(test_rand() % 3);
+	const char* prefix = prefixes[k];
+	const char* suffix = suffixes[(k + (test_rand() & 1)) % 3];
+
+	memset(entities, 0, sizeof(entities));
+	for (i = 0; i < nb_entities; i++) {
+		random_name(name, 3);
+		entities[i].match = strdup(name);
+		// Replacements that hold delimiters too, which must not be tokenized again
+		random_name(entities[i].replace, 4);
+		if (test_rand() & 1)
+			append(entities[i].replace, sizeof(entities[i].replace), prefix);
+		if (test_rand() % 4 == 0)
+			entities[i].replace[0] = 0;
+	}
+	snprintf(alphabet, sizeof(alphabet), "ABCx\r\n%s%s", prefix, suffix);
+	src[0] = 0;
+	for (i = (int)(test_rand() % 40); i > 0; i--) {
+		switch (test_rand() % 4) {
+		case 0:
+			append(src, sizeof(src), prefix);
+			append(src, sizeof(src), entities[test_rand() % nb_entities].match);
+			append(src, sizeof(src), suffix);
+			break;
+		default:
+			name[0] = random_char(alphabet);
+			name[1] = 0;
+			append(src, sizeof(src), name);
+			break;
+		}
+	}
+	check_same(src, entities, prefix, suffix, 0);
+	for (i = 0; i < nb_entities; i++)
+		free((char*)entities[i].match);
+}
+
+// Well formed tokens, whose replacements may hold the tokens of the next entities
+static void recursive_round(void)
+{
+	token_entity_t entities[MAX_ENTITIES + 1];
+	char src[512], name[8];
+	int i, j, nb_entities = 1 + (int)(test_rand() % MAX_ENTITIES), k = (int)(test_rand() % 3);
+	const char* prefix = prefixes[k];
+	const char* suffix = suffixes[k];
+
+	memset(entities, 0, sizeof(entities));
+	for (i = 0; i < nb_entities; i++) {
+		do {
+			random_name(name, 3);
+			for (j = 0; (j < i) && (strcmp(entities[j].match, name) != 0); j++);
+		} while (j < i);
+		entities[i].match = strdup(name);
+	}
+	for (i = 0; i < nb_entities; i++) {
+		random_name(entities[i].replace, 2);
+		for (j = i + 1; j < nb_entities; j++) {
+			if (test_rand() & 1) {
+				append(entities[i].replace, sizeof(entities[i].replace), prefix);
+				append(entities[i].replace, sizeof(entities[i].replace), entities[j].match);
+				append(entities[i].replace, sizeof(entities[i].replace), suffix);
+			}
+		}
+	}
+	src[0] = 0;
+	for (i = (int)(test_rand() % 20); i > 0; i--) {
+		if (test_rand() & 1) {
+			append(src, sizeof(src), prefix);
+			append(src, sizeof(src), entities[test_rand() % nb_entities].match);
+			append(src, sizeof(src), suffix);
+		} else {
+			random_name(name, 3);
+			append(src, sizeof(src), name);
+		}
+	}
+	check_same(src, entities, prefix, suffix, 1);
+	for (i = 0; i < nb_entities; i++)
+		free((char*)entities[i].match);
+}
+
+int main(void)
+{
+	int i;
+
+	for (i = 0; i < NB_ROUNDS; i++)
+		random_round();
+	for (i = 0; i < NB_ROUNDS / 4; i++)
+		recursive_round();
+	return TEST_RESULT();
+}
@@ -0,0 +1,105 @@
+/*
+ * transcode_bench.c: transcode.h against the scalar reference
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Converts the kind of strings that go through msapi_utf8.h, hardware IDs, paths and
+ * log messages, which are ASCII, and device descriptions in other languages, to UTF-16
+ * and back, with transcode.h and with the reference of transcode_ref.h, and checks
+ * that the outputs are equal. The makefile builds this for the scalar, SSE2 and AVX2
+ * paths.
+ */
+#include <string.h>
+#include "test.h"
+#include "transcode.h"
+#include "transcode_ref.h"
+
+#define NB_STRINGS 1024
+#define NB_ROUNDS 200
+
+enum { SET_HWID, SET_PATH, SET_LOG, SET_DESC, NB_SETS };
+static const char* set_name[NB_SETS] = { "hardware IDs", "paths", "log messages", "descriptions" };
+
+static size_t make_string(int set, int n, char* s, size_t size)
+{
+	switch (set) {
+	case SET_HWID:
+		return (size_t)snprintf(s, size, "USB\\VID_%04X&PID_%04X&MI_%02X\\%d&%08X&0&%04d",
+			n & 0xFFFF, (n * 7) & 0xFFFF, n & 3, n % 10, n * 2654435761u, n);
+	case SET_PATH:
+		return (size_t)snprintf(s, size, "C:\\Users\\Provisioning\\AppData\\Local\\Temp\\usb_driver_%05d\\amd64\\libusbK_%d.sys", n, n);
+	case SET_LOG:
+		return (size_t)snprintf(s, size, "libwdi:info [wdi_prepare_driver] successfully extracted driver files to C:\\usb_driver_%05d (%d files, %d bytes)", n, n % 40, n * 1301);
+	default:
+		return (size_t)snprintf(s, size, "P\xC3\xA9riph\xC3\xA9rique USB n\xC2\xB0%d (\xE8\xA8\xAD\xE5\xAE\x9A \xD0\xA3\xD1\x81\xD1\x82\xD1\x80\xD0\xBE\xD0\xB9\xD1\x81\xD1\x82\xD0\xB2\xD0\xBE)", n);
+	}
+}
+
+int main(void)
+{
+	static char src[NB_STRINGS][256], out8[NB_STRINGS][1024];
+	static uint16_t out16[NB_STRINGS][256];
+	static size_t len8[NB_STRINGS], len16[NB_STRINGS];
+	size_t total, r;
+	double t_ref, t_fast;
+	int set, i, k;
+
+#if defined(TRANSCODE_AVX2)
+	if (!__builtin_cpu_supports("avx2")) {
+		printf("SKIP (no AVX2)\n");
+		return 0;
+	}
+	printf("AVX2 build\n");
+#elif defined(TRANSCODE_SSE2)
+	printf("SSE2 build\n");
+#else
+	printf("scalar build\n");
+#endif
+	for (set = 0; set < NB_SETS; set++) {
+		total = 0;
+		for (i = 0; i < NB_STRINGS; i++) {
+			len8[i] = make_string(set, i, src[i], sizeof(src[i]));
+			len16[i] = ref_utf8_to_utf16((const unsigned char*)src[i], len8[i], out16[i]);
+			CHECK(utf8_to_utf16(src[i], len8[i], out16[i], 256) == len16[i]);
+			CHECK(utf16_to_utf8(out16[i], len16[i], out8[i], 1024) == len8[i]);
+			CHECK(memcmp(out8[i], src[i], len8[i]) == 0);
+			total += len8[i];
+		}
+
+		t_ref = test_now();
+		for (k = 0; k < NB_ROUNDS; k++) {
+			for (i = 0; i < NB_STRINGS; i++) {
+				r = ref_utf8_to_utf16((const unsigned char*)src[i], len8[i], out16[i]);
+				test_sink += ref_utf16_to_utf8(out16[i], r, (unsigned char*)out8[i]);
+			}
+		}
+		t_ref = test_now() - t_ref;
+		t_fast = test_now();
+		for (k = 0; k < NB_ROUNDS; k++) {
+			for (i = 0; i < NB_STRINGS; i++) {
+				r = utf8_to_utf16(src[i], len8[i], out16[i], 256);
+				test_sink += utf16_to_utf8(out16[i], r, out8[i], 1024);
+			}
+		}
+		t_fast = test_now() - t_fast;
+		printf("%-13s (%3zu bytes): reference %6.1f ns, transcode.h %6.1f ns per round trip, %.1fx (%.0f MB/s)\n",
+			set_name[set], total / NB_STRINGS, t_ref * 1e9 / (NB_ROUNDS * NB_STRINGS),
+			t_fast * 1e9 / (NB_ROUNDS * NB_STRINGS), t_ref / t_fast, (double)total * NB_ROUNDS / t_fast / 1e6);
+	}
+	return TEST_RESULT();
+}
@@ -0,0 +1,120 @@
+/*
+ * transcode_ref.h: scalar reference for the conversions of transcode.h
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Straightforward conversions, one character at a time, that follow the table of
+ * well-formed UTF-8 byte sequences of the Unicode standard (table 3-7), and replace
+ * each maximal invalid subpart, or unpaired surrogate, with U+FFFD. They write the
+ * whole output, which the caller must have room for, and return its length.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Range of the second byte of a sequence, per lead byte, or 0 if it can't start one
+static __inline int ref_utf8_second_range(unsigned char c, unsigned char* lower, unsigned char* upper)
+{
+	*lower = 0x80;
+	*upper = 0xBF;
+	if ((c >= 0xC2) && (c <= 0xDF))
+		return 2;
+	if (c == 0xE0)
+		*lower = 0xA0;
+	else if (c == 0xED)
+		*upper = 0x9F;
+	if ((c >= 0xE0) && (c <= 0xEF))
+		return 3;
+	if (c == 0xF0)
+		*lower = 0x90;
+	else if (c == 0xF4)
+		*upper = 0x8F;
+	if ((c >= 0xF0) && (c <= 0xF4))
+		return 4;
+	return 0;
+}
+
+static __inline size_t ref_utf8_to_utf16(const unsigned char* src, size_t size, uint16_t* dst)
+{
+	size_t i = 0, j, n = 0;
+	unsigned char lower, upper;
+	uint32_t c;
+	int len;
+
+	while (i < size) {
+		if (src[i] < 0x80) {
+			dst[n++] = src[i++];
+			continue;
+		}
+		len = ref_utf8_second_range(src[i], &lower, &upper);
+		if (len == 0) {
+			dst[n++] = 0xFFFD;
+			i++;
+			continue;
+		}
+		c = src[i] & (0xFF >> (len + 1));
+		for (j = 1; j < (size_t)len; j++) {
+			if ((i + j >= size) || (src[i + j] < lower) || (src[i + j] > upper))
+				break;
+			c = (c << 6) | (src[i + j] & 0x3F);
+			lower = 0x80;
+			upper = 0xBF;
+		}
+		i += j;
+		if (j < (size_t)len) {
+			dst[n++] = 0xFFFD;
+		} else if (c >= 0x10000) {
+			dst[n++] = (uint16_t)(0xD800 + ((c - 0x10000) >> 10));
+			dst[n++] = (uint16_t)(0xDC00 + ((c - 0x10000) & 0x3FF));
+		} else {
+			dst[n++] = (uint16_t)c;
+		}
+	}
+	return n;
+}
+
+static __inline size_t ref_utf16_to_utf8(const uint16_t* src, size_t size, unsigned char* dst)
+{
+	size_t i, n = 0;
+	uint32_t c;
+
+	for (i = 0; i < size; i++) {
+		c = src[i];
+		if ((c >= 0xD800) && (c < 0xDC00) && (i + 1 < size) && (src[i + 1] >= 0xDC00) && (src[i + 1] < 0xE000))
+			c = 0x10000 + ((c - 0xD800) << 10) + (src[++i] - 0xDC00);
+		else if ((c >= 0xD800) && (c < 0xE000))
+			c = 0xFFFD;
+		if (c < 0x80) {
+			dst[n++] = (unsigned char)c;
+		} else if (c < 0x800) {
+			dst[n++] = (unsigned char)(0xC0 | (c >> 6));
+			dst[n++] = (unsigned char)(0x80 | (c & 0x3F));
+		} else if (c < 0x10000) {
+			dst[n++] = (unsigned char)(0xE0 | (c >> 12));
+			dst[n++] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+			dst[n++] = (unsigned char)(0x80 | (c & 0x3F));
+		} else {
+			dst[n++] = (unsigned char)(0xF0 | (c >> 18));
+			dst[n++] = (unsigned char)(0x80 | ((c >> 12) & 0x3F));
+			dst[n++] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+			dst[n++] = (unsigned char)(0x80 | (c & 0x3F));
+		}
+	}
+	return n;
+}
@@ -0,0 +1,168 @@
+/*
+ * transcode_test.c: fuzzing of transcode.h against a scalar reference
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Every code point, then random UTF-8 and UTF-16, mostly ASCII with runs that are long
+ * enough for the SIMD paths, and some invalid sequences, are converted and must give
+ * the output of the reference, and its full length. The random inputs are converted at
+ * every destination size, and must be truncated without splitting a character or
+ * writing past the end. The makefile builds this for the scalar, SSE2 and AVX2 paths.
+ */
+#include <string.h>
+#include "test.h"
+#include "transcode.h"
+#include "transcode_ref.h"
+
+#define MAX_INPUT 200
+#define CANARY 0xA5
+
+static size_t random_utf8(unsigned char* s)
+{
+	static const unsigned char special[] = { 0x80, 0xBF, 0xC0, 0xC1, 0xC2, 0xDF, 0xE0, 0xED,
+		0xEF, 0xF0, 0xF4, 0xF5, 0xFF, 0x9F, 0xA0, 0x8F, 0x90 };
+	size_t size = (size_t)(test_rand() % MAX_INPUT), i = 0, run;
+	uint32_t c;
+
+	while (i + 4 <= size) {
+		switch (test_rand() % 8) {
+		case 0:
+			s[i++] = special[test_rand() % sizeof(special)];
+			break;
+		case 1:
+		case 2:
+			c = (uint32_t)(test_rand() % 0x110000);
+			if (c < 0x800) {
+				s[i++] = (unsigned char)(0xC0 | (c >> 6));
+				s[i++] = (unsigned char)(0x80 | (c & 0x3F));
+			} else if (c < 0x10000) {
+				s[i++] = (unsigned char)(0xE0 | (c >> 12));
+				s[i++] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+				s[i++] = (unsigned char)(0x80 | (c & 0x3F));
+			} else {
+				s[i++] = (unsigned char)(0xF0 | (c >> 18));
+				s[i++] = (unsigned char)(0x80 | ((c >> 12) & 0x3F));
+				s[i++] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+				s[i++] = (unsigned char)(0x80 | (c & 0x3F));
+			}
+			if (test_rand() % 8 == 0)
+				i--;
+			break;
+		default:
+			// Runs of ASCII, across the 16 and 32 byte blocks
+			for (run = (size_t)(test_rand() % 48); (run > 0) && (i < size); run--)
+				s[i++] = (unsigned char)(0x20 + test_rand() % 0x5F);
+			break;
+		}
+	}
+	return (i < size) ? i : size;
+}
+
+static size_t random_utf16(uint16_t* s)
+{
+	size_t size = (size_t)(test_rand() % MAX_INPUT), i = 0, run;
+
+	while (i < size) {
+		switch (test_rand() % 6) {
+		case 0:
+			// Unpaired or paired surrogates
+			s[i++] = (uint16_t)(0xD800 + test_rand() % 0x800);
+			break;
+		case 1:
+			s[i++] = (uint16_t)(0x80 + test_rand() % 0xFF80);
+			break;
+		default:
+			for (run = (size_t)(test_rand() % 48); (run > 0) && (i < size); run--)
+				s[i++] = (uint16_t)(test_rand() % 0x80);
+			break;
+		}
+	}
+	return size;
+}
+
+static void test_utf8_to_utf16(const unsigned char* s, size_t size, int all_sizes)
+{
+	uint16_t ref[2 * MAX_INPUT], out[2 * MAX_INPUT + 8];
+	size_t ref_size, dst_size, expected, i;
+
+	ref_size = ref_utf8_to_utf16(s, size, ref);
+	CHECK(utf8_to_utf16((const char*)s, size, NULL, 0) == ref_size);
+	for (dst_size = all_sizes ? 0 : ref_size; dst_size <= ref_size + 1; dst_size++) {
+		memset(out, CANARY, sizeof(out));
+		CHECK(utf8_to_utf16((const char*)s, size, out, dst_size) == ref_size);
+		expected = (dst_size < ref_size) ? dst_size : ref_size;
+		// The high surrogate of a pair that doesn't fit isn't written
+		if ((expected > 0) && (expected < ref_size) && (ref[expected - 1] >= 0xD800) && (ref[expected - 1] < 0xDC00))
+			expected--;
+		CHECK(memcmp(out, ref, expected * sizeof(uint16_t)) == 0);
+		// A vector store past dst_size would be caught here
+		for (i = expected * sizeof(uint16_t); (i < sizeof(out)) && (i < (dst_size + 32) * sizeof(uint16_t)); i++)
+			CHECK(((unsigned char*)out)[i] == CANARY);
+	}
+}
+
+static void test_utf16_to_utf8(const uint16_t* s, size_t size, int all_sizes)
+{
+	unsigned char ref[4 * MAX_INPUT], out[4 * MAX_INPUT + 8];
+	size_t ref_size, dst_size, expected, i;
+
+	ref_size = ref_utf16_to_utf8(s, size, ref);
+	CHECK(utf16_to_utf8(s, size, NULL, 0) == ref_size);
+	for (dst_size = all_sizes ? 0 : ref_size; dst_size <= ref_size + 1; dst_size++) {
+		memset(out, CANARY, sizeof(out));
+		CHECK(utf16_to_utf8(s, size, (char*)out, dst_size) == ref_size);
+		expected = (dst_size < ref_size) ? dst_size : ref_size;
+		// Only whole sequences are written
+		while ((expected > 0) && (expected < ref_size) && ((ref[expected] & 0xC0) == 0x80))
+			expected--;
+		CHECK(memcmp(out, ref, expected) == 0);
+		for (i = expected; (i < sizeof(out)) && (i < dst_size + 32); i++)
+			CHECK(out[i] == CANARY);
+	}
+}
+
+int main(void)
+{
+	unsigned char s8[MAX_INPUT];
+	uint16_t s16[MAX_INPUT];
+	uint32_t c;
+	size_t size;
+	int n;
+
+#if defined(TRANSCODE_AVX2)
+	if (!__builtin_cpu_supports("avx2")) {
+		printf("SKIP (no AVX2)\n");
+		return 0;
+	}
+#endif
+	// Every code point, and every surrogate on its own
+	for (c = 0; c < 0x110000; c++) {
+		s16[0] = (uint16_t)((c < 0x10000) ? c : 0xD800 + ((c - 0x10000) >> 10));
+		s16[1] = (uint16_t)((c < 0x10000) ? 'x' : 0xDC00 + ((c - 0x10000) & 0x3FF));
+		size = ref_utf16_to_utf8(s16, 2, s8);
+		test_utf8_to_utf16(s8, size, 0);
+		test_utf16_to_utf8(s16, 2, 0);
+	}
+	for (n = 0; n < 5000; n++) {
+		size = random_utf8(s8);
+		test_utf8_to_utf16(s8, size, 1);
+		size = random_utf16(s16);
+		test_utf16_to_utf8(s16, size, 1);
+	}
+	return TEST_RESULT();
+}
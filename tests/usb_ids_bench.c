@@ -0,0 +1,153 @@
+/*
+ * usb_ids_bench.c: footprint and lookups of the USB ID tables
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Usage: usb_ids_bench usb.ids
+ * Is linked with the tables that vid_data.sh generated from usb.ids, and checks that
+ * they give the same names as the runtime index of the same file, by usb_ids_parse().
+ * Then reports the memory used by both, the time to parse the file, and the time
+ * that each lookup takes.
+ */
+#include <string.h>
+#include "test.h"
+#include "usb_ids.h"
+
+#define NB_LOOKUPS 200000
+
+static int same_name(const char* a, const char* b)
+{
+	return ((a == NULL) || (b == NULL)) ? (a == b) : (strcmp(a, b) == 0);
+}
+
+// Size of the name pool of a generated table, which is made of whole pages
+static size_t pool_size(const struct usb_ids_table* t, size_t page_size)
+{
+	size_t i, end = 0, e;
+
+	for (i = 0; i < t->nb_vendors; i++) {
+		e = t->vendor_name[i] + strlen(t->names + t->vendor_name[i]) + 1;
+		end = (e > end) ? e : end;
+	}
+	for (i = 0; i < t->nb_products; i++) {
+		e = t->product_name[i] + strlen(t->names + t->product_name[i]) + 1;
+		end = (e > end) ? e : end;
+	}
+	for (i = 0; i < t->nb_classes; i++) {
+		e = t->class_name[i] + strlen(t->names + t->class_name[i]) + 1;
+		end = (e > end) ? e : end;
+	}
+	return (end + page_size - 1) / page_size * page_size;
+}
+
+static size_t index_size(const struct usb_ids_table* t)
+{
+	return t->nb_vendors * (sizeof(uint16_t) + 2 * sizeof(uint32_t)) + sizeof(uint32_t)
+		+ t->nb_products * (sizeof(uint16_t) + sizeof(uint32_t))
+		+ t->nb_classes * 2 * sizeof(uint32_t);
+}
+
+int main(int argc, char** argv)
+{
+	const struct usb_ids_table* builtin = &usb_ids_builtin;
+	static uint16_t vid[NB_LOOKUPS], pid[NB_LOOKUPS];
+	static int class_code[NB_LOOKUPS], subclass[NB_LOOKUPS], protocol[NB_LOOKUPS];
+	struct usb_ids_table parsed;
+	char *data, *copy;
+	size_t size, i, j, nb_found;
+	double t, t_parse = 1e9, t_vendor, t_product, t_class;
+	uint32_t key;
+	int k, r;
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: usb_ids_bench usb.ids\n");
+		return 1;
+	}
+	data = test_read_file(argv[1], &size, 0);
+	copy = malloc(size + 1);
+	if ((data == NULL) || (copy == NULL)) {
+		fprintf(stderr, "could not read %s\n", argv[1]);
+		return 1;
+	}
+	for (k = 0; k < 10; k++) {
+		memcpy(copy, data, size);
+		t = test_now();
+		r = usb_ids_parse(copy, size, &parsed);
+		t = test_now() - t;
+		t_parse = (t < t_parse) ? t : t_parse;
+		CHECK(r == 0);
+		if (k < 9)
+			usb_ids_free(&parsed);
+	}
+
+	// The generated tables and the runtime index must have the same content
+	CHECK(parsed.nb_vendors == builtin->nb_vendors);
+	CHECK(parsed.nb_products == builtin->nb_products);
+	CHECK(parsed.nb_classes == builtin->nb_classes);
+	for (i = 0; i < parsed.nb_vendors; i++) {
+		CHECK(same_name(usb_ids_vendor_name(builtin, parsed.vendor_id[i]), parsed.names + parsed.vendor_name[i]));
+		for (j = parsed.vendor_product[i]; j < parsed.vendor_product[i + 1]; j++) {
+			CHECK(same_name(usb_ids_product_name(builtin, parsed.vendor_id[i], parsed.product_id[j]),
+				parsed.names + parsed.product_name[j]));
+		}
+	}
+	for (i = 0; i < parsed.nb_classes; i++) {
+		key = parsed.class_id[i];
+		CHECK(same_name(usb_ids_class_name(builtin, key >> 24, ((key & 0xff) >= 2) ? (int)((key >> 16) & 0xff) : -1,
+			((key & 0xff) == 3) ? (int)((key >> 8) & 0xff) : -1), parsed.names + parsed.class_name[i]));
+	}
+
+	// Random lookups, about half of which are for known IDs
+	for (i = 0; i < NB_LOOKUPS; i++) {
+		j = (size_t)(test_rand() % builtin->nb_products);
+		for (k = 0; builtin->vendor_product[k + 1] <= j; k++);
+		vid[i] = (test_rand() & 1) ? builtin->vendor_id[k] : (uint16_t)test_rand();
+		pid[i] = (test_rand() & 1) ? builtin->product_id[j] : (uint16_t)test_rand();
+		key = builtin->class_id[test_rand() % builtin->nb_classes];
+		class_code[i] = (int)(key >> 24);
+		subclass[i] = ((key & 0xff) >= 2) ? (int)((key >> 16) & 0xff) : -1;
+		protocol[i] = ((key & 0xff) == 3) ? (int)((key >> 8) & 0xff) : -1;
+	}
+	nb_found = 0;
+	t_vendor = test_now();
+	for (i = 0; i < NB_LOOKUPS; i++)
+		nb_found += (usb_ids_vendor_name(builtin, vid[i]) != NULL);
+	t_vendor = test_now() - t_vendor;
+	t_product = test_now();
+	for (i = 0; i < NB_LOOKUPS; i++)
+		nb_found += (usb_ids_product_name(builtin, vid[i], pid[i]) != NULL);
+	t_product = test_now() - t_product;
+	t_class = test_now();
+	for (i = 0; i < NB_LOOKUPS; i++)
+		nb_found += (usb_ids_class_name(builtin, class_code[i], subclass[i], protocol[i]) != NULL);
+	t_class = test_now() - t_class;
+	test_sink += nb_found;
+
+	printf("%s: %zu bytes, %zu vendors, %zu products, %zu classes, subclasses and protocols\n",
+		argv[1], size, builtin->nb_vendors, builtin->nb_products, builtin->nb_classes);
+	printf("vid_data.c: %zu KB of IDs and offsets, %zu KB of names\n",
+		index_size(builtin) / 1024, pool_size(builtin, 16384) / 1024);
+	printf("usb_ids_parse(): %.2f ms, %zu KB of IDs and offsets, plus the %zu KB file\n",
+		t_parse * 1e3, index_size(&parsed) / 1024, size / 1024);
+	printf("vendor lookup: %.1f ns, product lookup: %.1f ns, class lookup: %.1f ns\n",
+		t_vendor * 1e9 / NB_LOOKUPS, t_product * 1e9 / NB_LOOKUPS, t_class * 1e9 / NB_LOOKUPS);
+	usb_ids_free(&parsed);
+	free(copy);
+	free(data);
+	return TEST_RESULT();
+}
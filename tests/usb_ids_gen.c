@@ -0,0 +1,123 @@
+/*
+ * usb_ids_gen.c: usb.ids file of the size of the real one
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Usage: usb_ids_gen [nb_vendors] [nb_products] > usb.ids
+ * Writes a usb.ids file with made up names, and the layout of the real one: sorted
+ * vendors, with a skewed number of sorted products each, some interfaces, the class
+ * list, and the other lists, that must be ignored. The defaults are about the size
+ * of the 2024 file. This is used to measure the tables of vid_data.sh and of
+ * wdi_load_usb_ids(), as no usb.ids with products is part of the sources.
+ */
+#include <string.h>
+#include "test.h"
+
+static const char* word[] = { "USB", "Hub", "Mouse", "Keyboard", "Audio", "Camera", "Storage",
+	"Adapter", "Controller", "Serial", "Bridge", "Wireless", "Receiver", "Dock", "Reader",
+	"Card", "Flash", "Drive", "Gamepad", "Printer", "Scanner", "Modem", "Ethernet", "Bluetooth",
+	"Technology", "Electronics", "Co., Ltd.", "Inc.", "Corp.", "GmbH", "Systems", "Devices",
+	"Semiconductor", "International", "Digital", "Micro", "Data", "Shenzhen", "Network", "Mode" };
+#define NB_WORDS (sizeof(word) / sizeof(word[0]))
+
+static void print_name(int nb_words)
+{
+	int i;
+
+	for (i = 0; i < nb_words; i++)
+		printf("%s%s", (i == 0) ? "" : " ", word[test_rand() % NB_WORDS]);
+	printf("\n");
+}
+
+// Pick n distinct IDs below max, at random, and sort them
+static void pick_ids(int* id, int n, int max)
+{
+	static unsigned char used[0x10000];
+	int i, j = 0;
+
+	memset(used, 0, sizeof(used));
+	for (i = 0; i < n; i++) {
+		do {
+			j = (int)(test_rand() % (uint64_t)max);
+		} while (used[j]);
+		used[j] = 1;
+	}
+	for (i = 0, j = 0; i < max; i++) {
+		if (used[i])
+			id[j++] = i;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	static int vid[0x10000], pid[0x10000];
+	int nb_vendors = (argc > 1) ? atoi(argv[1]) : 3400;
+	int nb_products = (argc > 2) ? atoi(argv[2]) : 21000;
+	int i, j, k, n, left, class_code[32], subclass[16];
+
+	if ((nb_vendors < 1) || (nb_vendors > 0x10000) || (nb_products < 0)) {
+		fprintf(stderr, "usage: usb_ids_gen [nb_vendors] [nb_products]\n");
+		return 1;
+	}
+	printf("#\n#\tList of USB ID's\n#\n# Version: 2026.10.16\n# Date:    2026-10-16 00:00:00\n#\n\n");
+	printf("# Syntax:\n# vendor  vendor_name\n#\tdevice  device_name\t\t\t\t<-- single tab\n\n");
+	pick_ids(vid, nb_vendors, 0x10000);
+	left = nb_products;
+	for (i = 0; i < nb_vendors; i++) {
+		printf("%04x  ", vid[i]);
+		print_name(1 + (int)(test_rand() % 4));
+		// Most vendors have a few products, and some have hundreds
+		n = (test_rand() % 8 == 0) ? (int)(test_rand() % 64) : (int)(test_rand() % 6);
+		if (test_rand() % 200 == 0)
+			n = 200 + (int)(test_rand() % 400);
+		if (i == nb_vendors - 1)
+			n = left;
+		if (n > left)
+			n = left;
+		left -= n;
+		pick_ids(pid, n, 0x10000);
+		for (j = 0; j < n; j++) {
+			printf("\t%04x  ", pid[j]);
+			print_name(1 + (int)(test_rand() % 5));
+			if (test_rand() % 50 == 0) {
+				printf("\t\t%02x  ", (int)(test_rand() % 8));
+				print_name(2);
+			}
+		}
+	}
+	printf("\n# List of known device classes, subclasses and protocols\n\n");
+	pick_ids(class_code, 32, 0x100);
+	for (i = 0; i < 32; i++) {
+		printf("C %02x  ", class_code[i]);
+		print_name(1 + (int)(test_rand() % 3));
+		n = (int)(test_rand() % 8);
+		pick_ids(subclass, n, 0x100);
+		for (j = 0; j < n; j++) {
+			printf("\t%02x  ", subclass[j]);
+			print_name(1 + (int)(test_rand() % 3));
+			for (k = 0; k < (int)(test_rand() % 4); k++) {
+				printf("\t\t%02x  ", k);
+				print_name(2);
+			}
+		}
+	}
+	printf("\n# List of Audio Class Terminal Types\n\nAT 0100  USB Undefined\nAT 0101  USB Streaming\n");
+	printf("\n# List of HID Descriptor Types\n\nHID 21  HID\nHID 22  Report\n");
+	printf("\n# List of Languages\n\nL 0001  Arabic\n\t01  Saudi Arabia\n\t02  Iraq\nL 0002  Bulgarian\n");
+	return 0;
+}
@@ -0,0 +1,279 @@
+/*
+ * usb_ids_test.c: usb.ids indexing, vendor search, and reloaded versions
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Indexes sample_usb.ids, as is and with CRLF line endings, checks the names of its
+ * vendors, products and classes, and that what must be ignored is, then the vendor
+ * search and the versions that libwdi.c keeps when the file is reloaded or unloaded.
+ */
+#include <string.h>
+#include <pthread.h>
+#include "test.h"
+#include "windows.h"
+#include "usb_ids.h"
+#include "usb_ids_versions.h"
+
+static int same_name(const char* a, const char* b)
+{
+	return ((a == NULL) || (b == NULL)) ? (a == b) : (strcmp(a, b) == 0);
+}
+
+// Same order as compare_vendor_matches() in libwdi.c
+static int compare_matches(const void* a, const void* b)
+{
+	uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+
+	return (x > y) - (x < y);
+}
+
+static void check_table(const struct usb_ids_table* t)
+{
+	CHECK(t->nb_vendors == 5);
+	CHECK(t->nb_products == 6);
+	CHECK(t->nb_classes == 10);
+	CHECK(same_name(usb_ids_vendor_name(t, 0x0001), "First Vendor"));
+	CHECK(same_name(usb_ids_vendor_name(t, 0x0002), "Vendor \"Quoted\" \\ Backslashed"));
+	CHECK(same_name(usb_ids_vendor_name(t, 0xffff), "Last Vendor"));
+	CHECK(usb_ids_vendor_name(t, 0x0000) == NULL);
+	CHECK(usb_ids_vendor_name(t, 0x0004) == NULL);
+	// The first of duplicate vendors and products is used, and the products of a duplicate are dropped
+	CHECK(same_name(usb_ids_vendor_name(t, 0x0003), "Example Devices, Inc."));
+	CHECK(same_name(usb_ids_product_name(t, 0x0003, 0x1234), "Example Adapter"));
+	CHECK(usb_ids_product_name(t, 0x0003, 0x5678) == NULL);
+	CHECK(same_name(usb_ids_product_name(t, 0x0abc, 0x0001), "Programmer"));
+	CHECK(same_name(usb_ids_product_name(t, 0x0abc, 0x0002), "Debugger"));
+	CHECK(same_name(usb_ids_product_name(t, 0x0001, 0x0001), "First Product"));
+	CHECK(same_name(usb_ids_product_name(t, 0x0001, 0xffff), "Last Product"));
+	CHECK(usb_ids_product_name(t, 0x0001, 0x1234) == NULL);
+	CHECK(usb_ids_product_name(t, 0x0002, 0x0001) == NULL);
+	CHECK(usb_ids_product_name(t, 0x0004, 0x0001) == NULL);
+	// Classes, subclasses and protocols
+	CHECK(same_name(usb_ids_class_name(t, 0x00, -1, -1), "(Defined at Interface level)"));
+	CHECK(same_name(usb_ids_class_name(t, 0x03, -1, -1), "Human Interface Device"));
+	CHECK(same_name(usb_ids_class_name(t, 0x03, 0x01, -1), "Boot Interface Subclass"));
+	CHECK(same_name(usb_ids_class_name(t, 0x03, 0x00, 0x02), "Mouse"));
+	CHECK(same_name(usb_ids_class_name(t, 0x03, 0x01, 0x01), "Keyboard"));
+	CHECK(same_name(usb_ids_class_name(t, 0xff, 0xff, 0xff), "Vendor Specific Protocol"));
+	CHECK(usb_ids_class_name(t, 0x03, 0x01, 0x02) == NULL);
+	CHECK(usb_ids_class_name(t, 0x01, -1, -1) == NULL);
+	CHECK(usb_ids_class_name(t, 0x03, -1, 0x01) == NULL);
+	CHECK(usb_ids_class_name(t, 0x100, -1, -1) == NULL);
+}
+
+static char* with_crlf(const char* data, size_t size, size_t* new_size)
+{
+	char* crlf = malloc(2 * size + 1);
+	size_t i, n = 0;
+
+	for (i = 0; i < size; i++) {
+		if (data[i] == '\n')
+			crlf[n++] = '\r';
+		crlf[n++] = data[i];
+	}
+	// And no line ending at the end of the file
+	*new_size = n - 2;
+	return crlf;
+}
+
+static void test_search(const struct usb_ids_table* t)
+{
+	struct usb_ids_index index;
+	uint32_t match[8];
+	size_t n;
+
+	CHECK(usb_ids_build_index(t, &index) == 0);
+	n = usb_ids_find_vendors(t, &index, "olimex", match);
+	CHECK((n == 1) && ((match[0] & 0xffff) == 0x0abc));
+	// "vendor" starts a name, then starts a word of two others, which shortest comes first
+	n = usb_ids_find_vendors(t, &index, "vendor", match);
+	CHECK(n == 3);
+	qsort(match, n, sizeof(uint32_t), compare_matches);
+	CHECK(((match[0] >> 24) == 1) && ((match[0] & 0xffff) == 0x0002));
+	CHECK(((match[1] >> 24) == 2) && ((match[1] & 0xffff) == 0xffff));
+	CHECK(((match[2] >> 24) == 2) && ((match[2] & 0xffff) == 0x0001));
+	// Other matches come last
+	n = usb_ids_find_vendors(t, &index, "endor", match);
+	CHECK(n == 3);
+	qsort(match, n, sizeof(uint32_t), compare_matches);
+	CHECK((match[0] >> 24) == 3);
+	// Short patterns don't use the index
+	n = usb_ids_find_vendors(t, &index, "ex", match);
+	CHECK(n == 2);
+	CHECK(usb_ids_find_vendors(t, &index, "missing", match) == 0);
+	usb_ids_free_index(&index);
+}
+
+#define NB_THREADS 4
+
+static struct usb_ids_versions shared = { NULL, NULL, 0 };
+static volatile LONG stop = 0;
+
+// The data is read by the lookup threads, so that ASan reports a version freed in use
+static struct usb_ids_file* new_version(void)
+{
+	struct usb_ids_file* f = (struct usb_ids_file*)calloc(1, sizeof(struct usb_ids_file));
+
+	f->data = strdup("usb.ids");
+	return f;
+}
+
+static int nb_in_list(struct usb_ids_file* list)
+{
+	int n = 0;
+
+	for (; list != NULL; list = list->previous)
+		n++;
+	return n;
+}
+
+static void test_versions(void)
+{
+	struct usb_ids_versions v = { NULL, NULL, 0 };
+	struct usb_ids_file *current, *in_use, *stale;
+	int i;
+
+	CHECK(usb_ids_acquire(&v) == NULL);
+	usb_ids_replace(&v, new_version());
+	// Every reloaded version is kept, as its names may still be in use
+	for (i = 0; i < 8; i++) {
+		current = usb_ids_acquire(&v);
+		CHECK(usb_ids_add_version(&v, new_version(), current));
+		usb_ids_release(current);
+		CHECK(nb_in_list(v.current) == i + 2);
+	}
+	// A version reloaded from one that is no longer current is not added
+	stale = v.current->previous;
+	current = new_version();
+	CHECK(!usb_ids_add_version(&v, current, stale));
+	usb_ids_free_file(current);
+	CHECK(nb_in_list(v.current) == 9);
+
+	// Loading the file again frees the versions without users
+	in_use = usb_ids_acquire(&v);
+	usb_ids_replace(&v, new_version());
+	CHECK(nb_in_list(v.current) == 1);
+	CHECK((v.unloaded == in_use) && (in_use->previous == NULL));
+	// Until it no longer has any
+	current = usb_ids_acquire(&v);
+	CHECK(usb_ids_add_version(&v, new_version(), current));
+	usb_ids_release(current);
+	CHECK(v.unloaded == in_use);
+	usb_ids_release(in_use);
+	usb_ids_replace(&v, NULL);
+	CHECK((v.current == NULL) && (v.unloaded == NULL));
+	CHECK(usb_ids_acquire(&v) == NULL);
+}
+
+static void* lookup_thread(void* arg)
+{
+	struct usb_ids_file* file;
+	volatile LONG* nb_lookups = (volatile LONG*)arg;
+
+	while (!stop) {
+		file = usb_ids_acquire(&shared);
+		if (file != NULL) {
+			*nb_lookups += (file->data[0] == 'u');
+			usb_ids_release(file);
+		}
+	}
+	return NULL;
+}
+
+// Reloads and loads, while other threads look names up
+static void test_concurrent_versions(void)
+{
+	struct usb_ids_file* current;
+	pthread_t thread[NB_THREADS];
+	volatile LONG nb_lookups[NB_THREADS] = { 0 };
+	int i, j, all_done = 0;
+
+	usb_ids_replace(&shared, new_version());
+	for (i = 0; i < NB_THREADS; i++)
+		CHECK(pthread_create(&thread[i], NULL, lookup_thread, (void*)&nb_lookups[i]) == 0);
+	// Until every thread had a few lookups
+	for (i = 0; (i < 20000) || (!all_done); i++) {
+		for (j = 0, all_done = 1; j < NB_THREADS; j++)
+			all_done &= (nb_lookups[j] > 10);
+		if (i % 16 == 15) {
+			usb_ids_replace(&shared, (i % 64 == 63) ? NULL : new_version());
+			continue;
+		}
+		current = usb_ids_acquire(&shared);
+		if (current == NULL) {
+			usb_ids_replace(&shared, new_version());
+			continue;
+		}
+		CHECK(usb_ids_add_version(&shared, new_version(), current));
+		usb_ids_release(current);
+	}
+	InterlockedExchange(&stop, 1);
+	for (i = 0; i < NB_THREADS; i++)
+		pthread_join(thread[i], NULL);
+	usb_ids_replace(&shared, NULL);
+	CHECK((shared.current == NULL) && (shared.unloaded == NULL));
+}
+
+int main(int argc, char** argv)
+{
+	struct usb_ids_table t;
+	char *data, *copy;
+	size_t size, crlf_size;
+
+	data = test_read_file((argc > 1) ? argv[1] : "sample_usb.ids", &size, 0);
+	if (data == NULL) {
+		fprintf(stderr, "could not read the sample usb.ids\n");
+		return 1;
+	}
+	copy = malloc(size + 1);
+	memcpy(copy, data, size);
+	CHECK(usb_ids_parse(copy, size, &t) == 0);
+	check_table(&t);
+	test_search(&t);
+	usb_ids_free(&t);
+	free(copy);
+
+	copy = with_crlf(data, size, &crlf_size);
+	CHECK(usb_ids_parse(copy, crlf_size, &t) == 0);
+	check_table(&t);
+	usb_ids_free(&t);
+	free(copy);
+
+	// The line number of the first unsorted ID is returned
+	copy = strdup("0002  B\n0001  A\n");
+	CHECK(usb_ids_parse(copy, strlen(copy), &t) == 2);
+	free(copy);
+	copy = strdup("0001  A\n\t0002  B\n\t0001  C\n");
+	CHECK(usb_ids_parse(copy, strlen(copy), &t) == 3);
+	free(copy);
+	copy = strdup("C 03  A\nC 01  B\n");
+	CHECK(usb_ids_parse(copy, strlen(copy), &t) == 2);
+	free(copy);
+	// An empty file is valid
+	copy = strdup("");
+	CHECK(usb_ids_parse(copy, 0, &t) == 0);
+	CHECK(usb_ids_vendor_name(&t, 0) == NULL);
+	CHECK(usb_ids_product_name(&t, 0, 0) == NULL);
+	usb_ids_free(&t);
+	free(copy);
+
+	test_versions();
+	test_concurrent_versions();
+	free(data);
+	return TEST_RESULT();
+}
@@ -0,0 +1,205 @@
+/*
+ * utf16le_bench.c: write path of the INF files
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Usage: utf16le_bench [-n nb_devices] template.inf.in...
+ * Writes the INF file of each template once per device, with a non-English device
+ * description, the way wdi_prepare_driver() used to, by rendering the whole text,
+ * converting it to UTF-16 in a second buffer and writing that, and the way it does
+ * now, by rendering straight into the streaming UTF-16LE writer. utf8_to_utf16()
+ * stands for the MultiByteToWideChar() call of utf8_to_wchar(), so the difference
+ * is the extra buffers and passes, not the decoder. Both outputs must be equal.
+ */
+#include <string.h>
+#include "test.h"
+#include "tokenizer.h"
+#include "utf16le.h"
+#include "inf_tags.h"
+
+struct output {
+	FILE* fd;
+	unsigned char* data;
+	size_t size, max_size;
+};
+
+static int sink(void* context, const unsigned char* data, size_t size)
+{
+	struct output* out = (struct output*)context;
+
+	if (out->data != NULL) {
+		if (out->size + size > out->max_size)
+			return -1;
+		memcpy(&out->data[out->size], data, size);
+	} else if (fwrite(data, 1, size, out->fd) != size) {
+		return -1;
+	}
+	out->size += size;
+	return 0;
+}
+
+static int write_to_utf16le(void* context, const char* src, long count)
+{
+	return utf16le_write((struct utf16le_writer*)context, src, (size_t)count);
+}
+
+// What wdi_prepare_driver() did before: render, convert the whole text, then write
+static int write_inf_buffered(const token_template_t* tmpl, const char* const* values, struct output* out)
+{
+	char* inf = NULL;
+	uint16_t *wide, u;
+	unsigned char* le;
+	long size;
+	size_t i, n;
+	int r = -1;
+
+	size = tokenize_render(tmpl, values, &inf);
+	if (size <= 0)
+		return -1;
+	// utf8_to_wchar() sized the output with a first call, then converted
+	n = utf8_to_utf16(inf, (size_t)size, NULL, 0);
+	wide = malloc((n + 2) * sizeof(uint16_t));
+	if (wide == NULL)
+		goto out;
+	wide[0] = UTF16LE_BOM;
+	utf8_to_utf16(inf, (size_t)size, &wide[1], n);
+	// Native to little endian, which is a no-op on the hosts that libwdi runs on
+	le = (unsigned char*)wide;
+	for (i = 0; i < n + 1; i++) {
+		u = wide[i];
+		le[2 * i] = (unsigned char)u;
+		le[2 * i + 1] = (unsigned char)(u >> 8);
+	}
+	r = sink(out, le, 2 * (n + 1));
+	free(wide);
+out:
+	free(inf);
+	return r;
+}
+
+static int write_inf_streaming(const token_template_t* tmpl, const char* const* values, struct output* out)
+{
+	static struct utf16le_writer writer;
+
+	utf16le_writer_init(&writer, sink, out, 1);
+	if (tokenize_render_to(tmpl, values, write_to_utf16le, &writer) <= 0)
+		return -1;
+	return utf16le_writer_flush(&writer);
+}
+
+static void set_device(char values[NB_INF_TAGS][256], int n)
+{
+	snprintf(values[INF_FILENAME], 256, "device_%05d.inf", n);
+	snprintf(values[CAT_FILENAME], 256, "device_%05d.cat", n);
+	snprintf(values[DEVICE_DESCRIPTION], 256, "P\xC3\xA9riph\xC3\xA9rique n\xC2\xB0%d \xE2\x80\x94 \xE8\xA8\xAD\xE5\xAE\x9A", n);
+	snprintf(values[DEVICE_HARDWARE_ID], 256, "VID_%04X&PID_%04X", 0x1000 + n % 0xE000, n & 0xFFFF);
+	snprintf(values[DEVICE_INTERFACE_GUID], 256, "{%08X-1234-5678-9ABC-DEF012345678}", n);
+}
+
+int main(int argc, char** argv)
+{
+	static char value[NB_INF_TAGS][256];
+	static unsigned char buffered[1 << 20], streamed[1 << 20];
+	const char* values[NB_INF_TAGS];
+	token_matcher_t* matcher;
+	token_template_t** tmpl;
+	struct output out_buffered, out_streamed, out;
+	char* src;
+	size_t src_size, total_out = 0;
+	int i, n, nb_templates, nb_devices = 4000;
+	double t_buffered, t_streamed;
+
+	if ((argc > 2) && (strcmp(argv[1], "-n") == 0)) {
+		nb_devices = atoi(argv[2]);
+		argc -= 2;
+		argv += 2;
+	}
+	if (argc < 2) {
+		fprintf(stderr, "usage: utf16le_bench [-n nb_devices] template.inf.in...\n");
+		return 1;
+	}
+	nb_templates = argc - 1;
+	tmpl = calloc(nb_templates, sizeof(token_template_t*));
+	matcher = tokenize_compile_names(inf_tags, "#", "#");
+	for (i = 0; i < nb_templates; i++) {
+		src = test_read_file(argv[i + 1], &src_size, 0);
+		if (src == NULL) {
+			fprintf(stderr, "could not read %s\n", argv[i + 1]);
+			return 1;
+		}
+		tmpl[i] = tokenize_compile_template(src, (long)src_size, matcher);
+		free(src);
+	}
+	for (i = 0; i < NB_INF_TAGS; i++)
+		values[i] = value[i];
+	snprintf(value[DEVICE_MANUFACTURER], 256, "Soci\xC3\xA9t\xC3\xA9 G\xC3\xA9n\xC3\xA9rale");
+	snprintf(value[DRIVER_DATE], 256, "10/16/2026");
+	snprintf(value[DRIVER_VERSION], 256, "6.1.7600.16385");
+	snprintf(value[WDF_VERSION], 256, "01011");
+	snprintf(value[KMDF_VERSION], 256, "1.11");
+
+	for (n = 0; n < 100; n++) {
+		set_device(value, n);
+		for (i = 0; i < nb_templates; i++) {
+			memset(&out_buffered, 0, sizeof(out_buffered));
+			out_buffered.data = buffered;
+			out_buffered.max_size = sizeof(buffered);
+			out_streamed = out_buffered;
+			out_streamed.data = streamed;
+			CHECK(write_inf_buffered(tmpl[i], values, &out_buffered) == 0);
+			CHECK(write_inf_streaming(tmpl[i], values, &out_streamed) == 0);
+			CHECK((out_buffered.size == out_streamed.size)
+				&& (memcmp(buffered, streamed, out_buffered.size) == 0));
+		}
+	}
+
+	memset(&out, 0, sizeof(out));
+	out.fd = fopen("/dev/null", "wb");
+	if (out.fd == NULL) {
+		fprintf(stderr, "could not open /dev/null\n");
+		return 1;
+	}
+	t_buffered = test_now();
+	for (n = 0; n < nb_devices; n++) {
+		set_device(value, n);
+		for (i = 0; i < nb_templates; i++)
+			test_sink += write_inf_buffered(tmpl[i], values, &out);
+	}
+	t_buffered = test_now() - t_buffered;
+	total_out = out.size;
+	t_streamed = test_now();
+	for (n = 0; n < nb_devices; n++) {
+		set_device(value, n);
+		for (i = 0; i < nb_templates; i++)
+			test_sink += write_inf_streaming(tmpl[i], values, &out);
+	}
+	t_streamed = test_now() - t_streamed;
+	fclose(out.fd);
+
+	printf("%d templates, %d devices, %.1f MB of UTF-16LE\n", nb_templates, nb_devices, total_out / 1e6);
+	printf("render + convert + write: %.2f us per inf (%.0f MB/s)\n",
+		t_buffered * 1e6 / ((double)nb_devices * nb_templates), total_out / t_buffered / 1e6);
+	printf("streaming writer: %.2f us per inf (%.0f MB/s), %.1fx\n",
+		t_streamed * 1e6 / ((double)nb_devices * nb_templates), total_out / t_streamed / 1e6,
+		t_buffered / t_streamed);
+	for (i = 0; i < nb_templates; i++)
+		tokenize_free_template(tmpl[i]);
+	tokenize_free(matcher);
+	free(tmpl);
+	return TEST_RESULT();
+}
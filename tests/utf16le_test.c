@@ -0,0 +1,159 @@
+/*
+ * utf16le_test.c: streaming UTF-16LE writer against the whole buffer conversion
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Random UTF-8, valid and not, is written in random pieces, down to single bytes,
+ * and the output must match what utf8_to_utf16() gives for the whole input.
+ */
+#include <string.h>
+#include "test.h"
+#include "utf16le.h"
+
+#define MAX_INPUT 256
+
+struct output {
+	unsigned char data[4 * MAX_INPUT + 16];
+	size_t size;
+	int fail_after;
+};
+
+static int sink(void* context, const unsigned char* data, size_t size)
+{
+	struct output* out = (struct output*)context;
+
+	if ((out->fail_after >= 0) && (out->size + size > (size_t)out->fail_after))
+		return -1;
+	// Only the size of the large outputs is checked
+	if (out->size + size <= sizeof(out->data))
+		memcpy(&out->data[out->size], data, size);
+	out->size += size;
+	return 0;
+}
+
+// Mostly well formed UTF-8, with some truncated, overlong, surrogate and stray bytes
+static size_t random_utf8(unsigned char* s)
+{
+	static const unsigned char special[] = { 0x80, 0xBF, 0xC0, 0xC1, 0xC2, 0xDF, 0xE0, 0xED,
+		0xEF, 0xF0, 0xF4, 0xF5, 0xFF, 0x9F, 0xA0, 0x8F, 0x90 };
+	size_t size = (size_t)(test_rand() % MAX_INPUT), i = 0;
+	uint32_t c;
+
+	while (i + 4 <= size) {
+		switch (test_rand() % 6) {
+		case 0:
+			s[i++] = (unsigned char)(test_rand() & 0x7F);
+			break;
+		case 1:
+			s[i++] = special[test_rand() % sizeof(special)];
+			break;
+		default:
+			c = (uint32_t)(test_rand() % 0x110000);
+			if (c < 0x80) {
+				s[i++] = (unsigned char)c;
+			} else if (c < 0x800) {
+				s[i++] = (unsigned char)(0xC0 | (c >> 6));
+				s[i++] = (unsigned char)(0x80 | (c & 0x3F));
+			} else if (c < 0x10000) {
+				s[i++] = (unsigned char)(0xE0 | (c >> 12));
+				s[i++] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+				s[i++] = (unsigned char)(0x80 | (c & 0x3F));
+			} else {
+				s[i++] = (unsigned char)(0xF0 | (c >> 18));
+				s[i++] = (unsigned char)(0x80 | ((c >> 12) & 0x3F));
+				s[i++] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+				s[i++] = (unsigned char)(0x80 | (c & 0x3F));
+			}
+			// Drop the end of some sequences
+			if ((c >= 0x80) && (test_rand() % 8 == 0))
+				i--;
+			break;
+		}
+	}
+	return i;
+}
+
+static size_t reference(const unsigned char* s, size_t size, unsigned char* dst)
+{
+	uint16_t units[MAX_INPUT + 1];
+	size_t i, n;
+
+	units[0] = UTF16LE_BOM;
+	n = utf8_to_utf16((const char*)s, size, &units[1], MAX_INPUT) + 1;
+	for (i = 0; i < n; i++) {
+		dst[2 * i] = (unsigned char)units[i];
+		dst[2 * i + 1] = (unsigned char)(units[i] >> 8);
+	}
+	return 2 * n;
+}
+
+static void write_in_pieces(struct utf16le_writer* w, const unsigned char* s, size_t size, size_t max_piece)
+{
+	size_t pos = 0, len;
+
+	while (pos < size) {
+		len = 1 + (size_t)(test_rand() % max_piece);
+		if (len > size - pos)
+			len = size - pos;
+		utf16le_write(w, (const char*)&s[pos], len);
+		pos += len;
+	}
+}
+
+int main(void)
+{
+	static const size_t max_pieces[] = { 1, 2, 3, 7, MAX_INPUT };
+	static struct utf16le_writer w;
+	static struct output out;
+	unsigned char s[MAX_INPUT], ref[4 * MAX_INPUT + 16];
+	size_t size, ref_size, i;
+	int n;
+
+	for (n = 0; n < 100000; n++) {
+		size = random_utf8(s);
+		ref_size = reference(s, size, ref);
+		for (i = 0; i < sizeof(max_pieces) / sizeof(max_pieces[0]); i++) {
+			memset(&out, 0, sizeof(out));
+			out.fail_after = -1;
+			utf16le_writer_init(&w, sink, &out, 1);
+			write_in_pieces(&w, s, size, max_pieces[i]);
+			CHECK(utf16le_writer_flush(&w) == 0);
+			CHECK((out.size == ref_size) && (memcmp(out.data, ref, ref_size) == 0));
+		}
+	}
+
+	// A sequence that is still incomplete at the end is replaced
+	memset(&out, 0, sizeof(out));
+	out.fail_after = -1;
+	utf16le_writer_init(&w, sink, &out, 0);
+	utf16le_write(&w, "A\xF0\x9F", 3);
+	utf16le_write(&w, "\x98", 1);
+	CHECK(utf16le_writer_flush(&w) == 0);
+	CHECK((out.size == 4) && (memcmp(out.data, "A\0\xFD\xFF", 4) == 0));
+
+	// Errors from the sink are returned, and nothing is written after them
+	memset(&out, 0, sizeof(out));
+	out.fail_after = UTF16LE_BUFFER_SIZE;
+	utf16le_writer_init(&w, sink, &out, 1);
+	memset(s, 'x', sizeof(s));
+	for (n = 0; n < 4 * UTF16LE_BUFFER_SIZE / MAX_INPUT; n++)
+		utf16le_write(&w, (const char*)s, sizeof(s));
+	CHECK(utf16le_writer_flush(&w) != 0);
+	CHECK(out.size <= UTF16LE_BUFFER_SIZE);
+	return TEST_RESULT();
+}
@@ -0,0 +1,198 @@
+/*
+ * vendor_search_bench.c: trigram index against a scan of the vendor names
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Looks up vendor names in the built-in table, the way a search box does, with every
+ * prefix of what is typed, and with random parts of the names. Checks that the trigram
+ * index of usb_ids.h finds the same vendors, ranked the same way, as a strstr() scan
+ * of lowercase copies of all the names, then reports the time that both take.
+ */
+#include <string.h>
+#include "test.h"
+#include "usb_ids.h"
+
+#define NB_RANDOM_PATTERNS 20000
+#define MAX_PATTERN_LEN 12
+
+static const struct usb_ids_table* t = &usb_ids_builtin;
+static struct usb_ids_index vendor_index;
+static char** lowercase_name;
+
+static int compare_matches(const void* a, const void* b)
+{
+	uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+
+	return (x > y) - (x < y);
+}
+
+// The scan that the index replaces, with the same ranking as usb_ids_find_vendors()
+static size_t find_vendors_scan(const char* pattern, uint32_t* match)
+{
+	size_t i, name_len, len = strlen(pattern), n = 0;
+	int level;
+
+	for (i = 0; i < t->nb_vendors; i++) {
+		if (strstr(lowercase_name[i], pattern) == NULL) {
+			continue;
+		}
+		name_len = strlen(lowercase_name[i]);
+		level = usb_ids_match_level(lowercase_name[i], name_len, pattern, len);
+		name_len = (name_len < 255) ? name_len : 255;
+		match[n++] = ((uint32_t)level << 24) | ((uint32_t)name_len << 16) | t->vendor_id[i];
+	}
+	qsort(match, n, sizeof(uint32_t), compare_matches);
+	return n;
+}
+
+static size_t find_vendors_index(const char* pattern, uint32_t* match)
+{
+	size_t n = usb_ids_find_vendors(t, &vendor_index, pattern, match);
+
+	qsort(match, n, sizeof(uint32_t), compare_matches);
+	return n;
+}
+
+static void lowercase(char* s)
+{
+	for (; *s != 0; s++) {
+		*s = (char)USB_IDS_TOLOWER(*s);
+	}
+}
+
+// Time one pattern with both searches, and return the number of matches
+static size_t time_pattern(const char* pattern, uint32_t* match, double* t_scan, double* t_index, int nb_runs)
+{
+	size_t n = 0;
+	double t0;
+	int k;
+
+	t0 = test_now();
+	for (k = 0; k < nb_runs; k++) {
+		test_sink += find_vendors_scan(pattern, match);
+	}
+	*t_scan = (test_now() - t0) / nb_runs;
+	t0 = test_now();
+	for (k = 0; k < nb_runs; k++) {
+		n = find_vendors_index(pattern, match);
+		test_sink += n;
+	}
+	*t_index = (test_now() - t0) / nb_runs;
+	return n;
+}
+
+int main(void)
+{
+	// What gets typed in the search box, one keystroke at a time
+	static const char* typed[] = { "Olimex", "Digilent", "FTDI", "Future Technology",
+		"Microchip", "Semiconductor", "Corp", "Nonexistent Vendor" };
+	static char pattern[NB_RANDOM_PATTERNS][MAX_PATTERN_LEN + 1];
+	uint32_t *match_scan, *match_index;
+	size_t i, j, len, n_scan, n_index, nb_keystrokes = 0, nb_matches, nb_patterns;
+	double t0, t_build, t_scan, t_index, t_typed_scan = 0.0, t_typed_index = 0.0;
+	char buf[MAX_PATTERN_LEN + 8];
+	const char* name;
+
+	t_build = test_now();
+	if (usb_ids_build_index(t, &vendor_index) != 0) {
+		fprintf(stderr, "could not build the index\n");
+		return 1;
+	}
+	t_build = test_now() - t_build;
+	lowercase_name = calloc(t->nb_vendors, sizeof(char*));
+	match_scan = malloc((t->nb_vendors + 1) * sizeof(uint32_t));
+	match_index = malloc((t->nb_vendors + 1) * sizeof(uint32_t));
+	for (i = 0; i < t->nb_vendors; i++) {
+		lowercase_name[i] = strdup(t->names + t->vendor_name[i]);
+		lowercase(lowercase_name[i]);
+	}
+
+	// Parts of random names, of 1 to MAX_PATTERN_LEN characters, and some that match nothing
+	for (i = 0; i < NB_RANDOM_PATTERNS; i++) {
+		name = lowercase_name[test_rand() % t->nb_vendors];
+		len = 1 + test_rand() % MAX_PATTERN_LEN;
+		j = test_rand() % strlen(name);
+		snprintf(pattern[i], sizeof(pattern[i]), "%.*s", (int)len, &name[j]);
+		if ((i % 8 == 0) && (len > 1)) {
+			pattern[i][len / 2] = '~';
+		}
+	}
+	for (i = 0; i < NB_RANDOM_PATTERNS; i++) {
+		n_scan = find_vendors_scan(pattern[i], match_scan);
+		n_index = find_vendors_index(pattern[i], match_index);
+		CHECK(n_scan == n_index);
+		CHECK((n_scan != n_index) || (memcmp(match_scan, match_index, n_scan * sizeof(uint32_t)) == 0));
+	}
+
+	printf("%zu vendors, index of %zu trigrams and lowercase names: %zu KB, built in %.1f ms\n", t->nb_vendors,
+		vendor_index.nb_trigrams, (vendor_index.nb_trigrams * 2 * sizeof(uint32_t)
+		+ vendor_index.vendor_start[vendor_index.nb_trigrams] * sizeof(uint16_t)
+		+ vendor_index.name_start[t->nb_vendors] + (t->nb_vendors + 1) * sizeof(uint32_t)) / 1024,
+		t_build * 1e3);
+	printf("%-20s %8s %12s %12s\n", "pattern", "matches", "scan (us)", "index (us)");
+	for (i = 0; i < sizeof(typed) / sizeof(typed[0]); i++) {
+		for (len = 1; len <= strlen(typed[i]); len++) {
+			snprintf(buf, sizeof(buf), "%.*s", (int)len, typed[i]);
+			lowercase(buf);
+			n_index = time_pattern(buf, match_index, &t_scan, &t_index, 20);
+			CHECK(n_index == find_vendors_scan(buf, match_scan));
+			t_typed_scan += t_scan;
+			t_typed_index += t_index;
+			nb_keystrokes++;
+		}
+		printf("%-20s %8zu %12.2f %12.2f\n", buf, n_index, t_scan * 1e6, t_index * 1e6);
+	}
+	printf("every keystroke of the above (%zu): scan %.1f us, index %.1f us per keystroke\n",
+		nb_keystrokes, t_typed_scan * 1e6 / nb_keystrokes, t_typed_index * 1e6 / nb_keystrokes);
+
+	// Parts of the names, by length, as the patterns of less than 3 characters have no trigram
+	printf("%-20s %8s %12s %12s\n", "random patterns", "matches", "scan (us)", "index (us)");
+	for (len = 1; len <= MAX_PATTERN_LEN; len++) {
+		nb_patterns = 0;
+		nb_matches = 0;
+		t_scan = 0.0;
+		t_index = 0.0;
+		for (i = 0; i < NB_RANDOM_PATTERNS; i++) {
+			if (strlen(pattern[i]) != len) {
+				continue;
+			}
+			t0 = test_now();
+			test_sink += find_vendors_scan(pattern[i], match_scan);
+			t_scan += test_now() - t0;
+			t0 = test_now();
+			nb_matches += find_vendors_index(pattern[i], match_index);
+			t_index += test_now() - t0;
+			nb_patterns++;
+		}
+		if (nb_patterns == 0) {
+			continue;
+		}
+		snprintf(buf, sizeof(buf), "%zu characters", len);
+		printf("%-20s %8.1f %12.2f %12.2f\n", buf, (double)nb_matches / nb_patterns,
+			t_scan * 1e6 / nb_patterns, t_index * 1e6 / nb_patterns);
+	}
+
+	for (i = 0; i < t->nb_vendors; i++) {
+		free(lowercase_name[i]);
+	}
+	free(lowercase_name);
+	free(match_scan);
+	free(match_index);
+	usb_ids_free_index(&vendor_index);
+	return TEST_RESULT();
+}
@@ -0,0 +1,80 @@
+/*
+ * vid_data_bench.c: packed VID table against the linear scan
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Looks up random VIDs, about half of which are known, with the linear scan of
+ * the old table, and with the binary search of the packed one.
+ */
+#include <string.h>
+#include "test.h"
+#include "usb_ids.h"
+#include "vid_data_ref.h"
+
+#define NB_LOOKUPS 200000
+
+static int same_name(const char* a, const char* b)
+{
+	return ((a == NULL) || (b == NULL)) ? (a == b) : (strcmp(a, b) == 0);
+}
+
+int main(void)
+{
+	const struct usb_ids_table* t = &usb_ids_builtin;
+	static uint16_t vid[NB_LOOKUPS];
+	const char* name;
+	double t_linear, t_packed;
+	size_t i, pool_size, nb_pages, ref_strings = 0;
+	int nb_found = 0;
+
+	for (i = 0; i < NB_LOOKUPS; i++) {
+		vid[i] = (test_rand() & 1) ? t->vendor_id[test_rand() % t->nb_vendors] : (uint16_t)test_rand();
+		CHECK(same_name(usb_ids_vendor_name(t, vid[i]), ref_get_vendor_name(vid[i])));
+	}
+
+	t_linear = test_now();
+	for (i = 0; i < NB_LOOKUPS; i++) {
+		name = ref_get_vendor_name(vid[i]);
+		test_sink += (name != NULL) ? (uint64_t)name[0] : 0;
+	}
+	t_linear = test_now() - t_linear;
+	t_packed = test_now();
+	for (i = 0; i < NB_LOOKUPS; i++) {
+		name = usb_ids_vendor_name(t, vid[i]);
+		nb_found += (name != NULL);
+		test_sink += (name != NULL) ? (uint64_t)name[0] : 0;
+	}
+	t_packed = test_now() - t_packed;
+
+	// Size of the tables: the pool ends with the last page that holds a name
+	for (i = 0, pool_size = 0; i < t->nb_vendors; i++) {
+		if (t->vendor_name[i] + strlen(t->names + t->vendor_name[i]) + 1 > pool_size)
+			pool_size = t->vendor_name[i] + strlen(t->names + t->vendor_name[i]) + 1;
+	}
+	nb_pages = (pool_size + 16383) / 16384;
+	for (i = 0; i < sizeof(usb_vendor_ref) / sizeof(usb_vendor_ref[0]); i++)
+		ref_strings += strlen(usb_vendor_ref[i].name) + 1;
+	printf("%zu vendors, %d lookups (%d hits)\n", t->nb_vendors, NB_LOOKUPS, nb_found);
+	printf("old table: %zu bytes of entries, %zu bytes of names, and a relocation per entry\n",
+		sizeof(usb_vendor_ref), ref_strings);
+	printf("packed table: %zu bytes of IDs and offsets, %zu bytes of names (%zu pages)\n",
+		t->nb_vendors * (sizeof(uint16_t) + 2 * sizeof(uint32_t)) + sizeof(uint32_t), nb_pages * 16384, nb_pages);
+	printf("linear scan: %.0f ns per lookup\n", t_linear * 1e9 / NB_LOOKUPS);
+	printf("binary search: %.1f ns per lookup, %.0fx\n", t_packed * 1e9 / NB_LOOKUPS, t_linear / t_packed);
+	return TEST_RESULT();
+}
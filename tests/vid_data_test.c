@@ -0,0 +1,64 @@
+/*
+ * vid_data_test.c: the packed tables of vid_data.c
+ * Copyright (c) 2026 libwdi contributors
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Every VID must get the same name as with the table that vid_data.c had before it
+ * was packed, and the tables must have the layout that the lookups rely on.
+ */
+#include <string.h>
+#include "test.h"
+#include "usb_ids.h"
+#include "vid_data_ref.h"
+
+int main(void)
+{
+	const struct usb_ids_table* t = &usb_ids_builtin;
+	struct usb_ids_table empty;
+	const char *name, *ref;
+	size_t i, nb_names = 0;
+	int vid;
+
+	for (vid = 0; vid <= 0xffff; vid++) {
+		name = usb_ids_vendor_name(t, (uint16_t)vid);
+		ref = ref_get_vendor_name((unsigned short)vid);
+		CHECK((name == NULL) == (ref == NULL));
+		if ((name != NULL) && (ref != NULL)) {
+			CHECK(strcmp(name, ref) == 0);
+			nb_names++;
+		}
+	}
+	CHECK(nb_names == t->nb_vendors);
+
+	// IDs strictly sorted, and product slices that cover all the products in order
+	for (i = 1; i < t->nb_vendors; i++)
+		CHECK(t->vendor_id[i - 1] < t->vendor_id[i]);
+	CHECK(t->vendor_product[0] == 0);
+	for (i = 0; i < t->nb_vendors; i++)
+		CHECK(t->vendor_product[i] <= t->vendor_product[i + 1]);
+	CHECK(t->vendor_product[t->nb_vendors] == t->nb_products);
+	for (i = 1; i < t->nb_classes; i++)
+		CHECK(t->class_id[i - 1] < t->class_id[i]);
+
+	// Lookups on an empty table
+	memset(&empty, 0, sizeof(empty));
+	CHECK(usb_ids_vendor_name(&empty, 0x1234) == NULL);
+	CHECK(usb_ids_class_name(&empty, 3, -1, -1) == NULL);
+	printf("%zu vendors checked\n", nb_names);
+	return TEST_RESULT();
+}